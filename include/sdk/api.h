@@ -121,16 +121,46 @@ extern "C" {
     VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_allocate(uint64_t address, uint64_t size, const MemoryAttributeOption** protection, size_t attributeSize, uint64_t* targetAddress);
     VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_change_protection(uint64_t address, uint64_t size, MemoryAttributeOption option);
     VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_query_regions(MemoryRegion** regions, uint64_t* size);
+    // Mapping changes recorded after sinceGeneration, oldest first. A zero or expired sinceGeneration yields VERTEX_REGION_RESET
+    // followed by the full map. *generation receives the value to pass next time. The array is allocated with malloc.
+    VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_query_region_changes(uint64_t sinceGeneration, RegionChange** changes, uint32_t* count, uint64_t* generation);
     VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_construct_attribute_filters(MemoryAttributeOption** options, uint32_t* count);
     VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_get_process_pointer_size(uint64_t* size);
     VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_free(uint64_t address, uint64_t size);
     VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_get_min_process_address(uint64_t* address);
     VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_get_max_process_address(uint64_t* address);
 
+    // Dirty Page Tracking API
+    // Bit i of the bitmap (LSB first) is set when page (address rounded down to *pageSize) + i was written or discarded since the last
+    // reset. Report a page as written whenever that cannot be ruled out.
+    // Passing a null bitmap only reports the tracking granularity through pageSize.
+    // Both return STATUS_ERROR_NOT_IMPLEMENTED when the host system does not actually record page writes.
+    VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_reset_dirty_tracking();
+    VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_query_dirty_pages(uint64_t address, uint64_t size, uint8_t* bitmap, uint64_t bitmapSize, uint64_t* pageSize);
+
+    // Page Residency API
+    // Bit i of the bitmap (LSB first) is set when page (address rounded down to *pageSize) + i is backed by memory or swap.
+    // Pages left clear must read as zero: only never-touched pages of private anonymous mappings qualify, since
+    // file-backed and shared pages hold data whether or not the target faulted them in. Passing a null bitmap only reports the page size.
+    VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_query_resident_pages(uint64_t address, uint64_t size, uint8_t* bitmap, uint64_t bitmapSize, uint64_t* pageSize);
+
+    // Asynchronous Read API
+    // A queue belongs to one thread and holds at most depth reads in flight; submit fails rather than exceeding it.
+    // Every submitted read produces exactly one completion carrying its userData. Buffers must stay valid until then.
+    VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_read_queue_create(uint32_t depth, uint64_t* queue);
+    VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_read_queue_submit(uint64_t queue, const AsyncReadRequest* requests, uint32_t count);
+    VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_read_queue_complete(uint64_t queue, AsyncReadCompletion* completions, uint32_t capacity, uint8_t wait, uint32_t* completed);
+    VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_read_queue_destroy(uint64_t queue);
+
     // ===============================================================================================================//
     // PROCESS DISASSEMBLY API FUNCTIONS                                                                              //
     // ===============================================================================================================//
     VERTEX_EXPORT StatusCode VERTEX_API vertex_process_disassemble_range(uint64_t address, uint32_t size, DisassemblerResults* results);
+    // Compact variant of disassemble_range: fixed records plus one string table holding only the fields requested.
+    VERTEX_EXPORT StatusCode VERTEX_API vertex_process_disassemble_range_compact(uint64_t address, uint32_t size, CompactDisassembly* results);
+    // Decodes up to maxInstructions at each requested address into one shared results array, in request order.
+    // The memory behind all ranges is read in a single batch. Ranges that no longer fit report STATUS_ERROR_MEMORY_BUFFER_TOO_SMALL.
+    VERTEX_EXPORT StatusCode VERTEX_API vertex_process_disassemble_ranges(const DisassemblerRangeRequest* requests, DisassemblerRangeResult* rangeResults, uint32_t count, DisassemblerResults* results);
 
     // ===============================================================================================================//
     // DEBUGGER API FUNCTIONS                                                                                         //
@@ -175,6 +205,9 @@ extern "C" {
     VERTEX_EXPORT StatusCode VERTEX_API vertex_debugger_resume_thread(uint32_t threadId);
     VERTEX_EXPORT StatusCode VERTEX_API vertex_debugger_get_registers(uint32_t threadId, RegisterSet* registers);
     VERTEX_EXPORT StatusCode VERTEX_API vertex_debugger_get_call_stack(uint32_t threadId, CallStack* callStack);
+    // Registers and the innermost call-stack frames of every thread of the stopped target in one call.
+    VERTEX_EXPORT StatusCode VERTEX_API vertex_debugger_get_thread_snapshot(const ThreadSnapshotRequest* request, ThreadSnapshot* snapshot);
+    VERTEX_EXPORT StatusCode VERTEX_API vertex_debugger_free_thread_snapshot(ThreadSnapshot* snapshot);
     VERTEX_EXPORT StatusCode VERTEX_API vertex_debugger_get_exception_info(ExceptionInfo* exception);
     VERTEX_EXPORT StatusCode VERTEX_API vertex_debugger_get_instruction_pointer(uint32_t threadId, uint64_t* address);
     VERTEX_EXPORT StatusCode VERTEX_API vertex_debugger_set_instruction_pointer(uint32_t threadId, uint64_t address);
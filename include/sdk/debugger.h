@@ -36,6 +36,8 @@ extern "C" {
 #define VERTEX_MAX_CONDITION_LENGTH 256
 #define VERTEX_MAX_SYMBOLS 4096
 #define VERTEX_MAX_HW_BREAKPOINTS 4
+#define VERTEX_REGISTER_CATEGORY_BIT(category) (1u << (uint32_t)(category))
+#define VERTEX_REGISTER_CATEGORY_ALL 0xFFFFFFFFu
 #define VERTEX_INFINITE_WAIT 0xFFFFFFFF
 
     // ===============================================================================================================//
@@ -252,6 +254,36 @@ extern "C" {
         uint32_t currentThreadId;
     } ThreadList;
 
+    typedef struct VertexThreadSnapshotRequest
+    {
+        uint32_t registerCategoryMask; // 0 skips registers
+        uint32_t maxFrames;            // innermost frames per thread, at most VERTEX_MAX_STACK_FRAMES; 0 skips call stacks
+    } ThreadSnapshotRequest;
+
+    typedef struct VertexThreadSnapshotEntry
+    {
+        ThreadInfo thread;
+        uint64_t basePointer;
+        uint64_t flagsRegister;
+        uint32_t firstRegister; // index into ThreadSnapshot::registers
+        uint32_t registerCount;
+        uint32_t firstFrame;    // index into ThreadSnapshot::frames
+        uint32_t frameCount;
+        StatusCode status;      // failure reading this thread; the other entries stay valid
+    } ThreadSnapshotEntry;
+
+    // threads, registers and frames point into one allocation released by vertex_debugger_free_thread_snapshot.
+    typedef struct VertexThreadSnapshot
+    {
+        ThreadSnapshotEntry* threads;
+        Register* registers;
+        StackFrame* frames;
+        uint32_t threadCount;
+        uint32_t registerCount;
+        uint32_t frameCount;
+        uint32_t currentThreadId;
+    } ThreadSnapshot;
+
     typedef struct VertexBreakpointInfo
     {
         uint32_t id;
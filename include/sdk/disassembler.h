@@ -7,6 +7,8 @@
 
 #include <stdint.h>
 
+#include "statuscode.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -26,6 +28,9 @@ extern "C" {
 #define VERTEX_MAX_SYMBOL_LENGTH        64
 #define VERTEX_MAX_SECTION_LENGTH       32
 
+#define VERTEX_COMPACT_DISASSEMBLY_VERSION  1
+#define VERTEX_COMPACT_NO_STRING            0xFFFFFFFFu
+
 // ===============================================================================================================//
 // DISASSEMBLER MACROS                                                                                            //
 // ===============================================================================================================//
@@ -111,6 +116,23 @@ typedef enum VertexInstructionFlags : uint32_t
     VERTEX_FLAG_HOT_PATH       = 0x00008000
 } InstructionFlags;
 
+typedef enum VertexDataAccess : uint8_t
+{
+    VERTEX_DATA_ACCESS_NONE         = 0x00,  // No RIP-relative or absolute memory operand
+    VERTEX_DATA_ACCESS_READ         = 0x01,  // mov eax, [rip+x]
+    VERTEX_DATA_ACCESS_WRITE        = 0x02,  // mov [rip+x], eax
+    VERTEX_DATA_ACCESS_ADDRESS_OF   = 0x04   // lea rax, [rip+x]
+} DataAccess;
+
+typedef enum VertexCompactField : uint32_t
+{
+    VERTEX_COMPACT_FIELD_NONE           = 0x00000000,  // Numeric fields and raw bytes only
+    VERTEX_COMPACT_FIELD_TEXT           = 0x00000001,  // mnemonic and operands
+    VERTEX_COMPACT_FIELD_COMMENT        = 0x00000002,
+    VERTEX_COMPACT_FIELD_TARGET_SYMBOL  = 0x00000004,
+    VERTEX_COMPACT_FIELD_SECTION        = 0x00000008
+} CompactField;
+
 // ===============================================================================================================//
 // DISASSEMBLER STRUCTURES                                                                                        //
 // ===============================================================================================================//
@@ -144,7 +166,12 @@ typedef struct VertexDisassemblerResult
     uint64_t functionStart;
     uint32_t instructionIndex;
 
-    uint32_t reserved[4];
+    uint8_t dataAccess;     // DataAccess bits for dataAddress
+    uint8_t dataSize;       // Operand size in bytes, 0 when unknown
+    uint16_t reserved0;
+    uint64_t dataAddress;   // Resolved RIP-relative or absolute memory operand, 0 if none
+
+    uint32_t reserved[2];
 
 } DisassemblerResult;
 
@@ -158,6 +185,63 @@ typedef struct VertexDisassemblerResults
     uint32_t totalSize;
 } DisassemblerResults;
 
+// Fixed-size instruction record of the compact result format. Text lives in the per-call string table of
+// CompactDisassembly; each string field is a byte offset of a NUL-terminated entry there, or
+// VERTEX_COMPACT_NO_STRING when the field is empty or was not requested.
+typedef struct VertexCompactInstruction
+{
+    uint64_t address;
+    uint64_t targetAddress;
+    uint64_t dataAddress;
+    uint64_t functionStart;
+    uint32_t flags;             // InstructionFlags bits
+
+    uint32_t mnemonic;
+    uint32_t operands;
+    uint32_t comment;
+    uint32_t targetSymbol;
+    uint32_t sectionName;
+
+    uint8_t size;
+    uint8_t category;           // InstructionCategory
+    uint8_t branchType;         // BranchType
+    uint8_t branchDirection;    // BranchDirection
+    uint8_t dataAccess;         // DataAccess bits for dataAddress
+    uint8_t dataSize;
+    uint8_t rawBytes[VERTEX_MAX_BYTES_LENGTH];
+    uint16_t reserved0;
+} CompactInstruction;
+
+// The caller sets version, fields and both buffers. Decoding stops when either buffer is full, so every
+// returned record has all requested strings. Later versions only append fields to this struct.
+typedef struct VertexCompactDisassembly
+{
+    uint32_t version;           // VERTEX_COMPACT_DISASSEMBLY_VERSION the caller was built against
+    uint32_t fields;            // CompactField bits selecting the strings to fill
+    CompactInstruction* instructions;
+    uint32_t capacity;
+    uint32_t count;
+    char* strings;
+    uint32_t stringCapacity;
+    uint32_t stringSize;
+    uint64_t startAddress;
+    uint64_t endAddress;
+} CompactDisassembly;
+
+typedef struct VertexDisassemblerRangeRequest
+{
+    uint64_t address;
+    uint32_t maxInstructions;
+    uint32_t reserved;
+} DisassemblerRangeRequest;
+
+typedef struct VertexDisassemblerRangeResult
+{
+    uint32_t firstResult;   // Index of the first instruction of this range in the shared DisassemblerResults array
+    uint32_t count;
+    StatusCode status;
+} DisassemblerRangeResult;
+
 typedef struct VertexXReference
 {
     uint64_t fromAddress;
@@ -23,6 +23,12 @@ extern "C" {
 #define VERTEX_NUMERIC_SYSTEMS_SUPPORTED 1
 #define VERTEX_NUMERIC_SYSTEMS_NOT_SUPPORTED 0
 
+#define VERTEX_REGION_READ (1u << 0)
+#define VERTEX_REGION_WRITE (1u << 1)
+#define VERTEX_REGION_EXECUTE (1u << 2)
+#define VERTEX_REGION_PRIVATE (1u << 3)
+#define VERTEX_REGION_FILE_BACKED (1u << 4)
+
 // ===============================================================================================================//
 // MEMORY ENUMS                                                                                                   //
 // ===============================================================================================================//
@@ -36,6 +42,14 @@ typedef enum VertexNumericSystem : int32_t
     VERTEX_HEXADECIMAL = 16,
 } NumericSystem;
 
+typedef enum VertexRegionChangeKind : int32_t
+{
+    VERTEX_REGION_RESET = 0, // Drop every known region; the complete map follows as additions.
+    VERTEX_REGION_ADDED,
+    VERTEX_REGION_REMOVED,
+    VERTEX_REGION_PROTECTION_CHANGED,
+} RegionChangeKind;
+
 // ===============================================================================================================//
 // MEMORY STRUCTURES                                                                                              //
 // ===============================================================================================================//
@@ -47,6 +61,14 @@ typedef struct VertexMemoryRegion
     uint64_t regionSize;
 } MemoryRegion;
 
+typedef struct VertexRegionChange
+{
+    uint64_t baseAddress;
+    uint64_t regionSize;
+    RegionChangeKind kind;
+    uint32_t protection; // VERTEX_REGION_* flags of the mapping after the change
+} RegionChange;
+
 typedef struct VertexBulkReadRequest
 {
     uint64_t address;
@@ -71,6 +93,20 @@ typedef struct VertexBulkWriteResult
     StatusCode status;
 } BulkWriteResult;
 
+typedef struct VertexAsyncReadRequest
+{
+    uint64_t address;
+    uint64_t size;
+    void* buffer;
+    uint64_t userData;
+} AsyncReadRequest;
+
+typedef struct VertexAsyncReadCompletion
+{
+    uint64_t userData;
+    StatusCode status;
+} AsyncReadCompletion;
+
 typedef enum VertexMemoryAttributeType : int32_t
 {
     VERTEX_PROTECTION = 0,
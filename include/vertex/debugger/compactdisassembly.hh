@@ -0,0 +1,56 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#pragma once
+
+#include <sdk/disassembler.h>
+#include <sdk/statuscode.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string_view>
+
+namespace Vertex::Runtime
+{
+    class Plugin;
+}
+
+namespace Vertex::Debugger
+{
+    // Decodes [address, address + size) into caller-owned compact records. Used by every module sweep, so
+    // implementations must be safe to call from several threads at once.
+    using XrefDisassembler = std::function<StatusCode(std::uint64_t address, std::uint32_t size, ::CompactDisassembly* results)>;
+    using LegacyDisassembler = std::function<StatusCode(std::uint64_t address, std::uint32_t size, ::DisassemblerResults* results)>;
+
+    // Record and string storage reused across the calls of one sweep. Records are never zero-filled; the
+    // runtime writes every field of the ones it returns.
+    class CompactDisassemblyBuffer final
+    {
+    public:
+        explicit CompactDisassemblyBuffer(std::size_t capacity, std::uint32_t fields = VERTEX_COMPACT_FIELD_NONE, std::size_t stringCapacity = 0);
+
+        [[nodiscard]] ::CompactDisassembly* prepare() noexcept;
+
+        [[nodiscard]] std::span<const ::CompactInstruction> instructions() const noexcept;
+        [[nodiscard]] std::string_view string_at(std::uint32_t offset) const noexcept;
+
+    private:
+        std::unique_ptr<::CompactInstruction[]> m_instructions {};
+        std::unique_ptr<char[]> m_strings {};
+        ::CompactDisassembly m_descriptor {};
+    };
+
+    [[nodiscard]] std::string_view compact_string(const ::CompactDisassembly& results, std::uint32_t offset) noexcept;
+
+    // Serves the compact format from a runtime that only exports the legacy call, decoding into per-thread
+    // scratch and copying out the requested fields.
+    [[nodiscard]] StatusCode disassemble_compact_from_legacy(const LegacyDisassembler& legacy, std::uint64_t address,
+                                                             std::uint32_t size, ::CompactDisassembly* results);
+
+    // Binds the active plugin's compact entry point, falling back to the legacy one when it is not exported.
+    [[nodiscard]] XrefDisassembler plugin_disassembler(Runtime::Plugin& plugin);
+}
@@ -0,0 +1,121 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#pragma once
+
+#include <vertex/debugger/functiontable.hh>
+#include <vertex/debugger/xrefindex.hh>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Vertex::Debugger
+{
+    enum class BlockExit : std::uint8_t
+    {
+        FallThrough,
+        Jump,
+        Conditional,
+        Return,
+        IndirectJump,
+        TailCall,
+        Halt
+    };
+
+    enum class FlowEdgeKind : std::uint8_t
+    {
+        FallThrough,
+        Jump,
+        Taken,
+        NotTaken
+    };
+
+    struct BasicBlock final
+    {
+        std::uint64_t start {};
+        std::uint64_t end {};
+        std::uint32_t instructionCount {};
+        std::uint32_t immediateDominator {};
+        BlockExit exit {BlockExit::FallThrough};
+    };
+
+    struct FlowEdge final
+    {
+        std::uint32_t from {};
+        std::uint32_t to {};
+        FlowEdgeKind kind {FlowEdgeKind::FallThrough};
+        bool backEdge {};
+    };
+
+    // What the graph builder needs from one decoded instruction.
+    struct FlowInstruction final
+    {
+        std::uint64_t address {};
+        std::uint64_t targetAddress {};
+        std::uint32_t size {};
+        ::BranchType branchType {VERTEX_BRANCH_NONE};
+    };
+
+    // Basic blocks, edges and the dominator tree of one function. Blocks are the instructions reachable from
+    // the function start, split at branch targets and after control transfers, and are sorted by address with
+    // the entry block first. Edges are stored grouped by source and by target, so successor and predecessor
+    // lists are spans; dominance is answered in constant time from dominator-tree DFS numbering.
+    class ControlFlowGraph final
+    {
+    public:
+        static constexpr std::uint32_t NO_BLOCK = UINT32_MAX;
+
+        [[nodiscard]] static std::shared_ptr<const ControlFlowGraph> build(const FunctionRange& function,
+                                                                           std::span<const FlowInstruction> instructions);
+        [[nodiscard]] static std::shared_ptr<const ControlFlowGraph> build(const FunctionRange& function,
+                                                                           const XrefDisassembler& disassemble);
+
+        [[nodiscard]] const FunctionRange& function() const noexcept { return m_function; }
+        [[nodiscard]] std::span<const BasicBlock> blocks() const noexcept { return m_blocks; }
+        [[nodiscard]] std::span<const FlowEdge> edges() const noexcept { return m_edges; }
+        [[nodiscard]] std::size_t instruction_count() const noexcept { return m_instructionCount; }
+        [[nodiscard]] bool truncated() const noexcept { return m_truncated; }
+
+        [[nodiscard]] std::optional<std::uint32_t> block_at(std::uint64_t address) const;
+        [[nodiscard]] std::span<const FlowEdge> successors(std::uint32_t block) const;
+        [[nodiscard]] std::span<const FlowEdge> predecessors(std::uint32_t block) const;
+        [[nodiscard]] bool dominates(std::uint32_t dominator, std::uint32_t block) const;
+        [[nodiscard]] std::vector<std::uint32_t> blocks_reaching(std::uint32_t block) const;
+
+    private:
+        [[nodiscard]] static std::shared_ptr<ControlFlowGraph> assemble(const FunctionRange& function,
+                                                                        std::span<const FlowInstruction> instructions);
+
+        FunctionRange m_function {};
+        std::vector<BasicBlock> m_blocks {};
+        std::vector<FlowEdge> m_edges {};
+        std::vector<std::uint32_t> m_successorOffsets {};
+        std::vector<FlowEdge> m_predecessors {};
+        std::vector<std::uint32_t> m_predecessorOffsets {};
+        std::vector<std::uint32_t> m_dominatorPreorder {};
+        std::vector<std::uint32_t> m_dominatorPostorder {};
+        std::size_t m_instructionCount {};
+        bool m_truncated {};
+    };
+
+    // Graphs already built for the functions of one module, keyed by function start. Safe to share between
+    // threads; two threads asking for the same function may both build it, and the first result is kept.
+    class ModuleControlFlowCache final
+    {
+    public:
+        [[nodiscard]] std::shared_ptr<const ControlFlowGraph> find(std::uint64_t functionStart) const;
+        [[nodiscard]] std::shared_ptr<const ControlFlowGraph> acquire(const FunctionRange& function, const XrefDisassembler& disassemble);
+        [[nodiscard]] std::size_t size() const;
+
+    private:
+        mutable std::mutex m_mutex {};
+        std::unordered_map<std::uint64_t, std::shared_ptr<const ControlFlowGraph>> m_graphs {};
+    };
+}
@@ -62,6 +62,9 @@ namespace Vertex::Debugger
         [[nodiscard]] std::optional<DisassemblyLine>
         disassemble_one(std::uint64_t pc, std::chrono::milliseconds timeout) override;
 
+        [[nodiscard]] std::vector<std::optional<DisassemblyLine>>
+        disassemble_many(std::span<const std::uint64_t> pcs, std::chrono::milliseconds timeout) override;
+
         void shutdown() override;
 
         void on_engine_event(EngineEvent event) override;
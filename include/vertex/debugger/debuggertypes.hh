@@ -47,7 +47,16 @@ namespace Vertex::Debugger
         Call = 0,
         UnconditionalJump,
         ConditionalJump,
-        Loop
+        Loop,
+        Data
+    };
+
+    enum class XrefAccess : std::uint8_t
+    {
+        None = 0,
+        Read = 1 << 0,
+        Write = 1 << 1,
+        AddressOf = 1 << 2
     };
 
     enum class XrefDirection : std::uint8_t
@@ -63,6 +72,8 @@ namespace Vertex::Debugger
         XrefType type {XrefType::Call};
         std::string symbolName {};
         std::string moduleName {};
+        XrefAccess access {XrefAccess::None};
+        std::uint8_t operandSize {};
     };
 
     struct DisassemblyLine final
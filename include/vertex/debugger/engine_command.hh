@@ -74,6 +74,12 @@ namespace Vertex::Debugger::service
         std::uint32_t instructionCount {1};
     };
 
+    struct CmdDisassembleBatch final
+    {
+        std::vector<std::uint64_t> addresses {};
+        std::uint32_t instructionCount {1};
+    };
+
     struct CmdReadMemory final
     {
         std::uint64_t address {};
@@ -99,6 +105,7 @@ namespace Vertex::Debugger::service
         CmdReadRegisters,
         CmdReadCallStack,
         CmdDisassemble,
+        CmdDisassembleBatch,
         CmdReadMemory,
         CmdWriteMemory>;
 
@@ -130,6 +137,13 @@ namespace Vertex::Debugger::service
         std::uint64_t engineGeneration {};
     };
 
+    // ranges[i] holds the instructions decoded at addresses[i] of the request; empty where decoding failed.
+    struct DisassemblyBatchPayload final
+    {
+        std::vector<std::vector<DisassemblyLine>> ranges {};
+        std::uint64_t engineGeneration {};
+    };
+
     struct MemoryReadPayload final
     {
         std::vector<std::uint8_t> bytes {};
@@ -143,6 +157,7 @@ namespace Vertex::Debugger::service
         RegisterSnapshotPayload,
         CallStackSnapshotPayload,
         DisassemblyPayload,
+        DisassemblyBatchPayload,
         MemoryReadPayload>;
 
     struct CommandResult final
@@ -0,0 +1,87 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#pragma once
+
+#include <sdk/statuscode.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Vertex::Debugger
+{
+    // Ordered from most to least trusted. Unwind ranges and the extent of a sized symbol are never split by a
+    // guessed start; call targets and prologues divide the rest of the code.
+    enum class FunctionSource : std::uint8_t
+    {
+        Unwind,
+        Symbol,
+        CallTarget,
+        Prologue
+    };
+
+    struct FunctionRange final
+    {
+        std::uint64_t start {};
+        std::uint64_t end {};
+        FunctionSource source {FunctionSource::Unwind};
+    };
+
+    using ImageReader = std::function<StatusCode(std::uint64_t address, std::uint64_t size, std::uint8_t* buffer)>;
+
+    struct CodeRange final
+    {
+        std::uint64_t begin {};
+        std::uint64_t end {};
+    };
+
+    // Executable segments (ELF) or code sections (PE) of a mapped image, read from its headers only. Empty when the
+    // image format is not recognised.
+    [[nodiscard]] std::vector<CodeRange> image_code_ranges(std::uint64_t moduleBase, std::uint64_t moduleSize, const ImageReader& read);
+
+    struct KnownFunction final
+    {
+        std::uint64_t start {};
+        std::uint64_t size {};
+    };
+
+    // Starts without a recorded size only begin a range; a known function's extent also keeps guessed starts out.
+    struct FunctionDiscoveryHints final
+    {
+        std::vector<std::uint64_t> knownStarts {};
+        std::vector<KnownFunction> knownFunctions {};
+        std::vector<std::uint64_t> callTargets {};
+    };
+
+    // Function boundaries of one loaded module. Exact ranges come from the unwind tables of the mapped image
+    // (.eh_frame_hdr for ELF, .pdata for PE); symbols, call targets and prologue patterns fill the gaps those
+    // tables leave, such as leaf functions and stripped binaries. Ranges are sorted and never overlap.
+    class ModuleFunctionTable final
+    {
+    public:
+        [[nodiscard]] static std::shared_ptr<const ModuleFunctionTable> build(std::uint64_t moduleBase, std::uint64_t moduleSize,
+                                                                              const ImageReader& read,
+                                                                              const FunctionDiscoveryHints& hints);
+
+        [[nodiscard]] std::optional<FunctionRange> find(std::uint64_t address) const;
+        [[nodiscard]] std::optional<std::uint64_t> start_at_or_before(std::uint64_t address) const;
+        [[nodiscard]] std::optional<std::uint64_t> start_after(std::uint64_t address) const;
+        [[nodiscard]] std::span<const FunctionRange> ranges() const noexcept { return m_ranges; }
+        [[nodiscard]] std::size_t count_from(FunctionSource source) const noexcept;
+
+        [[nodiscard]] std::uint64_t base_address() const noexcept { return m_baseAddress; }
+        [[nodiscard]] std::uint64_t size() const noexcept { return m_size; }
+        [[nodiscard]] bool overlaps(std::uint64_t address, std::uint64_t size) const noexcept;
+
+    private:
+        std::uint64_t m_baseAddress {};
+        std::uint64_t m_size {};
+        std::vector<FunctionRange> m_ranges {};
+    };
+}
@@ -13,6 +13,7 @@
 #include <cstdint>
 #include <functional>
 #include <optional>
+#include <span>
 #include <vector>
 
 namespace Vertex::Debugger
@@ -63,6 +64,21 @@ namespace Vertex::Debugger
         disassemble_one(std::uint64_t pc,
                         std::chrono::milliseconds timeout = DEFAULT_SNAPSHOT_TIMEOUT) = 0;
 
+        // One entry per pc, in order. Implementations that can reach the engine decode all of them in a
+        // single command; the default falls back to one round trip per pc.
+        [[nodiscard]] virtual std::vector<std::optional<DisassemblyLine>>
+        disassemble_many(std::span<const std::uint64_t> pcs,
+                         std::chrono::milliseconds timeout = DEFAULT_SNAPSHOT_TIMEOUT)
+        {
+            std::vector<std::optional<DisassemblyLine>> lines {};
+            lines.reserve(pcs.size());
+            for (const auto pc : pcs)
+            {
+                lines.push_back(disassemble_one(pc, timeout));
+            }
+            return lines;
+        }
+
         virtual void shutdown() = 0;
 
         virtual void on_engine_event(EngineEvent event) = 0;
@@ -0,0 +1,71 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#pragma once
+
+#include <vertex/debugger/functiontable.hh>
+#include <vertex/debugger/xrefindex.hh>
+
+#include <sdk/disassembler.h>
+#include <sdk/statuscode.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Vertex::Debugger
+{
+    // Byte pattern anchored at the instruction it was generated for. mask[i] is 0 where bytes[i] is a
+    // wildcard; the pattern never ends in a wildcard.
+    struct CodeSignature final
+    {
+        std::uint64_t address {};
+        std::vector<std::uint8_t> bytes {};
+        std::vector<std::uint8_t> mask {};
+        std::size_t matchCount {};
+
+        [[nodiscard]] bool unique() const noexcept { return matchCount == 1; }
+        [[nodiscard]] std::string to_pattern() const;
+    };
+
+    struct SignatureOptions final
+    {
+        std::size_t workerCount {1};
+        std::size_t maxBytes {128};
+    };
+
+    // Marks the bytes of one decoded instruction that change when the module is rebuilt or relocated:
+    // rel32 branch displacements, RIP-relative and absolute memory operands, and immediates pointing into
+    // the module. Relative operands that cannot be located in the encoding mask the whole instruction.
+    [[nodiscard]] std::vector<std::uint8_t> relocation_mask(const ::CompactInstruction& instr, std::span<const std::uint8_t> bytes,
+                                                            std::uint64_t moduleBase, std::uint64_t moduleSize);
+
+    // Counts positions in image where the masked pattern matches, stopping once limit is reached. The image
+    // is split across workers with enough overlap that matches straddling a split are seen exactly once.
+    [[nodiscard]] std::size_t count_pattern_matches(std::span<const std::uint8_t> image, std::span<const std::uint8_t> bytes,
+                                                    std::span<const std::uint8_t> mask, std::size_t limit, std::size_t workerCount);
+
+    // Holds a snapshot of one module image and produces the shortest pattern, starting at a given
+    // instruction, that matches nowhere else in that image.
+    class CodeSignatureGenerator final
+    {
+    public:
+        CodeSignatureGenerator(std::uint64_t moduleBase, std::uint64_t moduleSize, const ImageReader& read, SignatureOptions options);
+
+        [[nodiscard]] std::expected<CodeSignature, StatusCode> generate(std::uint64_t address, const XrefDisassembler& disassemble) const;
+
+        [[nodiscard]] std::uint64_t base_address() const noexcept { return m_baseAddress; }
+        [[nodiscard]] std::span<const std::uint8_t> image() const noexcept { return m_image; }
+
+    private:
+        [[nodiscard]] std::vector<std::size_t> find_matches(std::span<const std::uint8_t> bytes, std::span<const std::uint8_t> mask) const;
+
+        std::uint64_t m_baseAddress {};
+        std::vector<std::uint8_t> m_image {};
+        SignatureOptions m_options {};
+    };
+}
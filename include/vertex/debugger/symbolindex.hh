@@ -0,0 +1,126 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Vertex::Debugger
+{
+    enum class SymbolSearchMode
+    {
+        Prefix,
+        Substring
+    };
+
+    struct SymbolMatch final
+    {
+        std::uint64_t address {};
+        std::uint64_t offset {};
+        std::uint64_t size {};
+        std::string_view name {};
+        std::string_view moduleName {};
+    };
+
+    struct SymbolSpan final
+    {
+        std::uint64_t address {};
+        std::uint64_t size {};
+    };
+
+    class SymbolIndex;
+
+    class SymbolIndexBuilder final
+    {
+    public:
+        void add_module(std::string_view name, std::uint64_t baseAddress, std::uint64_t size);
+        void add_symbol(std::uint64_t address, std::uint64_t size, std::string_view name);
+
+        [[nodiscard]] std::shared_ptr<const SymbolIndex> build();
+
+    private:
+        struct PendingSymbol final
+        {
+            std::uint64_t address {};
+            std::uint64_t size {};
+            std::uint32_t nameOffset {};
+            std::uint32_t nameLength {};
+        };
+
+        struct PendingModule final
+        {
+            std::uint64_t baseAddress {};
+            std::uint64_t size {};
+            std::uint32_t nameOffset {};
+            std::uint32_t nameLength {};
+        };
+
+        std::string m_arena {};
+        std::vector<PendingSymbol> m_symbols {};
+        std::vector<PendingModule> m_modules {};
+    };
+
+    // Immutable, address-sorted symbol table for every loaded module. Names live in one string arena, so the
+    // index is a handful of flat arrays; lookups are binary searches and name search narrows candidates with a
+    // case-insensitive trigram index before verifying them. Instances are only handed out as shared_ptr<const>
+    // and are safe to read from any thread.
+    class SymbolIndex final
+    {
+    public:
+        [[nodiscard]] std::optional<std::string_view> name_at(std::uint64_t address) const;
+        [[nodiscard]] std::optional<SymbolMatch> resolve(std::uint64_t address) const;
+        [[nodiscard]] std::optional<std::uint64_t> symbol_at_or_before(std::uint64_t address) const;
+        [[nodiscard]] std::optional<std::uint64_t> symbol_after(std::uint64_t address) const;
+        [[nodiscard]] std::string format(std::uint64_t address) const;
+        [[nodiscard]] std::vector<SymbolSpan> spans_in(std::uint64_t begin, std::uint64_t end) const;
+
+        [[nodiscard]] std::vector<SymbolMatch> search(std::string_view query, SymbolSearchMode mode, std::size_t maxResults) const;
+
+        [[nodiscard]] std::size_t size() const noexcept { return m_entries.size(); }
+        [[nodiscard]] bool empty() const noexcept { return m_entries.empty(); }
+
+    private:
+        friend class SymbolIndexBuilder;
+
+        struct Entry final
+        {
+            std::uint64_t address {};
+            std::uint64_t size {};
+            std::uint32_t nameOffset {};
+            std::uint32_t nameLength {};
+            std::uint32_t module {};
+        };
+
+        struct Module final
+        {
+            std::uint64_t baseAddress {};
+            std::uint64_t size {};
+            std::uint32_t nameOffset {};
+            std::uint32_t nameLength {};
+        };
+
+        static constexpr std::uint32_t NO_MODULE = UINT32_MAX;
+
+        [[nodiscard]] std::string_view name_of(const Entry& entry) const noexcept;
+        [[nodiscard]] std::string_view module_name_of(const Entry& entry) const noexcept;
+        [[nodiscard]] std::uint64_t extent_end(std::size_t entryIndex) const noexcept;
+        [[nodiscard]] SymbolMatch make_match(const Entry& entry, std::uint64_t address) const;
+
+        std::string m_arena {};
+        std::vector<Entry> m_entries {};
+        std::vector<Module> m_modules {};
+
+        // Posting lists for every lowercase trigram: m_trigramKeys[i] owns
+        // m_trigramPostings[m_trigramOffsets[i] .. m_trigramOffsets[i + 1]), entry indices in ascending order.
+        std::vector<std::uint32_t> m_trigramKeys {};
+        std::vector<std::uint32_t> m_trigramOffsets {};
+        std::vector<std::uint32_t> m_trigramPostings {};
+    };
+}
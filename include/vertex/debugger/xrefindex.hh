@@ -0,0 +1,74 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#pragma once
+
+#include <vertex/debugger/compactdisassembly.hh>
+#include <vertex/debugger/debuggertypes.hh>
+
+#include <sdk/disassembler.h>
+#include <sdk/statuscode.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Vertex::Debugger
+{
+    struct XrefRecord final
+    {
+        std::uint64_t source {};
+        std::uint64_t target {};
+        XrefType type {XrefType::Call};
+        XrefAccess access {XrefAccess::None};
+        std::uint8_t operandSize {};
+    };
+
+    struct XrefIndexBuildOptions final
+    {
+        std::size_t workerCount {1};
+        std::size_t sliceBytes {256 * 1024};
+        std::size_t chunkBytes {4096};
+        std::size_t chunkInstructions {500};
+    };
+
+    // Code and data references originating in one module, collected by a linear sweep that is split into
+    // slices across workers. References are kept sorted by target and by source, so both query directions
+    // are binary searches. The disassembler callback must be safe to call from several threads at once.
+    class ModuleXrefIndex final
+    {
+    public:
+        [[nodiscard]] static std::shared_ptr<const ModuleXrefIndex> build(std::uint64_t moduleBase, std::uint64_t moduleSize,
+                                                                          const XrefDisassembler& disassemble,
+                                                                          const XrefIndexBuildOptions& options);
+
+        [[nodiscard]] std::span<const XrefRecord> references_to(std::uint64_t target) const;
+        [[nodiscard]] std::span<const XrefRecord> references_from(std::uint64_t begin, std::uint64_t end) const;
+
+        [[nodiscard]] std::optional<std::uint64_t> function_start_at_or_before(std::uint64_t address) const;
+        [[nodiscard]] std::optional<std::uint64_t> function_start_after(std::uint64_t address) const;
+        [[nodiscard]] std::string_view target_symbol(std::uint64_t target) const;
+        [[nodiscard]] std::span<const std::uint64_t> function_starts() const noexcept { return m_functionStarts; }
+
+        [[nodiscard]] std::uint64_t base_address() const noexcept { return m_baseAddress; }
+        [[nodiscard]] std::uint64_t size() const noexcept { return m_size; }
+        [[nodiscard]] std::size_t reference_count() const noexcept { return m_bySource.size(); }
+        [[nodiscard]] bool overlaps(std::uint64_t address, std::uint64_t size) const noexcept;
+
+    private:
+        std::uint64_t m_baseAddress {};
+        std::uint64_t m_size {};
+        std::vector<XrefRecord> m_byTarget {};
+        std::vector<XrefRecord> m_bySource {};
+        std::vector<std::uint64_t> m_functionStarts {};
+        std::vector<std::pair<std::uint64_t, std::string>> m_targetSymbols {};
+    };
+}
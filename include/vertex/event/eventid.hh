@@ -31,4 +31,6 @@ namespace Vertex::Event
     static constexpr EventId SCRIPT_DIAGNOSTIC_EVENT = 20;
 
     static constexpr EventId DEBUGGER_NAVIGATE_EVENT = 21;
+
+    static constexpr EventId MEMORY_REGIONS_CHANGED_EVENT = 22;
 }
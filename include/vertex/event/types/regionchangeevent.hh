@@ -0,0 +1,44 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#pragma once
+
+#include <vertex/event/vertexevent.hh>
+#include <vertex/event/eventid.hh>
+
+#include <sdk/api.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Vertex::Event
+{
+    class RegionChangeEvent final : public VertexEvent
+    {
+    public:
+        RegionChangeEvent(std::vector<::RegionChange> changes, const std::uint64_t generation)
+            : VertexEvent(MEMORY_REGIONS_CHANGED_EVENT), m_changes(std::move(changes)), m_generation(generation)
+        {}
+
+        [[nodiscard]] const std::vector<::RegionChange>& get_changes() const noexcept
+        {
+            return m_changes;
+        }
+
+        [[nodiscard]] std::uint64_t get_generation() const noexcept
+        {
+            return m_generation;
+        }
+
+        [[nodiscard]] bool is_reset() const noexcept
+        {
+            return !m_changes.empty() && m_changes.front().kind == VERTEX_REGION_RESET;
+        }
+
+    private:
+        std::vector<::RegionChange> m_changes {};
+        std::uint64_t m_generation {};
+    };
+}
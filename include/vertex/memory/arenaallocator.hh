@@ -13,6 +13,7 @@
 #include <memory>
 #include <mimalloc.h>
 #include <new>
+#include <type_traits>
 
 namespace Vertex::Memory
 {
@@ -224,6 +225,35 @@ namespace Vertex::Memory
             return array;
         }
 
+        template<class T>
+        [[nodiscard]] T* allocate_array_nothrow(const std::size_t count) noexcept
+        {
+            static_assert(std::is_nothrow_default_constructible_v<T>);
+
+            if (count == 0)
+            {
+                return nullptr;
+            }
+
+            void* ptr = allocate_nothrow(sizeof(T) * count, alignof(T));
+            if (!ptr)
+            {
+                return nullptr;
+            }
+
+            T* array = static_cast<T*>(ptr);
+
+            if constexpr (!std::is_trivially_default_constructible_v<T>)
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    std::construct_at(&array[i]);
+                }
+            }
+
+            return array;
+        }
+
         void reset() noexcept
         {
             Chunk* chunk = m_firstChunk;
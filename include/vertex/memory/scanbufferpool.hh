@@ -0,0 +1,61 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#pragma once
+
+#include <sdk/statuscode.h>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace Vertex::Memory
+{
+    // Page-mapped read buffer. Tries explicit huge pages first and falls back to regular pages
+    // advised for transparent huge pages, so large process reads fault in 2 MiB steps.
+    class ScanBuffer final
+    {
+      public:
+        static constexpr std::size_t HUGE_PAGE_SIZE = 2ULL * 1024 * 1024;
+
+        ScanBuffer() = default;
+        ~ScanBuffer() noexcept;
+
+        ScanBuffer(const ScanBuffer&) = delete;
+        ScanBuffer& operator=(const ScanBuffer&) = delete;
+
+        ScanBuffer(ScanBuffer&& other) noexcept;
+        ScanBuffer& operator=(ScanBuffer&& other) noexcept;
+
+        [[nodiscard]] StatusCode allocate(std::size_t size, bool useHugePages);
+        void release() noexcept;
+
+        [[nodiscard]] char* data() const noexcept { return m_base; }
+        [[nodiscard]] std::size_t capacity() const noexcept { return m_capacity; }
+        [[nodiscard]] bool is_huge_page_backed() const noexcept { return m_hugePages; }
+
+      private:
+        char* m_base{};
+        std::size_t m_capacity{};
+        bool m_hugePages{};
+    };
+
+    // One warm buffer per scan worker. Buffers survive across scans and are only remapped when a
+    // larger size is requested. reserve() must not race with workers; acquire() is safe as long as
+    // every worker only touches its own slot.
+    class ScanBufferPool final
+    {
+      public:
+        [[nodiscard]] StatusCode reserve(std::size_t workerCount, std::size_t bufferSize, bool useHugePages);
+        [[nodiscard]] std::span<char> acquire(std::size_t workerIndex, std::size_t minimumSize);
+        void release() noexcept;
+
+        [[nodiscard]] std::size_t worker_count() const noexcept { return m_buffers.size(); }
+        [[nodiscard]] std::size_t total_capacity() const noexcept;
+
+      private:
+        std::vector<ScanBuffer> m_buffers{};
+        bool m_useHugePages{true};
+    };
+} // namespace Vertex::Memory
@@ -59,6 +59,12 @@ namespace Vertex::Memory
             return m_arena.allocate_array<T>(count);
         }
 
+        template<class T>
+        [[nodiscard]] T* arena_allocate_array_nothrow(std::size_t count) noexcept
+        {
+            return m_arena.allocate_array_nothrow<T>(count);
+        }
+
         [[nodiscard]] void* pool_allocate()
         {
             return m_resultPool.allocate();
@@ -4,8 +4,13 @@
 //
 #pragma once
 
+#include <vertex/debugger/controlflow.hh>
 #include <vertex/debugger/debuggertypes.hh>
 #include <vertex/debugger/debuggerengine.hh>
+#include <vertex/debugger/functiontable.hh>
+#include <vertex/debugger/signature.hh>
+#include <vertex/debugger/symbolindex.hh>
+#include <vertex/debugger/xrefindex.hh>
 #include <vertex/runtime/iloader.hh>
 #include <vertex/thread/ithreaddispatcher.hh>
 #include <vertex/runtime/iregistry.hh>
@@ -17,11 +22,13 @@
 #include <sdk/disassembler.h>
 
 #include <atomic>
+#include <expected>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <span>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <string>
 #include <string_view>
@@ -34,6 +41,9 @@ namespace Vertex::Model
     using DebuggerEventHandler = std::move_only_function<void(Debugger::DirtyFlags, const Debugger::EngineSnapshot&)>;
     using ExtensionResultHandler = std::move_only_function<void(bool isTop, Debugger::ExtensionResult result)>;
     using XrefResultCallback = std::function<void(std::vector<Debugger::XrefEntry>)>;
+    using FunctionRangeCallback = std::function<void(std::optional<Debugger::FunctionRange>)>;
+    using ControlFlowCallback = std::function<void(std::shared_ptr<const Debugger::ControlFlowGraph>)>;
+    using SignatureCallback = std::function<void(std::expected<Debugger::CodeSignature, StatusCode>)>;
 
     class DebuggerModel final
     {
@@ -129,11 +139,15 @@ namespace Vertex::Model
 
         void query_xrefs_to(std::uint64_t address, XrefResultCallback callback) const;
         void query_xrefs_from(std::uint64_t address, XrefResultCallback callback);
+        void query_function_at(std::uint64_t address, FunctionRangeCallback callback) const;
+        void query_control_flow(std::uint64_t address, ControlFlowCallback callback) const;
+        void generate_signature(std::uint64_t address, SignatureCallback callback) const;
         void request_modules();
         void request_module_imports_exports(std::string_view moduleName);
 
         [[nodiscard]] const std::vector<Debugger::ImportEntry>& get_cached_imports() const;
         [[nodiscard]] const std::vector<Debugger::ExportEntry>& get_cached_exports() const;
+        [[nodiscard]] std::shared_ptr<const Debugger::SymbolIndex> get_symbol_index() const;
 
         void request_registers();
         void request_registers_for_thread(std::uint32_t threadId);
@@ -156,7 +170,11 @@ namespace Vertex::Model
         [[nodiscard]] static Debugger::DisassemblyLine convert_disasm_result(const ::DisassemblerResult& instr, std::uint64_t currentAddress);
         static void resolve_disassembly_symbols(Debugger::DisassemblyRange& range,
                                                  std::span<const Debugger::ModuleInfo> modules,
-                                                 const std::unordered_map<std::uint64_t, std::string>& symbolTable);
+                                                 const Debugger::SymbolIndex* symbols);
+        static void resolve_call_stack_symbols(Debugger::CallStack& callStack, const Debugger::SymbolIndex* symbols,
+                                               std::span<const std::shared_ptr<const Debugger::ModuleFunctionTable>> functions = {});
+        static void apply_function_bounds(Debugger::DisassemblyRange& range,
+                                          std::span<const std::shared_ptr<const Debugger::ModuleFunctionTable>> functions);
 
     private:
         static constexpr std::string_view MODEL_NAME{"DebuggerModel"};
@@ -166,6 +184,8 @@ namespace Vertex::Model
         static constexpr std::size_t XREF_SCAN_CHUNK_BYTES = 4096;
         static constexpr std::size_t XREF_SCAN_CHUNK_INSTRUCTIONS = 500;
         static constexpr std::size_t XREF_BACKWARD_PROBE_BYTES = 4096;
+        static constexpr std::size_t XREF_INDEX_SLICE_BYTES = 256 * 1024;
+        static constexpr std::uint64_t EXTEND_UP_RESYNC_BYTES = 4096;
 
         enum class QueryFamily : std::uint8_t
         {
@@ -184,6 +204,24 @@ namespace Vertex::Model
             std::uint64_t dispatchGeneration{};
         };
 
+        // Registers and innermost frames of one thread, captured for every thread when the target stops.
+        struct ThreadStopState final
+        {
+            Debugger::RegisterSet registers{};
+            Debugger::CallStack callStack{};
+            bool callStackComplete{};
+        };
+
+        struct XrefIndexSlot final
+        {
+            std::string path{};
+            std::uint64_t size{};
+            std::shared_ptr<const Debugger::ModuleXrefIndex> index{};
+            std::vector<Debugger::CodeRange> code{};
+            std::shared_ptr<const Debugger::ModuleFunctionTable> functions{};
+            std::shared_ptr<Debugger::ModuleControlFlowCache> graphs{};
+        };
+
         struct PendingBreakpointAdd final
         {
             std::uint64_t address{};
@@ -195,6 +233,14 @@ namespace Vertex::Model
         void resync_watchpoints_from_plugin();
         void request_symbol_table();
 
+        [[nodiscard]] std::shared_ptr<const Debugger::ModuleXrefIndex> acquire_xref_index(Runtime::Plugin& plugin, const Debugger::ModuleInfo& module) const;
+        void invalidate_xref_indices(std::uint64_t address, std::uint64_t size) const;
+        void prune_xref_indices(std::span<const Debugger::ModuleInfo> modules) const;
+        [[nodiscard]] std::shared_ptr<const Debugger::ModuleFunctionTable> acquire_function_table(Runtime::Plugin& plugin, const Debugger::ModuleInfo& module) const;
+        [[nodiscard]] std::vector<std::shared_ptr<const Debugger::ModuleFunctionTable>> cached_function_tables() const;
+        [[nodiscard]] std::shared_ptr<const Debugger::ControlFlowGraph> acquire_control_flow(Runtime::Plugin& plugin, const Debugger::ModuleInfo& module, std::uint64_t address) const;
+        void prefetch_function_table(std::uint64_t address);
+
         Configuration::ISettings& m_settingsService;
         Runtime::ILoader& m_loaderService;
         Log::ILog& m_loggerService;
@@ -218,6 +264,8 @@ namespace Vertex::Model
         std::unordered_map<std::uint32_t, PendingBreakpointAdd> m_pendingBreakpointAdds{};
         std::vector<Debugger::ModuleInfo> m_cachedModules{};
         std::vector<Debugger::ThreadInfo> m_cachedThreads{};
+        std::unordered_map<std::uint32_t, ThreadStopState> m_cachedThreadStates{};
+        std::uint64_t m_threadStatesGeneration{};
         std::vector<Debugger::LogEntry> m_cachedLogs{};
         Debugger::MemoryBlock m_cachedMemoryBlock{};
 
@@ -229,7 +277,12 @@ namespace Vertex::Model
         std::vector<Debugger::LocalVariable> m_cachedLocalVariables{};
         Debugger::ExceptionData m_cachedException{};
 
-        std::unordered_map<std::uint64_t, std::string> m_symbolTable{};
+        std::shared_ptr<const Debugger::SymbolIndex> m_symbolIndex{};
+
+        mutable std::mutex m_xrefIndexMutex{};
+        mutable std::unordered_map<std::uint64_t, XrefIndexSlot> m_xrefIndices{};
+        mutable std::uint64_t m_xrefIndexEpoch{};
+        std::unordered_set<std::uint64_t> m_functionTableBuilds{};
 
         QueryTracker m_queryRegisters{};
         QueryTracker m_queryThreads{};
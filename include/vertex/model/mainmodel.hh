@@ -16,6 +16,8 @@
 #include <sdk/statuscode.h>
 #include <sdk/memory.h>
 
+#include <filesystem>
+#include <functional>
 #include <optional>
 #include <span>
 #include <string_view>
@@ -36,6 +38,8 @@ namespace Vertex::Model
         std::span<const std::uint8_t> bytes{};
     };
 
+    using RegionChangesCallback = std::move_only_function<void(StatusCode status, std::vector<RegionChange> changes, std::uint64_t generation)>;
+
     class MainModel final
     {
       public:
@@ -59,6 +63,8 @@ namespace Vertex::Model
         [[nodiscard]] StatusCode read_process_memory_bulk(std::span<const BulkReadEntry> entries, std::span<BulkReadResult> results) const;
         [[nodiscard]] StatusCode write_process_memory_bulk(std::span<const BulkWriteEntry> entries) const;
         [[nodiscard]] StatusCode query_memory_regions(std::vector<MemoryRegion>& regions) const;
+        // Runs on the scanner channel; onComplete is invoked there once the plugin has answered.
+        [[nodiscard]] StatusCode query_region_changes(std::uint64_t sinceGeneration, RegionChangesCallback onComplete) const;
         [[nodiscard]] StatusCode get_file_executable_extensions(std::vector<std::string>& extensions) const;
         [[nodiscard]] StatusCode open_new_process(std::string_view processPath, int argc, const char** argv) const;
         [[nodiscard]] StatusCode get_min_process_address(std::uint64_t& address) const;
@@ -100,7 +106,10 @@ namespace Vertex::Model
                                                       const std::vector<std::uint8_t>& input,
                                                       const std::vector<std::uint8_t>& input2) const;
 
+        [[nodiscard]] StatusCode extend_scan() const;
         [[nodiscard]] StatusCode undo_scan() const;
+        [[nodiscard]] StatusCode export_scan_session(const std::filesystem::path& path) const;
+        [[nodiscard]] StatusCode import_scan_session(const std::filesystem::path& path, Scanner::TypeId& importedTypeId) const;
         [[nodiscard]] StatusCode stop_scan() const;
         void finalize_scan() const;
         [[nodiscard]] bool can_undo_scan() const;
@@ -109,6 +118,7 @@ namespace Vertex::Model
         [[nodiscard]] std::uint64_t get_scan_results_count() const;
         [[nodiscard]] StatusCode get_scan_results(std::vector<Scanner::IMemoryScanner::ScanResultEntry>& results, std::size_t maxResults = 10000) const;
         [[nodiscard]] StatusCode get_scan_results_range(std::vector<Scanner::IMemoryScanner::ScanResultEntry>& results, std::size_t startIndex, std::size_t count) const;
+        [[nodiscard]] StatusCode get_scan_results_page(Scanner::ScanResultPage& page, std::size_t startIndex, std::size_t count) const;
 
         [[nodiscard]] Theme get_theme() const;
         [[nodiscard]] StatusCode is_process_opened() const;
@@ -127,6 +137,7 @@ namespace Vertex::Model
         static constexpr std::string_view MODEL_NAME{"MainModel"};
 
         void ensure_memory_reader_setup() const;
+        [[nodiscard]] StatusCode query_session_modules(std::vector<Scanner::ScanRegion>& modules) const;
 
         Configuration::ISettings& m_settingsService;
         Scanner::IMemoryScanner& m_memoryService;
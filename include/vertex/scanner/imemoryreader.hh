@@ -22,6 +22,20 @@ namespace Vertex::Scanner
         StatusCode status{StatusCode::STATUS_OK};
     };
 
+    struct AsyncReadRequest final
+    {
+        std::uint64_t address{};
+        std::uint64_t size{};
+        void* buffer{};
+        std::uint64_t userData{};
+    };
+
+    struct AsyncReadCompletion final
+    {
+        std::uint64_t userData{};
+        StatusCode status{StatusCode::STATUS_OK};
+    };
+
     class IMemoryReader
     {
     public:
@@ -45,5 +59,78 @@ namespace Vertex::Scanner
             static_cast<void>(results);
             return StatusCode::STATUS_ERROR_NOT_IMPLEMENTED;
         }
+
+        [[nodiscard]] virtual bool supports_dirty_tracking() const noexcept
+        {
+            return false;
+        }
+
+        virtual StatusCode reset_dirty_tracking()
+        {
+            return StatusCode::STATUS_ERROR_NOT_IMPLEMENTED;
+        }
+
+        // Bit i of the bitmap marks page (address rounded down to pageSize) + i as written since the last reset.
+        // An empty bitmap only reports the page size.
+        virtual StatusCode query_dirty_pages(std::uint64_t address, std::uint64_t size, std::span<std::uint8_t> bitmap, std::uint64_t& pageSize)
+        {
+            static_cast<void>(address);
+            static_cast<void>(size);
+            static_cast<void>(bitmap);
+            static_cast<void>(pageSize);
+            return StatusCode::STATUS_ERROR_NOT_IMPLEMENTED;
+        }
+
+        [[nodiscard]] virtual bool supports_residency_query() const noexcept
+        {
+            return false;
+        }
+
+        // Bit i of the bitmap marks page (address rounded down to pageSize) + i as backed by memory or swap.
+        // An empty bitmap only reports the page size.
+        virtual StatusCode query_resident_pages(std::uint64_t address, std::uint64_t size, std::span<std::uint8_t> bitmap, std::uint64_t& pageSize)
+        {
+            static_cast<void>(address);
+            static_cast<void>(size);
+            static_cast<void>(bitmap);
+            static_cast<void>(pageSize);
+            return StatusCode::STATUS_ERROR_NOT_IMPLEMENTED;
+        }
+
+        [[nodiscard]] virtual bool supports_async_read() const noexcept
+        {
+            return false;
+        }
+
+        // A read queue belongs to the thread that opened it and never holds more than depth reads in flight.
+        // Every submitted read yields one completion with its userData; buffers must outlive it.
+        virtual StatusCode open_read_queue(std::uint32_t depth, std::uint64_t& queue)
+        {
+            static_cast<void>(depth);
+            static_cast<void>(queue);
+            return StatusCode::STATUS_ERROR_NOT_IMPLEMENTED;
+        }
+
+        virtual StatusCode submit_reads(std::uint64_t queue, std::span<const AsyncReadRequest> requests)
+        {
+            static_cast<void>(queue);
+            static_cast<void>(requests);
+            return StatusCode::STATUS_ERROR_NOT_IMPLEMENTED;
+        }
+
+        virtual StatusCode complete_reads(std::uint64_t queue, std::span<AsyncReadCompletion> completions, bool wait, std::uint32_t& completed)
+        {
+            static_cast<void>(queue);
+            static_cast<void>(completions);
+            static_cast<void>(wait);
+            completed = 0;
+            return StatusCode::STATUS_ERROR_NOT_IMPLEMENTED;
+        }
+
+        virtual StatusCode close_read_queue(std::uint64_t queue)
+        {
+            static_cast<void>(queue);
+            return StatusCode::STATUS_ERROR_NOT_IMPLEMENTED;
+        }
     };
 } // namespace Vertex::Scanner
@@ -55,6 +55,9 @@ namespace Vertex::Scanner
         [[nodiscard]] virtual StatusCode snapshot_results(std::vector<IMemoryScanner::ScanResultEntry>& out,
                                                           std::size_t startIndex,
                                                           std::size_t count) const = 0;
+        [[nodiscard]] virtual StatusCode snapshot_results_page(ScanResultPage& page,
+                                                               std::size_t startIndex,
+                                                               std::size_t count) const = 0;
         [[nodiscard]] virtual bool can_undo() const = 0;
         [[nodiscard]] virtual bool is_scanning() const = 0;
 
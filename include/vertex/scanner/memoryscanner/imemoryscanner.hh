@@ -8,7 +8,11 @@
 #include <vertex/scanner/scanconfig.hh>
 #include <vertex/scanner/scanner_typeschema.hh>
 #include <vertex/scanner/imemoryreader.hh>
+#include <vertex/scanner/scanresult.hh>
+#include <vertex/scanner/scanbudget.hh>
+#include <vertex/scanner/scansession.hh>
 
+#include <filesystem>
 #include <vector>
 #include <string>
 #include <memory>
@@ -23,6 +27,8 @@ namespace Vertex::Scanner
         std::uint64_t size{};
     };
 
+    using SchemaResolver = std::function<std::shared_ptr<const TypeSchema>(TypeId id)>;
+
     class IMemoryScanner
     {
       public:
@@ -44,6 +50,7 @@ namespace Vertex::Scanner
 
         virtual StatusCode initialize_scan(const ScanConfiguration& configuration, std::shared_ptr<const TypeSchema> schema, const std::vector<ScanRegion>& memoryRegions) = 0;
         virtual StatusCode initialize_next_scan(const ScanConfiguration& configuration, std::shared_ptr<const TypeSchema> schema) = 0;
+        virtual StatusCode extend_scan(std::shared_ptr<const TypeSchema> schema, const std::vector<ScanRegion>& memoryRegions) = 0;
         virtual StatusCode undo_scan() = 0;
         virtual StatusCode stop_scan() = 0;
         virtual void finalize_scan() = 0;
@@ -52,11 +59,16 @@ namespace Vertex::Scanner
         [[nodiscard]] virtual std::uint64_t get_total_regions() const noexcept = 0;
         [[nodiscard]] virtual std::uint64_t get_results_count() const = 0;
         [[nodiscard]] virtual StatusCode get_last_plugin_error() const noexcept = 0;
+        [[nodiscard]] virtual ScanBudgetUsage get_budget_usage() const noexcept = 0;
         virtual void set_scan_abort_state(bool state) = 0;
         virtual bool is_scan_complete() = 0;
         [[nodiscard]] virtual bool can_undo() const = 0;
 
         virtual StatusCode get_scan_results_range(std::vector<ScanResultEntry>& results, std::size_t startIndex, std::size_t count) const = 0;
         virtual StatusCode get_scan_results(std::vector<ScanResultEntry>& results, std::size_t maxResults) const = 0;
+        virtual StatusCode read_scan_results_page(ScanResultPage& page, std::size_t startIndex, std::size_t count, bool readCurrentValues) const = 0;
+
+        virtual StatusCode export_session(const std::filesystem::path& path, const std::vector<ScanRegion>& modules, ScanSessionCompression compression) = 0;
+        virtual StatusCode import_session(const std::filesystem::path& path, const std::vector<ScanRegion>& modules, const SchemaResolver& resolveSchema) = 0;
     };
 } // namespace Vertex::Scanner
@@ -12,6 +12,7 @@
 #include <vertex/scanner/scanresult.hh>
 #include <vertex/scanner/simd/simd_scanner.hh>
 #include <vertex/io/scanresultstore.hh>
+#include <vertex/memory/scanbufferpool.hh>
 #include <vertex/log/ilog.hh>
 #include <atomic>
 #include <mutex>
@@ -40,6 +41,7 @@ namespace Vertex::Scanner
         std::shared_ptr<std::vector<WriterRegionMetadata>> writerRegions{};
         std::uint64_t resultsCount{};
         ScanConfiguration config{};
+        std::vector<ScanRegion> scannedRegions{};
     };
 
     class MemoryScanner final : public IMemoryScanner
@@ -57,12 +59,17 @@ namespace Vertex::Scanner
 
         StatusCode initialize_scan(const ScanConfiguration& configuration, std::shared_ptr<const TypeSchema> schema, const std::vector<ScanRegion>& memoryRegions) override;
         StatusCode initialize_next_scan(const ScanConfiguration& configuration, std::shared_ptr<const TypeSchema> schema) override;
+        StatusCode extend_scan(std::shared_ptr<const TypeSchema> schema, const std::vector<ScanRegion>& memoryRegions) override;
         StatusCode undo_scan() override;
         StatusCode stop_scan() override;
         void finalize_scan() override;
 
         StatusCode get_scan_results_range(std::vector<ScanResultEntry>& results, std::size_t startIndex, std::size_t count) const override;
         StatusCode get_scan_results(std::vector<ScanResultEntry>& results, std::size_t maxResults) const override;
+        StatusCode read_scan_results_page(ScanResultPage& page, std::size_t startIndex, std::size_t count, bool readCurrentValues) const override;
+
+        StatusCode export_session(const std::filesystem::path& path, const std::vector<ScanRegion>& modules, ScanSessionCompression compression) override;
+        StatusCode import_session(const std::filesystem::path& path, const std::vector<ScanRegion>& modules, const SchemaResolver& resolveSchema) override;
 
         void set_scan_abort_state(bool state) override;
         bool is_scan_complete() override;
@@ -74,20 +81,32 @@ namespace Vertex::Scanner
         [[nodiscard]] std::uint64_t get_total_regions() const noexcept override;
         [[nodiscard]] std::uint64_t get_results_count() const override;
         [[nodiscard]] StatusCode get_last_plugin_error() const noexcept override;
+        [[nodiscard]] ScanBudgetUsage get_budget_usage() const noexcept override;
 
       private:
-        StatusCode scan_memory_region(const ScanRegion& region, std::size_t writerIndex, IMemoryReader& reader, Memory::AlignedByteVector& regionBuffer);
+        StatusCode scan_memory_region(const ScanRegion& region, std::size_t writerIndex, IMemoryReader& reader, std::span<char> regionBuffer);
+        [[nodiscard]] bool scan_chunk_range(const std::uint8_t* chunkData, std::size_t from, std::size_t to, std::size_t limit, std::uint64_t chunkBaseAddress, std::size_t writerIndex, ScanResult& batchResult);
+        [[nodiscard]] bool scan_non_zero_pages(const std::uint8_t* chunkData, std::size_t from, std::size_t to, std::size_t limit, std::uint64_t chunkBaseAddress, std::size_t writerIndex,
+                                               ScanResult& batchResult);
+        StatusCode scan_chunks_async(std::size_t writerIndex, IMemoryReader& reader, std::uint64_t readQueue, std::uint32_t depth, std::size_t threadBufferSize);
         StatusCode scan_previous_results_from_regions(std::size_t sortedStartIndex, std::size_t totalCount, std::size_t previousValueSize, std::size_t previousFirstValueSize, std::size_t writerIndex);
 
         [[nodiscard]] bool check_value_matches(const std::uint8_t* currentData) const;
         [[nodiscard]] bool check_value_matches_with_previous(const std::uint8_t* currentData, const std::uint8_t* previousData) const;
         void resolve_comparator();
+        void resolve_page_filters();
 
         StatusCode create_worker_pool(std::size_t workerCount);
+        [[nodiscard]] std::size_t configured_thread_buffer_size() const;
+        StatusCode reserve_scan_buffers(std::size_t workerCount, std::size_t bufferSize);
         StatusCode distribute_regions_to_readers(const std::vector<ScanRegion>& memoryRegions);
 
         StatusCode write_results_direct(const ScanResult& results, std::size_t writerIndex);
         StatusCode get_scan_results_locked(std::vector<ScanResultEntry>& results, std::size_t startIndex, std::size_t count) const;
+        StatusCode fill_scan_results_locked(ScanResultPage& page, std::vector<ScanResultEntry>& results, std::size_t startIndex, std::size_t count) const;
+        StatusCode copy_result_records_locked(ScanResultPage& page, std::size_t startIndex, std::size_t count) const;
+        void read_current_values(ScanResultPage& page) const;
+        void rebuild_result_index_locked();
 
         struct ChunkDescriptor final
         {
@@ -102,16 +121,55 @@ namespace Vertex::Scanner
             const std::byte* recordPtr{};
         };
 
+        // One entry per non-empty finalized writer store; endIndex is the exclusive
+        // prefix sum of result counts, so a global index resolves with one binary search.
+        struct ResultIndexEntry final
+        {
+            std::uint64_t endIndex{};
+            const std::byte* base{};
+        };
+
+        // Per-worker scratch that survives across scans; the arena is reset at the start of every chunk.
+        struct AsyncReadSlot final
+        {
+            std::uint64_t address{};
+            std::size_t scanSize{};
+            std::size_t readSize{};
+            bool lastPieceOfChunk{};
+        };
+
+        struct WorkerScratch final
+        {
+            explicit WorkerScratch(const std::size_t arenaSize)
+                : context(arenaSize)
+            {
+            }
+
+            Memory::ScannerMemoryContext context;
+            ScanResult batch{};
+        };
+
         StatusCode create_writer_regions(std::size_t writerCount);
+        StatusCode append_writer_regions(std::size_t writerCount);
+        StatusCode open_writer_regions_locked(std::size_t writerCount);
         void cleanup_writer_regions(std::vector<WriterRegionMetadata>& regions) const;
         void cleanup_snapshot_regions(const ScanSnapshot& snapshot) const;
         void save_snapshot_for_undo();
+        [[nodiscard]] std::size_t max_undo_depth() const;
+        [[nodiscard]] std::uint64_t retained_store_bytes(std::size_t levelLimit) const;
         StatusCode finalize_writer_store(std::size_t writerIndex);
         void reconcile_result_count();
         void notify_scan_completion();
         void notify_scan_progress();
         void notify_scan_progress_throttled();
         [[nodiscard]] bool drain_active_scan();
+        [[nodiscard]] ScanBudgetLimits load_budget_limits() const;
+        void begin_dirty_epoch();
+        [[nodiscard]] std::size_t prepare_dirty_page_filter(std::size_t previousValueSize);
+        [[nodiscard]] bool is_clean_record(const std::size_t sortedIndex) const noexcept
+        {
+            return !m_cleanRecordBits.empty() && ((m_cleanRecordBits[sortedIndex >> 6] >> (sortedIndex & 63)) & 1) != 0;
+        }
         StatusCode build_sorted_next_scan_records(const std::vector<WriterRegionMetadata>& previousRegions, std::size_t previousValueSize, std::size_t previousFirstValueSize);
 
         // Give each atomic enough space to hold their own CPU cache line to prevent false sharing between threads
@@ -150,9 +208,13 @@ namespace Vertex::Scanner
         VertexComparator_t m_resolvedPluginComparator{};
         std::size_t m_resolvedPluginValueSize{};
         Simd::SimdScanCapability m_simdCapability{};
+        bool m_skipNonResidentPages{};
+        bool m_skipZeroPages{};
 
         std::size_t m_workerCount{};
         std::vector<ChunkDescriptor> m_allChunks{};
+        Memory::ScanBufferPool m_scanBuffers{};
+        std::vector<std::unique_ptr<WorkerScratch>> m_workerScratch{};
 
         START_PADDING_WARNING_SUPPRESSION
         alignas(std::hardware_destructive_interference_size) std::atomic<std::size_t> m_nextChunkIndex{};
@@ -160,12 +222,35 @@ namespace Vertex::Scanner
         END_PADDING_WARNING_SUPPRESSION
 
         std::vector<SortedRecordRef> m_sortedNextScanRecords{};
+        std::uint32_t m_nextScanSampleShift{};
+
+        // One bit per sorted record whose pages were not written since the live epoch began, which predates every
+        // read of the current results. Only meaningful while m_dirtyEpochValid says so.
+        std::vector<std::uint64_t> m_cleanRecordBits{};
+        std::atomic<bool> m_dirtyEpochValid{};
+        std::uint64_t m_sortedIndexBudgetBytes{};
+
+        ScanBudgetGovernor m_budget{};
+
+        // First-scan predicate and the merged address ranges it has covered so far, so an extend scan
+        // only visits memory mapped or grown since. Workers write to m_writerRegions[m_writerBase + i].
+        ScanConfiguration m_firstScanConfig{};
+        std::vector<ScanRegion> m_scannedRegions{};
+        std::size_t m_writerBase{};
 
         mutable std::shared_mutex m_writerRegionsMutex{};
         std::vector<WriterRegionMetadata> m_writerRegions{};
+        std::vector<ResultIndexEntry> m_resultIndex{};
 
         static constexpr std::size_t MAX_UNDO_DEPTH = 10;
         static constexpr std::size_t NEXT_SCAN_CHUNK_SIZE = 4096;
+        static constexpr std::size_t NEXT_SCAN_BUNDLE_SIZE = 256;
+        static constexpr std::size_t WORKER_ARENA_SIZE = 256ULL * 1024;
+        static constexpr std::uint64_t DIRTY_QUERY_MAX_GAP_PAGES = 64;
+        static constexpr std::uint64_t DIRTY_QUERY_MAX_WINDOW_PAGES = 64ULL * 1024;
+        static constexpr std::size_t ZERO_PAGE_PROBE_SIZE = 4096;
+        static constexpr std::uint32_t MAX_ASYNC_READ_DEPTH = 64;
+        static constexpr std::size_t MAX_RETAINED_PAGE_BYTES = 4ULL * 1024 * 1024;
         std::deque<ScanSnapshot> m_undoHistory{};
         mutable std::mutex m_undoHistoryMutex{};
 
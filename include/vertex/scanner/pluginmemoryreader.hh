@@ -7,6 +7,8 @@
 #include <vertex/scanner/imemoryreader.hh>
 #include <vertex/runtime/iloader.hh>
 
+#include <atomic>
+
 namespace Vertex::Scanner
 {
     class PluginMemoryReader final : public IMemoryReader
@@ -21,8 +23,20 @@ namespace Vertex::Scanner
         [[nodiscard]] bool supports_bulk_read() const noexcept override;
         [[nodiscard]] std::uint32_t bulk_request_limit() const noexcept override;
         StatusCode read_memory_bulk(std::span<const BulkReadRequest> requests, std::span<BulkReadResult> results) override;
+        [[nodiscard]] bool supports_dirty_tracking() const noexcept override;
+        StatusCode reset_dirty_tracking() override;
+        StatusCode query_dirty_pages(std::uint64_t address, std::uint64_t size, std::span<std::uint8_t> bitmap, std::uint64_t& pageSize) override;
+        [[nodiscard]] bool supports_residency_query() const noexcept override;
+        StatusCode query_resident_pages(std::uint64_t address, std::uint64_t size, std::span<std::uint8_t> bitmap, std::uint64_t& pageSize) override;
+        [[nodiscard]] bool supports_async_read() const noexcept override;
+        StatusCode open_read_queue(std::uint32_t depth, std::uint64_t& queue) override;
+        StatusCode submit_reads(std::uint64_t queue, std::span<const AsyncReadRequest> requests) override;
+        StatusCode complete_reads(std::uint64_t queue, std::span<AsyncReadCompletion> completions, bool wait, std::uint32_t& completed) override;
+        StatusCode close_read_queue(std::uint64_t queue) override;
 
     private:
         Runtime::ILoader& m_loaderService;
+        // Set when the runtime exports dirty tracking but reports that the kernel does not maintain it.
+        std::atomic<const Runtime::Plugin*> m_dirtyTrackingUnavailable{};
     };
 } // namespace Vertex::Scanner
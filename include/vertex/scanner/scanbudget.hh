@@ -0,0 +1,83 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#pragma once
+
+#include <vertex/macrohelp.hh>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <optional>
+
+namespace Vertex::Scanner
+{
+    enum class ScanBudgetPolicy : std::uint8_t
+    {
+        AbortWithPartialResults = 0,
+        Downsample = 1
+    };
+
+    // A limit of zero means unlimited.
+    struct ScanBudgetLimits final
+    {
+        std::uint64_t diskBytes{};
+        std::uint64_t memoryBytes{};
+        ScanBudgetPolicy policy{ScanBudgetPolicy::AbortWithPartialResults};
+    };
+
+    struct ScanBudgetUsage final
+    {
+        std::uint64_t diskBytes{};
+        std::uint64_t memoryBytes{};
+        // Combined shift of the memory and disk admissions, i.e. results kept are one of 2^sampleShift matches.
+        std::uint32_t sampleShift{};
+        bool exceeded{};
+    };
+
+    class ScanBudgetGovernor final
+    {
+      public:
+        static constexpr std::uint32_t MAX_SAMPLE_SHIFT = 16;
+
+        // Bytes already held by result stores that outlive this scan (undo levels) count against the disk budget.
+        void reset(const ScanBudgetLimits& limits, std::uint64_t retainedDiskBytes = 0) noexcept;
+
+        // Reserves budget for a result batch and returns the sample shift to apply to it
+        // (keep one of 2^shift records), or nullopt once the scan has to stop writing.
+        // Downsampling halves the remaining headroom per step, so disk usage stays below twice the budget.
+        [[nodiscard]] std::optional<std::uint32_t> admit_disk_batch(std::uint64_t batchBytes) noexcept;
+
+        // Same contract for in-memory structures sized up front, e.g. the next-scan index. The memory and disk
+        // shifts are tracked apart, so downsampling one never forces the other.
+        [[nodiscard]] std::optional<std::uint32_t> admit_memory(std::uint64_t bytes) noexcept;
+        void release_memory(std::uint64_t bytes) noexcept;
+
+        [[nodiscard]] std::uint64_t next_sample_sequence(std::uint64_t count) noexcept;
+        [[nodiscard]] static bool keep_sample(const std::uint64_t sequence, const std::uint32_t shift) noexcept
+        {
+            return (sequence & ((std::uint64_t{1} << shift) - 1)) == 0;
+        }
+
+        [[nodiscard]] bool exceeded() const noexcept { return m_exceeded.load(std::memory_order_acquire); }
+        [[nodiscard]] ScanBudgetPolicy policy() const noexcept { return m_limits.policy; }
+        [[nodiscard]] ScanBudgetUsage usage() const noexcept;
+
+      private:
+        ScanBudgetLimits m_limits{};
+
+        START_PADDING_WARNING_SUPPRESSION
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::uint64_t> m_diskUsed{};
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::uint64_t> m_memoryUsed{};
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::uint64_t> m_sampleSequence{};
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::uint32_t> m_diskSampleShift{};
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::uint32_t> m_memorySampleShift{};
+        alignas(std::hardware_destructive_interference_size) std::atomic<bool> m_exceeded{};
+        END_PADDING_WARNING_SUPPRESSION
+
+        std::uint64_t m_nextDiskThreshold{};
+        std::mutex m_thresholdMutex{};
+    };
+} // namespace Vertex::Scanner
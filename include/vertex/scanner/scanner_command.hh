@@ -7,6 +7,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <limits>
 #include <memory>
 #include <variant>
@@ -18,6 +19,7 @@
 #include <vertex/scanner/memoryscanner/imemoryscanner.hh>
 #include <vertex/scanner/scanconfig.hh>
 #include <vertex/scanner/scanner_typeschema.hh>
+#include <vertex/scanner/scansession.hh>
 
 namespace Vertex::Scanner::service
 {
@@ -32,6 +34,12 @@ namespace Vertex::Scanner::service
         ScanConfiguration config{};
     };
 
+    // Runs the first-scan predicate over the parts of regions that the session has not scanned yet.
+    struct CmdExtendScan final
+    {
+        std::vector<ScanRegion> regions{};
+    };
+
     struct CmdUndoScan final
     {
     };
@@ -40,6 +48,19 @@ namespace Vertex::Scanner::service
     {
     };
 
+    struct CmdExportSession final
+    {
+        std::filesystem::path path{};
+        std::vector<ScanRegion> modules{};
+        ScanSessionCompression compression{ScanSessionCompression::Zlib};
+    };
+
+    struct CmdImportSession final
+    {
+        std::filesystem::path path{};
+        std::vector<ScanRegion> modules{};
+    };
+
     struct CmdCancel final
     {
         Runtime::CommandId target{Runtime::INVALID_COMMAND_ID};
@@ -68,8 +89,11 @@ namespace Vertex::Scanner::service
     using Command = std::variant<
         CmdStartScan,
         CmdNextScan,
+        CmdExtendScan,
         CmdUndoScan,
         CmdStopScan,
+        CmdExportSession,
+        CmdImportSession,
         CmdCancel,
         CmdRefreshValues,
         CmdRegisterType,
@@ -92,11 +116,17 @@ namespace Vertex::Scanner::service
         std::vector<TypeSchema> types{};
     };
 
+    struct ImportSessionResultPayload final
+    {
+        TypeId id{TypeId::Invalid};
+    };
+
     using CommandResultPayload = std::variant<
         std::monostate,
         StartScanResultPayload,
         RegisterTypeResultPayload,
-        QueryTypesResultPayload>;
+        QueryTypesResultPayload,
+        ImportSessionResultPayload>;
 
     struct CommandResult final
     {
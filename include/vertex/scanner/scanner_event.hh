@@ -54,6 +54,10 @@ namespace Vertex::Scanner
         std::uint8_t percentComplete{};
         std::uint64_t addressesScanned{};
         std::uint64_t matchesSoFar{};
+        std::uint64_t diskBytesUsed{};
+        std::uint64_t memoryBytesUsed{};
+        std::uint32_t sampleShift{};
+        bool budgetExceeded{};
     };
 
     struct ScanCompleteInfo final
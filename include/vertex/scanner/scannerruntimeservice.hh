@@ -58,6 +58,9 @@ namespace Vertex::Scanner
         [[nodiscard]] StatusCode snapshot_results(std::vector<IMemoryScanner::ScanResultEntry>& out,
                                                   std::size_t startIndex,
                                                   std::size_t count) const override;
+        [[nodiscard]] StatusCode snapshot_results_page(ScanResultPage& page,
+                                                       std::size_t startIndex,
+                                                       std::size_t count) const override;
         [[nodiscard]] bool can_undo() const override;
         [[nodiscard]] bool is_scanning() const override;
 
@@ -99,10 +102,16 @@ namespace Vertex::Scanner
                                                 std::chrono::milliseconds timeout);
         Runtime::CommandId dispatch_next_scan(service::CmdNextScan command,
                                                std::chrono::milliseconds timeout);
+        Runtime::CommandId dispatch_extend_scan(service::CmdExtendScan command,
+                                                 std::chrono::milliseconds timeout);
         Runtime::CommandId dispatch_undo_scan(service::CmdUndoScan command,
                                                std::chrono::milliseconds timeout);
         Runtime::CommandId dispatch_stop_scan(service::CmdStopScan command,
                                                std::chrono::milliseconds timeout);
+        Runtime::CommandId dispatch_export_session(service::CmdExportSession command,
+                                                    std::chrono::milliseconds timeout);
+        Runtime::CommandId dispatch_import_session(service::CmdImportSession command,
+                                                    std::chrono::milliseconds timeout);
         Runtime::CommandId dispatch_cancel(service::CmdCancel command,
                                             std::chrono::milliseconds timeout);
         Runtime::CommandId dispatch_refresh_values(service::CmdRefreshValues command,
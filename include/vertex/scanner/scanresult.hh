@@ -5,7 +5,10 @@
 #pragma once
 
 #include <vertex/memory/scannerallocator.hh>
+#include <vertex/scanner/imemoryreader.hh>
+#include <algorithm>
 #include <cstring>
+#include <span>
 #include <vector>
 
 namespace Vertex::Scanner
@@ -77,4 +80,116 @@ namespace Vertex::Scanner
             return m_writePos;
         }
     };
+
+    struct ScanResultRecordView final
+    {
+        std::uint64_t address{};
+        std::span<const std::uint8_t> currentValue{};
+        std::span<const std::uint8_t> previousValue{};
+        std::span<const std::uint8_t> firstValue{};
+    };
+
+    // Caller-owned page of raw result records as stored by the writer stores
+    // (address, value at last scan, optional first value). Buffers only grow until
+    // release(), so repeatedly paging a window of the same size never touches the allocator.
+    struct ScanResultPage final
+    {
+        Memory::AlignedByteVector records{};
+        Memory::AlignedByteVector currentValues{};
+        std::vector<std::uint8_t> currentValid{};
+        std::vector<BulkReadRequest> bulkRequests{};
+        std::vector<BulkReadResult> bulkResults{};
+
+        std::size_t count{};
+        std::size_t valueSize{};
+        std::size_t firstValueSize{};
+        std::size_t recordSize{};
+        bool hasCurrentValues{};
+
+        void prepare(std::size_t recordCount, std::size_t valSize, std::size_t firstValSize)
+        {
+            valueSize = valSize;
+            firstValueSize = firstValSize;
+            recordSize = sizeof(std::uint64_t) + valSize + firstValSize;
+            count = 0;
+            hasCurrentValues = false;
+
+            if (records.size() < recordCount * recordSize)
+            {
+                records.resize(recordCount * recordSize);
+            }
+        }
+
+        void prepare_current_values()
+        {
+            const std::size_t needed = count * valueSize;
+            if (currentValues.size() < needed)
+            {
+                currentValues.resize(needed);
+            }
+            if (currentValid.size() < count)
+            {
+                currentValid.resize(count);
+            }
+            std::fill_n(currentValid.begin(), count, std::uint8_t{});
+            hasCurrentValues = true;
+        }
+
+        void clear() noexcept
+        {
+            count = 0;
+            hasCurrentValues = false;
+        }
+
+        [[nodiscard]] std::size_t capacity_bytes() const noexcept
+        {
+            return records.capacity() + currentValues.capacity() + currentValid.capacity() +
+                   bulkRequests.capacity() * sizeof(BulkReadRequest) + bulkResults.capacity() * sizeof(BulkReadResult);
+        }
+
+        void release() noexcept
+        {
+            clear();
+            records = {};
+            currentValues = {};
+            currentValid = {};
+            bulkRequests = {};
+            bulkResults = {};
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return count == 0;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return count;
+        }
+
+        [[nodiscard]] std::uint64_t address_at(std::size_t index) const noexcept
+        {
+            std::uint64_t address{};
+            std::memcpy(&address, records.data() + (index * recordSize), sizeof(std::uint64_t));
+            return address;
+        }
+
+        [[nodiscard]] ScanResultRecordView operator[](std::size_t index) const noexcept
+        {
+            const auto* record = reinterpret_cast<const std::uint8_t*>(records.data() + (index * recordSize));
+
+            ScanResultRecordView view{};
+            std::memcpy(&view.address, record, sizeof(std::uint64_t));
+            view.previousValue = {record + sizeof(std::uint64_t), valueSize};
+            if (firstValueSize > 0)
+            {
+                view.firstValue = {record + sizeof(std::uint64_t) + valueSize, firstValueSize};
+            }
+            if (hasCurrentValues && currentValid[index] != 0)
+            {
+                view.currentValue = {reinterpret_cast<const std::uint8_t*>(currentValues.data()) + (index * valueSize), valueSize};
+            }
+            return view;
+        }
+    };
 }
@@ -0,0 +1,32 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Vertex::Scanner
+{
+    enum class ScanSessionCompression : std::uint32_t
+    {
+        None = 0,
+        Zlib = 1
+    };
+
+    // Session file layout (host byte order, guarded by the byte order mark):
+    //   header  : magic, version, byte order mark, compression, module count, level count, first scan config
+    //   modules : [u32 name length][name][u64 size] per module, sorted by load address
+    //   scanned : [u32 count] then [u32 module index][u64 offset][u64 size] per range the results cover
+    //   levels  : oldest undo level first, current results last; each level is
+    //             [i32 iteration][config][u64 record count][u64 raw size][u64 stored size][payload]
+    // Payload records replace the absolute address with [u32 module index][u64 offset];
+    // SCAN_SESSION_ABSOLUTE_MODULE marks addresses outside any module.
+    inline constexpr std::uint32_t SCAN_SESSION_MAGIC{0x53535856};
+    inline constexpr std::uint16_t SCAN_SESSION_VERSION{2};
+    inline constexpr std::uint16_t SCAN_SESSION_BYTE_ORDER_MARK{0xFEFF};
+    inline constexpr std::uint32_t SCAN_SESSION_ABSOLUTE_MODULE{0xFFFFFFFF};
+    inline constexpr std::size_t SCAN_SESSION_MAX_VALUE_SIZE{1024ULL * 1024};
+    inline constexpr std::size_t SCAN_SESSION_IO_CHUNK_SIZE{1024ULL * 1024};
+}
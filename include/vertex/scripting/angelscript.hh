@@ -6,6 +6,7 @@
 #pragma once
 
 #include <vertex/scripting/iangelscript.hh>
+#include <vertex/scripting/stdlib/analysis.hh>
 #include <vertex/scripting/stdlib/io.hh>
 #include <vertex/scripting/stdlib/process.hh>
 #include <vertex/scripting/stdlib/memory.hh>
@@ -151,6 +152,7 @@ namespace Vertex::Scripting
         Stdlib::ScriptProcess m_scriptProcess;
         Stdlib::ScriptMemory m_scriptMemory;
         Stdlib::ScriptUtility m_scriptUtility;
+        Stdlib::ScriptAnalysis m_scriptAnalysis;
         Stdlib::ScriptUI m_scriptUI{};
 
     };
@@ -0,0 +1,101 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+
+#pragma once
+
+#include <vertex/debugger/controlflow.hh>
+#include <vertex/debugger/functiontable.hh>
+#include <vertex/event/eventbus.hh>
+#include <vertex/runtime/iloader.hh>
+#include <vertex/thread/ithreaddispatcher.hh>
+
+#include <sdk/statuscode.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+class asIScriptEngine;
+
+namespace Vertex::Scripting::Stdlib
+{
+    struct ScriptBasicBlock final
+    {
+        std::uint64_t start{};
+        std::uint64_t end{};
+        std::uint32_t instructionCount{};
+        std::int32_t immediateDominator{-1};
+        std::int32_t exit{};
+    };
+
+    struct ScriptFlowEdge final
+    {
+        std::uint32_t from{};
+        std::uint32_t to{};
+        std::int32_t kind{};
+        bool backEdge{};
+    };
+
+    class ScriptAnalysis final
+    {
+    public:
+        ScriptAnalysis(Runtime::ILoader& loader, Event::EventBus& eventBus, Thread::IThreadDispatcher& dispatcher);
+        ~ScriptAnalysis();
+
+        ScriptAnalysis(const ScriptAnalysis&) = delete;
+        ScriptAnalysis& operator=(const ScriptAnalysis&) = delete;
+        ScriptAnalysis(ScriptAnalysis&&) = delete;
+        ScriptAnalysis& operator=(ScriptAnalysis&&) = delete;
+
+        [[nodiscard]] StatusCode register_api(asIScriptEngine& engine);
+
+        // Drops the function tables and graphs of every module overlapping the written or remapped range.
+        void invalidate(std::uint64_t address, std::uint64_t size);
+
+        [[nodiscard]] StatusCode analyze_function(std::uint64_t address);
+        [[nodiscard]] std::uint64_t get_function_start() const;
+        [[nodiscard]] std::uint64_t get_function_end() const;
+
+        [[nodiscard]] std::uint32_t get_block_count() const;
+        [[nodiscard]] ScriptBasicBlock get_block_at(std::uint32_t index) const;
+        [[nodiscard]] std::int32_t get_block_index(std::uint64_t address) const;
+        [[nodiscard]] std::uint32_t get_edge_count() const;
+        [[nodiscard]] ScriptFlowEdge get_edge_at(std::uint32_t index) const;
+        [[nodiscard]] bool block_dominates(std::uint32_t dominator, std::uint32_t block) const;
+
+    private:
+        struct ModuleAnalysis final
+        {
+            std::string path{};
+            std::uint64_t size{};
+            std::shared_ptr<const Debugger::ModuleFunctionTable> functions{};
+            std::shared_ptr<Debugger::ModuleControlFlowCache> graphs{};
+        };
+
+        std::reference_wrapper<Runtime::ILoader> m_loader;
+        std::reference_wrapper<Event::EventBus> m_eventBus;
+        std::reference_wrapper<Thread::IThreadDispatcher> m_dispatcher;
+
+        std::mutex m_modulesMutex{};
+        std::unordered_map<std::uint64_t, ModuleAnalysis> m_modules{};
+
+        mutable std::mutex m_graphMutex{};
+        std::shared_ptr<const Debugger::ControlFlowGraph> m_graph{};
+
+        Event::SubscriptionId m_openSubscriptionId{};
+        Event::SubscriptionId m_closeSubscriptionId{};
+        Event::SubscriptionId m_memoryChangedSubscriptionId{};
+        Event::SubscriptionId m_regionsChangedSubscriptionId{};
+
+        void forget_process();
+
+        [[nodiscard]] static StatusCode register_flow_enums(asIScriptEngine& engine);
+        [[nodiscard]] static StatusCode register_basic_block_type(asIScriptEngine& engine);
+        [[nodiscard]] static StatusCode register_flow_edge_type(asIScriptEngine& engine);
+    };
+}
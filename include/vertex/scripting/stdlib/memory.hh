@@ -54,10 +54,15 @@ namespace Vertex::Scripting::Stdlib
     class ScriptMemory final
     {
     public:
+        using WriteObserver = std::function<void(std::uint64_t address, std::uint64_t size)>;
+
         ScriptMemory(Runtime::ILoader& loader, Thread::IThreadDispatcher& dispatcher);
 
         [[nodiscard]] StatusCode register_api(asIScriptEngine& engine);
 
+        // Called after every successful script write, so caches derived from target memory can drop the range.
+        void set_write_observer(WriteObserver observer);
+
         [[nodiscard]] StatusCode read_memory(std::uint64_t address, std::uint32_t size, std::string& out) const;
         [[nodiscard]] StatusCode write_memory(std::uint64_t address, const std::string& data) const;
 
@@ -79,6 +84,8 @@ namespace Vertex::Scripting::Stdlib
         std::reference_wrapper<Runtime::ILoader> m_loader;
         std::reference_wrapper<Thread::IThreadDispatcher> m_dispatcher;
 
+        WriteObserver m_writeObserver{};
+
         mutable std::mutex m_regionsMutex{};
         std::vector<ScriptMemoryRegion> m_regions{};
 
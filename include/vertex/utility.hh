@@ -193,6 +193,8 @@ namespace Vertex
             ID_ANALYTICS,
             ID_INJECTOR,
             ID_SCRIPTING,
+            ID_EXPORT_SCAN_SESSION,
+            ID_IMPORT_SCAN_SESSION,
         };
     }
 
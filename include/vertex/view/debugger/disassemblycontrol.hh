@@ -148,6 +148,8 @@ namespace Vertex::View::Debugger
         using SelectionChangeCallback = std::function<void(std::uint64_t address)>;
         using ScrollBoundaryCallback = std::function<void(std::uint64_t boundaryAddress, bool isTop)>;
         using ShowInMemoryCallback = std::function<void(std::uint64_t address)>;
+        using FunctionStartCallback = std::function<void(std::uint64_t address)>;
+        using CopySignatureCallback = std::function<void(std::uint64_t address)>;
         using XrefResultHandler = std::function<void(std::vector<::Vertex::Debugger::XrefEntry>)>;
         using XrefQueryCallback = std::function<void(std::uint64_t address,
             ::Vertex::Debugger::XrefDirection direction, XrefResultHandler onResult)>;
@@ -187,6 +189,8 @@ namespace Vertex::View::Debugger
         void set_scroll_boundary_callback(ScrollBoundaryCallback callback);
         void set_show_in_memory_callback(ShowInMemoryCallback callback);
         void set_xref_query_callback(XrefQueryCallback callback);
+        void set_function_start_callback(FunctionStartCallback callback);
+        void set_copy_signature_callback(CopySignatureCallback callback);
 
         void set_extension_result(bool isTop, ::Vertex::Debugger::ExtensionResult result);
 
@@ -271,6 +275,8 @@ namespace Vertex::View::Debugger
         static constexpr int MENU_ID_REMOVE_BREAKPOINT = 1009;
         static constexpr int MENU_ID_EDIT_CONDITION = 1010;
         static constexpr int MENU_ID_SHOW_IN_MEMORY = 1011;
+        static constexpr int MENU_ID_GO_TO_FUNCTION_START = 1012;
+        static constexpr int MENU_ID_COPY_SIGNATURE = 1013;
 
         void load_system_colors();
 
@@ -342,6 +348,8 @@ namespace Vertex::View::Debugger
         ScrollBoundaryCallback m_scrollBoundaryCallback{};
         ShowInMemoryCallback m_showInMemoryCallback{};
         XrefQueryCallback m_xrefQueryCallback{};
+        FunctionStartCallback m_functionStartCallback{};
+        CopySignatureCallback m_copySignatureCallback{};
 
         bool m_fetchingMore{};
         int m_wheelAccumulator{};
@@ -28,6 +28,8 @@ namespace Vertex::View::Debugger
         using ScrollBoundaryCallback = std::function<void(std::uint64_t boundaryAddress, bool isTop)>;
         using ShowInMemoryCallback = std::function<void(std::uint64_t address)>;
         using XrefQueryCallback = DisassemblyControl::XrefQueryCallback;
+        using FunctionStartCallback = DisassemblyControl::FunctionStartCallback;
+        using CopySignatureCallback = DisassemblyControl::CopySignatureCallback;
 
         DisassemblyPanel(
             wxWindow* parent,
@@ -50,6 +52,8 @@ namespace Vertex::View::Debugger
         void set_scroll_boundary_callback(ScrollBoundaryCallback callback);
         void set_show_in_memory_callback(ShowInMemoryCallback callback);
         void set_xref_query_callback(XrefQueryCallback callback);
+        void set_function_start_callback(FunctionStartCallback callback);
+        void set_copy_signature_callback(CopySignatureCallback callback);
 
         [[nodiscard]] std::uint64_t get_selected_address() const;
         [[nodiscard]] DisassemblyHeader* get_header() const { return m_disassemblyHeader; }
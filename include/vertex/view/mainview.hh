@@ -74,6 +74,8 @@ namespace Vertex::View
         void on_memory_region_settings_clicked(wxCommandEvent& event);
 
         void on_open_project(wxCommandEvent& event);
+        void on_export_scan_session(wxCommandEvent& event);
+        void on_import_scan_session(wxCommandEvent& event);
         void on_exit(wxCommandEvent& event);
 
         void on_close(wxCloseEvent& event);
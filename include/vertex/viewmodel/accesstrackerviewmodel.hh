@@ -183,7 +183,9 @@ namespace Vertex::ViewModel
         void notify_entries_changed_shared();
         void marshal_to_ui(std::function<void()> fn);
         void schedule_enrichment_worker();
-        static void run_enrichment_job(AccessTrackerSharedState& state, const EnrichmentJob& job);
+        static void run_enrichment_batch(AccessTrackerSharedState& state, std::span<const EnrichmentJob> jobs);
+        static void run_enrichment_job(AccessTrackerSharedState& state, const EnrichmentJob& job,
+                                       std::optional<Debugger::DisassemblyLine> disassembly);
         static void invoke_completion(TrackingCompletion completion, StatusCode status);
 
         std::string m_viewModelName {};
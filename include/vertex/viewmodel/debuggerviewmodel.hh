@@ -15,6 +15,7 @@
 
 #include <vertex/event/eventbus.hh>
 #include <vertex/event/types/processopenevent.hh>
+#include <vertex/event/types/regionchangeevent.hh>
 #include <vertex/model/debuggermodel.hh>
 #include <vertex/debugger/debuggertypes.hh>
 #include <vertex/debugger/debuggerengine.hh>
@@ -65,6 +66,9 @@ namespace Vertex::ViewModel
 
         void query_xrefs_to(std::uint64_t address, Model::XrefResultCallback callback) const;
         void query_xrefs_from(std::uint64_t address, Model::XrefResultCallback callback) const;
+        void navigate_to_function_start(std::uint64_t address) const;
+        void query_control_flow(std::uint64_t address, Model::ControlFlowCallback callback) const;
+        void generate_signature(std::uint64_t address, Model::SignatureCallback callback) const;
         void load_modules_and_disassemble() const;
 
         void ensure_data_loaded() const;
@@ -151,6 +155,7 @@ namespace Vertex::ViewModel
         void notify_view_update(ViewUpdateFlags flags) const;
         void on_process_opened(const Event::ProcessOpenEvent& event);
         void on_process_closed();
+        void on_regions_changed(const Event::RegionChangeEvent& event) const;
         void on_engine_event(Debugger::DirtyFlags flags, const Debugger::EngineSnapshot& snapshot) const;
 
         std::uint32_t m_selectedStackFrame {};
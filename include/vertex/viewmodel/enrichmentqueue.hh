@@ -12,6 +12,7 @@
 #include <mutex>
 #include <optional>
 #include <unordered_map>
+#include <vector>
 
 namespace Vertex::ViewModel
 {
@@ -28,6 +29,7 @@ namespace Vertex::ViewModel
     public:
         static constexpr std::size_t MAX_PENDING_DISTINCT_PCS {128};
         static constexpr std::size_t MAX_IN_FLIGHT {4};
+        static constexpr std::size_t MAX_BATCH_SIZE {32};
         static constexpr std::chrono::milliseconds DEFAULT_DRAIN_TIMEOUT {std::chrono::seconds{2}};
 
         EnrichmentQueue() = default;
@@ -42,6 +44,9 @@ namespace Vertex::ViewModel
 
         [[nodiscard]] std::optional<EnrichmentJob> pop_next();
 
+        // Takes up to maxJobs of the oldest jobs as one in-flight unit, released by a single complete_job().
+        [[nodiscard]] std::vector<EnrichmentJob> pop_batch(std::size_t maxJobs = MAX_BATCH_SIZE);
+
         void complete_job() noexcept;
 
         [[nodiscard]] bool wait_for_drain(
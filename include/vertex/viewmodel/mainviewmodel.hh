@@ -13,6 +13,8 @@
 #include <atomic>
 #include <mutex>
 #include <optional>
+#include <span>
+#include <filesystem>
 
 #include <vertex/thread/ithreaddispatcher.hh>
 #include <vertex/event/eventbus.hh>
@@ -87,6 +89,8 @@ namespace Vertex::ViewModel
         void initial_scan();
         void next_scan();
         void undo_scan() const;
+        [[nodiscard]] StatusCode export_scan_session(const std::filesystem::path& path) const;
+        [[nodiscard]] StatusCode import_scan_session(const std::filesystem::path& path);
         void update_scan_progress();
         void finalize_scan_results();
         void open_project() const;
@@ -191,6 +195,7 @@ namespace Vertex::ViewModel
         void subscribe_to_events();
         void unsubscribe_from_events() const;
         void update_available_scan_modes();
+        void publish_region_changes();
         void notify_view_update(ViewUpdateFlags flags) const;
         void start_freeze_timer();
         void stop_freeze_timer();
@@ -202,6 +207,8 @@ namespace Vertex::ViewModel
         void reload_type_entries();
         [[nodiscard]] const Scanner::TypeSchema* current_type_entry() const noexcept;
         [[nodiscard]] bool current_type_is_plugin() const noexcept;
+        [[nodiscard]] std::string format_scanned_bytes(std::span<const std::uint8_t> bytes) const;
+        [[nodiscard]] ScannedValue make_scanned_value(const Scanner::ScanResultRecordView& record) const;
 
         bool m_isInitialScanAvailable {};
         bool m_isNextScanAvailable {};
@@ -223,6 +230,7 @@ namespace Vertex::ViewModel
 
         std::uint64_t m_minProcessAddress {};
         std::uint64_t m_maxProcessAddress {};
+        std::atomic<std::uint64_t> m_regionGeneration {};
 
         std::string m_processInformation {};
         std::string m_valueInput {};
@@ -241,8 +249,27 @@ namespace Vertex::ViewModel
         {
             int startIndex {-1};
             int endIndex {-1};
-            std::vector<Scanner::IMemoryScanner::ScanResultEntry> addresses {};
+            Scanner::ScanResultPage page {};
+            Scanner::ScanResultPage sparePage {};
+
+            void reset() noexcept
+            {
+                startIndex = -1;
+                endIndex = -1;
+                page.clear();
+                sparePage.clear();
+            }
         } m_cacheWindow {};
+        mutable Scanner::ScanResultPage m_lookupPage {};
+
+        struct VisibleRefreshScratch final
+        {
+            std::vector<char> values {};
+            std::vector<char> singleValue {};
+            std::vector<std::uint8_t> readOk {};
+            std::vector<Model::BulkReadEntry> bulkEntries {};
+            std::vector<BulkReadResult> bulkResults {};
+        } m_visibleRefresh {};
 
         std::unique_ptr<Model::MainModel> m_model {};
         std::unique_ptr<std::thread> m_freezeTimerThread {};
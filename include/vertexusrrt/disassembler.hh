@@ -7,7 +7,9 @@
 
 #include <sdk/api.h>
 #include <cstdint>
+#include <optional>
 #include <span>
+#include <string_view>
 
 namespace PluginRuntime
 {
@@ -34,6 +36,17 @@ namespace PluginRuntime
         DisassemblerResults* results
     );
 
+    // Fills the records and, for VERTEX_COMPACT_FIELD_TEXT, mnemonic and operand strings of the compact format.
+    [[nodiscard]] StatusCode disassemble_compact(
+        uint64_t address,
+        std::span<const uint8_t> code,
+        CompactDisassembly* results
+    );
+
+    // Appends a NUL-terminated entry to the string table. Empty text maps to VERTEX_COMPACT_NO_STRING;
+    // nullopt means the table is full.
+    [[nodiscard]] std::optional<uint32_t> append_compact_string(CompactDisassembly& results, std::string_view text);
+
     [[nodiscard]] uint32_t disassemble_single(
         uint64_t address,
         std::span<const uint8_t> code,
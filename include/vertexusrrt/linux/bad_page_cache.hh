@@ -0,0 +1,42 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under LGPLv3.0+
+//
+
+#pragma once
+
+#include <vertexusrrt/native_handle.hh>
+
+#include <chrono>
+#include <cstdint>
+#include <shared_mutex>
+#include <unordered_set>
+
+namespace MemoryInternal
+{
+    // Pages a read recently faulted on. Bulk reads consult it so that every other request on a freed
+    // page fails without another syscall. Entries live for one region epoch: the cache is dropped when
+    // the regions are enumerated again, the target changes, or the epoch grows older than EPOCH_LIFETIME.
+    class BadPageCache final
+    {
+    public:
+        static constexpr auto EPOCH_LIFETIME = std::chrono::seconds{1};
+        static constexpr std::size_t MAX_PAGES = 64ULL * 1024;
+
+        void begin_batch(native_handle pid);
+        void invalidate();
+
+        [[nodiscard]] bool touches_bad_page(std::uint64_t address, std::uint64_t size) const;
+        void add(std::uint64_t address);
+
+        [[nodiscard]] static std::uint64_t page_of(std::uint64_t address) noexcept;
+
+    private:
+        mutable std::shared_mutex m_mutex{};
+        native_handle m_pid{INVALID_HANDLE_VALUE};
+        std::chrono::steady_clock::time_point m_epochStart{};
+        std::unordered_set<std::uint64_t> m_pages{};
+    };
+
+    [[nodiscard]] BadPageCache& bad_read_pages();
+}
@@ -0,0 +1,53 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under LGPLv3.0+
+//
+
+#pragma once
+
+#include <vertexusrrt/native_handle.hh>
+
+#include <sdk/api.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ProcessInternal
+{
+    struct ElfSymbol final
+    {
+        std::string name{};
+        std::uint64_t value{};
+        std::uint64_t size{};
+        std::uint32_t index{};
+        std::uint16_t sectionIndex{};
+        std::uint8_t type{};
+        std::uint8_t bind{};
+        std::uint8_t visibility{};
+        bool dynamic{};
+    };
+
+    struct ElfImport final
+    {
+        std::string name{};
+        std::uint64_t offset{};
+        std::uint32_t symbolIndex{};
+        std::uint8_t type{};
+    };
+
+    struct ElfModuleSymbols final
+    {
+        std::string buildId{};
+        std::vector<ElfSymbol> symbols{};
+        std::vector<ElfImport> imports{};
+        std::vector<std::string> neededLibraries{};
+    };
+
+    // Parses .symtab, .dynsym, the PLT relocations and DT_NEEDED of the file backing module. The file is
+    // mapped through /proc/pid/map_files when permitted, otherwise through the module path. Results are
+    // kept in memory and under the user cache directory keyed by GNU build-id, so attaching to the same
+    // binaries again skips parsing. Returns nullptr when no backing file can be read.
+    [[nodiscard]] std::shared_ptr<const ElfModuleSymbols> load_elf_symbols(native_handle pid, const ModuleInformation& module);
+}
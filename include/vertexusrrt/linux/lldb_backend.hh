@@ -68,4 +68,10 @@ namespace Debugger
     void terminate_lldb();
 
     [[nodiscard]] LldbBackendState& get_backend_state();
+
+    // Writes the registers of frame whose RegisterCategory bit is set in categoryMask, at most capacity of them.
+    // flagsRegister receives the first flags register seen if it is still zero.
+    [[nodiscard]] std::uint32_t collect_registers(lldb::SBFrame& frame, std::uint32_t categoryMask, Register* out, std::uint32_t capacity,
+                                                  std::uint64_t& flagsRegister);
+    void fill_stack_frame(lldb::SBFrame& frame, std::uint32_t frameIndex, StackFrame& out);
 }
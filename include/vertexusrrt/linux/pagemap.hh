@@ -0,0 +1,38 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under LGPLv3.0+
+//
+
+#pragma once
+
+#include <vertexusrrt/native_handle.hh>
+
+#include <sdk/statuscode.h>
+
+#include <cstdint>
+#include <span>
+
+namespace Pagemap
+{
+    inline constexpr std::uint64_t ENTRY_PRESENT = 1ULL << 63;
+    inline constexpr std::uint64_t ENTRY_SWAPPED = 1ULL << 62;
+    inline constexpr std::uint64_t ENTRY_SOFT_DIRTY = 1ULL << 55;
+
+    [[nodiscard]] std::uint64_t page_size() noexcept;
+
+    // Fills one /proc/pid/pagemap entry per page starting at firstPage. Entries past the end of the
+    // address space read as zero.
+    [[nodiscard]] StatusCode read_entries(native_handle pid, std::uint64_t firstPage, std::span<std::uint64_t> entries);
+
+    // Sets bit i of bitmap (LSB first) when the pagemap entry of page (address / page_size()) + i has any
+    // bit of mask set, or with markAbsent also when the page is neither present nor swapped. bitmapSize must
+    // cover every page touched by [address, address + size).
+    [[nodiscard]] StatusCode fill_bitmap(native_handle pid, std::uint64_t address, std::uint64_t size, std::uint64_t mask, std::uint8_t* bitmap, std::uint64_t bitmapSize,
+                                         bool markAbsent = false);
+
+    // Writes "4" to /proc/pid/clear_refs, which clears the soft-dirty bit of every page of the target.
+    [[nodiscard]] StatusCode clear_soft_dirty(native_handle pid);
+
+    // True when the kernel actually maintains the soft-dirty bit; probed once on a private page.
+    [[nodiscard]] bool soft_dirty_supported();
+}
@@ -0,0 +1,43 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under LGPLv3.0+
+//
+
+#pragma once
+
+#include <vertexusrrt/native_handle.hh>
+
+#include <cstdint>
+#include <shared_mutex>
+
+#include <sys/types.h>
+#include <sys/uio.h>
+
+namespace MemoryInternal
+{
+    // One read-write /proc/pid/mem descriptor shared by every write path. It is opened on first use,
+    // reopened when the target changes and closed together with the process handle. Writes through it
+    // ignore page protection, so they reach read-only code pages that process_vm_writev cannot.
+    class ProcMemFile final
+    {
+    public:
+        ProcMemFile() = default;
+        ~ProcMemFile();
+
+        ProcMemFile(const ProcMemFile&) = delete;
+        ProcMemFile& operator=(const ProcMemFile&) = delete;
+
+        // Same contract as pwritev(2): bytes written, or -1 with errno set.
+        [[nodiscard]] ssize_t write(native_handle pid, const iovec* iovs, int count, std::uint64_t address);
+        void close();
+
+    private:
+        [[nodiscard]] bool open_for(native_handle pid);
+
+        std::shared_mutex m_mutex{};
+        native_handle m_pid{INVALID_HANDLE_VALUE};
+        int m_fd{-1};
+    };
+
+    [[nodiscard]] ProcMemFile& proc_mem_file();
+}
@@ -0,0 +1,92 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under LGPLv3.0+
+//
+
+#pragma once
+
+#include <vertexusrrt/native_handle.hh>
+
+#include <sdk/api.h>
+
+#include <cstdint>
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace MemoryInternal
+{
+    struct MapsEntry final
+    {
+        std::uint64_t start{};
+        std::uint64_t end{};
+        bool readable{};
+        bool writable{};
+        bool executable{};
+        bool isPrivate{};
+        bool isFileBacked{};
+        // No backing object at all: an unnamed mapping, the heap or a stack.
+        bool isAnonymous{};
+        std::uint64_t offset{};
+        std::string path{};
+
+        [[nodiscard]] bool same_permissions(const MapsEntry& other) const
+        {
+            return writable == other.writable
+                && executable == other.executable
+                && isPrivate == other.isPrivate
+                && isFileBacked == other.isFileBacked;
+        }
+
+        [[nodiscard]] std::uint32_t protection() const;
+    };
+
+    // Appends one entry per well-formed line of /proc/pid/maps text. Malformed lines are skipped.
+    void parse_maps(std::string_view text, std::vector<MapsEntry>& entries);
+
+    // Cached view of /proc/pid/maps. Every refresh reads the file in one go, parses it in place and records
+    // how the mappings moved since the previous refresh, so callers can follow the address space through
+    // changes_since() instead of enumerating it again.
+    class RegionMap final
+    {
+    public:
+        static constexpr std::size_t MAX_CHANGE_HISTORY = 64ULL * 1024;
+
+        [[nodiscard]] StatusCode refresh(native_handle pid);
+        void reset();
+
+        [[nodiscard]] bool tracks(native_handle pid) const;
+
+        // Fills changes with everything recorded after generation. A generation of zero, one from another
+        // target, or one older than the retained history yields VERTEX_REGION_RESET and the full map.
+        void changes_since(std::uint64_t generation, std::vector<RegionChange>& changes, std::uint64_t& current) const;
+
+        template <class Visitor>
+        void visit(Visitor&& visitor) const
+        {
+            std::shared_lock lock(m_mutex);
+            visitor(m_entries);
+        }
+
+    private:
+        struct RecordedChange final
+        {
+            std::uint64_t generation{};
+            RegionChange change{};
+        };
+
+        void record(const MapsEntry& entry, RegionChangeKind kind, std::uint64_t generation);
+        void diff_against(const std::vector<MapsEntry>& next);
+
+        mutable std::shared_mutex m_mutex{};
+        native_handle m_pid{INVALID_HANDLE_VALUE};
+        std::vector<MapsEntry> m_entries{};
+        std::deque<RecordedChange> m_history{};
+        std::uint64_t m_generation{};
+        std::uint64_t m_historyFloor{};
+    };
+
+    [[nodiscard]] RegionMap& region_map();
+}
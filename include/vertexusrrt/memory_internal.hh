@@ -9,6 +9,7 @@
 
 #include <sdk/api.h>
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <filesystem>
@@ -22,9 +23,7 @@
 #endif
 #include <tlhelp32.h>
 #else
-#include <charconv>
-#include <format>
-#include <fstream>
+#include <vertexusrrt/linux/region_map.hh>
 #endif
 
 namespace MemoryInternal
@@ -131,91 +130,24 @@ namespace MemoryInternal
             }
 
             CloseHandle(snapshot);
+            std::ranges::sort(baseToNameIndex);
         }
 #else
-        void build(native_handle pid)
+        // Maps entries arrive sorted by address, so the index stays sorted for find().
+        void build(const std::vector<MapsEntry>& entries)
         {
             nameStorage.clear();
             baseToNameIndex.clear();
 
-            if (pid == INVALID_HANDLE_VALUE)
+            for (const auto& entry : entries)
             {
-                return;
-            }
-
-            const auto mapsPath = std::format("/proc/{}/maps", pid);
-            std::ifstream mapsFile{mapsPath};
-            if (!mapsFile)
-            {
-                return;
-            }
-
-            std::string line{};
-            while (std::getline(mapsFile, line))
-            {
-                std::string_view sv{line};
-
-                const auto dashPos = sv.find('-');
-                if (dashPos == std::string_view::npos)
+                if (entry.offset != 0 || !entry.isFileBacked)
                 {
                     continue;
                 }
 
-                std::uint64_t start{};
-                std::from_chars(sv.data(), sv.data() + dashPos, start, 16);
-                sv.remove_prefix(dashPos + 1);
-
-                const auto spacePos = sv.find(' ');
-                if (spacePos == std::string_view::npos)
-                {
-                    continue;
-                }
-                sv.remove_prefix(spacePos + 1);
-
-                const auto permsEnd = sv.find(' ');
-                if (permsEnd == std::string_view::npos)
-                {
-                    continue;
-                }
-                sv.remove_prefix(permsEnd + 1);
-
-                const auto offsetEnd = sv.find(' ');
-                if (offsetEnd == std::string_view::npos)
-                {
-                    continue;
-                }
-
-                std::uint64_t offset{};
-                std::from_chars(sv.data(), sv.data() + offsetEnd, offset, 16);
-
-                if (offset != 0)
-                {
-                    continue;
-                }
-
-                sv.remove_prefix(offsetEnd + 1);
-
-                for (int i = 0; i < 2; ++i)
-                {
-                    const auto nextSpace = sv.find(' ');
-                    if (nextSpace == std::string_view::npos)
-                    {
-                        break;
-                    }
-                    sv.remove_prefix(nextSpace + 1);
-                    while (!sv.empty() && sv.front() == ' ')
-                    {
-                        sv.remove_prefix(1);
-                    }
-                }
-
-                if (sv.empty() || sv.front() == '[')
-                {
-                    continue;
-                }
-
-                auto moduleName = std::filesystem::path{std::string{sv}}.filename().string();
-                baseToNameIndex.emplace_back(start, nameStorage.size());
+                auto moduleName = std::filesystem::path{entry.path}.filename().string();
+                baseToNameIndex.emplace_back(entry.start, nameStorage.size());
                 nameStorage.push_back(std::move(moduleName));
             }
         }
@@ -223,14 +155,12 @@ namespace MemoryInternal
 
         [[nodiscard]] const char* find(const std::uint64_t allocationBase) const
         {
-            for (const auto& [base, index] : baseToNameIndex)
+            const auto it = std::ranges::lower_bound(baseToNameIndex, allocationBase, {}, &std::pair<std::uint64_t, std::size_t>::first);
+            if (it == baseToNameIndex.end() || it->first != allocationBase)
             {
-                if (base == allocationBase)
-                {
-                    return nameStorage[index].c_str();
-                }
+                return nullptr;
             }
-            return nullptr;
+            return nameStorage[it->second].c_str();
         }
     };
 
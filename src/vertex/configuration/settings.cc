@@ -191,7 +191,20 @@ namespace Vertex::Configuration
         }
 
         const int maxUndoDepth = get_int("memoryScan.maxUndoDepth", 3);
-        return maxUndoDepth >= 1 && maxUndoDepth <= 10;
+        if (maxUndoDepth < 1 || maxUndoDepth > 10)
+        {
+            return false;
+        }
+
+        const int diskBudgetMB = get_int("memoryScan.diskBudgetMB", 0);
+        const int memoryBudgetMB = get_int("memoryScan.memoryBudgetMB", 0);
+        if (diskBudgetMB < 0 || memoryBudgetMB < 0)
+        {
+            return false;
+        }
+
+        const int budgetPolicy = get_int("memoryScan.budgetPolicy", 0);
+        return budgetPolicy >= 0 && budgetPolicy <= 1;
     }
 
     bool Settings::get_bool(const std::string& key, bool defaultValue) const
@@ -288,7 +301,14 @@ namespace Vertex::Configuration
         m_settings["memoryScan"]["readerThreads"] = std::clamp(hardwareConcurrency / 2, 1, 8);
         m_settings["memoryScan"]["threadBufferSizeMB"] = 8;
         m_settings["memoryScan"]["workerChunkSizeMB"] = 8;
+        m_settings["memoryScan"]["hugePageBuffers"] = true;
+        m_settings["memoryScan"]["softDirtyTracking"] = false;
+        m_settings["memoryScan"]["skipNonResidentPages"] = false;
+        m_settings["memoryScan"]["asyncReadDepth"] = 0;
         m_settings["memoryScan"]["maxUndoDepth"] = 3;
+        m_settings["memoryScan"]["diskBudgetMB"] = 0;
+        m_settings["memoryScan"]["memoryBudgetMB"] = 0;
+        m_settings["memoryScan"]["budgetPolicy"] = 0;
 
         set_default_language();
 
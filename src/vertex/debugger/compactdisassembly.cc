@@ -0,0 +1,188 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <vertex/debugger/compactdisassembly.hh>
+#include <vertex/runtime/caller.hh>
+#include <vertex/runtime/plugin.hh>
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+namespace Vertex::Debugger
+{
+    namespace
+    {
+        [[nodiscard]] std::optional<std::uint32_t> append_string(::CompactDisassembly& results, const std::string_view text)
+        {
+            if (text.empty())
+            {
+                return VERTEX_COMPACT_NO_STRING;
+            }
+            if (results.stringCapacity - results.stringSize <= text.size())
+            {
+                return std::nullopt;
+            }
+
+            const auto offset = results.stringSize;
+            std::memcpy(results.strings + offset, text.data(), text.size());
+            results.strings[offset + text.size()] = '\0';
+            results.stringSize += static_cast<std::uint32_t>(text.size() + 1);
+            return offset;
+        }
+
+        [[nodiscard]] std::string_view bounded(const char* text, const std::size_t capacity)
+        {
+            return {text, ::strnlen(text, capacity)};
+        }
+
+        // Returns false when a requested string does not fit; the record is then left out.
+        [[nodiscard]] bool to_compact(const ::DisassemblerResult& instr, ::CompactDisassembly& results, ::CompactInstruction& record)
+        {
+            record.address = instr.address;
+            record.targetAddress = instr.targetAddress;
+            record.dataAddress = instr.dataAddress;
+            record.functionStart = instr.functionStart;
+            record.flags = instr.flags;
+            record.size = static_cast<std::uint8_t>(instr.size);
+            record.category = static_cast<std::uint8_t>(instr.category);
+            record.branchType = static_cast<std::uint8_t>(instr.branchType);
+            record.branchDirection = static_cast<std::uint8_t>(instr.branchDirection);
+            record.dataAccess = instr.dataAccess;
+            record.dataSize = instr.dataSize;
+            record.reserved0 = 0;
+            std::ranges::copy(instr.rawBytes, record.rawBytes);
+
+            const auto pick = [&results](const std::uint32_t field, const char* text, const std::size_t capacity) -> std::optional<std::uint32_t>
+            {
+                return (results.fields & field) != 0 ? append_string(results, bounded(text, capacity)) : VERTEX_COMPACT_NO_STRING;
+            };
+
+            const auto mark = results.stringSize;
+            const auto mnemonic = pick(VERTEX_COMPACT_FIELD_TEXT, instr.mnemonic, VERTEX_MAX_MNEMONIC_LENGTH);
+            const auto operands = pick(VERTEX_COMPACT_FIELD_TEXT, instr.operands, VERTEX_MAX_OPERANDS_LENGTH);
+            const auto comment = pick(VERTEX_COMPACT_FIELD_COMMENT, instr.comment, VERTEX_MAX_COMMENT_LENGTH);
+            const auto targetSymbol = pick(VERTEX_COMPACT_FIELD_TARGET_SYMBOL, instr.targetSymbol, VERTEX_MAX_SYMBOL_LENGTH);
+            const auto sectionName = pick(VERTEX_COMPACT_FIELD_SECTION, instr.sectionName, VERTEX_MAX_SECTION_LENGTH);
+            if (!mnemonic || !operands || !comment || !targetSymbol || !sectionName)
+            {
+                results.stringSize = mark;
+                return false;
+            }
+
+            record.mnemonic = *mnemonic;
+            record.operands = *operands;
+            record.comment = *comment;
+            record.targetSymbol = *targetSymbol;
+            record.sectionName = *sectionName;
+            return true;
+        }
+    }
+
+    CompactDisassemblyBuffer::CompactDisassemblyBuffer(const std::size_t capacity, const std::uint32_t fields, const std::size_t stringCapacity)
+        : m_instructions(std::make_unique_for_overwrite<::CompactInstruction[]>(capacity)),
+          m_strings(stringCapacity > 0 ? std::make_unique_for_overwrite<char[]>(stringCapacity) : nullptr)
+    {
+        m_descriptor.version = VERTEX_COMPACT_DISASSEMBLY_VERSION;
+        m_descriptor.fields = fields;
+        m_descriptor.instructions = m_instructions.get();
+        m_descriptor.capacity = static_cast<std::uint32_t>(capacity);
+        m_descriptor.strings = m_strings.get();
+        m_descriptor.stringCapacity = static_cast<std::uint32_t>(stringCapacity);
+    }
+
+    ::CompactDisassembly* CompactDisassemblyBuffer::prepare() noexcept
+    {
+        m_descriptor.count = 0;
+        m_descriptor.stringSize = 0;
+        m_descriptor.startAddress = 0;
+        m_descriptor.endAddress = 0;
+        return &m_descriptor;
+    }
+
+    std::span<const ::CompactInstruction> CompactDisassemblyBuffer::instructions() const noexcept
+    {
+        return {m_descriptor.instructions, std::min(m_descriptor.count, m_descriptor.capacity)};
+    }
+
+    std::string_view CompactDisassemblyBuffer::string_at(const std::uint32_t offset) const noexcept
+    {
+        return compact_string(m_descriptor, offset);
+    }
+
+    std::string_view compact_string(const ::CompactDisassembly& results, const std::uint32_t offset) noexcept
+    {
+        const auto used = std::min(results.stringSize, results.stringCapacity);
+        if (offset == VERTEX_COMPACT_NO_STRING || offset >= used || !results.strings)
+        {
+            return {};
+        }
+        return bounded(results.strings + offset, used - offset);
+    }
+
+    StatusCode disassemble_compact_from_legacy(const LegacyDisassembler& legacy, const std::uint64_t address,
+                                               const std::uint32_t size, ::CompactDisassembly* results)
+    {
+        if (!legacy || !results || (!results->instructions && results->capacity > 0))
+        {
+            return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        thread_local std::vector<::DisassemblerResult> scratch {};
+        if (scratch.size() < results->capacity)
+        {
+            scratch.resize(results->capacity);
+        }
+
+        ::DisassemblerResults legacyResults {};
+        legacyResults.results = scratch.data();
+        legacyResults.capacity = results->capacity;
+        legacyResults.startAddress = address;
+
+        results->count = 0;
+        results->stringSize = 0;
+        results->startAddress = address;
+        results->endAddress = address;
+
+        if (const auto status = legacy(address, size, &legacyResults); status != StatusCode::STATUS_OK)
+        {
+            return status;
+        }
+
+        for (const auto& instr : std::span {scratch.data(), std::min(legacyResults.count, results->capacity)})
+        {
+            if (!to_compact(instr, *results, results->instructions[results->count]))
+            {
+                break;
+            }
+            results->endAddress = instr.address + instr.size;
+            ++results->count;
+        }
+        return StatusCode::STATUS_OK;
+    }
+
+    XrefDisassembler plugin_disassembler(Runtime::Plugin& plugin)
+    {
+        if (plugin.internal_vertex_process_disassemble_range_compact != nullptr)
+        {
+            return [&plugin](const std::uint64_t address, const std::uint32_t size, ::CompactDisassembly* results)
+            {
+                return Runtime::get_status(Runtime::safe_call(
+                    plugin.internal_vertex_process_disassemble_range_compact, address, size, results));
+            };
+        }
+
+        return [&plugin](const std::uint64_t address, const std::uint32_t size, ::CompactDisassembly* results)
+        {
+            return disassemble_compact_from_legacy(
+                [&plugin](const std::uint64_t start, const std::uint32_t length, ::DisassemblerResults* legacyResults)
+                {
+                    return Runtime::get_status(Runtime::safe_call(
+                        plugin.internal_vertex_process_disassemble_range, start, length, legacyResults));
+                },
+                address, size, results);
+        };
+    }
+}
@@ -0,0 +1,560 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <vertex/debugger/controlflow.hh>
+
+#include <sdk/disassembler.h>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace Vertex::Debugger
+{
+    namespace
+    {
+        // Open-ended ranges from prologue heuristics can span a whole code section; anything past this is
+        // left out of the graph and the graph is flagged as truncated.
+        constexpr std::uint64_t MAX_FUNCTION_BYTES = 4 * 1024 * 1024;
+        constexpr std::uint32_t DECODE_CHUNK_BYTES = 4096;
+        constexpr std::size_t DECODE_CHUNK_INSTRUCTIONS = 512;
+
+        [[nodiscard]] bool is_conditional(const ::BranchType branchType)
+        {
+            return branchType == VERTEX_BRANCH_CONDITIONAL || branchType == VERTEX_BRANCH_LOOP;
+        }
+
+        [[nodiscard]] bool ends_block(const ::BranchType branchType)
+        {
+            switch (branchType)
+            {
+                case VERTEX_BRANCH_UNCONDITIONAL:
+                case VERTEX_BRANCH_CONDITIONAL:
+                case VERTEX_BRANCH_RETURN:
+                case VERTEX_BRANCH_LOOP:
+                case VERTEX_BRANCH_EXCEPTION:
+                case VERTEX_BRANCH_INDIRECT_JUMP:
+                case VERTEX_BRANCH_TABLE_SWITCH:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+    }
+
+    std::shared_ptr<const ControlFlowGraph> ControlFlowGraph::build(const FunctionRange& function,
+                                                                    const std::span<const FlowInstruction> instructions)
+    {
+        if (std::ranges::is_sorted(instructions, {}, &FlowInstruction::address))
+        {
+            return assemble(function, instructions);
+        }
+
+        std::vector<FlowInstruction> sorted(instructions.begin(), instructions.end());
+        std::ranges::sort(sorted, {}, &FlowInstruction::address);
+        return assemble(function, sorted);
+    }
+
+    std::shared_ptr<const ControlFlowGraph> ControlFlowGraph::build(const FunctionRange& function, const XrefDisassembler& disassemble)
+    {
+        const auto end = function.end > function.start
+            ? std::min(function.end, function.start + MAX_FUNCTION_BYTES)
+            : function.start;
+
+        std::vector<FlowInstruction> instructions {};
+        CompactDisassemblyBuffer buffer {DECODE_CHUNK_INSTRUCTIONS};
+        bool truncated = function.end > end;
+
+        auto cursor = function.start;
+        while (disassemble && cursor < end)
+        {
+            const auto chunkSize = static_cast<std::uint32_t>(std::min<std::uint64_t>(DECODE_CHUNK_BYTES, end - cursor));
+            const auto status = disassemble(cursor, chunkSize, buffer.prepare());
+            const auto decoded = buffer.instructions();
+            if (status != StatusCode::STATUS_OK || decoded.empty())
+            {
+                truncated = true;
+                break;
+            }
+
+            for (const auto& instr : decoded)
+            {
+                if (instr.address >= end || instr.size == 0)
+                {
+                    break;
+                }
+                if (instr.address < cursor)
+                {
+                    continue;
+                }
+
+                instructions.push_back({
+                    .address = instr.address,
+                    .targetAddress = instr.targetAddress,
+                    .size = instr.size,
+                    .branchType = static_cast<::BranchType>(instr.branchType)
+                });
+            }
+
+            const auto& lastInstr = decoded.back();
+            const auto nextAddress = lastInstr.address + lastInstr.size;
+            if (nextAddress <= cursor)
+            {
+                truncated = true;
+                break;
+            }
+            cursor = nextAddress;
+        }
+
+        auto graph = assemble(function, instructions);
+        graph->m_truncated = truncated;
+        return graph;
+    }
+
+    std::shared_ptr<ControlFlowGraph> ControlFlowGraph::assemble(const FunctionRange& function,
+                                                                 const std::span<const FlowInstruction> instructions)
+    {
+        auto graph = std::make_shared<ControlFlowGraph>();
+        graph->m_function = function;
+
+        if (instructions.empty() || instructions.front().address != function.start)
+        {
+            graph->m_successorOffsets.assign(1, 0);
+            graph->m_predecessorOffsets.assign(1, 0);
+            return graph;
+        }
+
+        const auto count = static_cast<std::uint32_t>(instructions.size());
+
+        const auto index_of = [&](const std::uint64_t address) -> std::uint32_t
+        {
+            if (address < function.start || address >= function.end)
+            {
+                return NO_BLOCK;
+            }
+            const auto it = std::ranges::lower_bound(instructions, address, {}, &FlowInstruction::address);
+            return it != instructions.end() && it->address == address
+                ? static_cast<std::uint32_t>(it - instructions.begin())
+                : NO_BLOCK;
+        };
+
+        const auto next_of = [&](const std::uint32_t i) -> std::uint32_t
+        {
+            const auto& instr = instructions[i];
+            return i + 1 < count && instr.size != 0 && instructions[i + 1].address == instr.address + instr.size
+                ? i + 1
+                : NO_BLOCK;
+        };
+
+        // Walk everything reachable from the entry, marking where blocks must begin. Bytes the sweep decoded
+        // that no path reaches (alignment padding, embedded data, misdecodes) never become blocks.
+        std::vector<std::uint8_t> leader(count);
+        std::vector<std::uint8_t> reached(count);
+        std::vector<std::uint32_t> work {0};
+        leader[0] = 1;
+
+        while (!work.empty())
+        {
+            auto i = work.back();
+            work.pop_back();
+
+            while (i != NO_BLOCK && !reached[i])
+            {
+                reached[i] = 1;
+                const auto& instr = instructions[i];
+                const auto target = index_of(instr.targetAddress);
+
+                if (is_conditional(instr.branchType) || instr.branchType == VERTEX_BRANCH_UNCONDITIONAL)
+                {
+                    if (target != NO_BLOCK)
+                    {
+                        leader[target] = 1;
+                        work.push_back(target);
+                    }
+                    if (const auto next = next_of(i); next != NO_BLOCK && is_conditional(instr.branchType))
+                    {
+                        leader[next] = 1;
+                        work.push_back(next);
+                    }
+                    break;
+                }
+
+                if (ends_block(instr.branchType))
+                {
+                    break;
+                }
+
+                const auto next = next_of(i);
+                if (next != NO_BLOCK && reached[next])
+                {
+                    leader[next] = 1;
+                }
+                i = next;
+            }
+        }
+
+        std::vector<std::uint32_t> blockOf(count, NO_BLOCK);
+        std::vector<std::uint32_t> lastOf {};
+
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            if (!reached[i])
+            {
+                continue;
+            }
+
+            const auto& instr = instructions[i];
+            const bool continues = i > 0 && !leader[i] && reached[i - 1] && next_of(i - 1) == i &&
+                                   !ends_block(instructions[i - 1].branchType);
+            if (!continues)
+            {
+                graph->m_blocks.push_back({.start = instr.address, .end = instr.address});
+                lastOf.push_back(i);
+            }
+
+            auto& block = graph->m_blocks.back();
+            block.end = instr.address + instr.size;
+            ++block.instructionCount;
+            blockOf[i] = static_cast<std::uint32_t>(graph->m_blocks.size() - 1);
+            lastOf.back() = i;
+            ++graph->m_instructionCount;
+        }
+
+        const auto blockCount = static_cast<std::uint32_t>(graph->m_blocks.size());
+        graph->m_successorOffsets.reserve(blockCount + 1);
+
+        for (std::uint32_t b = 0; b < blockCount; ++b)
+        {
+            graph->m_successorOffsets.push_back(static_cast<std::uint32_t>(graph->m_edges.size()));
+
+            const auto i = lastOf[b];
+            const auto& instr = instructions[i];
+            const auto target = index_of(instr.targetAddress);
+            const auto next = next_of(i);
+            const auto nextBlock = next != NO_BLOCK && reached[next] ? blockOf[next] : NO_BLOCK;
+            auto& block = graph->m_blocks[b];
+
+            const auto add_edge = [&](const std::uint32_t to, const FlowEdgeKind kind)
+            {
+                graph->m_edges.push_back({.from = b, .to = to, .kind = kind});
+            };
+
+            if (is_conditional(instr.branchType))
+            {
+                block.exit = BlockExit::Conditional;
+                if (target != NO_BLOCK)
+                {
+                    add_edge(blockOf[target], FlowEdgeKind::Taken);
+                }
+                if (nextBlock != NO_BLOCK)
+                {
+                    add_edge(nextBlock, FlowEdgeKind::NotTaken);
+                }
+                continue;
+            }
+
+            switch (instr.branchType)
+            {
+                case VERTEX_BRANCH_UNCONDITIONAL:
+                    if (target != NO_BLOCK)
+                    {
+                        block.exit = BlockExit::Jump;
+                        add_edge(blockOf[target], FlowEdgeKind::Jump);
+                    }
+                    else
+                    {
+                        const bool leavesFunction = instr.targetAddress < function.start || instr.targetAddress >= function.end;
+                        block.exit = leavesFunction ? BlockExit::TailCall : BlockExit::Jump;
+                    }
+                    break;
+                case VERTEX_BRANCH_RETURN:
+                    block.exit = BlockExit::Return;
+                    break;
+                case VERTEX_BRANCH_INDIRECT_JUMP:
+                case VERTEX_BRANCH_TABLE_SWITCH:
+                    block.exit = BlockExit::IndirectJump;
+                    break;
+                case VERTEX_BRANCH_EXCEPTION:
+                    block.exit = BlockExit::Halt;
+                    break;
+                default:
+                    if (nextBlock != NO_BLOCK)
+                    {
+                        block.exit = BlockExit::FallThrough;
+                        add_edge(nextBlock, FlowEdgeKind::FallThrough);
+                    }
+                    else
+                    {
+                        block.exit = BlockExit::Halt;
+                    }
+                    break;
+            }
+        }
+        graph->m_successorOffsets.push_back(static_cast<std::uint32_t>(graph->m_edges.size()));
+
+        const auto successors_of = [&](const std::uint32_t b)
+        {
+            return std::span {graph->m_edges}.subspan(graph->m_successorOffsets[b],
+                                                      graph->m_successorOffsets[b + 1] - graph->m_successorOffsets[b]);
+        };
+
+        // Reverse postorder over the successors, which is the visiting order the dominator iteration wants.
+        std::vector<std::uint32_t> postorder {};
+        postorder.reserve(blockCount);
+        {
+            std::vector<std::uint8_t> seen(blockCount);
+            std::vector<std::pair<std::uint32_t, std::uint32_t>> stack {{0, 0}};
+            seen[0] = 1;
+            while (!stack.empty())
+            {
+                auto& [block, nextEdge] = stack.back();
+                const auto out = successors_of(block);
+                if (nextEdge < out.size())
+                {
+                    const auto to = out[nextEdge++].to;
+                    if (!seen[to])
+                    {
+                        seen[to] = 1;
+                        stack.emplace_back(to, 0);
+                    }
+                    continue;
+                }
+                postorder.push_back(block);
+                stack.pop_back();
+            }
+        }
+
+        std::vector<std::uint32_t> order(blockCount, NO_BLOCK);
+        for (std::uint32_t k = 0; k < postorder.size(); ++k)
+        {
+            order[postorder[k]] = k;
+        }
+
+        graph->m_predecessors = graph->m_edges;
+        std::ranges::stable_sort(graph->m_predecessors, {}, &FlowEdge::to);
+        graph->m_predecessorOffsets.assign(blockCount + 1, 0);
+        for (const auto& edge : graph->m_predecessors)
+        {
+            ++graph->m_predecessorOffsets[edge.to + 1];
+        }
+        for (std::uint32_t b = 0; b < blockCount; ++b)
+        {
+            graph->m_predecessorOffsets[b + 1] += graph->m_predecessorOffsets[b];
+        }
+
+        // Cooper, Harvey and Kennedy's iterative scheme: blocks higher in postorder are closer to the entry.
+        std::vector<std::uint32_t> idom(blockCount, NO_BLOCK);
+        idom[0] = 0;
+
+        const auto intersect = [&](std::uint32_t lhs, std::uint32_t rhs)
+        {
+            while (lhs != rhs)
+            {
+                while (order[lhs] < order[rhs])
+                {
+                    lhs = idom[lhs];
+                }
+                while (order[rhs] < order[lhs])
+                {
+                    rhs = idom[rhs];
+                }
+            }
+            return lhs;
+        };
+
+        for (bool changed = true; changed;)
+        {
+            changed = false;
+            for (auto it = postorder.rbegin(); it != postorder.rend(); ++it)
+            {
+                const auto block = *it;
+                if (block == 0)
+                {
+                    continue;
+                }
+
+                auto newIdom = NO_BLOCK;
+                for (const auto& edge : graph->predecessors(block))
+                {
+                    if (idom[edge.from] == NO_BLOCK)
+                    {
+                        continue;
+                    }
+                    newIdom = newIdom == NO_BLOCK ? edge.from : intersect(edge.from, newIdom);
+                }
+
+                if (newIdom != idom[block])
+                {
+                    idom[block] = newIdom;
+                    changed = true;
+                }
+            }
+        }
+
+        // Number the dominator tree once so dominance is an interval check instead of an idom-chain walk.
+        std::vector<std::uint32_t> childOffsets(blockCount + 1, 0);
+        std::vector<std::uint32_t> children(blockCount);
+        for (std::uint32_t b = 1; b < blockCount; ++b)
+        {
+            graph->m_blocks[b].immediateDominator = idom[b];
+            if (idom[b] != NO_BLOCK)
+            {
+                ++childOffsets[idom[b] + 1];
+            }
+        }
+        graph->m_blocks[0].immediateDominator = NO_BLOCK;
+        for (std::uint32_t b = 0; b < blockCount; ++b)
+        {
+            childOffsets[b + 1] += childOffsets[b];
+        }
+        {
+            auto cursor = childOffsets;
+            for (std::uint32_t b = 1; b < blockCount; ++b)
+            {
+                if (idom[b] != NO_BLOCK)
+                {
+                    children[cursor[idom[b]]++] = b;
+                }
+            }
+        }
+
+        graph->m_dominatorPreorder.assign(blockCount, NO_BLOCK);
+        graph->m_dominatorPostorder.assign(blockCount, NO_BLOCK);
+        {
+            std::uint32_t preCounter {};
+            std::uint32_t postCounter {};
+            std::vector<std::pair<std::uint32_t, std::uint32_t>> stack {{0, childOffsets[0]}};
+            graph->m_dominatorPreorder[0] = preCounter++;
+            while (!stack.empty())
+            {
+                auto& [block, nextChild] = stack.back();
+                if (nextChild < childOffsets[block + 1])
+                {
+                    const auto child = children[nextChild++];
+                    graph->m_dominatorPreorder[child] = preCounter++;
+                    stack.emplace_back(child, childOffsets[child]);
+                    continue;
+                }
+                graph->m_dominatorPostorder[block] = postCounter++;
+                stack.pop_back();
+            }
+        }
+
+        for (auto& edge : graph->m_edges)
+        {
+            edge.backEdge = graph->dominates(edge.to, edge.from);
+        }
+        for (auto& edge : graph->m_predecessors)
+        {
+            edge.backEdge = graph->dominates(edge.to, edge.from);
+        }
+
+        return graph;
+    }
+
+    std::optional<std::uint32_t> ControlFlowGraph::block_at(const std::uint64_t address) const
+    {
+        const auto it = std::ranges::upper_bound(m_blocks, address, {}, &BasicBlock::start);
+        if (it == m_blocks.begin())
+        {
+            return std::nullopt;
+        }
+
+        const auto& block = *std::prev(it);
+        if (address >= block.end)
+        {
+            return std::nullopt;
+        }
+        return static_cast<std::uint32_t>(std::prev(it) - m_blocks.begin());
+    }
+
+    std::span<const FlowEdge> ControlFlowGraph::successors(const std::uint32_t block) const
+    {
+        if (block >= m_blocks.size())
+        {
+            return {};
+        }
+        return std::span {m_edges}.subspan(m_successorOffsets[block], m_successorOffsets[block + 1] - m_successorOffsets[block]);
+    }
+
+    std::span<const FlowEdge> ControlFlowGraph::predecessors(const std::uint32_t block) const
+    {
+        if (block >= m_blocks.size())
+        {
+            return {};
+        }
+        return std::span {m_predecessors}.subspan(m_predecessorOffsets[block], m_predecessorOffsets[block + 1] - m_predecessorOffsets[block]);
+    }
+
+    bool ControlFlowGraph::dominates(const std::uint32_t dominator, const std::uint32_t block) const
+    {
+        if (dominator >= m_blocks.size() || block >= m_blocks.size())
+        {
+            return false;
+        }
+        if (m_dominatorPreorder[dominator] == NO_BLOCK || m_dominatorPreorder[block] == NO_BLOCK)
+        {
+            return dominator == block;
+        }
+        return m_dominatorPreorder[dominator] <= m_dominatorPreorder[block] &&
+               m_dominatorPostorder[block] <= m_dominatorPostorder[dominator];
+    }
+
+    std::vector<std::uint32_t> ControlFlowGraph::blocks_reaching(const std::uint32_t block) const
+    {
+        std::vector<std::uint32_t> result {};
+        if (block >= m_blocks.size())
+        {
+            return result;
+        }
+
+        std::vector<std::uint8_t> seen(m_blocks.size());
+        std::vector<std::uint32_t> work {block};
+        seen[block] = 1;
+        while (!work.empty())
+        {
+            const auto current = work.back();
+            work.pop_back();
+            result.push_back(current);
+
+            for (const auto& edge : predecessors(current))
+            {
+                if (!seen[edge.from])
+                {
+                    seen[edge.from] = 1;
+                    work.push_back(edge.from);
+                }
+            }
+        }
+
+        std::ranges::sort(result);
+        return result;
+    }
+
+    std::shared_ptr<const ControlFlowGraph> ModuleControlFlowCache::find(const std::uint64_t functionStart) const
+    {
+        std::scoped_lock lock{m_mutex};
+        const auto it = m_graphs.find(functionStart);
+        return it != m_graphs.end() ? it->second : nullptr;
+    }
+
+    std::shared_ptr<const ControlFlowGraph> ModuleControlFlowCache::acquire(const FunctionRange& function, const XrefDisassembler& disassemble)
+    {
+        if (auto cached = find(function.start))
+        {
+            return cached;
+        }
+
+        auto graph = ControlFlowGraph::build(function, disassemble);
+
+        std::scoped_lock lock{m_mutex};
+        return m_graphs.try_emplace(function.start, std::move(graph)).first->second;
+    }
+
+    std::size_t ModuleControlFlowCache::size() const
+    {
+        std::scoped_lock lock{m_mutex};
+        return m_graphs.size();
+    }
+}
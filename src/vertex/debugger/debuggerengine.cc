@@ -27,6 +27,8 @@
 namespace Vertex::Debugger
 {
     static constexpr std::uint32_t MAX_COMMAND_BURST {32};
+    static constexpr std::uint32_t MAX_DISASSEMBLE_INSTRUCTIONS {16};
+    static constexpr std::uint32_t DISASM_BYTE_WINDOW {64};
 
     namespace
     {
@@ -43,6 +45,23 @@ namespace Vertex::Debugger
             }
             std::unreachable();
         }
+
+        [[nodiscard]] DisassemblyLine to_disassembly_line(const ::DisassemblerResult& instr)
+        {
+            DisassemblyLine line {};
+            line.address = instr.address;
+            line.bytes.assign(instr.rawBytes, instr.rawBytes + instr.size);
+            line.mnemonic = instr.mnemonic;
+            line.operands = instr.operands;
+            line.comment = instr.comment;
+            line.sectionName = instr.sectionName;
+            line.targetSymbolName = instr.targetSymbol;
+            line.functionStart = instr.functionStart;
+            line.branchTarget = instr.targetAddress != 0
+                ? std::optional<std::uint64_t> {instr.targetAddress}
+                : std::nullopt;
+            return line;
+        }
     }
 
     DebuggerEngine::DebuggerEngine(Runtime::ILoader& loader, Thread::IThreadDispatcher& dispatcher, Log::ILog& logger)
@@ -552,9 +571,7 @@ namespace Vertex::Debugger
                 }
                 else if constexpr (std::is_same_v<Cmd, service::CmdDisassemble>)
                 {
-                    static constexpr std::size_t MAX_INSTRUCTIONS {16};
-                    static constexpr std::uint32_t DISASM_BYTE_WINDOW {64};
-                    std::array<::DisassemblerResult, MAX_INSTRUCTIONS> buffer {};
+                    std::array<::DisassemblerResult, MAX_DISASSEMBLE_INSTRUCTIONS> buffer {};
                     ::DisassemblerResults sdkResults {};
                     sdkResults.results = buffer.data();
                     sdkResults.count = 0;
@@ -577,19 +594,7 @@ namespace Vertex::Debugger
                     lines.reserve(take);
                     for (const auto& instr : std::span {sdkResults.results, take})
                     {
-                        DisassemblyLine line {};
-                        line.address = instr.address;
-                        line.bytes.assign(instr.rawBytes, instr.rawBytes + instr.size);
-                        line.mnemonic = instr.mnemonic;
-                        line.operands = instr.operands;
-                        line.comment = instr.comment;
-                        line.sectionName = instr.sectionName;
-                        line.targetSymbolName = instr.targetSymbol;
-                        line.functionStart = instr.functionStart;
-                        line.branchTarget = instr.targetAddress != 0
-                            ? std::optional<std::uint64_t> {instr.targetAddress}
-                            : std::nullopt;
-                        lines.push_back(std::move(line));
+                        lines.push_back(to_disassembly_line(instr));
                     }
 
                     post_service_result(commandId, StatusCode::STATUS_OK,
@@ -598,6 +603,82 @@ namespace Vertex::Debugger
                             .engineGeneration = m_generation.load(std::memory_order_acquire),
                         });
                 }
+                else if constexpr (std::is_same_v<Cmd, service::CmdDisassembleBatch>)
+                {
+                    const auto perRange = std::clamp<std::uint32_t>(arg.instructionCount, 1, MAX_DISASSEMBLE_INSTRUCTIONS);
+                    const auto rangeCount = static_cast<std::uint32_t>(arg.addresses.size());
+                    std::vector<::DisassemblerResult> buffer(static_cast<std::size_t>(rangeCount) * perRange);
+                    std::vector<std::vector<DisassemblyLine>> ranges(rangeCount);
+
+                    // One plugin call covers every address when the runtime exports the batched entry point;
+                    // older runtimes get one range call per address.
+                    if (plugin->internal_vertex_process_disassemble_ranges != nullptr)
+                    {
+                        std::vector<::DisassemblerRangeRequest> requests {};
+                        requests.reserve(rangeCount);
+                        for (const auto address : arg.addresses)
+                        {
+                            requests.push_back(::DisassemblerRangeRequest {address, perRange, 0});
+                        }
+
+                        std::vector<::DisassemblerRangeResult> outcomes(rangeCount);
+                        ::DisassemblerResults sdkResults {};
+                        sdkResults.results = buffer.data();
+                        sdkResults.capacity = static_cast<std::uint32_t>(buffer.size());
+
+                        const auto result = Runtime::safe_call(
+                            plugin->internal_vertex_process_disassemble_ranges,
+                            requests.data(), outcomes.data(), rangeCount, &sdkResults);
+                        const auto status = Runtime::get_status(result);
+                        if (status != StatusCode::STATUS_OK)
+                        {
+                            post_service_result(commandId, status);
+                            return;
+                        }
+
+                        for (std::uint32_t i {}; i < rangeCount; ++i)
+                        {
+                            // Plugin-reported slices are untrusted; anything past the shared buffer is dropped.
+                            if (outcomes[i].status != StatusCode::STATUS_OK || outcomes[i].firstResult >= buffer.size())
+                            {
+                                continue;
+                            }
+                            const auto count = std::min<std::size_t>(outcomes[i].count, buffer.size() - outcomes[i].firstResult);
+                            for (const auto& instr : std::span {buffer.data() + outcomes[i].firstResult, count})
+                            {
+                                ranges[i].push_back(to_disassembly_line(instr));
+                            }
+                        }
+                    }
+                    else
+                    {
+                        for (std::uint32_t i {}; i < rangeCount; ++i)
+                        {
+                            ::DisassemblerResults sdkResults {};
+                            sdkResults.results = buffer.data() + static_cast<std::size_t>(i) * perRange;
+                            sdkResults.capacity = perRange;
+                            sdkResults.startAddress = arg.addresses[i];
+
+                            const auto result = Runtime::safe_call(
+                                plugin->internal_vertex_process_disassemble_range,
+                                arg.addresses[i], DISASM_BYTE_WINDOW, &sdkResults);
+                            if (Runtime::get_status(result) != StatusCode::STATUS_OK)
+                            {
+                                continue;
+                            }
+                            for (const auto& instr : std::span {sdkResults.results, std::min(sdkResults.count, perRange)})
+                            {
+                                ranges[i].push_back(to_disassembly_line(instr));
+                            }
+                        }
+                    }
+
+                    post_service_result(commandId, StatusCode::STATUS_OK,
+                        service::DisassemblyBatchPayload {
+                            .ranges = std::move(ranges),
+                            .engineGeneration = m_generation.load(std::memory_order_acquire),
+                        });
+                }
                 else
                 {
                     post_service_result(commandId, StatusCode::STATUS_ERROR_NOT_IMPLEMENTED);
@@ -215,6 +215,39 @@ namespace Vertex::Debugger
         return std::nullopt;
     }
 
+    std::vector<std::optional<DisassemblyLine>>
+    DebuggerRuntimeService::disassemble_many(std::span<const std::uint64_t> pcs, std::chrono::milliseconds timeout)
+    {
+        std::vector<std::optional<DisassemblyLine>> lines(pcs.size());
+        if (pcs.empty())
+        {
+            return lines;
+        }
+
+        const auto id = send_command(
+            service::CmdDisassembleBatch {.addresses = {pcs.begin(), pcs.end()}, .instructionCount = 1}, timeout);
+        if (id == Runtime::INVALID_COMMAND_ID)
+        {
+            return lines;
+        }
+        const auto result = await_result(id, timeout);
+        if (result.code != STATUS_OK)
+        {
+            return lines;
+        }
+        if (const auto* payload = std::get_if<service::DisassemblyBatchPayload>(&result.payload))
+        {
+            for (std::size_t i {}; i < lines.size() && i < payload->ranges.size(); ++i)
+            {
+                if (!payload->ranges[i].empty())
+                {
+                    lines[i] = payload->ranges[i].front();
+                }
+            }
+        }
+        return lines;
+    }
+
     void DebuggerRuntimeService::shutdown()
     {
         bool expected = false;
@@ -0,0 +1,1108 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <vertex/debugger/functiontable.hh>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace Vertex::Debugger
+{
+    namespace
+    {
+        constexpr std::uint64_t READ_BLOCK_BYTES = 64 * 1024;
+        constexpr std::uint64_t HEADER_BYTES = 4096;
+        constexpr std::uint64_t MAX_TABLE_BYTES = 64ULL * 1024 * 1024;
+        constexpr std::uint64_t PAGE_MASK = ~0xFFFULL;
+
+        constexpr std::uint32_t ELF_PT_LOAD = 1;
+        constexpr std::uint32_t ELF_PT_GNU_EH_FRAME = 0x6474E550;
+        constexpr std::uint32_t ELF_PF_X = 1;
+        constexpr std::uint16_t ELF_EM_386 = 3;
+        constexpr std::uint16_t ELF_EM_X86_64 = 62;
+        constexpr std::uint16_t ELF_EM_AARCH64 = 183;
+
+        constexpr std::uint16_t PE_MACHINE_I386 = 0x14C;
+        constexpr std::uint16_t PE_MACHINE_AMD64 = 0x8664;
+        constexpr std::uint16_t PE_MACHINE_ARM64 = 0xAA64;
+        constexpr std::uint16_t PE_MAGIC_PE32 = 0x10B;
+        constexpr std::uint16_t PE_MAGIC_PE32_PLUS = 0x20B;
+        constexpr std::uint32_t PE_DIRECTORY_EXCEPTION = 3;
+        constexpr std::uint32_t PE_SCN_CNT_CODE = 0x20;
+        constexpr std::uint32_t PE_SCN_MEM_EXECUTE = 0x20000000;
+        constexpr std::uint8_t PE_UNW_FLAG_CHAININFO = 0x4;
+
+        constexpr std::uint8_t DW_EH_PE_OMIT = 0xFF;
+        constexpr std::uint8_t DW_EH_PE_FORMAT_MASK = 0x0F;
+        constexpr std::uint8_t DW_EH_PE_APPLICATION_MASK = 0x70;
+        constexpr std::uint8_t DW_EH_PE_INDIRECT = 0x80;
+        constexpr std::uint8_t DW_EH_PE_PCREL = 0x10;
+        constexpr std::uint8_t DW_EH_PE_DATAREL = 0x30;
+
+        enum class ImageArch
+        {
+            Unknown,
+            X86,
+            X64,
+            Arm64
+        };
+
+        struct AddressRange final
+        {
+            std::uint64_t begin {};
+            std::uint64_t end {};
+        };
+
+        struct ImageLayout final
+        {
+            ImageArch arch {ImageArch::Unknown};
+            std::vector<AddressRange> executable {};
+            std::vector<FunctionRange> unwind {};
+        };
+
+        // Serves small reads out of one cached block. Unwind tables and code are walked in address order,
+        // so this turns thousands of tiny reads into a few large ones.
+        class BlockReader final
+        {
+        public:
+            BlockReader(const ImageReader& read, const std::uint64_t begin, const std::uint64_t end)
+                : m_read {read}, m_begin {begin}, m_end {end}
+            {
+            }
+
+            [[nodiscard]] bool read(const std::uint64_t address, const std::span<std::uint8_t> out)
+            {
+                return read_some(address, out) == out.size();
+            }
+
+            [[nodiscard]] std::size_t read_some(const std::uint64_t address, std::span<std::uint8_t> out)
+            {
+                if (address < m_begin || address >= m_end)
+                {
+                    return 0;
+                }
+
+                out = out.first(static_cast<std::size_t>(std::min<std::uint64_t>(out.size(), m_end - address)));
+
+                if (out.size() > READ_BLOCK_BYTES)
+                {
+                    return m_read(address, out.size(), out.data()) == StatusCode::STATUS_OK ? out.size() : 0;
+                }
+
+                if (!covers(address, out.size()) && !load(address) &&
+                    m_read(address, out.size(), out.data()) != StatusCode::STATUS_OK)
+                {
+                    return 0;
+                }
+
+                if (covers(address, out.size()))
+                {
+                    std::memcpy(out.data(), m_block.data() + (address - m_blockAddress), out.size());
+                }
+                return out.size();
+            }
+
+            template <class T>
+            [[nodiscard]] std::optional<T> value(const std::uint64_t address)
+            {
+                std::array<std::uint8_t, sizeof(T)> bytes {};
+                if (!read(address, bytes))
+                {
+                    return std::nullopt;
+                }
+
+                T result {};
+                std::memcpy(&result, bytes.data(), sizeof(T));
+                return result;
+            }
+
+        private:
+            [[nodiscard]] bool covers(const std::uint64_t address, const std::size_t size) const noexcept
+            {
+                return !m_block.empty() && address >= m_blockAddress && address + size <= m_blockAddress + m_block.size();
+            }
+
+            [[nodiscard]] bool load(const std::uint64_t address)
+            {
+                m_block.resize(static_cast<std::size_t>(std::min(READ_BLOCK_BYTES, m_end - address)));
+                m_blockAddress = address;
+                if (m_read(address, m_block.size(), m_block.data()) != StatusCode::STATUS_OK)
+                {
+                    m_block.clear();
+                    return false;
+                }
+                return true;
+            }
+
+            const ImageReader& m_read;
+            std::uint64_t m_begin {};
+            std::uint64_t m_end {};
+            std::uint64_t m_blockAddress {};
+            std::vector<std::uint8_t> m_block {};
+        };
+
+        // Sequential decoder for DWARF exception-handling data held in a local buffer mapped at `address`.
+        class EhCursor final
+        {
+        public:
+            EhCursor(const std::span<const std::uint8_t> bytes, const std::uint64_t address, const std::uint8_t pointerSize)
+                : m_bytes {bytes}, m_address {address}, m_pointerSize {pointerSize}
+            {
+            }
+
+            [[nodiscard]] bool ok() const noexcept { return !m_failed; }
+            [[nodiscard]] std::uint64_t address() const noexcept { return m_address + m_position; }
+
+            template <class T>
+            [[nodiscard]] T fixed()
+            {
+                T result {};
+                if (m_position + sizeof(T) > m_bytes.size())
+                {
+                    m_failed = true;
+                    return result;
+                }
+                std::memcpy(&result, m_bytes.data() + m_position, sizeof(T));
+                m_position += sizeof(T);
+                return result;
+            }
+
+            [[nodiscard]] std::uint64_t uleb()
+            {
+                std::uint64_t result {};
+                for (std::uint32_t shift = 0; shift < 64; shift += 7)
+                {
+                    const auto byte = fixed<std::uint8_t>();
+                    result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+                    if ((byte & 0x80) == 0 || m_failed)
+                    {
+                        return result;
+                    }
+                }
+                m_failed = true;
+                return result;
+            }
+
+            [[nodiscard]] std::int64_t sleb()
+            {
+                std::uint64_t result {};
+                std::uint32_t shift {};
+                std::uint8_t byte {};
+                do
+                {
+                    byte = fixed<std::uint8_t>();
+                    if (m_failed || shift >= 64)
+                    {
+                        m_failed = true;
+                        return 0;
+                    }
+                    result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+                    shift += 7;
+                } while ((byte & 0x80) != 0);
+
+                if (shift < 64 && (byte & 0x40) != 0)
+                {
+                    result |= ~0ULL << shift;
+                }
+                return static_cast<std::int64_t>(result);
+            }
+
+            [[nodiscard]] std::string_view string()
+            {
+                const auto remaining = m_bytes.subspan(std::min(m_position, m_bytes.size()));
+                const auto terminator = std::ranges::find(remaining, std::uint8_t {0});
+                if (terminator == remaining.end())
+                {
+                    m_failed = true;
+                    return {};
+                }
+
+                const auto length = static_cast<std::size_t>(std::distance(remaining.begin(), terminator));
+                m_position += length + 1;
+                return {reinterpret_cast<const char*>(remaining.data()), length};
+            }
+
+            [[nodiscard]] std::optional<std::uint64_t> encoded(const std::uint8_t encoding, const std::uint64_t dataBase)
+            {
+                if (encoding == DW_EH_PE_OMIT || (encoding & DW_EH_PE_INDIRECT) != 0)
+                {
+                    return std::nullopt;
+                }
+
+                const auto fieldAddress = address();
+                std::uint64_t value {};
+                switch (encoding & DW_EH_PE_FORMAT_MASK)
+                {
+                    case 0x00:
+                        value = m_pointerSize == 4 ? fixed<std::uint32_t>() : fixed<std::uint64_t>();
+                        break;
+                    case 0x01: value = uleb(); break;
+                    case 0x02: value = fixed<std::uint16_t>(); break;
+                    case 0x03: value = fixed<std::uint32_t>(); break;
+                    case 0x04: value = fixed<std::uint64_t>(); break;
+                    case 0x09: value = static_cast<std::uint64_t>(sleb()); break;
+                    case 0x0A: value = static_cast<std::uint64_t>(static_cast<std::int64_t>(fixed<std::int16_t>())); break;
+                    case 0x0B: value = static_cast<std::uint64_t>(static_cast<std::int64_t>(fixed<std::int32_t>())); break;
+                    case 0x0C: value = static_cast<std::uint64_t>(fixed<std::int64_t>()); break;
+                    default:
+                        m_failed = true;
+                        return std::nullopt;
+                }
+
+                if (m_failed)
+                {
+                    return std::nullopt;
+                }
+
+                switch (encoding & DW_EH_PE_APPLICATION_MASK)
+                {
+                    case 0x00: return value;
+                    case DW_EH_PE_PCREL: return fieldAddress + value;
+                    case DW_EH_PE_DATAREL: return dataBase + value;
+                    default: return std::nullopt;
+                }
+            }
+
+        private:
+            std::span<const std::uint8_t> m_bytes {};
+            std::uint64_t m_address {};
+            std::size_t m_position {};
+            std::uint8_t m_pointerSize {8};
+            bool m_failed {};
+        };
+
+        struct FdeRecord final
+        {
+            std::uint64_t begin {};
+            std::uint64_t range {};
+            std::uint64_t next {};
+            bool isCie {};
+            bool terminator {};
+        };
+
+        class EhFrameParser final
+        {
+        public:
+            EhFrameParser(BlockReader& reader, const std::uint8_t pointerSize)
+                : m_reader {reader}, m_pointerSize {pointerSize}
+            {
+            }
+
+            [[nodiscard]] std::optional<FdeRecord> parse_entry(const std::uint64_t address)
+            {
+                std::array<std::uint8_t, 64> bytes {};
+                const auto available = m_reader.read_some(address, bytes);
+                EhCursor cursor {std::span {bytes}.first(available), address, m_pointerSize};
+
+                FdeRecord record {};
+                std::uint64_t length = cursor.fixed<std::uint32_t>();
+                if (!cursor.ok())
+                {
+                    return std::nullopt;
+                }
+                if (length == 0)
+                {
+                    record.terminator = true;
+                    return record;
+                }
+
+                const bool extended = length == 0xFFFFFFFF;
+                if (extended)
+                {
+                    length = cursor.fixed<std::uint64_t>();
+                }
+                record.next = cursor.address() + length;
+
+                const auto cieFieldAddress = cursor.address();
+                const std::uint64_t ciePointer = extended ? cursor.fixed<std::uint64_t>() : cursor.fixed<std::uint32_t>();
+                if (!cursor.ok())
+                {
+                    return std::nullopt;
+                }
+                if (ciePointer == 0)
+                {
+                    record.isCie = true;
+                    return record;
+                }
+
+                const auto encoding = fde_encoding(cieFieldAddress - ciePointer);
+                if (!encoding.has_value())
+                {
+                    return std::nullopt;
+                }
+
+                const auto begin = cursor.encoded(*encoding, 0);
+                const auto range = cursor.encoded(*encoding & DW_EH_PE_FORMAT_MASK, 0);
+                if (!begin.has_value() || !range.has_value())
+                {
+                    return std::nullopt;
+                }
+
+                record.begin = *begin;
+                record.range = *range;
+                return record;
+            }
+
+        private:
+            [[nodiscard]] std::optional<std::uint8_t> fde_encoding(const std::uint64_t cieAddress)
+            {
+                if (const auto it = m_cieEncodings.find(cieAddress); it != m_cieEncodings.end())
+                {
+                    return it->second;
+                }
+
+                const auto encoding = parse_cie(cieAddress);
+                m_cieEncodings.emplace(cieAddress, encoding);
+                return encoding;
+            }
+
+            [[nodiscard]] std::optional<std::uint8_t> parse_cie(const std::uint64_t address) const
+            {
+                std::array<std::uint8_t, 512> bytes {};
+                const auto available = m_reader.read_some(address, bytes);
+                EhCursor cursor {std::span {bytes}.first(available), address, m_pointerSize};
+
+                std::uint64_t id {};
+                if (cursor.fixed<std::uint32_t>() == 0xFFFFFFFF)
+                {
+                    std::ignore = cursor.fixed<std::uint64_t>();
+                    id = cursor.fixed<std::uint64_t>();
+                }
+                else
+                {
+                    id = cursor.fixed<std::uint32_t>();
+                }
+                const auto version = cursor.fixed<std::uint8_t>();
+                const auto augmentation = cursor.string();
+                if (!cursor.ok() || id != 0)
+                {
+                    return std::nullopt;
+                }
+
+                if (version >= 4)
+                {
+                    std::ignore = cursor.fixed<std::uint8_t>();
+                    std::ignore = cursor.fixed<std::uint8_t>();
+                }
+                std::ignore = cursor.uleb();
+                std::ignore = cursor.sleb();
+                std::ignore = version == 1 ? cursor.fixed<std::uint8_t>() : cursor.uleb();
+
+                std::uint8_t encoding {};
+                if (augmentation.starts_with('z'))
+                {
+                    std::ignore = cursor.uleb();
+                    for (const char code : augmentation.substr(1))
+                    {
+                        if (code == 'R')
+                        {
+                            encoding = cursor.fixed<std::uint8_t>();
+                            break;
+                        }
+                        if (code == 'P')
+                        {
+                            const auto personalityEncoding = cursor.fixed<std::uint8_t>();
+                            std::ignore = cursor.encoded(personalityEncoding & DW_EH_PE_FORMAT_MASK, 0);
+                        }
+                        else if (code == 'L')
+                        {
+                            std::ignore = cursor.fixed<std::uint8_t>();
+                        }
+                        else if (code != 'S' && code != 'B' && code != 'G')
+                        {
+                            break;
+                        }
+                    }
+                }
+
+                if (!cursor.ok())
+                {
+                    return std::nullopt;
+                }
+                return encoding;
+            }
+
+            BlockReader& m_reader;
+            std::uint8_t m_pointerSize {8};
+            std::unordered_map<std::uint64_t, std::optional<std::uint8_t>> m_cieEncodings {};
+        };
+
+        template <class T>
+        [[nodiscard]] std::optional<T> header_field(const std::span<const std::uint8_t> header, const std::uint64_t offset)
+        {
+            if (offset + sizeof(T) > header.size())
+            {
+                return std::nullopt;
+            }
+
+            T result {};
+            std::memcpy(&result, header.data() + offset, sizeof(T));
+            return result;
+        }
+
+        void add_unwind_range(ImageLayout& layout, const std::uint64_t moduleBase, const std::uint64_t moduleEnd,
+                              const std::uint64_t begin, const std::uint64_t length)
+        {
+            if (length == 0 || begin < moduleBase || begin >= moduleEnd || length > moduleEnd - begin)
+            {
+                return;
+            }
+            layout.unwind.push_back({.start = begin, .end = begin + length, .source = FunctionSource::Unwind});
+        }
+
+        void parse_eh_frame(BlockReader& reader, ImageLayout& layout, const std::uint64_t moduleBase, const std::uint64_t moduleEnd,
+                            const AddressRange& header, const std::span<const AddressRange> loadSegments,
+                            const std::uint8_t pointerSize)
+        {
+            std::vector<std::uint8_t> bytes(static_cast<std::size_t>(std::min(header.end - header.begin, MAX_TABLE_BYTES)));
+            bytes.resize(reader.read_some(header.begin, bytes));
+
+            EhCursor cursor {bytes, header.begin, pointerSize};
+            const auto version = cursor.fixed<std::uint8_t>();
+            const auto framePointerEncoding = cursor.fixed<std::uint8_t>();
+            const auto countEncoding = cursor.fixed<std::uint8_t>();
+            const auto tableEncoding = cursor.fixed<std::uint8_t>();
+            if (!cursor.ok() || version != 1)
+            {
+                return;
+            }
+
+            const auto frameAddress = cursor.encoded(framePointerEncoding, header.begin);
+            const auto count = cursor.encoded(countEncoding, header.begin);
+
+            EhFrameParser parser {reader, pointerSize};
+
+            // The binary-search table lists every FDE, so it is preferred over walking .eh_frame itself.
+            if (count.has_value() && tableEncoding != DW_EH_PE_OMIT)
+            {
+                for (std::uint64_t i = 0; i < *count && cursor.ok(); ++i)
+                {
+                    std::ignore = cursor.encoded(tableEncoding, header.begin);
+                    const auto fdeAddress = cursor.encoded(tableEncoding, header.begin);
+                    if (!fdeAddress.has_value())
+                    {
+                        break;
+                    }
+
+                    if (const auto record = parser.parse_entry(*fdeAddress); record.has_value() && !record->isCie)
+                    {
+                        add_unwind_range(layout, moduleBase, moduleEnd, record->begin, record->range);
+                    }
+                }
+                return;
+            }
+
+            if (!frameAddress.has_value())
+            {
+                return;
+            }
+
+            const auto segment = std::ranges::find_if(loadSegments, [&](const AddressRange& range)
+            {
+                return *frameAddress >= range.begin && *frameAddress < range.end;
+            });
+            if (segment == loadSegments.end())
+            {
+                return;
+            }
+
+            for (auto entry = *frameAddress; entry < segment->end;)
+            {
+                const auto record = parser.parse_entry(entry);
+                if (!record.has_value() || record->terminator || record->next <= entry)
+                {
+                    break;
+                }
+
+                if (!record->isCie)
+                {
+                    add_unwind_range(layout, moduleBase, moduleEnd, record->begin, record->range);
+                }
+                entry = record->next;
+            }
+        }
+
+        [[nodiscard]] ImageLayout parse_elf(BlockReader& reader, const std::span<const std::uint8_t> header,
+                                            const std::uint64_t moduleBase, const std::uint64_t moduleEnd, const bool withUnwind)
+        {
+            ImageLayout layout {};
+
+            const bool is64 = header_field<std::uint8_t>(header, 4) == 2;
+            if (header_field<std::uint8_t>(header, 5) != 1)
+            {
+                return layout;
+            }
+
+            switch (header_field<std::uint16_t>(header, 18).value_or(0))
+            {
+                case ELF_EM_X86_64: layout.arch = ImageArch::X64; break;
+                case ELF_EM_386: layout.arch = ImageArch::X86; break;
+                case ELF_EM_AARCH64: layout.arch = ImageArch::Arm64; break;
+                default: break;
+            }
+
+            const std::uint64_t programHeaderOffset = is64
+                ? header_field<std::uint64_t>(header, 0x20).value_or(0)
+                : header_field<std::uint32_t>(header, 0x1C).value_or(0);
+            const std::uint16_t entrySize = header_field<std::uint16_t>(header, is64 ? 0x36 : 0x2A).value_or(0);
+            const std::uint16_t entryCount = header_field<std::uint16_t>(header, is64 ? 0x38 : 0x2C).value_or(0);
+            if (programHeaderOffset == 0 || entrySize < (is64 ? 56 : 32) || entryCount == 0)
+            {
+                return layout;
+            }
+
+            std::vector<std::uint8_t> table(static_cast<std::size_t>(entrySize) * entryCount);
+            if (!reader.read(moduleBase + programHeaderOffset, table))
+            {
+                return layout;
+            }
+
+            struct Segment final
+            {
+                std::uint32_t type {};
+                std::uint32_t flags {};
+                std::uint64_t address {};
+                std::uint64_t size {};
+            };
+
+            std::vector<Segment> segments {};
+            std::uint64_t lowestLoad {UINT64_MAX};
+            for (std::size_t i = 0; i < entryCount; ++i)
+            {
+                const auto entry = std::span<const std::uint8_t> {table}.subspan(i * entrySize, entrySize);
+                Segment segment {};
+                segment.type = header_field<std::uint32_t>(entry, 0).value_or(0);
+                segment.flags = header_field<std::uint32_t>(entry, is64 ? 4 : 24).value_or(0);
+                segment.address = is64 ? header_field<std::uint64_t>(entry, 16).value_or(0) : header_field<std::uint32_t>(entry, 8).value_or(0);
+                segment.size = is64 ? header_field<std::uint64_t>(entry, 40).value_or(0) : header_field<std::uint32_t>(entry, 20).value_or(0);
+                if (segment.type == ELF_PT_LOAD)
+                {
+                    lowestLoad = std::min(lowestLoad, segment.address & PAGE_MASK);
+                }
+                segments.push_back(segment);
+            }
+
+            if (lowestLoad == UINT64_MAX)
+            {
+                return layout;
+            }
+
+            // Shared objects and PIE link at zero; fixed-address executables are already mapped at their link address.
+            const auto loadBias = moduleBase - lowestLoad;
+            const auto clamp = [&](const Segment& segment)
+            {
+                const auto begin = std::clamp(segment.address + loadBias, moduleBase, moduleEnd);
+                const auto end = std::clamp(segment.address + loadBias + segment.size, begin, moduleEnd);
+                return AddressRange {begin, end};
+            };
+
+            std::vector<AddressRange> loadSegments {};
+            std::optional<AddressRange> frameHeader {};
+            for (const auto& segment : segments)
+            {
+                if (segment.type == ELF_PT_LOAD)
+                {
+                    loadSegments.push_back(clamp(segment));
+                    if ((segment.flags & ELF_PF_X) != 0)
+                    {
+                        layout.executable.push_back(loadSegments.back());
+                    }
+                }
+                else if (segment.type == ELF_PT_GNU_EH_FRAME)
+                {
+                    frameHeader = clamp(segment);
+                }
+            }
+
+            if (withUnwind && frameHeader.has_value() && frameHeader->end > frameHeader->begin)
+            {
+                parse_eh_frame(reader, layout, moduleBase, moduleEnd, *frameHeader, loadSegments, is64 ? 8 : 4);
+            }
+            return layout;
+        }
+
+        void parse_pdata(BlockReader& reader, ImageLayout& layout, const std::uint64_t moduleBase, const std::uint64_t moduleEnd,
+                         const std::uint32_t directoryRva, const std::uint32_t directorySize)
+        {
+            const std::size_t entrySize = layout.arch == ImageArch::Arm64 ? 8 : 12;
+            std::vector<std::uint8_t> table(std::min<std::size_t>(directorySize, MAX_TABLE_BYTES) / entrySize * entrySize);
+            table.resize(reader.read_some(moduleBase + directoryRva, table) / entrySize * entrySize);
+
+            for (std::size_t offset = 0; offset < table.size(); offset += entrySize)
+            {
+                const auto entry = std::span<const std::uint8_t> {table}.subspan(offset, entrySize);
+                const auto begin = header_field<std::uint32_t>(entry, 0).value_or(0);
+
+                if (layout.arch == ImageArch::Arm64)
+                {
+                    const auto unwindData = header_field<std::uint32_t>(entry, 4).value_or(0);
+                    std::uint64_t length {};
+                    switch (unwindData & 0x3)
+                    {
+                        case 0:
+                            length = static_cast<std::uint64_t>(reader.value<std::uint32_t>(moduleBase + unwindData).value_or(0) & 0x3FFFF) * 4;
+                            break;
+                        case 1:
+                            length = static_cast<std::uint64_t>((unwindData >> 2) & 0x7FF) * 4;
+                            break;
+                        default:
+                            // Packed fragments continue a function described by an earlier entry.
+                            continue;
+                    }
+                    add_unwind_range(layout, moduleBase, moduleEnd, moduleBase + begin, length);
+                    continue;
+                }
+
+                const auto end = header_field<std::uint32_t>(entry, 4).value_or(0);
+                const auto unwindInfo = header_field<std::uint32_t>(entry, 8).value_or(0);
+                if (end <= begin || (unwindInfo & 1) != 0)
+                {
+                    continue;
+                }
+
+                // Chained entries describe cold or split-out parts of a function that starts elsewhere.
+                const auto versionAndFlags = reader.value<std::uint8_t>(moduleBase + unwindInfo);
+                if (!versionAndFlags.has_value() || ((*versionAndFlags >> 3) & PE_UNW_FLAG_CHAININFO) != 0)
+                {
+                    continue;
+                }
+                add_unwind_range(layout, moduleBase, moduleEnd, moduleBase + begin, end - begin);
+            }
+        }
+
+        [[nodiscard]] ImageLayout parse_pe(BlockReader& reader, const std::span<const std::uint8_t> header,
+                                           const std::uint64_t moduleBase, const std::uint64_t moduleEnd, const bool withUnwind)
+        {
+            ImageLayout layout {};
+
+            const auto ntOffset = header_field<std::uint32_t>(header, 0x3C).value_or(0);
+            if (header_field<std::uint32_t>(header, ntOffset) != 0x00004550)
+            {
+                return layout;
+            }
+
+            switch (header_field<std::uint16_t>(header, ntOffset + 4).value_or(0))
+            {
+                case PE_MACHINE_AMD64: layout.arch = ImageArch::X64; break;
+                case PE_MACHINE_I386: layout.arch = ImageArch::X86; break;
+                case PE_MACHINE_ARM64: layout.arch = ImageArch::Arm64; break;
+                default: break;
+            }
+
+            const auto sectionCount = header_field<std::uint16_t>(header, ntOffset + 6).value_or(0);
+            const auto optionalSize = header_field<std::uint16_t>(header, ntOffset + 20).value_or(0);
+            const std::uint64_t optionalOffset = ntOffset + 24;
+            const auto magic = header_field<std::uint16_t>(header, optionalOffset).value_or(0);
+            if (magic != PE_MAGIC_PE32 && magic != PE_MAGIC_PE32_PLUS)
+            {
+                return layout;
+            }
+
+            const bool plus = magic == PE_MAGIC_PE32_PLUS;
+            const auto directoryCount = header_field<std::uint32_t>(header, optionalOffset + (plus ? 108 : 92)).value_or(0);
+            const std::uint64_t directoryOffset = optionalOffset + (plus ? 112 : 96);
+
+            const std::uint64_t sectionOffset = optionalOffset + optionalSize;
+            std::vector<std::uint8_t> sections(static_cast<std::size_t>(sectionCount) * 40);
+            if (reader.read(moduleBase + sectionOffset, sections))
+            {
+                for (std::size_t i = 0; i < sectionCount; ++i)
+                {
+                    const auto section = std::span<const std::uint8_t> {sections}.subspan(i * 40, 40);
+                    const auto virtualSize = header_field<std::uint32_t>(section, 8).value_or(0);
+                    const auto virtualAddress = header_field<std::uint32_t>(section, 12).value_or(0);
+                    const auto characteristics = header_field<std::uint32_t>(section, 36).value_or(0);
+                    if ((characteristics & (PE_SCN_MEM_EXECUTE | PE_SCN_CNT_CODE)) == 0 || virtualSize == 0)
+                    {
+                        continue;
+                    }
+
+                    const auto begin = std::min(moduleBase + virtualAddress, moduleEnd);
+                    layout.executable.push_back({begin, std::min(begin + virtualSize, moduleEnd)});
+                }
+            }
+
+            if (withUnwind && directoryCount > PE_DIRECTORY_EXCEPTION &&
+                (layout.arch == ImageArch::X64 || layout.arch == ImageArch::Arm64))
+            {
+                const auto exceptionRva = reader.value<std::uint32_t>(moduleBase + directoryOffset + PE_DIRECTORY_EXCEPTION * 8);
+                const auto exceptionSize = reader.value<std::uint32_t>(moduleBase + directoryOffset + PE_DIRECTORY_EXCEPTION * 8 + 4);
+                if (exceptionRva.value_or(0) != 0 && exceptionSize.value_or(0) != 0)
+                {
+                    parse_pdata(reader, layout, moduleBase, moduleEnd, *exceptionRva, *exceptionSize);
+                }
+            }
+            return layout;
+        }
+
+        [[nodiscard]] ImageLayout parse_image(BlockReader& reader, const std::uint64_t moduleBase, const std::uint64_t moduleEnd,
+                                              const bool withUnwind)
+        {
+            std::vector<std::uint8_t> header(static_cast<std::size_t>(std::min(HEADER_BYTES, moduleEnd - moduleBase)));
+            header.resize(reader.read_some(moduleBase, header));
+
+            if (header.size() >= 64 && header[0] == 0x7F && header[1] == 'E' && header[2] == 'L' && header[3] == 'F')
+            {
+                return parse_elf(reader, header, moduleBase, moduleEnd, withUnwind);
+            }
+            if (header.size() >= 64 && header[0] == 'M' && header[1] == 'Z')
+            {
+                return parse_pe(reader, header, moduleBase, moduleEnd, withUnwind);
+            }
+            return {};
+        }
+
+        struct ProloguePattern final
+        {
+            std::array<std::uint8_t, 5> bytes {};
+            std::size_t length {};
+        };
+
+        constexpr std::array X64_PROLOGUES {
+            ProloguePattern {{0xF3, 0x0F, 0x1E, 0xFA}, 4},
+            ProloguePattern {{0x55, 0x48, 0x89, 0xE5}, 4},
+            ProloguePattern {{0x55, 0x48, 0x8B, 0xEC}, 4},
+            ProloguePattern {{0x55, 0x48, 0x83, 0xEC}, 4},
+            ProloguePattern {{0x53, 0x48, 0x83, 0xEC}, 4},
+            ProloguePattern {{0x56, 0x48, 0x83, 0xEC}, 4},
+            ProloguePattern {{0x57, 0x48, 0x83, 0xEC}, 4},
+            ProloguePattern {{0x48, 0x83, 0xEC}, 3},
+            ProloguePattern {{0x48, 0x81, 0xEC}, 3},
+            ProloguePattern {{0x48, 0x89, 0x5C, 0x24}, 4},
+            ProloguePattern {{0x48, 0x89, 0x4C, 0x24}, 4},
+            ProloguePattern {{0x48, 0x89, 0x54, 0x24}, 4},
+            ProloguePattern {{0x48, 0x89, 0x74, 0x24}, 4},
+            ProloguePattern {{0x48, 0x89, 0x6C, 0x24}, 4},
+            ProloguePattern {{0x4C, 0x89, 0x44, 0x24}, 4},
+            ProloguePattern {{0x40, 0x53}, 2},
+            ProloguePattern {{0x40, 0x55}, 2},
+            ProloguePattern {{0x40, 0x56}, 2},
+            ProloguePattern {{0x40, 0x57}, 2},
+            ProloguePattern {{0x41, 0x54}, 2},
+            ProloguePattern {{0x41, 0x55}, 2},
+            ProloguePattern {{0x41, 0x56}, 2},
+            ProloguePattern {{0x41, 0x57}, 2},
+        };
+
+        constexpr std::array X86_PROLOGUES {
+            ProloguePattern {{0xF3, 0x0F, 0x1E, 0xFB}, 4},
+            ProloguePattern {{0x8B, 0xFF, 0x55, 0x8B, 0xEC}, 5},
+            ProloguePattern {{0x55, 0x8B, 0xEC}, 3},
+            ProloguePattern {{0x55, 0x89, 0xE5}, 3},
+        };
+
+        constexpr std::uint32_t ARM64_STP_FP_LR_PRE_MASK = 0xFFC07FFF;
+        constexpr std::uint32_t ARM64_STP_FP_LR_PRE = 0xA9807BFD;
+        constexpr std::uint32_t ARM64_PACIASP = 0xD503233F;
+        constexpr std::uint32_t ARM64_RET = 0xD65F03C0;
+        constexpr std::uint32_t ARM64_NOP = 0xD503201F;
+        constexpr std::uint32_t ARM64_B_MASK = 0xFC000000;
+        constexpr std::uint32_t ARM64_B = 0x14000000;
+
+        [[nodiscard]] bool matches_prologue(const std::span<const ProloguePattern> patterns, const std::span<const std::uint8_t> code)
+        {
+            return std::ranges::any_of(patterns, [code](const ProloguePattern& pattern)
+            {
+                return code.size() >= pattern.length &&
+                       std::ranges::equal(code.first(pattern.length), std::span {pattern.bytes}.first(pattern.length));
+            });
+        }
+
+        // Compilers pad between x86 functions with int3 or nop and align entries to 16 bytes, so only aligned
+        // addresses that follow padding or a return are considered.
+        void scan_prologues(BlockReader& reader, const ImageLayout& layout, std::vector<std::uint64_t>& out)
+        {
+            const bool isArm = layout.arch == ImageArch::Arm64;
+            const auto patterns = layout.arch == ImageArch::X64
+                ? std::span<const ProloguePattern> {X64_PROLOGUES}
+                : std::span<const ProloguePattern> {X86_PROLOGUES};
+            const std::uint64_t alignment = isArm ? 4 : 16;
+
+            for (const auto& range : layout.executable)
+            {
+                for (auto address = (range.begin + alignment - 1) & ~(alignment - 1); address < range.end; address += alignment)
+                {
+                    std::array<std::uint8_t, 9> window {};
+                    const auto leadIn = address > range.begin ? (isArm ? 4u : 1u) : 0u;
+                    const auto available = reader.read_some(address - leadIn, window);
+                    if (available <= leadIn)
+                    {
+                        continue;
+                    }
+
+                    const auto code = std::span<const std::uint8_t> {window}.subspan(leadIn, available - leadIn);
+                    if (isArm)
+                    {
+                        if (code.size() < 4)
+                        {
+                            continue;
+                        }
+
+                        std::uint32_t instruction {};
+                        std::uint32_t previous {};
+                        std::memcpy(&instruction, code.data(), 4);
+                        if (leadIn != 0)
+                        {
+                            std::memcpy(&previous, window.data(), 4);
+                        }
+
+                        const bool followsBoundary = leadIn == 0 || previous == ARM64_RET || previous == ARM64_NOP ||
+                                                     previous == 0 || (previous & ARM64_B_MASK) == ARM64_B;
+                        const bool isPrologue = instruction == ARM64_PACIASP ||
+                                                (instruction & ARM64_STP_FP_LR_PRE_MASK) == ARM64_STP_FP_LR_PRE;
+                        if (followsBoundary && isPrologue)
+                        {
+                            out.push_back(address);
+                        }
+                        continue;
+                    }
+
+                    const bool followsBoundary = leadIn == 0 || window[0] == 0xCC || window[0] == 0x90 || window[0] == 0xC3;
+                    if (followsBoundary && matches_prologue(patterns, code))
+                    {
+                        out.push_back(address);
+                    }
+                }
+            }
+        }
+    }
+
+    std::shared_ptr<const ModuleFunctionTable> ModuleFunctionTable::build(const std::uint64_t moduleBase, const std::uint64_t moduleSize,
+                                                                          const ImageReader& read,
+                                                                          const FunctionDiscoveryHints& hints)
+    {
+        auto table = std::make_shared<ModuleFunctionTable>();
+        table->m_baseAddress = moduleBase;
+        table->m_size = moduleSize;
+
+        if (moduleSize == 0)
+        {
+            return table;
+        }
+
+        const auto moduleEnd = moduleBase + moduleSize;
+        ImageLayout layout {};
+        std::vector<std::uint64_t> prologueStarts {};
+
+        if (read)
+        {
+            BlockReader reader {read, moduleBase, moduleEnd};
+            layout = parse_image(reader, moduleBase, moduleEnd, true);
+            if (layout.arch != ImageArch::Unknown)
+            {
+                scan_prologues(reader, layout, prologueStarts);
+            }
+        }
+
+        std::ranges::sort(layout.executable, {}, &AddressRange::begin);
+
+        auto& exact = layout.unwind;
+        std::ranges::sort(exact, {}, &FunctionRange::start);
+        std::vector<FunctionRange> ranges {};
+        ranges.reserve(exact.size());
+        for (const auto& range : exact)
+        {
+            if (ranges.empty() || range.start >= ranges.back().end)
+            {
+                ranges.push_back(range);
+            }
+        }
+
+        const auto coveredByExact = [&ranges](const std::uint64_t address)
+        {
+            const auto it = std::ranges::upper_bound(ranges, address, {}, &FunctionRange::start);
+            return it != ranges.begin() && address < std::prev(it)->end;
+        };
+
+        const auto executableRange = [&layout](const std::uint64_t address) -> std::optional<AddressRange>
+        {
+            const auto it = std::ranges::upper_bound(layout.executable, address, {}, &AddressRange::begin);
+            if (it == layout.executable.begin() || address >= std::prev(it)->end)
+            {
+                return std::nullopt;
+            }
+            return *std::prev(it);
+        };
+
+        std::vector<std::pair<std::uint64_t, FunctionSource>> candidates {};
+        const auto addCandidates = [&](const std::span<const std::uint64_t> starts, const FunctionSource source)
+        {
+            for (const auto start : starts)
+            {
+                if (start < moduleBase || start >= moduleEnd || coveredByExact(start))
+                {
+                    continue;
+                }
+
+                // Symbols are trusted anywhere in the image; guessed starts must at least point at code.
+                if (source != FunctionSource::Symbol && !layout.executable.empty() && !executableRange(start).has_value())
+                {
+                    continue;
+                }
+                candidates.emplace_back(start, source);
+            }
+        };
+
+        std::vector<std::uint64_t> sizedStarts {};
+        std::vector<KnownFunction> knownFunctions {hints.knownFunctions};
+        std::ranges::sort(knownFunctions, {}, &KnownFunction::start);
+        sizedStarts.reserve(knownFunctions.size());
+        for (const auto& function : knownFunctions)
+        {
+            sizedStarts.push_back(function.start);
+        }
+        const auto knownSize = [&](const std::uint64_t start) -> std::uint64_t
+        {
+            const auto it = std::ranges::lower_bound(knownFunctions, start, {}, &KnownFunction::start);
+            return it != knownFunctions.end() && it->start == start ? it->size : 0;
+        };
+
+        addCandidates(sizedStarts, FunctionSource::Symbol);
+        addCandidates(hints.knownStarts, FunctionSource::Symbol);
+        addCandidates(hints.callTargets, FunctionSource::CallTarget);
+        addCandidates(prologueStarts, FunctionSource::Prologue);
+
+        std::ranges::sort(candidates);
+        const auto [duplicatesBegin, duplicatesEnd] = std::ranges::unique(candidates, {}, &std::pair<std::uint64_t, FunctionSource>::first);
+        candidates.erase(duplicatesBegin, duplicatesEnd);
+
+        // A sized symbol covers start + size, clipped to its code section and the next unwind range. Loop heads after
+        // padding look like prologues and get called too, so a guessed start in there would cut the function short.
+        // Symbols without a size (most exports) give no extent and leave the heuristics alone.
+        std::uint64_t symbolReach {};
+        std::size_t kept {};
+        for (const auto& candidate : candidates)
+        {
+            const auto [start, source] = candidate;
+            if (source != FunctionSource::Symbol)
+            {
+                if (start >= symbolReach)
+                {
+                    candidates[kept++] = candidate;
+                }
+                continue;
+            }
+
+            candidates[kept++] = candidate;
+            const auto size = knownSize(start);
+            const auto code = executableRange(start);
+            if (size == 0 || (!code.has_value() && !layout.executable.empty()))
+            {
+                continue;
+            }
+
+            auto reach = code.has_value() ? code->end : moduleEnd;
+            if (size < reach - start)
+            {
+                reach = start + size;
+            }
+            if (const auto next = std::ranges::upper_bound(ranges, start, {}, &FunctionRange::start); next != ranges.end())
+            {
+                reach = std::min(reach, next->start);
+            }
+            symbolReach = std::max(symbolReach, reach);
+        }
+        candidates.resize(kept);
+
+        // An open-ended start runs until the next known start or the end of its code section.
+        std::vector<FunctionRange> merged {};
+        merged.reserve(ranges.size() + candidates.size());
+        auto exactIt = ranges.begin();
+        for (std::size_t i = 0; i < candidates.size(); ++i)
+        {
+            const auto [start, source] = candidates[i];
+            while (exactIt != ranges.end() && exactIt->start < start)
+            {
+                merged.push_back(*exactIt++);
+            }
+
+            auto end = moduleEnd;
+            if (const auto code = executableRange(start); code.has_value())
+            {
+                end = code->end;
+            }
+            if (i + 1 < candidates.size())
+            {
+                end = std::min(end, candidates[i + 1].first);
+            }
+            if (exactIt != ranges.end())
+            {
+                end = std::min(end, exactIt->start);
+            }
+
+            merged.push_back({.start = start, .end = end, .source = source});
+        }
+        merged.insert(merged.end(), exactIt, ranges.end());
+
+        table->m_ranges = std::move(merged);
+        return table;
+    }
+
+    std::optional<FunctionRange> ModuleFunctionTable::find(const std::uint64_t address) const
+    {
+        const auto it = std::ranges::upper_bound(m_ranges, address, {}, &FunctionRange::start);
+        if (it == m_ranges.begin() || address >= std::prev(it)->end)
+        {
+            return std::nullopt;
+        }
+        return *std::prev(it);
+    }
+
+    std::optional<std::uint64_t> ModuleFunctionTable::start_at_or_before(const std::uint64_t address) const
+    {
+        const auto it = std::ranges::upper_bound(m_ranges, address, {}, &FunctionRange::start);
+        if (it == m_ranges.begin())
+        {
+            return std::nullopt;
+        }
+        return std::prev(it)->start;
+    }
+
+    std::optional<std::uint64_t> ModuleFunctionTable::start_after(const std::uint64_t address) const
+    {
+        const auto it = std::ranges::upper_bound(m_ranges, address, {}, &FunctionRange::start);
+        if (it == m_ranges.end())
+        {
+            return std::nullopt;
+        }
+        return it->start;
+    }
+
+    std::size_t ModuleFunctionTable::count_from(const FunctionSource source) const noexcept
+    {
+        return static_cast<std::size_t>(std::ranges::count(m_ranges, source, &FunctionRange::source));
+    }
+
+    std::vector<CodeRange> image_code_ranges(const std::uint64_t moduleBase, const std::uint64_t moduleSize, const ImageReader& read)
+    {
+        std::vector<CodeRange> code {};
+        if (moduleSize == 0 || !read)
+        {
+            return code;
+        }
+
+        BlockReader reader {read, moduleBase, moduleBase + moduleSize};
+        const auto layout = parse_image(reader, moduleBase, moduleBase + moduleSize, false);
+        for (const auto& range : layout.executable)
+        {
+            if (range.end > range.begin)
+            {
+                code.push_back({.begin = range.begin, .end = range.end});
+            }
+        }
+        std::ranges::sort(code, {}, &CodeRange::begin);
+        return code;
+    }
+
+    bool ModuleFunctionTable::overlaps(const std::uint64_t address, const std::uint64_t size) const noexcept
+    {
+        return size != 0 && m_size != 0 &&
+               address < m_baseAddress + m_size && m_baseAddress < address + size;
+    }
+}
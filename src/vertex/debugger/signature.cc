@@ -0,0 +1,402 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <vertex/debugger/signature.hh>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <thread>
+#include <tuple>
+
+namespace Vertex::Debugger
+{
+    namespace
+    {
+        constexpr std::uint64_t IMAGE_READ_BLOCK = 64 * 1024;
+        constexpr std::size_t SLICES_PER_WORKER = 4;
+        constexpr std::size_t MIN_SLICE_BYTES = 64 * 1024;
+        constexpr std::size_t DECODE_INSTRUCTIONS = 64;
+        constexpr std::uint32_t DECODE_SLACK_BYTES = 16;
+
+        [[nodiscard]] bool is_relative_branch(const ::BranchType branchType)
+        {
+            return branchType == VERTEX_BRANCH_UNCONDITIONAL || branchType == VERTEX_BRANCH_CONDITIONAL ||
+                   branchType == VERTEX_BRANCH_CALL || branchType == VERTEX_BRANCH_LOOP;
+        }
+
+        [[nodiscard]] std::uint64_t read_le(const std::span<const std::uint8_t> bytes, const std::size_t offset, const std::size_t width)
+        {
+            std::uint64_t value {};
+            for (std::size_t i = 0; i < width; ++i)
+            {
+                value |= static_cast<std::uint64_t>(bytes[offset + i]) << (i * 8);
+            }
+            return value;
+        }
+
+        template <class Visitor>
+        void scan_range(const std::span<const std::uint8_t> image, const std::span<const std::uint8_t> bytes,
+                        const std::span<const std::uint8_t> mask, const std::size_t anchor,
+                        const std::size_t begin, const std::size_t end, Visitor&& visit)
+        {
+            const auto length = bytes.size();
+            const auto anchorByte = bytes[anchor];
+
+            auto position = begin;
+            while (position < end)
+            {
+                const auto* found = static_cast<const std::uint8_t*>(
+                    std::memchr(image.data() + position + anchor, anchorByte, end - position));
+                if (found == nullptr)
+                {
+                    return;
+                }
+
+                position = static_cast<std::size_t>(found - image.data()) - anchor;
+                bool matches = true;
+                for (std::size_t i = 0; i < length; ++i)
+                {
+                    if (mask[i] != 0 && image[position + i] != bytes[i])
+                    {
+                        matches = false;
+                        break;
+                    }
+                }
+
+                if (matches && !visit(position))
+                {
+                    return;
+                }
+                ++position;
+            }
+        }
+
+        // Runs scan_range over slices of the image on up to workerCount threads. Each slice owns the match
+        // positions in [begin, end) and may read past end by up to the pattern length.
+        template <class SliceVisitor>
+        void scan_parallel(const std::span<const std::uint8_t> image, const std::span<const std::uint8_t> bytes,
+                           const std::span<const std::uint8_t> mask, const std::size_t workerCount,
+                           SliceVisitor&& makeVisitor)
+        {
+            if (bytes.empty() || bytes.size() > image.size())
+            {
+                return;
+            }
+
+            const auto anchorIt = std::ranges::find_if(mask, [](const std::uint8_t m) { return m != 0; });
+            if (anchorIt == mask.end())
+            {
+                return;
+            }
+            const auto anchor = static_cast<std::size_t>(anchorIt - mask.begin());
+
+            const auto positions = image.size() - bytes.size() + 1;
+            const auto workers = std::max<std::size_t>(workerCount, 1);
+            const auto sliceBytes = std::max(MIN_SLICE_BYTES, (positions + workers * SLICES_PER_WORKER - 1) / (workers * SLICES_PER_WORKER));
+            const auto sliceCount = (positions + sliceBytes - 1) / sliceBytes;
+
+            std::atomic<std::size_t> nextSlice {};
+            const auto worker = [&]()
+            {
+                for (auto i = nextSlice.fetch_add(1, std::memory_order_relaxed); i < sliceCount;
+                     i = nextSlice.fetch_add(1, std::memory_order_relaxed))
+                {
+                    const auto begin = i * sliceBytes;
+                    scan_range(image, bytes, mask, anchor, begin, std::min(begin + sliceBytes, positions), makeVisitor(i));
+                }
+            };
+
+            const auto threadCount = std::clamp<std::size_t>(workers, 1, sliceCount);
+            std::vector<std::jthread> threads {};
+            threads.reserve(threadCount - 1);
+            for (std::size_t i = 1; i < threadCount; ++i)
+            {
+                threads.emplace_back(worker);
+            }
+            worker();
+        }
+    }
+
+    std::string CodeSignature::to_pattern() const
+    {
+        std::string pattern {};
+        pattern.reserve(bytes.size() * 3);
+        for (std::size_t i = 0; i < bytes.size(); ++i)
+        {
+            if (i != 0)
+            {
+                pattern += ' ';
+            }
+            pattern += mask[i] != 0 ? fmt::format("{:02X}", bytes[i]) : std::string {"??"};
+        }
+        return pattern;
+    }
+
+    std::vector<std::uint8_t> relocation_mask(const ::CompactInstruction& instr, const std::span<const std::uint8_t> bytes,
+                                              const std::uint64_t moduleBase, const std::uint64_t moduleSize)
+    {
+        const auto size = std::min<std::size_t>(instr.size, bytes.size());
+        std::vector<std::uint8_t> mask(size, 1);
+        const auto nextIp = instr.address + instr.size;
+
+        const auto wildcard = [&mask](const std::size_t offset, const std::size_t width)
+        {
+            std::fill_n(mask.begin() + static_cast<std::ptrdiff_t>(offset), width, std::uint8_t {0});
+        };
+
+        // Operands follow the opcode, so byte 0 is never part of one; the first match wins because
+        // displacements are encoded before any immediate.
+        const auto find_value = [&](const std::uint64_t value, const std::size_t width) -> std::optional<std::size_t>
+        {
+            for (std::size_t offset = 1; offset + width <= size; ++offset)
+            {
+                if (read_le(bytes, offset, width) == value)
+                {
+                    return offset;
+                }
+            }
+            return std::nullopt;
+        };
+
+        const auto fits_int32 = [](const std::int64_t value)
+        {
+            return value >= std::numeric_limits<std::int32_t>::min() && value <= std::numeric_limits<std::int32_t>::max();
+        };
+
+        bool located = true;
+
+        if (instr.targetAddress != 0 && is_relative_branch(static_cast<::BranchType>(instr.branchType)) &&
+            !(instr.dataAddress != 0 && instr.targetAddress == instr.dataAddress))
+        {
+            const auto rel = static_cast<std::int64_t>(instr.targetAddress - nextIp);
+            if (size >= 5 && fits_int32(rel) && read_le(bytes, size - 4, 4) == static_cast<std::uint32_t>(rel))
+            {
+                wildcard(size - 4, 4);
+            }
+            else if (!(size >= 2 && rel >= -128 && rel <= 127 && bytes[size - 1] == static_cast<std::uint8_t>(rel)))
+            {
+                located = false;
+            }
+        }
+
+        if (instr.dataAddress != 0)
+        {
+            const auto disp = static_cast<std::int64_t>(instr.dataAddress - nextIp);
+            if (const auto offset = fits_int32(disp) ? find_value(static_cast<std::uint32_t>(disp), 4) : std::nullopt)
+            {
+                wildcard(*offset, 4);
+            }
+            else if (const auto absolute = find_value(instr.dataAddress, 8))
+            {
+                wildcard(*absolute, 8);
+            }
+            else if (const auto absolute32 = instr.dataAddress <= UINT32_MAX ? find_value(instr.dataAddress, 4) : std::nullopt)
+            {
+                wildcard(*absolute32, 4);
+            }
+            else
+            {
+                located = false;
+            }
+        }
+
+        if (!located)
+        {
+            wildcard(0, size);
+            return mask;
+        }
+
+        for (const std::size_t width : {8u, 4u})
+        {
+            for (std::size_t offset = 1; offset + width <= size; ++offset)
+            {
+                const auto value = read_le(bytes, offset, width);
+                const bool intact = std::all_of(mask.begin() + static_cast<std::ptrdiff_t>(offset),
+                                                mask.begin() + static_cast<std::ptrdiff_t>(offset + width),
+                                                [](const std::uint8_t m) { return m != 0; });
+                if (intact && value >= moduleBase && value - moduleBase < moduleSize)
+                {
+                    wildcard(offset, width);
+                }
+            }
+        }
+
+        return mask;
+    }
+
+    std::size_t count_pattern_matches(const std::span<const std::uint8_t> image, const std::span<const std::uint8_t> bytes,
+                                      const std::span<const std::uint8_t> mask, const std::size_t limit, const std::size_t workerCount)
+    {
+        std::atomic<std::size_t> count {};
+        scan_parallel(image, bytes, mask, workerCount, [&count, limit](std::size_t)
+        {
+            return [&count, limit](std::size_t)
+            {
+                return count.fetch_add(1, std::memory_order_relaxed) + 1 < limit;
+            };
+        });
+        return std::min(count.load(), limit);
+    }
+
+    CodeSignatureGenerator::CodeSignatureGenerator(const std::uint64_t moduleBase, const std::uint64_t moduleSize,
+                                                   const ImageReader& read, const SignatureOptions options)
+        : m_baseAddress {moduleBase},
+          m_image(moduleSize),
+          m_options {options}
+    {
+        // Unreadable pages stay zero-filled; they can only add matches, never hide one.
+        for (std::uint64_t offset = 0; read && offset < moduleSize; offset += IMAGE_READ_BLOCK)
+        {
+            const auto length = std::min(IMAGE_READ_BLOCK, moduleSize - offset);
+            std::ignore = read(moduleBase + offset, length, m_image.data() + offset);
+        }
+    }
+
+    std::vector<std::size_t> CodeSignatureGenerator::find_matches(const std::span<const std::uint8_t> bytes,
+                                                                  const std::span<const std::uint8_t> mask) const
+    {
+        const auto workers = std::max<std::size_t>(m_options.workerCount, 1);
+        std::vector<std::vector<std::size_t>> perSlice(workers * SLICES_PER_WORKER + 1);
+
+        scan_parallel(m_image, bytes, mask, workers, [&perSlice](const std::size_t slice)
+        {
+            return [&positions = perSlice[std::min(slice, perSlice.size() - 1)]](const std::size_t position)
+            {
+                positions.push_back(position);
+                return true;
+            };
+        });
+
+        std::vector<std::size_t> matches {};
+        for (auto& positions : perSlice)
+        {
+            matches.insert(matches.end(), positions.begin(), positions.end());
+        }
+        std::ranges::sort(matches);
+        return matches;
+    }
+
+    std::expected<CodeSignature, StatusCode> CodeSignatureGenerator::generate(const std::uint64_t address, const XrefDisassembler& disassemble) const
+    {
+        if (address < m_baseAddress || address - m_baseAddress >= m_image.size() || !disassemble || m_options.maxBytes == 0)
+        {
+            return std::unexpected(StatusCode::STATUS_ERROR_INVALID_PARAMETER);
+        }
+
+        const auto startOffset = static_cast<std::size_t>(address - m_baseAddress);
+        const auto available = std::min(m_image.size() - startOffset, m_options.maxBytes);
+
+        CompactDisassemblyBuffer buffer {DECODE_INSTRUCTIONS};
+
+        const auto decodeBytes = static_cast<std::uint32_t>(std::min<std::size_t>(available + DECODE_SLACK_BYTES, m_image.size() - startOffset));
+        if (const auto status = disassemble(address, decodeBytes, buffer.prepare()); status != StatusCode::STATUS_OK)
+        {
+            return std::unexpected(status);
+        }
+        const auto decoded = buffer.instructions();
+        if (decoded.empty() || decoded.front().address != address)
+        {
+            return std::unexpected(StatusCode::STATUS_ERROR_GENERAL);
+        }
+
+        CodeSignature signature {.address = address};
+        std::vector<std::size_t> boundaries {};
+        auto cursor = address;
+        for (const auto& instr : decoded)
+        {
+            if (instr.address != cursor || instr.size == 0 || signature.bytes.size() >= available)
+            {
+                break;
+            }
+
+            const auto offset = static_cast<std::size_t>(instr.address - m_baseAddress);
+            const auto length = std::min<std::size_t>(instr.size, available - signature.bytes.size());
+            const std::span instrBytes {m_image.data() + offset, std::min<std::size_t>(instr.size, m_image.size() - offset)};
+            const auto instrMask = relocation_mask(instr, instrBytes, m_baseAddress, m_image.size());
+
+            signature.bytes.insert(signature.bytes.end(), instrBytes.begin(), instrBytes.begin() + static_cast<std::ptrdiff_t>(length));
+            signature.mask.insert(signature.mask.end(), instrMask.begin(), instrMask.begin() + static_cast<std::ptrdiff_t>(std::min(length, instrMask.size())));
+            signature.mask.resize(signature.bytes.size(), 0);
+            boundaries.push_back(signature.bytes.size());
+            cursor = instr.address + instr.size;
+        }
+
+        // The first scan covers whole instructions up to the first fixed byte; every later byte only filters
+        // the candidates it found, so extending the pattern never rescans the image.
+        const auto firstFixed = std::ranges::find_if(signature.mask, [](const std::uint8_t m) { return m != 0; });
+        if (firstFixed == signature.mask.end())
+        {
+            return std::unexpected(StatusCode::STATUS_ERROR_GENERAL);
+        }
+        const auto firstFixedIndex = static_cast<std::size_t>(firstFixed - signature.mask.begin());
+        const auto prefix = *std::ranges::upper_bound(boundaries, firstFixedIndex);
+
+        const std::span allBytes {signature.bytes};
+        const std::span allMask {signature.mask};
+        auto candidates = find_matches(allBytes.first(prefix), allMask.first(prefix));
+
+        std::size_t length = prefix;
+        if (candidates.size() == 1)
+        {
+            // Already unique within the first instructions. One pass over the places the shortest prefix
+            // matches records where each stops agreeing with the pattern; the signature has to reach past
+            // the latest of those disagreements, and no longer.
+            const auto shortest = firstFixedIndex + 1;
+            const auto workers = std::max<std::size_t>(m_options.workerCount, 1);
+            std::vector<std::size_t> perSlice(workers * SLICES_PER_WORKER + 1, shortest);
+
+            scan_parallel(m_image, allBytes.first(shortest), allMask.first(shortest), workers, [&](const std::size_t slice)
+            {
+                return [&, &needed = perSlice[std::min(slice, perSlice.size() - 1)]](const std::size_t position)
+                {
+                    if (position == startOffset)
+                    {
+                        return true;
+                    }
+                    for (std::size_t i = shortest; i < prefix; ++i)
+                    {
+                        if (allMask[i] != 0 && (position + i >= m_image.size() || m_image[position + i] != allBytes[i]))
+                        {
+                            needed = std::max(needed, i + 1);
+                            break;
+                        }
+                    }
+                    return true;
+                };
+            });
+            length = std::ranges::max(perSlice);
+        }
+        else
+        {
+            for (std::size_t i = prefix; i < signature.bytes.size() && candidates.size() > 1; ++i)
+            {
+                if (signature.mask[i] == 0)
+                {
+                    continue;
+                }
+
+                std::erase_if(candidates, [&](const std::size_t candidate)
+                {
+                    return candidate + i >= m_image.size() || m_image[candidate + i] != signature.bytes[i];
+                });
+                length = i + 1;
+            }
+        }
+
+        signature.bytes.resize(length);
+        signature.mask.resize(length);
+        while (!signature.mask.empty() && signature.mask.back() == 0)
+        {
+            signature.mask.pop_back();
+            signature.bytes.pop_back();
+        }
+        signature.matchCount = candidates.size();
+        return signature;
+    }
+}
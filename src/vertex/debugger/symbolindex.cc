@@ -0,0 +1,380 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <vertex/debugger/symbolindex.hh>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <utility>
+
+namespace Vertex::Debugger
+{
+    namespace
+    {
+        constexpr std::size_t TRIGRAM_LENGTH = 3;
+
+        [[nodiscard]] char fold_case(const char c) noexcept
+        {
+            return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+        }
+
+        [[nodiscard]] std::uint32_t trigram_key(const std::string_view text, const std::size_t position) noexcept
+        {
+            return static_cast<std::uint32_t>(static_cast<unsigned char>(fold_case(text[position]))) << 16 |
+                   static_cast<std::uint32_t>(static_cast<unsigned char>(fold_case(text[position + 1]))) << 8 |
+                   static_cast<std::uint32_t>(static_cast<unsigned char>(fold_case(text[position + 2])));
+        }
+
+        void collect_trigrams(const std::string_view text, std::vector<std::uint32_t>& out)
+        {
+            out.clear();
+            if (text.size() < TRIGRAM_LENGTH)
+            {
+                return;
+            }
+
+            for (std::size_t i = 0; i + TRIGRAM_LENGTH <= text.size(); ++i)
+            {
+                out.push_back(trigram_key(text, i));
+            }
+
+            std::ranges::sort(out);
+            const auto [uniqueEnd, last] = std::ranges::unique(out);
+            out.erase(uniqueEnd, last);
+        }
+
+        [[nodiscard]] bool matches(const std::string_view name, const std::string_view query, const SymbolSearchMode mode) noexcept
+        {
+            if (query.size() > name.size())
+            {
+                return false;
+            }
+
+            const auto equalFolded = [](const char lhs, const char rhs) { return fold_case(lhs) == fold_case(rhs); };
+
+            if (mode == SymbolSearchMode::Prefix)
+            {
+                return std::ranges::equal(name.substr(0, query.size()), query, equalFolded);
+            }
+            return !std::ranges::search(name, query, equalFolded).empty();
+        }
+    }
+
+    void SymbolIndexBuilder::add_module(const std::string_view name, const std::uint64_t baseAddress, const std::uint64_t size)
+    {
+        if (size == 0)
+        {
+            return;
+        }
+
+        m_modules.push_back({
+            .baseAddress = baseAddress,
+            .size = size,
+            .nameOffset = static_cast<std::uint32_t>(m_arena.size()),
+            .nameLength = static_cast<std::uint32_t>(name.size())
+        });
+        m_arena.append(name);
+    }
+
+    void SymbolIndexBuilder::add_symbol(const std::uint64_t address, const std::uint64_t size, const std::string_view name)
+    {
+        if (address == 0 || name.empty())
+        {
+            return;
+        }
+
+        m_symbols.push_back({
+            .address = address,
+            .size = size,
+            .nameOffset = static_cast<std::uint32_t>(m_arena.size()),
+            .nameLength = static_cast<std::uint32_t>(name.size())
+        });
+        m_arena.append(name);
+    }
+
+    std::shared_ptr<const SymbolIndex> SymbolIndexBuilder::build()
+    {
+        auto index = std::make_shared<SymbolIndex>();
+
+        std::ranges::sort(m_modules, {}, &PendingModule::baseAddress);
+        index->m_modules.reserve(m_modules.size());
+        for (const auto& mod : m_modules)
+        {
+            index->m_modules.push_back({
+                .baseAddress = mod.baseAddress,
+                .size = mod.size,
+                .nameOffset = mod.nameOffset,
+                .nameLength = mod.nameLength
+            });
+        }
+
+        // Aliases share an address; the first name reported for it wins.
+        std::ranges::stable_sort(m_symbols, {}, &PendingSymbol::address);
+        const auto [aliasesBegin, aliasesEnd] = std::ranges::unique(m_symbols, {}, &PendingSymbol::address);
+        m_symbols.erase(aliasesBegin, aliasesEnd);
+
+        index->m_entries.reserve(m_symbols.size());
+        for (const auto& symbol : m_symbols)
+        {
+            auto moduleIndex = SymbolIndex::NO_MODULE;
+            const auto it = std::ranges::upper_bound(index->m_modules, symbol.address, {}, &SymbolIndex::Module::baseAddress);
+            if (it != index->m_modules.begin())
+            {
+                const auto& mod = *std::prev(it);
+                if (symbol.address < mod.baseAddress + mod.size)
+                {
+                    moduleIndex = static_cast<std::uint32_t>(std::distance(index->m_modules.begin(), std::prev(it)));
+                }
+            }
+
+            index->m_entries.push_back({
+                .address = symbol.address,
+                .size = symbol.size,
+                .nameOffset = symbol.nameOffset,
+                .nameLength = symbol.nameLength,
+                .module = moduleIndex
+            });
+        }
+
+        index->m_arena = std::move(m_arena);
+        m_symbols = {};
+        m_modules = {};
+        m_arena = {};
+
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> postings {};
+        std::vector<std::uint32_t> nameTrigrams {};
+        for (std::uint32_t i = 0; i < index->m_entries.size(); ++i)
+        {
+            collect_trigrams(index->name_of(index->m_entries[i]), nameTrigrams);
+            for (const auto key : nameTrigrams)
+            {
+                postings.emplace_back(key, i);
+            }
+        }
+
+        // Entries are visited in ascending order, so a stable sort by key leaves every posting list sorted.
+        std::ranges::stable_sort(postings, {}, &std::pair<std::uint32_t, std::uint32_t>::first);
+
+        index->m_trigramPostings.reserve(postings.size());
+        for (const auto& [key, entry] : postings)
+        {
+            if (index->m_trigramKeys.empty() || index->m_trigramKeys.back() != key)
+            {
+                index->m_trigramKeys.push_back(key);
+                index->m_trigramOffsets.push_back(static_cast<std::uint32_t>(index->m_trigramPostings.size()));
+            }
+            index->m_trigramPostings.push_back(entry);
+        }
+        index->m_trigramOffsets.push_back(static_cast<std::uint32_t>(index->m_trigramPostings.size()));
+
+        return index;
+    }
+
+    std::string_view SymbolIndex::name_of(const Entry& entry) const noexcept
+    {
+        return std::string_view {m_arena}.substr(entry.nameOffset, entry.nameLength);
+    }
+
+    std::string_view SymbolIndex::module_name_of(const Entry& entry) const noexcept
+    {
+        if (entry.module == NO_MODULE)
+        {
+            return {};
+        }
+
+        const auto& mod = m_modules[entry.module];
+        return std::string_view {m_arena}.substr(mod.nameOffset, mod.nameLength);
+    }
+
+    // A symbol without a reported size is taken to run up to the next symbol, clamped to its module.
+    std::uint64_t SymbolIndex::extent_end(const std::size_t entryIndex) const noexcept
+    {
+        const auto& entry = m_entries[entryIndex];
+        if (entry.size != 0)
+        {
+            return entry.address + entry.size;
+        }
+
+        const bool hasNext = entryIndex + 1 < m_entries.size();
+        if (entry.module == NO_MODULE)
+        {
+            return hasNext ? m_entries[entryIndex + 1].address : entry.address + 1;
+        }
+
+        const auto& mod = m_modules[entry.module];
+        const auto moduleEnd = mod.baseAddress + mod.size;
+        return hasNext ? std::min(m_entries[entryIndex + 1].address, moduleEnd) : moduleEnd;
+    }
+
+    SymbolMatch SymbolIndex::make_match(const Entry& entry, const std::uint64_t address) const
+    {
+        return SymbolMatch {
+            .address = entry.address,
+            .offset = address - entry.address,
+            .size = entry.size,
+            .name = name_of(entry),
+            .moduleName = module_name_of(entry)
+        };
+    }
+
+    std::optional<std::string_view> SymbolIndex::name_at(const std::uint64_t address) const
+    {
+        const auto it = std::ranges::lower_bound(m_entries, address, {}, &Entry::address);
+        if (it == m_entries.end() || it->address != address)
+        {
+            return std::nullopt;
+        }
+        return name_of(*it);
+    }
+
+    std::optional<SymbolMatch> SymbolIndex::resolve(const std::uint64_t address) const
+    {
+        const auto it = std::ranges::upper_bound(m_entries, address, {}, &Entry::address);
+        if (it == m_entries.begin())
+        {
+            return std::nullopt;
+        }
+
+        const auto entryIndex = static_cast<std::size_t>(std::distance(m_entries.begin(), it)) - 1;
+        if (address >= extent_end(entryIndex))
+        {
+            return std::nullopt;
+        }
+        return make_match(m_entries[entryIndex], address);
+    }
+
+    std::optional<std::uint64_t> SymbolIndex::symbol_at_or_before(const std::uint64_t address) const
+    {
+        const auto it = std::ranges::upper_bound(m_entries, address, {}, &Entry::address);
+        if (it == m_entries.begin())
+        {
+            return std::nullopt;
+        }
+        return std::prev(it)->address;
+    }
+
+    std::optional<std::uint64_t> SymbolIndex::symbol_after(const std::uint64_t address) const
+    {
+        const auto it = std::ranges::upper_bound(m_entries, address, {}, &Entry::address);
+        if (it == m_entries.end())
+        {
+            return std::nullopt;
+        }
+        return it->address;
+    }
+
+    std::string SymbolIndex::format(const std::uint64_t address) const
+    {
+        const auto match = resolve(address);
+        if (!match.has_value())
+        {
+            return {};
+        }
+
+        if (match->offset == 0)
+        {
+            return std::string {match->name};
+        }
+        return fmt::format("{}+0x{:X}", match->name, match->offset);
+    }
+
+    std::vector<SymbolSpan> SymbolIndex::spans_in(const std::uint64_t begin, const std::uint64_t end) const
+    {
+        std::vector<SymbolSpan> spans {};
+        if (end <= begin)
+        {
+            return spans;
+        }
+
+        const auto first = std::ranges::lower_bound(m_entries, begin, {}, &Entry::address);
+        const auto last = std::ranges::lower_bound(first, m_entries.end(), end, {}, &Entry::address);
+        spans.reserve(static_cast<std::size_t>(std::distance(first, last)));
+        for (const auto& entry : std::ranges::subrange(first, last))
+        {
+            spans.push_back({.address = entry.address, .size = entry.size});
+        }
+        return spans;
+    }
+
+    std::vector<SymbolMatch> SymbolIndex::search(const std::string_view query, const SymbolSearchMode mode, const std::size_t maxResults) const
+    {
+        std::vector<SymbolMatch> results {};
+        if (query.empty() || maxResults == 0)
+        {
+            return results;
+        }
+
+        const auto accept = [&](const std::uint32_t entryIndex)
+        {
+            const auto& entry = m_entries[entryIndex];
+            if (matches(name_of(entry), query, mode))
+            {
+                results.push_back(make_match(entry, entry.address));
+            }
+            return results.size() < maxResults;
+        };
+
+        std::vector<std::uint32_t> queryTrigrams {};
+        collect_trigrams(query, queryTrigrams);
+
+        if (queryTrigrams.empty())
+        {
+            for (std::uint32_t i = 0; i < m_entries.size(); ++i)
+            {
+                if (!accept(i))
+                {
+                    break;
+                }
+            }
+            return results;
+        }
+
+        std::vector<std::span<const std::uint32_t>> lists {};
+        lists.reserve(queryTrigrams.size());
+        for (const auto key : queryTrigrams)
+        {
+            const auto it = std::ranges::lower_bound(m_trigramKeys, key);
+            if (it == m_trigramKeys.end() || *it != key)
+            {
+                return results;
+            }
+
+            const auto slot = static_cast<std::size_t>(std::distance(m_trigramKeys.begin(), it));
+            lists.emplace_back(m_trigramPostings.data() + m_trigramOffsets[slot],
+                               m_trigramOffsets[slot + 1] - m_trigramOffsets[slot]);
+        }
+
+        // Intersect starting from the rarest trigram; every candidate still gets a full match check because
+        // trigrams alone do not encode their order or position.
+        std::ranges::sort(lists, {}, &std::span<const std::uint32_t>::size);
+
+        std::vector<std::uint32_t> candidates {lists.front().begin(), lists.front().end()};
+        std::vector<std::uint32_t> narrowed {};
+        for (const auto& list : lists | std::views::drop(1))
+        {
+            if (candidates.empty())
+            {
+                break;
+            }
+
+            narrowed.clear();
+            std::ranges::set_intersection(candidates, list, std::back_inserter(narrowed));
+            std::swap(candidates, narrowed);
+        }
+
+        for (const auto candidate : candidates)
+        {
+            if (!accept(candidate))
+            {
+                break;
+            }
+        }
+
+        return results;
+    }
+}
@@ -0,0 +1,296 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <vertex/debugger/xrefindex.hh>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <thread>
+#include <unordered_set>
+
+namespace Vertex::Debugger
+{
+    namespace
+    {
+        // A slice starts decoding slightly before its first owned byte so that variable-length
+        // instruction streams have resynchronised by the time the slice boundary is reached.
+        constexpr std::uint64_t SLICE_SYNC_BYTES = 64;
+
+        // Only branch targets carry text in a sweep, and most of them have no symbol at all.
+        constexpr std::size_t SYMBOL_BYTES_PER_INSTRUCTION = 32;
+
+        struct SliceResult final
+        {
+            std::vector<XrefRecord> records {};
+            std::vector<std::uint64_t> functionStarts {};
+            std::vector<std::pair<std::uint64_t, std::string>> targetSymbols {};
+            std::uint64_t sweepEnd {};
+        };
+
+        [[nodiscard]] XrefType classify_reference(const ::CompactInstruction& instr)
+        {
+            switch (instr.branchType)
+            {
+                case VERTEX_BRANCH_CALL:
+                case VERTEX_BRANCH_INDIRECT_CALL:
+                    return XrefType::Call;
+                case VERTEX_BRANCH_CONDITIONAL:
+                    return XrefType::ConditionalJump;
+                case VERTEX_BRANCH_LOOP:
+                    return XrefType::Loop;
+                default:
+                    return XrefType::UnconditionalJump;
+            }
+        }
+
+        [[nodiscard]] bool is_function_entry(const ::CompactInstruction& instr)
+        {
+            return (instr.flags & VERTEX_FLAG_ENTRY_POINT) != 0 ||
+                   (instr.functionStart != 0 && instr.functionStart == instr.address);
+        }
+
+        void sweep_slice(const std::uint64_t moduleBase, const std::uint64_t moduleEnd,
+                         const std::uint64_t sliceBegin, const std::uint64_t sliceEnd,
+                         const XrefDisassembler& disassemble, const XrefIndexBuildOptions& options,
+                         CompactDisassemblyBuffer& buffer, SliceResult& out)
+        {
+            std::unordered_set<std::uint64_t> namedTargets {};
+            auto cursor = sliceBegin - std::min(SLICE_SYNC_BYTES, sliceBegin - moduleBase);
+            out.sweepEnd = sliceBegin;
+
+            while (cursor < sliceEnd)
+            {
+                const auto chunkSize = static_cast<std::uint32_t>(
+                    std::min<std::uint64_t>(options.chunkBytes, moduleEnd - cursor));
+
+                const auto status = disassemble(cursor, chunkSize, buffer.prepare());
+                const auto decoded = buffer.instructions();
+                if (status != StatusCode::STATUS_OK || decoded.empty())
+                {
+                    cursor += chunkSize;
+                    continue;
+                }
+
+                bool reachedEnd {};
+                for (const auto& instr : decoded)
+                {
+                    if (instr.address >= sliceEnd)
+                    {
+                        reachedEnd = true;
+                        break;
+                    }
+
+                    if (instr.address < sliceBegin)
+                    {
+                        continue;
+                    }
+
+                    out.sweepEnd = instr.address + instr.size;
+
+                    if (is_function_entry(instr))
+                    {
+                        out.functionStarts.push_back(instr.address);
+                    }
+
+                    const bool hasData = instr.dataAccess != VERTEX_DATA_ACCESS_NONE && instr.dataAddress != 0;
+                    if (hasData)
+                    {
+                        out.records.push_back({
+                            .source = instr.address,
+                            .target = instr.dataAddress,
+                            .type = XrefType::Data,
+                            .access = static_cast<XrefAccess>(instr.dataAccess),
+                            .operandSize = instr.dataSize
+                        });
+                    }
+
+                    // call [rip+x] reports the pointer slot as its target, which the data reference already covers.
+                    if (instr.targetAddress == 0 || instr.branchType == VERTEX_BRANCH_NONE ||
+                        (hasData && instr.targetAddress == instr.dataAddress))
+                    {
+                        continue;
+                    }
+
+                    out.records.push_back({
+                        .source = instr.address,
+                        .target = instr.targetAddress,
+                        .type = classify_reference(instr)
+                    });
+
+                    const auto symbol = buffer.string_at(instr.targetSymbol);
+                    if (!symbol.empty() && namedTargets.insert(instr.targetAddress).second)
+                    {
+                        out.targetSymbols.emplace_back(instr.targetAddress, symbol);
+                    }
+                }
+
+                if (reachedEnd)
+                {
+                    break;
+                }
+
+                const auto& lastInstr = decoded.back();
+                const auto nextAddress = lastInstr.address + lastInstr.size;
+                cursor = nextAddress > cursor ? nextAddress : cursor + chunkSize;
+            }
+        }
+    }
+
+    std::shared_ptr<const ModuleXrefIndex> ModuleXrefIndex::build(const std::uint64_t moduleBase, const std::uint64_t moduleSize,
+                                                                  const XrefDisassembler& disassemble,
+                                                                  const XrefIndexBuildOptions& options)
+    {
+        auto index = std::make_shared<ModuleXrefIndex>();
+        index->m_baseAddress = moduleBase;
+        index->m_size = moduleSize;
+
+        if (moduleSize == 0 || !disassemble || options.chunkBytes == 0)
+        {
+            return index;
+        }
+
+        const std::uint64_t moduleEnd = moduleBase + moduleSize;
+        const std::uint64_t sliceBytes = std::max<std::uint64_t>(options.sliceBytes, options.chunkBytes);
+        const auto sliceCount = static_cast<std::size_t>((moduleSize + sliceBytes - 1) / sliceBytes);
+
+        std::vector<SliceResult> slices(sliceCount);
+        std::atomic<std::size_t> nextSlice {};
+
+        const auto worker = [&]()
+        {
+            const auto capacity = std::max<std::size_t>(options.chunkInstructions, 1);
+            CompactDisassemblyBuffer buffer {capacity, VERTEX_COMPACT_FIELD_TARGET_SYMBOL, capacity * SYMBOL_BYTES_PER_INSTRUCTION};
+
+            for (auto i = nextSlice.fetch_add(1, std::memory_order_relaxed); i < sliceCount;
+                 i = nextSlice.fetch_add(1, std::memory_order_relaxed))
+            {
+                const std::uint64_t sliceBegin = moduleBase + i * sliceBytes;
+                const std::uint64_t sliceEnd = std::min(sliceBegin + sliceBytes, moduleEnd);
+                sweep_slice(moduleBase, moduleEnd, sliceBegin, sliceEnd, disassemble, options, buffer, slices[i]);
+            }
+        };
+
+        {
+            const auto workerCount = std::clamp<std::size_t>(options.workerCount, 1, sliceCount);
+            std::vector<std::jthread> workers {};
+            workers.reserve(workerCount - 1);
+            for (std::size_t i = 1; i < workerCount; ++i)
+            {
+                workers.emplace_back(worker);
+            }
+            worker();
+        }
+
+        std::size_t recordCount {};
+        for (const auto& slice : slices)
+        {
+            recordCount += slice.records.size();
+        }
+        index->m_bySource.reserve(recordCount);
+
+        // An instruction owned by one slice can run past its end; whatever the next slice decoded inside
+        // that instruction is a misaligned decode and is dropped.
+        std::uint64_t previousEnd = moduleBase;
+        for (auto& slice : slices)
+        {
+            for (const auto& record : slice.records)
+            {
+                if (record.source >= previousEnd)
+                {
+                    index->m_bySource.push_back(record);
+                }
+            }
+
+            for (const auto start : slice.functionStarts)
+            {
+                if (start >= previousEnd)
+                {
+                    index->m_functionStarts.push_back(start);
+                }
+            }
+
+            std::ranges::move(slice.targetSymbols, std::back_inserter(index->m_targetSymbols));
+            previousEnd = std::max(previousEnd, slice.sweepEnd);
+            slice = {};
+        }
+
+        const auto bySource = [](const XrefRecord& lhs, const XrefRecord& rhs)
+        {
+            return lhs.source != rhs.source ? lhs.source < rhs.source : lhs.target < rhs.target;
+        };
+        const auto byTarget = [](const XrefRecord& lhs, const XrefRecord& rhs)
+        {
+            return lhs.target != rhs.target ? lhs.target < rhs.target : lhs.source < rhs.source;
+        };
+
+        std::ranges::sort(index->m_bySource, bySource);
+        index->m_byTarget = index->m_bySource;
+        std::ranges::sort(index->m_byTarget, byTarget);
+
+        std::ranges::sort(index->m_functionStarts);
+        const auto [startsEnd, startsLast] = std::ranges::unique(index->m_functionStarts);
+        index->m_functionStarts.erase(startsEnd, startsLast);
+
+        std::ranges::stable_sort(index->m_targetSymbols, {}, &std::pair<std::uint64_t, std::string>::first);
+        const auto [symbolsEnd, symbolsLast] = std::ranges::unique(index->m_targetSymbols, {}, &std::pair<std::uint64_t, std::string>::first);
+        index->m_targetSymbols.erase(symbolsEnd, symbolsLast);
+
+        return index;
+    }
+
+    std::span<const XrefRecord> ModuleXrefIndex::references_to(const std::uint64_t target) const
+    {
+        const auto range = std::ranges::equal_range(m_byTarget, target, {}, &XrefRecord::target);
+        return {range.begin(), range.end()};
+    }
+
+    std::span<const XrefRecord> ModuleXrefIndex::references_from(const std::uint64_t begin, const std::uint64_t end) const
+    {
+        if (end <= begin)
+        {
+            return {};
+        }
+
+        const auto first = std::ranges::lower_bound(m_bySource, begin, {}, &XrefRecord::source);
+        const auto last = std::ranges::lower_bound(first, m_bySource.end(), end, {}, &XrefRecord::source);
+        return {first, last};
+    }
+
+    std::optional<std::uint64_t> ModuleXrefIndex::function_start_at_or_before(const std::uint64_t address) const
+    {
+        const auto it = std::ranges::upper_bound(m_functionStarts, address);
+        if (it == m_functionStarts.begin())
+        {
+            return std::nullopt;
+        }
+        return *std::prev(it);
+    }
+
+    std::optional<std::uint64_t> ModuleXrefIndex::function_start_after(const std::uint64_t address) const
+    {
+        const auto it = std::ranges::upper_bound(m_functionStarts, address);
+        if (it == m_functionStarts.end())
+        {
+            return std::nullopt;
+        }
+        return *it;
+    }
+
+    std::string_view ModuleXrefIndex::target_symbol(const std::uint64_t target) const
+    {
+        const auto it = std::ranges::lower_bound(m_targetSymbols, target, {}, &std::pair<std::uint64_t, std::string>::first);
+        if (it == m_targetSymbols.end() || it->first != target)
+        {
+            return {};
+        }
+        return it->second;
+    }
+
+    bool ModuleXrefIndex::overlaps(const std::uint64_t address, const std::uint64_t size) const noexcept
+    {
+        return size != 0 && m_size != 0 &&
+               address < m_baseAddress + m_size && m_baseAddress < address + size;
+    }
+}
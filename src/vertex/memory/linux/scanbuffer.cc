@@ -0,0 +1,92 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <vertex/memory/scanbufferpool.hh>
+
+#include <sys/mman.h>
+
+#include <utility>
+
+namespace Vertex::Memory
+{
+    namespace
+    {
+        [[nodiscard]] constexpr std::size_t round_up(const std::size_t value, const std::size_t granularity) noexcept
+        {
+            return (value + granularity - 1) / granularity * granularity;
+        }
+    }
+
+    ScanBuffer::~ScanBuffer() noexcept { release(); }
+
+    ScanBuffer::ScanBuffer(ScanBuffer&& other) noexcept
+        : m_base(std::exchange(other.m_base, nullptr)),
+          m_capacity(std::exchange(other.m_capacity, 0)),
+          m_hugePages(std::exchange(other.m_hugePages, false))
+    {
+    }
+
+    ScanBuffer& ScanBuffer::operator=(ScanBuffer&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+
+            m_base = std::exchange(other.m_base, nullptr);
+            m_capacity = std::exchange(other.m_capacity, 0);
+            m_hugePages = std::exchange(other.m_hugePages, false);
+        }
+        return *this;
+    }
+
+    StatusCode ScanBuffer::allocate(const std::size_t size, const bool useHugePages)
+    {
+        if (size == 0)
+        {
+            return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        release();
+
+        const std::size_t capacity = round_up(size, HUGE_PAGE_SIZE);
+        void* mapped = MAP_FAILED;
+
+        if (useHugePages)
+        {
+            mapped = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            m_hugePages = mapped != MAP_FAILED;
+        }
+
+        if (mapped == MAP_FAILED)
+        {
+            mapped = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (mapped == MAP_FAILED)
+            {
+                return StatusCode::STATUS_ERROR_MEMORY_ALLOCATION_FAILED;
+            }
+
+            if (useHugePages)
+            {
+                // Best effort: THP may be disabled system-wide, the mapping still works without it.
+                madvise(mapped, capacity, MADV_HUGEPAGE);
+            }
+        }
+
+        m_base = static_cast<char*>(mapped);
+        m_capacity = capacity;
+        return StatusCode::STATUS_OK;
+    }
+
+    void ScanBuffer::release() noexcept
+    {
+        if (m_base)
+        {
+            munmap(m_base, m_capacity);
+        }
+
+        m_base = nullptr;
+        m_capacity = 0;
+        m_hugePages = false;
+    }
+} // namespace Vertex::Memory
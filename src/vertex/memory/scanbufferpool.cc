@@ -0,0 +1,71 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <vertex/memory/scanbufferpool.hh>
+
+namespace Vertex::Memory
+{
+    StatusCode ScanBufferPool::reserve(const std::size_t workerCount, const std::size_t bufferSize, const bool useHugePages)
+    {
+        if (workerCount == 0 || bufferSize == 0)
+        {
+            return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        if (useHugePages != m_useHugePages)
+        {
+            m_buffers.clear();
+            m_useHugePages = useHugePages;
+        }
+
+        m_buffers.resize(workerCount);
+
+        for (auto& buffer : m_buffers)
+        {
+            if (buffer.capacity() >= bufferSize)
+            {
+                continue;
+            }
+
+            const StatusCode status = buffer.allocate(bufferSize, m_useHugePages);
+            if (status != StatusCode::STATUS_OK)
+            {
+                return status;
+            }
+        }
+
+        return StatusCode::STATUS_OK;
+    }
+
+    std::span<char> ScanBufferPool::acquire(const std::size_t workerIndex, const std::size_t minimumSize)
+    {
+        if (workerIndex >= m_buffers.size())
+        {
+            return {};
+        }
+
+        ScanBuffer& buffer = m_buffers[workerIndex];
+        if (buffer.capacity() < minimumSize && buffer.allocate(minimumSize, m_useHugePages) != StatusCode::STATUS_OK)
+        {
+            return {};
+        }
+
+        return {buffer.data(), buffer.capacity()};
+    }
+
+    void ScanBufferPool::release() noexcept
+    {
+        m_buffers.clear();
+    }
+
+    std::size_t ScanBufferPool::total_capacity() const noexcept
+    {
+        std::size_t total{};
+        for (const auto& buffer : m_buffers)
+        {
+            total += buffer.capacity();
+        }
+        return total;
+    }
+} // namespace Vertex::Memory
@@ -0,0 +1,92 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <vertex/memory/scanbufferpool.hh>
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+
+#include <utility>
+
+namespace Vertex::Memory
+{
+    namespace
+    {
+        [[nodiscard]] constexpr std::size_t round_up(const std::size_t value, const std::size_t granularity) noexcept
+        {
+            return (value + granularity - 1) / granularity * granularity;
+        }
+    }
+
+    ScanBuffer::~ScanBuffer() noexcept { release(); }
+
+    ScanBuffer::ScanBuffer(ScanBuffer&& other) noexcept
+        : m_base(std::exchange(other.m_base, nullptr)),
+          m_capacity(std::exchange(other.m_capacity, 0)),
+          m_hugePages(std::exchange(other.m_hugePages, false))
+    {
+    }
+
+    ScanBuffer& ScanBuffer::operator=(ScanBuffer&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+
+            m_base = std::exchange(other.m_base, nullptr);
+            m_capacity = std::exchange(other.m_capacity, 0);
+            m_hugePages = std::exchange(other.m_hugePages, false);
+        }
+        return *this;
+    }
+
+    StatusCode ScanBuffer::allocate(const std::size_t size, const bool useHugePages)
+    {
+        if (size == 0)
+        {
+            return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        release();
+
+        const SIZE_T largePageMinimum = GetLargePageMinimum();
+        const std::size_t granularity = largePageMinimum != 0 ? static_cast<std::size_t>(largePageMinimum) : HUGE_PAGE_SIZE;
+        const std::size_t capacity = round_up(size, granularity);
+        void* mapped{};
+
+        // Large pages need SeLockMemoryPrivilege; without it the allocation fails and we use normal pages.
+        if (useHugePages && largePageMinimum != 0)
+        {
+            mapped = VirtualAlloc(nullptr, capacity, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            m_hugePages = mapped != nullptr;
+        }
+
+        if (!mapped)
+        {
+            mapped = VirtualAlloc(nullptr, capacity, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+            if (!mapped)
+            {
+                return StatusCode::STATUS_ERROR_MEMORY_ALLOCATION_FAILED;
+            }
+        }
+
+        m_base = static_cast<char*>(mapped);
+        m_capacity = capacity;
+        return StatusCode::STATUS_OK;
+    }
+
+    void ScanBuffer::release() noexcept
+    {
+        if (m_base)
+        {
+            VirtualFree(m_base, 0, MEM_RELEASE);
+        }
+
+        m_base = nullptr;
+        m_capacity = 0;
+        m_hugePages = false;
+    }
+} // namespace Vertex::Memory
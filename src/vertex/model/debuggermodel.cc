@@ -13,10 +13,12 @@
 #include <wx/app.h>
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstdlib>
 #include <limits>
 #include <span>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -27,6 +29,7 @@
 namespace
 {
     constexpr std::uint32_t PENDING_BREAKPOINT_ID_BASE = 0xFFFF'0000u;
+    constexpr std::uint32_t THREAD_SNAPSHOT_FRAMES = 32;
     std::atomic<std::uint32_t> g_pendingIdCounter{0};
 
     [[nodiscard]] bool is_pending_id(const std::uint32_t id)
@@ -95,6 +98,122 @@ namespace
                 return "<unknown>";
         }
     }
+
+    void append_register(Vertex::Debugger::RegisterSet& registers, const ::Register& sdkRegister)
+    {
+        Vertex::Debugger::Register reg{};
+        reg.name = sdkRegister.name;
+        reg.value = sdkRegister.value;
+        reg.previousValue = sdkRegister.previousValue;
+        reg.bitWidth = sdkRegister.bitWidth;
+        reg.modified = sdkRegister.modified != 0;
+
+        switch (sdkRegister.category)
+        {
+            case VERTEX_REG_SEGMENT:
+                reg.category = Vertex::Debugger::RegisterCategory::Segment;
+                registers.segment.push_back(std::move(reg));
+                break;
+            case VERTEX_REG_FLAGS:
+                reg.category = Vertex::Debugger::RegisterCategory::Flags;
+                registers.flags.push_back(std::move(reg));
+                break;
+            case VERTEX_REG_FLOATING_POINT:
+                reg.category = Vertex::Debugger::RegisterCategory::FloatingPoint;
+                registers.floatingPoint.push_back(std::move(reg));
+                break;
+            case VERTEX_REG_VECTOR:
+                reg.category = Vertex::Debugger::RegisterCategory::Vector;
+                registers.vector.push_back(std::move(reg));
+                break;
+            case VERTEX_REG_GENERAL:
+            default:
+                reg.category = Vertex::Debugger::RegisterCategory::General;
+                registers.generalPurpose.push_back(std::move(reg));
+                break;
+        }
+    }
+
+    [[nodiscard]] Vertex::Debugger::StackFrame to_stack_frame(const ::StackFrame& sdkFrame)
+    {
+        Vertex::Debugger::StackFrame frame{};
+        frame.frameIndex = sdkFrame.frameIndex;
+        frame.returnAddress = sdkFrame.returnAddress;
+        frame.framePointer = sdkFrame.framePointer;
+        frame.stackPointer = sdkFrame.stackPointer;
+        frame.functionName = sdkFrame.functionName;
+        frame.moduleName = sdkFrame.moduleName;
+        frame.sourceFile = sdkFrame.sourceFile;
+        frame.sourceLine = sdkFrame.sourceLine;
+        return frame;
+    }
+
+    [[nodiscard]] std::string target_symbol_name(const Vertex::Debugger::SymbolIndex* symbols,
+                                                  const Vertex::Debugger::ModuleXrefIndex& index,
+                                                  const std::uint64_t target)
+    {
+        if (symbols)
+        {
+            if (const auto name = symbols->name_at(target); name.has_value())
+            {
+                return std::string{*name};
+            }
+        }
+
+        if (const auto name = index.target_symbol(target); !name.empty())
+        {
+            return std::string{name};
+        }
+
+        return symbols ? symbols->format(target) : std::string{};
+    }
+
+    [[nodiscard]] std::string describe_code_address(const Vertex::Debugger::SymbolIndex* symbols,
+                                                    const std::span<const std::shared_ptr<const Vertex::Debugger::ModuleFunctionTable>> functions,
+                                                    const std::uint64_t address)
+    {
+        if (symbols)
+        {
+            if (auto name = symbols->format(address); !name.empty())
+            {
+                return name;
+            }
+        }
+
+        for (const auto& table : functions)
+        {
+            if (!table->overlaps(address, 1))
+            {
+                continue;
+            }
+
+            if (const auto function = table->find(address); function.has_value())
+            {
+                return function->start == address
+                    ? fmt::format("sub_{:X}", address)
+                    : fmt::format("sub_{:X}+0x{:X}", function->start, address - function->start);
+            }
+            break;
+        }
+
+        return {};
+    }
+
+    [[nodiscard]] Vertex::Debugger::ThreadState to_thread_state(const ::ThreadState state)
+    {
+        switch (state)
+        {
+            case VERTEX_THREAD_SUSPENDED:
+                return Vertex::Debugger::ThreadState::Suspended;
+            case VERTEX_THREAD_WAITING:
+                return Vertex::Debugger::ThreadState::Waiting;
+            case VERTEX_THREAD_TERMINATED:
+                return Vertex::Debugger::ThreadState::Terminated;
+            case VERTEX_THREAD_RUNNING:
+            default:
+                return Vertex::Debugger::ThreadState::Running;
+        }
+    }
 }
 
 namespace Vertex::Model
@@ -403,6 +522,7 @@ namespace Vertex::Model
         }
 
         ++m_memoryWriteGeneration;
+        invalidate_xref_indices(address, writeSize);
 
         {
             std::scoped_lock lock{m_cacheMutex};
@@ -1741,6 +1861,7 @@ namespace Vertex::Model
                             std::scoped_lock lock{m_cacheMutex};
                             m_cachedModules.clear();
                         }
+                        prune_xref_indices({});
                         if (m_eventHandler)
                         {
                             m_eventHandler(Debugger::DirtyFlags::Modules, m_engine->get_snapshot());
@@ -1795,6 +1916,8 @@ namespace Vertex::Model
                         return;
                     }
 
+                    prune_xref_indices(modules);
+
                     {
                         std::scoped_lock lock{m_cacheMutex};
                         m_cachedModules = std::move(modules);
@@ -1858,7 +1981,7 @@ namespace Vertex::Model
 
                 const auto& plugin = pluginOpt.value().get();
 
-                std::unordered_map<std::uint64_t, std::string> table{};
+                Debugger::SymbolIndexBuilder builder{};
                 const bool hasSymbolEnumeration =
                     plugin.internal_vertex_symbol_enumerate_functions &&
                     plugin.internal_vertex_symbol_free_enumeration;
@@ -1871,6 +1994,8 @@ namespace Vertex::Model
 
                 for (const auto& mod : modules)
                 {
+                    builder.add_module(mod.name, mod.baseAddress, mod.size);
+
                     if (!hasSymbolEnumeration || mod.baseAddress == 0)
                     {
                         continue;
@@ -1890,17 +2015,9 @@ namespace Vertex::Model
                     {
                         for (const auto& symbol : std::span{symbols, symbolCount})
                         {
-                            if (symbol.address == 0)
-                            {
-                                continue;
-                            }
-
                             const auto nameBegin = std::begin(symbol.name);
                             const auto nameEnd = std::find(nameBegin, std::end(symbol.name), '\0');
-                            if (nameBegin != nameEnd)
-                            {
-                                table[symbol.address] = std::string{nameBegin, nameEnd};
-                            }
+                            builder.add_symbol(symbol.address, symbol.size, std::string_view{nameBegin, nameEnd});
                         }
                     }
 
@@ -1913,9 +2030,10 @@ namespace Vertex::Model
                     }
                 }
 
-                m_loggerService.log_info(fmt::format("{}: Built symbol table with {} entries", MODEL_NAME, table.size()));
+                auto symbolIndex = builder.build();
+                m_loggerService.log_info(fmt::format("{}: Built symbol index with {} entries", MODEL_NAME, symbolIndex->size()));
 
-                wxTheApp->CallAfter([this, generation, symbolTable = std::move(table)]() mutable
+                wxTheApp->CallAfter([this, generation, symbolIndex = std::move(symbolIndex)]() mutable
                 {
                     if (m_engine->get_generation() != generation)
                     {
@@ -1924,14 +2042,16 @@ namespace Vertex::Model
 
                     {
                         std::scoped_lock lock{m_cacheMutex};
-                        m_symbolTable = std::move(symbolTable);
+                        m_symbolIndex = std::move(symbolIndex);
+                        resolve_call_stack_symbols(m_cachedCallStack, m_symbolIndex.get(), cached_function_tables());
                     }
 
                     if (!m_cachedDisassembly.lines.empty())
                     {
                         {
                             std::scoped_lock lock{m_cacheMutex};
-                            resolve_disassembly_symbols(m_cachedDisassembly, m_cachedModules, m_symbolTable);
+                            apply_function_bounds(m_cachedDisassembly, cached_function_tables());
+                            resolve_disassembly_symbols(m_cachedDisassembly, m_cachedModules, m_symbolIndex.get());
                         }
 
                         if (m_eventHandler)
@@ -1939,6 +2059,11 @@ namespace Vertex::Model
                             m_eventHandler(Debugger::DirtyFlags::Disassembly, m_engine->get_snapshot());
                         }
                     }
+
+                    if (!m_cachedCallStack.frames.empty() && m_eventHandler)
+                    {
+                        m_eventHandler(Debugger::DirtyFlags::CallStack, m_engine->get_snapshot());
+                    }
                 });
 
                 return StatusCode::STATUS_OK;
@@ -2032,7 +2157,8 @@ namespace Vertex::Model
 
                 {
                     std::scoped_lock lock{m_cacheMutex};
-                    resolve_disassembly_symbols(newDisasm, m_cachedModules, m_symbolTable);
+                    apply_function_bounds(newDisasm, cached_function_tables());
+                    resolve_disassembly_symbols(newDisasm, m_cachedModules, m_symbolIndex.get());
                 }
 
                 wxTheApp->CallAfter([this, generation, disasm = std::move(newDisasm)]() mutable
@@ -2048,6 +2174,7 @@ namespace Vertex::Model
                         return;
                     }
 
+                    const auto disasmAddress = disasm.startAddress;
                     {
                         std::scoped_lock lock{m_cacheMutex};
                         m_cachedDisassembly = std::move(disasm);
@@ -2058,6 +2185,8 @@ namespace Vertex::Model
                         m_eventHandler(Debugger::DirtyFlags::Disassembly, m_engine->get_snapshot());
                     }
 
+                    prefetch_function_table(disasmAddress);
+
                     if (m_queryDisassembly.pendingRedispatch.load(std::memory_order_acquire))
                     {
                         request_disassembly(m_pendingDisasmAddress.load(std::memory_order_acquire));
@@ -2121,18 +2250,40 @@ namespace Vertex::Model
 
                 auto& plugin = pluginOpt.value().get();
 
-                constexpr std::size_t MAX_INSTRUCTIONS = 200;
-                std::vector<::DisassemblerResult> resultBuffer(MAX_INSTRUCTIONS);
+                // Variable-length code cannot be decoded backwards, so decoding starts at a known function
+                // entry and the instructions before the requested window are dropped afterwards.
+                auto decodeStart = startAddress;
+                for (const auto& functions : cached_function_tables())
+                {
+                    if (!functions->overlaps(fromAddress - 1, 1))
+                    {
+                        continue;
+                    }
+
+                    if (const auto anchor = functions->start_at_or_before(startAddress);
+                        anchor.has_value() && startAddress - *anchor <= EXTEND_UP_RESYNC_BYTES)
+                    {
+                        decodeStart = *anchor;
+                    }
+                    else if (const auto next = functions->start_after(startAddress); next.has_value() && *next < fromAddress)
+                    {
+                        decodeStart = *next;
+                    }
+                    break;
+                }
+
+                const auto maxInstructions = std::max<std::size_t>(200, fromAddress - decodeStart);
+                std::vector<::DisassemblerResult> resultBuffer(maxInstructions);
                 ::DisassemblerResults results{};
                 results.results = resultBuffer.data();
                 results.count = 0;
-                results.capacity = static_cast<std::uint32_t>(MAX_INSTRUCTIONS);
-                results.startAddress = startAddress;
+                results.capacity = static_cast<std::uint32_t>(maxInstructions);
+                results.startAddress = decodeStart;
 
                 const auto disasmResult = Runtime::safe_call(
                     plugin.internal_vertex_process_disassemble_range,
-                    startAddress,
-                    static_cast<std::uint32_t>(fromAddress - startAddress),
+                    decodeStart,
+                    static_cast<std::uint32_t>(fromAddress - decodeStart),
                     &results
                 );
                 const auto status = Runtime::get_status(disasmResult);
@@ -2153,7 +2304,8 @@ namespace Vertex::Model
                 newLines.reserve(results.count);
 
                 for (const auto& instr : std::span{results.results, results.count}
-                    | std::views::take_while([fromAddress](const auto& r) { return r.address < fromAddress; }))
+                    | std::views::take_while([fromAddress](const auto& r) { return r.address < fromAddress; })
+                    | std::views::filter([startAddress](const auto& r) { return r.address >= startAddress; }))
                 {
                     newLines.push_back(convert_disasm_result(instr, 0));
                 }
@@ -2168,7 +2320,8 @@ namespace Vertex::Model
                     Debugger::DisassemblyRange tempRange{};
                     tempRange.lines = std::move(newLines);
                     std::scoped_lock lock{m_cacheMutex};
-                    resolve_disassembly_symbols(tempRange, m_cachedModules, m_symbolTable);
+                    apply_function_bounds(tempRange, cached_function_tables());
+                    resolve_disassembly_symbols(tempRange, m_cachedModules, m_symbolIndex.get());
                     newLines = std::move(tempRange.lines);
                 }
 
@@ -2323,7 +2476,8 @@ namespace Vertex::Model
                     Debugger::DisassemblyRange tempRange{};
                     tempRange.lines = std::move(newLines);
                     std::scoped_lock lock{m_cacheMutex};
-                    resolve_disassembly_symbols(tempRange, m_cachedModules, m_symbolTable);
+                    apply_function_bounds(tempRange, cached_function_tables());
+                    resolve_disassembly_symbols(tempRange, m_cachedModules, m_symbolIndex.get());
                     newLines = std::move(tempRange.lines);
                 }
 
@@ -2902,40 +3056,10 @@ namespace Vertex::Model
                 newRegs.stackPointer = sdkRegs.stackPointer;
                 newRegs.basePointer = sdkRegs.basePointer;
 
-                for (const auto& [name, category, value, previousValue, bitWidth, modified]
+                for (const auto& sdkRegister
                     : std::span{sdkRegs.registers, std::min<std::uint32_t>(sdkRegs.registerCount, VERTEX_MAX_REGISTERS)})
                 {
-                    Debugger::Register reg{};
-                    reg.name = name;
-                    reg.value = value;
-                    reg.previousValue = previousValue;
-                    reg.bitWidth = bitWidth;
-                    reg.modified = modified != 0;
-
-                    switch (category)
-                    {
-                        case VERTEX_REG_SEGMENT:
-                            reg.category = Debugger::RegisterCategory::Segment;
-                            newRegs.segment.push_back(std::move(reg));
-                            break;
-                        case VERTEX_REG_FLAGS:
-                            reg.category = Debugger::RegisterCategory::Flags;
-                            newRegs.flags.push_back(std::move(reg));
-                            break;
-                        case VERTEX_REG_FLOATING_POINT:
-                            reg.category = Debugger::RegisterCategory::FloatingPoint;
-                            newRegs.floatingPoint.push_back(std::move(reg));
-                            break;
-                        case VERTEX_REG_VECTOR:
-                            reg.category = Debugger::RegisterCategory::Vector;
-                            newRegs.vector.push_back(std::move(reg));
-                            break;
-                        case VERTEX_REG_GENERAL:
-                        default:
-                            reg.category = Debugger::RegisterCategory::General;
-                            newRegs.generalPurpose.push_back(std::move(reg));
-                            break;
-                    }
+                    append_register(newRegs, sdkRegister);
                 }
 
                 wxTheApp->CallAfter([this, generation, threadId, newRegs = std::move(newRegs),
@@ -2997,6 +3121,32 @@ namespace Vertex::Model
 
         const auto generation = m_engine->get_generation();
 
+        bool servedFromStopState{};
+        {
+            std::scoped_lock lock{m_cacheMutex};
+            if (const auto it = m_cachedThreadStates.find(threadId);
+                it != m_cachedThreadStates.end() && m_threadStatesGeneration == generation)
+            {
+                m_cachedRegisters = it->second.registers;
+                m_cachedSnapshot.currentThreadId = threadId;
+                if (m_cachedRegisters.instructionPointer != 0)
+                {
+                    m_cachedSnapshot.currentAddress = m_cachedRegisters.instructionPointer;
+                    m_navigationAddress = 0;
+                }
+                servedFromStopState = true;
+            }
+        }
+
+        if (servedFromStopState)
+        {
+            if (m_eventHandler)
+            {
+                m_eventHandler(Debugger::DirtyFlags::Registers, m_engine->get_snapshot());
+            }
+            return;
+        }
+
         std::packaged_task<StatusCode()> task(
             [this, generation, threadId]() -> StatusCode
             {
@@ -3042,40 +3192,10 @@ namespace Vertex::Model
                 newRegs.stackPointer = sdkRegs.stackPointer;
                 newRegs.basePointer = sdkRegs.basePointer;
 
-                for (const auto& [name, category, value, previousValue, bitWidth, modified]
+                for (const auto& sdkRegister
                     : std::span{sdkRegs.registers, std::min<std::uint32_t>(sdkRegs.registerCount, VERTEX_MAX_REGISTERS)})
                 {
-                    Debugger::Register reg{};
-                    reg.name = name;
-                    reg.value = value;
-                    reg.previousValue = previousValue;
-                    reg.bitWidth = bitWidth;
-                    reg.modified = modified != 0;
-
-                    switch (category)
-                    {
-                        case VERTEX_REG_SEGMENT:
-                            reg.category = Debugger::RegisterCategory::Segment;
-                            newRegs.segment.push_back(std::move(reg));
-                            break;
-                        case VERTEX_REG_FLAGS:
-                            reg.category = Debugger::RegisterCategory::Flags;
-                            newRegs.flags.push_back(std::move(reg));
-                            break;
-                        case VERTEX_REG_FLOATING_POINT:
-                            reg.category = Debugger::RegisterCategory::FloatingPoint;
-                            newRegs.floatingPoint.push_back(std::move(reg));
-                            break;
-                        case VERTEX_REG_VECTOR:
-                            reg.category = Debugger::RegisterCategory::Vector;
-                            newRegs.vector.push_back(std::move(reg));
-                            break;
-                        case VERTEX_REG_GENERAL:
-                        default:
-                            reg.category = Debugger::RegisterCategory::General;
-                            newRegs.generalPurpose.push_back(std::move(reg));
-                            break;
-                    }
+                    append_register(newRegs, sdkRegister);
                 }
 
                 wxTheApp->CallAfter([this, generation, threadId, newRegs = std::move(newRegs),
@@ -3178,17 +3298,7 @@ namespace Vertex::Model
                 for (const auto& sdkFrame
                     : std::span{sdkCallStack.frames, std::min<std::uint32_t>(sdkCallStack.frameCount, VERTEX_MAX_STACK_FRAMES)})
                 {
-                    Debugger::StackFrame frame{};
-                    frame.frameIndex = sdkFrame.frameIndex;
-                    frame.returnAddress = sdkFrame.returnAddress;
-                    frame.framePointer = sdkFrame.framePointer;
-                    frame.stackPointer = sdkFrame.stackPointer;
-                    frame.functionName = sdkFrame.functionName;
-                    frame.moduleName = sdkFrame.moduleName;
-                    frame.sourceFile = sdkFrame.sourceFile;
-                    frame.sourceLine = sdkFrame.sourceLine;
-
-                    newCallStack.frames.push_back(std::move(frame));
+                    newCallStack.frames.push_back(to_stack_frame(sdkFrame));
                 }
 
                 const auto frameCount = newCallStack.frames.size();
@@ -3210,6 +3320,7 @@ namespace Vertex::Model
 
                     {
                         std::scoped_lock lock{m_cacheMutex};
+                        resolve_call_stack_symbols(callStack, m_symbolIndex.get(), cached_function_tables());
                         m_cachedCallStack = std::move(callStack);
                     }
 
@@ -3247,6 +3358,27 @@ namespace Vertex::Model
 
         const auto generation = m_engine->get_generation();
 
+        bool servedFromStopState{};
+        {
+            std::scoped_lock lock{m_cacheMutex};
+            if (const auto it = m_cachedThreadStates.find(threadId);
+                it != m_cachedThreadStates.end() && m_threadStatesGeneration == generation && it->second.callStackComplete)
+            {
+                m_cachedCallStack = it->second.callStack;
+                resolve_call_stack_symbols(m_cachedCallStack, m_symbolIndex.get(), cached_function_tables());
+                servedFromStopState = true;
+            }
+        }
+
+        if (servedFromStopState)
+        {
+            if (m_eventHandler)
+            {
+                m_eventHandler(Debugger::DirtyFlags::CallStack, m_engine->get_snapshot());
+            }
+            return;
+        }
+
         std::packaged_task<StatusCode()> task(
             [this, generation, threadId]() -> StatusCode
             {
@@ -3273,17 +3405,7 @@ namespace Vertex::Model
                 for (const auto& sdkFrame
                     : std::span{sdkCallStack.frames, std::min<std::uint32_t>(sdkCallStack.frameCount, VERTEX_MAX_STACK_FRAMES)})
                 {
-                    Debugger::StackFrame frame{};
-                    frame.frameIndex = sdkFrame.frameIndex;
-                    frame.returnAddress = sdkFrame.returnAddress;
-                    frame.framePointer = sdkFrame.framePointer;
-                    frame.stackPointer = sdkFrame.stackPointer;
-                    frame.functionName = sdkFrame.functionName;
-                    frame.moduleName = sdkFrame.moduleName;
-                    frame.sourceFile = sdkFrame.sourceFile;
-                    frame.sourceLine = sdkFrame.sourceLine;
-
-                    newCallStack.frames.push_back(std::move(frame));
+                    newCallStack.frames.push_back(to_stack_frame(sdkFrame));
                 }
 
                 wxTheApp->CallAfter([this, generation, callStack = std::move(newCallStack)]() mutable
@@ -3295,6 +3417,7 @@ namespace Vertex::Model
 
                     {
                         std::scoped_lock lock{m_cacheMutex};
+                        resolve_call_stack_symbols(callStack, m_symbolIndex.get(), cached_function_tables());
                         m_cachedCallStack = std::move(callStack);
                     }
 
@@ -3541,7 +3664,14 @@ namespace Vertex::Model
         m_loggerService.log_info(fmt::format("{}: Register {} updated on thread {}",
             MODEL_NAME, registerName, threadId));
 
+        // The stop-state snapshot still holds the pre-write registers (and, for the instruction pointer, the old call stack).
+        {
+            std::scoped_lock lock{m_cacheMutex};
+            m_cachedThreadStates.erase(threadId);
+        }
+
         request_registers_for_thread(threadId);
+        request_call_stack_for_thread(threadId);
         return StatusCode::STATUS_OK;
     }
 
@@ -3950,26 +4080,12 @@ namespace Vertex::Model
 
                 const auto& plugin = pluginOpt.value().get();
 
-                ::ThreadList threadList{};
                 std::vector<Debugger::ThreadInfo> loadedThreads{};
+                std::unordered_map<std::uint32_t, ThreadStopState> threadStates{};
+                std::unordered_map<std::int32_t, std::string> priorityStrings{};
+                std::uint32_t currentThreadId{};
 
-                const auto threadResult = Runtime::safe_call(plugin.internal_vertex_debugger_get_threads, &threadList);
-                const auto taskStatus = Runtime::get_status(threadResult);
-                if (taskStatus != StatusCode::STATUS_OK)
-                {
-                    wxTheApp->CallAfter([this]()
-                    {
-                        m_queryThreads.inflight.store(false, std::memory_order_release);
-                        if (m_queryThreads.pendingRedispatch.load(std::memory_order_acquire))
-                        {
-                            request_threads();
-                        }
-                    });
-                    return taskStatus;
-                }
-
-                for (const auto& sdkThread
-                    : std::span{threadList.threads, std::min<std::uint32_t>(threadList.threadCount, VERTEX_MAX_THREADS)})
+                const auto append_thread = [&](const ::ThreadInfo& sdkThread)
                 {
                     Debugger::ThreadInfo thread{};
                     thread.id = sdkThread.id;
@@ -3978,40 +4094,84 @@ namespace Vertex::Model
                     thread.stackPointer = sdkThread.stackPointer;
                     thread.entryPoint = sdkThread.entryPoint;
                     thread.priority = sdkThread.priority;
-                    thread.isCurrent = (sdkThread.isCurrent != 0) || (sdkThread.id == threadList.currentThreadId);
+                    thread.isCurrent = (sdkThread.isCurrent != 0) || (sdkThread.id == currentThreadId);
+                    thread.state = to_thread_state(sdkThread.state);
 
-                    char* priorityStr = nullptr;
-                    const auto priorityResult = Runtime::safe_call(plugin.internal_vertex_debugger_thread_priority_value_to_string, sdkThread.priority, &priorityStr, nullptr);
-                    if (Runtime::status_ok(priorityResult) && priorityStr)
+                    auto [priorityIt, inserted] = priorityStrings.try_emplace(sdkThread.priority);
+                    if (inserted)
                     {
-                        thread.priorityString = priorityStr;
+                        char* priorityStr = nullptr;
+                        const auto priorityResult = Runtime::safe_call(plugin.internal_vertex_debugger_thread_priority_value_to_string, sdkThread.priority, &priorityStr, nullptr);
+                        if (Runtime::status_ok(priorityResult) && priorityStr)
+                        {
+                            priorityIt->second = priorityStr;
+                        }
                     }
+                    thread.priorityString = priorityIt->second;
+
+                    loadedThreads.push_back(std::move(thread));
+                };
+
+                const ::ThreadSnapshotRequest snapshotRequest{VERTEX_REGISTER_CATEGORY_ALL, THREAD_SNAPSHOT_FRAMES};
+                ::ThreadSnapshot threadSnapshot{};
+                const auto snapshotResult = Runtime::safe_call(plugin.internal_vertex_debugger_get_thread_snapshot, &snapshotRequest, &threadSnapshot);
+                if (Runtime::status_ok(snapshotResult))
+                {
+                    currentThreadId = threadSnapshot.currentThreadId;
 
-                    switch (sdkThread.state)
+                    for (const auto& entry : std::span{threadSnapshot.threads, threadSnapshot.threadCount})
                     {
-                        case VERTEX_THREAD_RUNNING:
-                            thread.state = Debugger::ThreadState::Running;
-                            break;
-                        case VERTEX_THREAD_SUSPENDED:
-                            thread.state = Debugger::ThreadState::Suspended;
-                            break;
-                        case VERTEX_THREAD_WAITING:
-                            thread.state = Debugger::ThreadState::Waiting;
-                            break;
-                        case VERTEX_THREAD_TERMINATED:
-                            thread.state = Debugger::ThreadState::Terminated;
-                            break;
-                        default:
-                            thread.state = Debugger::ThreadState::Running;
-                            break;
+                        append_thread(entry.thread);
+                        if (entry.status != StatusCode::STATUS_OK)
+                        {
+                            continue;
+                        }
+
+                        ThreadStopState& stopState = threadStates[entry.thread.id];
+                        stopState.registers.instructionPointer = entry.thread.instructionPointer;
+                        stopState.registers.stackPointer = entry.thread.stackPointer;
+                        stopState.registers.basePointer = entry.basePointer;
+                        for (const auto& sdkRegister : std::span{threadSnapshot.registers + entry.firstRegister, entry.registerCount})
+                        {
+                            append_register(stopState.registers, sdkRegister);
+                        }
+                        for (const auto& sdkFrame : std::span{threadSnapshot.frames + entry.firstFrame, entry.frameCount})
+                        {
+                            stopState.callStack.frames.push_back(to_stack_frame(sdkFrame));
+                        }
+                        stopState.callStackComplete = entry.frameCount < THREAD_SNAPSHOT_FRAMES;
                     }
 
-                    loadedThreads.push_back(std::move(thread));
+                    std::ignore = Runtime::safe_call(plugin.internal_vertex_debugger_free_thread_snapshot, &threadSnapshot);
                 }
+                else
+                {
+                    ::ThreadList threadList{};
+                    const auto threadResult = Runtime::safe_call(plugin.internal_vertex_debugger_get_threads, &threadList);
+                    const auto taskStatus = Runtime::get_status(threadResult);
+                    if (taskStatus != StatusCode::STATUS_OK)
+                    {
+                        wxTheApp->CallAfter([this]()
+                        {
+                            m_queryThreads.inflight.store(false, std::memory_order_release);
+                            if (m_queryThreads.pendingRedispatch.load(std::memory_order_acquire))
+                            {
+                                request_threads();
+                            }
+                        });
+                        return taskStatus;
+                    }
 
-                const auto currentThreadId = threadList.currentThreadId;
+                    currentThreadId = threadList.currentThreadId;
+                    for (const auto& sdkThread
+                        : std::span{threadList.threads, std::min<std::uint32_t>(threadList.threadCount, VERTEX_MAX_THREADS)})
+                    {
+                        append_thread(sdkThread);
+                    }
+                }
 
-                wxTheApp->CallAfter([this, generation, threads = std::move(loadedThreads), currentThreadId]() mutable
+                wxTheApp->CallAfter([this, generation, threads = std::move(loadedThreads), states = std::move(threadStates),
+                    currentThreadId]() mutable
                 {
                     m_queryThreads.inflight.store(false, std::memory_order_release);
 
@@ -4027,6 +4187,8 @@ namespace Vertex::Model
                     {
                         std::scoped_lock lock{m_cacheMutex};
                         m_cachedThreads = std::move(threads);
+                        m_cachedThreadStates = std::move(states);
+                        m_threadStatesGeneration = generation;
 
                         if (currentThreadId != 0 && m_cachedSnapshot.currentThreadId == 0)
                         {
@@ -4240,7 +4402,7 @@ namespace Vertex::Model
 
     void DebuggerModel::resolve_disassembly_symbols(Debugger::DisassemblyRange& range,
                                                      const std::span<const Debugger::ModuleInfo> modules,
-                                                     const std::unordered_map<std::uint64_t, std::string>& symbolTable)
+                                                     const Debugger::SymbolIndex* symbols)
     {
         if (range.lines.empty())
         {
@@ -4268,9 +4430,9 @@ namespace Vertex::Model
                 }
             }
 
-            if (auto it = symbolTable.find(line.address); it != symbolTable.end())
+            if (const auto name = symbols ? symbols->name_at(line.address) : std::nullopt; name.has_value())
             {
-                line.symbolName = it->second;
+                line.symbolName = *name;
                 line.isFunctionEntry = true;
             }
             else if (line.isFunctionEntry && line.symbolName.empty())
@@ -4283,12 +4445,9 @@ namespace Vertex::Model
                 line.symbolName = fmt::format("loc_{:X}", line.address);
             }
 
-            if (line.branchTarget.has_value() && line.targetSymbolName.empty())
+            if (line.branchTarget.has_value() && line.targetSymbolName.empty() && symbols)
             {
-                if (auto it = symbolTable.find(*line.branchTarget); it != symbolTable.end())
-                {
-                    line.targetSymbolName = it->second;
-                }
+                line.targetSymbolName = symbols->format(*line.branchTarget);
             }
 
             if (line.comment.empty())
@@ -4329,6 +4488,65 @@ namespace Vertex::Model
         }
     }
 
+    void DebuggerModel::resolve_call_stack_symbols(Debugger::CallStack& callStack, const Debugger::SymbolIndex* symbols,
+                                                   const std::span<const std::shared_ptr<const Debugger::ModuleFunctionTable>> functions)
+    {
+        for (auto& frame : callStack.frames)
+        {
+            if (!frame.functionName.empty())
+            {
+                continue;
+            }
+
+            frame.functionName = describe_code_address(symbols, functions, frame.returnAddress);
+            if (frame.moduleName.empty() && symbols)
+            {
+                if (const auto match = symbols->resolve(frame.returnAddress); match.has_value())
+                {
+                    frame.moduleName = match->moduleName;
+                }
+            }
+        }
+    }
+
+    void DebuggerModel::apply_function_bounds(Debugger::DisassemblyRange& range,
+                                              const std::span<const std::shared_ptr<const Debugger::ModuleFunctionTable>> functions)
+    {
+        if (functions.empty())
+        {
+            return;
+        }
+
+        const Debugger::ModuleFunctionTable* table{};
+        for (auto& line : range.lines)
+        {
+            if (line.functionStart != 0)
+            {
+                continue;
+            }
+
+            if (!table || !table->overlaps(line.address, 1))
+            {
+                const auto it = std::ranges::find_if(functions, [&line](const auto& candidate)
+                {
+                    return candidate->overlaps(line.address, 1);
+                });
+                table = it != functions.end() ? it->get() : nullptr;
+            }
+
+            if (!table)
+            {
+                continue;
+            }
+
+            if (const auto function = table->find(line.address); function.has_value())
+            {
+                line.functionStart = function->start;
+                line.isFunctionEntry = line.isFunctionEntry || function->start == line.address;
+            }
+        }
+    }
+
     void DebuggerModel::clear_cached_data()
     {
         std::scoped_lock lock{m_cacheMutex};
@@ -4341,6 +4559,8 @@ namespace Vertex::Model
         m_pendingBreakpointAdds.clear();
         m_cachedModules.clear();
         m_cachedThreads.clear();
+        m_cachedThreadStates.clear();
+        m_threadStatesGeneration = 0;
         m_cachedLogs.clear();
         m_cachedMemoryBlock = {};
         m_cachedImports.clear();
@@ -4349,135 +4569,526 @@ namespace Vertex::Model
         m_cachedWatchVariables.clear();
         m_cachedLocalVariables.clear();
         m_cachedException = {};
-        m_symbolTable.clear();
+        m_symbolIndex.reset();
         m_hasMemoryRequest.store(false, std::memory_order_release);
         m_queryMemory.pendingRedispatch.store(false, std::memory_order_release);
         m_memoryWriteGeneration = 0;
+
+        std::scoped_lock xrefLock{m_xrefIndexMutex};
+        m_xrefIndices.clear();
+        ++m_xrefIndexEpoch;
     }
 
-    void DebuggerModel::query_xrefs_to(const std::uint64_t address, XrefResultCallback callback) const
+    std::shared_ptr<const Debugger::ModuleXrefIndex> DebuggerModel::acquire_xref_index(Runtime::Plugin& plugin, const Debugger::ModuleInfo& module) const
     {
-        std::uint64_t moduleBase{};
-        std::uint64_t moduleSize{};
-        std::string moduleName{};
-        std::unordered_map<std::uint64_t, std::string> symbolTableCopy{};
-        std::vector<Debugger::ModuleInfo> modulesCopy{};
+        std::uint64_t epoch{};
+        {
+            std::scoped_lock lock{m_xrefIndexMutex};
+            if (const auto it = m_xrefIndices.find(module.baseAddress);
+                it != m_xrefIndices.end() && it->second.size == module.size && it->second.path == module.path)
+            {
+                return it->second.index;
+            }
+            epoch = m_xrefIndexEpoch;
+        }
+
+        const Debugger::XrefIndexBuildOptions options{
+            .workerCount = std::max(1u, std::thread::hardware_concurrency()),
+            .sliceBytes = XREF_INDEX_SLICE_BYTES,
+            .chunkBytes = XREF_SCAN_CHUNK_BYTES,
+            .chunkInstructions = XREF_SCAN_CHUNK_INSTRUCTIONS
+        };
+
+        const auto buildStart = std::chrono::steady_clock::now();
+        auto index = Debugger::ModuleXrefIndex::build(module.baseAddress, module.size, Debugger::plugin_disassembler(plugin), options);
+        const auto buildTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - buildStart);
+
+        // Writes to data leave the decoded code alone, so only the code ranges invalidate the index.
+        auto code = Debugger::image_code_ranges(module.baseAddress, module.size,
+            [&plugin](const std::uint64_t address, const std::uint64_t size, std::uint8_t* buffer)
+            {
+                return Runtime::get_status(Runtime::safe_call(
+                    plugin.internal_vertex_memory_read_process, address, size, reinterpret_cast<char*>(buffer)));
+            });
 
+        m_loggerService.log_info(fmt::format("{}: Indexed {} xrefs in module {} (0x{:X}+0x{:X}) in {} ms",
+            MODEL_NAME, index->reference_count(), module.name, module.baseAddress, module.size, buildTime.count()));
+
+        std::scoped_lock lock{m_xrefIndexMutex};
+        if (m_xrefIndexEpoch == epoch)
         {
-            std::scoped_lock lock{m_cacheMutex};
-            for (const auto& mod : m_cachedModules)
+            m_xrefIndices.insert_or_assign(module.baseAddress, XrefIndexSlot{
+                .path = module.path,
+                .size = module.size,
+                .index = index,
+                .code = std::move(code),
+                .graphs = std::make_shared<Debugger::ModuleControlFlowCache>()
+            });
+        }
+        return index;
+    }
+
+    void DebuggerModel::invalidate_xref_indices(const std::uint64_t address, const std::uint64_t size) const
+    {
+        std::scoped_lock lock{m_xrefIndexMutex};
+        const auto erased = std::erase_if(m_xrefIndices, [address, size](const auto& entry)
+        {
+            const auto& code = entry.second.code;
+            if (code.empty())
             {
-                if (address >= mod.baseAddress && address < mod.baseAddress + mod.size)
-                {
-                    moduleName = mod.name;
-                    moduleBase = mod.baseAddress;
-                    moduleSize = mod.size;
-                    break;
-                }
+                return entry.second.index->overlaps(address, size);
             }
-            symbolTableCopy = m_symbolTable;
-            modulesCopy = m_cachedModules;
+            return size != 0 && std::ranges::any_of(code, [address, size](const Debugger::CodeRange& range)
+            {
+                return address < range.end && range.begin < address + size;
+            });
+        });
+        if (erased != 0)
+        {
+            ++m_xrefIndexEpoch;
         }
+    }
 
-        if (moduleBase == 0 || moduleSize == 0)
+    void DebuggerModel::prune_xref_indices(const std::span<const Debugger::ModuleInfo> modules) const
+    {
+        std::scoped_lock lock{m_xrefIndexMutex};
+        const auto erased = std::erase_if(m_xrefIndices, [modules](const auto& entry)
         {
-            m_loggerService.log_warn(fmt::format("{}: Xref query for 0x{:X} - no containing module found", MODEL_NAME, address));
-            wxTheApp->CallAfter([cb = std::move(callback)]() { cb({}); });
-            return;
+            return std::ranges::none_of(modules, [&entry](const Debugger::ModuleInfo& mod)
+            {
+                return mod.baseAddress == entry.first && mod.size == entry.second.size && mod.path == entry.second.path;
+            });
+        });
+        if (erased != 0)
+        {
+            ++m_xrefIndexEpoch;
         }
+    }
 
-        m_loggerService.log_info(fmt::format("{}: Scanning module {} (0x{:X}+0x{:X}) for xrefs to 0x{:X}",
-            MODEL_NAME, moduleName, moduleBase, moduleSize, address));
+    std::shared_ptr<const Debugger::ModuleFunctionTable> DebuggerModel::acquire_function_table(Runtime::Plugin& plugin, const Debugger::ModuleInfo& module) const
+    {
+        {
+            std::scoped_lock lock{m_xrefIndexMutex};
+            if (const auto it = m_xrefIndices.find(module.baseAddress);
+                it != m_xrefIndices.end() && it->second.functions && it->second.size == module.size && it->second.path == module.path)
+            {
+                return it->second.functions;
+            }
+        }
 
-        auto sharedCallback = std::make_shared<XrefResultCallback>(std::move(callback));
+        // Call targets and plugin-flagged entry points come from the xref sweep, which also pins the slot
+        // the finished table is stored in.
+        const auto xrefs = acquire_xref_index(plugin, module);
+        const auto moduleEnd = module.baseAddress + module.size;
 
-        std::packaged_task<StatusCode()> task(
-            [this, address, moduleBase, moduleSize, sharedCallback,
-             symbols = std::move(symbolTableCopy), modules = std::move(modulesCopy)]() -> StatusCode
+        Debugger::FunctionDiscoveryHints hints{};
+        hints.knownStarts.assign(xrefs->function_starts().begin(), xrefs->function_starts().end());
+        {
+            std::scoped_lock lock{m_cacheMutex};
+            if (m_symbolIndex)
             {
-                auto pluginOpt = m_loaderService.get_active_plugin();
-                if (!pluginOpt.has_value())
+                for (const auto& span : m_symbolIndex->spans_in(module.baseAddress, moduleEnd))
                 {
-                    wxTheApp->CallAfter([cb = sharedCallback]() { (*cb)({}); });
-                    return StatusCode::STATUS_ERROR_PLUGIN_NOT_LOADED;
+                    hints.knownFunctions.push_back({.start = span.address, .size = span.size});
                 }
+            }
+        }
+        for (const auto& record : xrefs->references_from(module.baseAddress, moduleEnd))
+        {
+            if (record.type == Debugger::XrefType::Call && record.target >= module.baseAddress && record.target < moduleEnd)
+            {
+                hints.callTargets.push_back(record.target);
+            }
+        }
 
-                auto& plugin = pluginOpt.value().get();
-                std::vector<Debugger::XrefEntry> results{};
-                std::uint64_t scanAddr = moduleBase;
-                const std::uint64_t scanEnd = moduleBase + moduleSize;
+        const auto buildStart = std::chrono::steady_clock::now();
+        auto table = Debugger::ModuleFunctionTable::build(module.baseAddress, module.size,
+            [&plugin](const std::uint64_t address, const std::uint64_t size, std::uint8_t* buffer)
+            {
+                return Runtime::get_status(Runtime::safe_call(
+                    plugin.internal_vertex_memory_read_process, address, size, reinterpret_cast<char*>(buffer)));
+            },
+            hints);
+        const auto buildTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - buildStart);
+
+        m_loggerService.log_info(fmt::format("{}: Found {} functions ({} from unwind tables) in module {} in {} ms",
+            MODEL_NAME, table->ranges().size(), table->count_from(Debugger::FunctionSource::Unwind), module.name, buildTime.count()));
+
+        std::scoped_lock lock{m_xrefIndexMutex};
+        if (const auto it = m_xrefIndices.find(module.baseAddress); it != m_xrefIndices.end() && it->second.index == xrefs)
+        {
+            it->second.functions = table;
+        }
+        return table;
+    }
+
+    std::vector<std::shared_ptr<const Debugger::ModuleFunctionTable>> DebuggerModel::cached_function_tables() const
+    {
+        std::vector<std::shared_ptr<const Debugger::ModuleFunctionTable>> tables{};
+        std::scoped_lock lock{m_xrefIndexMutex};
+        for (const auto& slot : m_xrefIndices | std::views::values)
+        {
+            if (slot.functions)
+            {
+                tables.push_back(slot.functions);
+            }
+        }
+        return tables;
+    }
+
+    std::shared_ptr<const Debugger::ControlFlowGraph> DebuggerModel::acquire_control_flow(Runtime::Plugin& plugin, const Debugger::ModuleInfo& module,
+                                                                                          const std::uint64_t address) const
+    {
+        const auto functions = acquire_function_table(plugin, module);
+        const auto function = functions->find(address);
+        if (!function.has_value())
+        {
+            return nullptr;
+        }
+
+        // The graph cache lives in the module's xref slot so that memory writes and module reloads drop it
+        // together with the index it was derived from.
+        std::shared_ptr<Debugger::ModuleControlFlowCache> graphs{};
+        {
+            std::scoped_lock lock{m_xrefIndexMutex};
+            if (const auto it = m_xrefIndices.find(module.baseAddress); it != m_xrefIndices.end() && it->second.functions == functions)
+            {
+                graphs = it->second.graphs;
+            }
+        }
+
+        const auto disassemble = Debugger::plugin_disassembler(plugin);
+
+        return graphs ? graphs->acquire(*function, disassemble) : Debugger::ControlFlowGraph::build(*function, disassemble);
+    }
+
+    void DebuggerModel::prefetch_function_table(const std::uint64_t address)
+    {
+        std::optional<Debugger::ModuleInfo> module{};
+        {
+            std::scoped_lock lock{m_cacheMutex};
+            const auto it = std::ranges::find_if(m_cachedModules, [address](const Debugger::ModuleInfo& mod)
+            {
+                return address >= mod.baseAddress && address < mod.baseAddress + mod.size;
+            });
+            if (it != m_cachedModules.end() && it->baseAddress != 0)
+            {
+                module = *it;
+            }
+        }
 
-                while (scanAddr < scanEnd)
+        if (!module.has_value())
+        {
+            return;
+        }
+
+        {
+            std::scoped_lock lock{m_xrefIndexMutex};
+            if (const auto it = m_xrefIndices.find(module->baseAddress); it != m_xrefIndices.end() && it->second.functions)
+            {
+                return;
+            }
+            if (!m_functionTableBuilds.insert(module->baseAddress).second)
+            {
+                return;
+            }
+        }
+
+        const auto generation = m_engine->get_generation();
+        const auto baseAddress = module->baseAddress;
+
+        std::packaged_task<StatusCode()> task(
+            [this, generation, mod = std::move(*module)]() -> StatusCode
+            {
+                auto pluginOpt = m_loaderService.get_active_plugin();
+                if (pluginOpt.has_value())
                 {
-                    const auto chunkSize = static_cast<std::uint32_t>(
-                        std::min<std::uint64_t>(XREF_SCAN_CHUNK_BYTES, scanEnd - scanAddr));
+                    std::ignore = acquire_function_table(pluginOpt.value().get(), mod);
+                }
 
-                    std::vector<::DisassemblerResult> resultBuffer(XREF_SCAN_CHUNK_INSTRUCTIONS);
-                    ::DisassemblerResults disasmResults{};
-                    disasmResults.results = resultBuffer.data();
-                    disasmResults.count = 0;
-                    disasmResults.capacity = static_cast<std::uint32_t>(XREF_SCAN_CHUNK_INSTRUCTIONS);
-                    disasmResults.startAddress = scanAddr;
+                wxTheApp->CallAfter([this, generation, baseAddress = mod.baseAddress]()
+                {
+                    {
+                        std::scoped_lock lock{m_xrefIndexMutex};
+                        m_functionTableBuilds.erase(baseAddress);
+                    }
 
-                    const auto status = Runtime::safe_call(
-                        plugin.internal_vertex_process_disassemble_range,
-                        scanAddr, chunkSize, &disasmResults);
+                    if (m_engine->get_generation() != generation)
+                    {
+                        return;
+                    }
 
-                    if (!Runtime::status_ok(status) || disasmResults.count == 0)
                     {
-                        scanAddr += chunkSize;
-                        continue;
+                        std::scoped_lock lock{m_cacheMutex};
+                        const auto functions = cached_function_tables();
+                        apply_function_bounds(m_cachedDisassembly, functions);
+                        resolve_disassembly_symbols(m_cachedDisassembly, m_cachedModules, m_symbolIndex.get());
+                        resolve_call_stack_symbols(m_cachedCallStack, m_symbolIndex.get(), functions);
                     }
 
-                    for (const auto& instr : std::span{disasmResults.results, disasmResults.count})
+                    if (m_eventHandler)
                     {
-                        if (instr.targetAddress != address)
-                        {
-                            continue;
-                        }
+                        m_eventHandler(Debugger::DirtyFlags::Disassembly | Debugger::DirtyFlags::CallStack, m_engine->get_snapshot());
+                    }
+                });
 
-                        Debugger::XrefEntry entry{};
-                        entry.address = instr.address;
-                        entry.targetAddress = address;
+                return pluginOpt.has_value() ? StatusCode::STATUS_OK : StatusCode::STATUS_ERROR_PLUGIN_NOT_LOADED;
+            });
 
-                        if (auto it = symbols.find(instr.address); it != symbols.end())
-                        {
-                            entry.symbolName = it->second;
-                        }
+        const auto result = m_dispatcher.dispatch_with_priority(
+            Thread::ThreadChannel::Scanner,
+            Thread::DispatchPriority::Low,
+            std::move(task));
 
-                        for (const auto& mod : modules)
-                        {
-                            if (instr.address >= mod.baseAddress &&
-                                instr.address < mod.baseAddress + mod.size)
-                            {
-                                entry.moduleName = mod.name;
-                                break;
-                            }
-                        }
+        if (!result.has_value())
+        {
+            std::scoped_lock lock{m_xrefIndexMutex};
+            m_functionTableBuilds.erase(baseAddress);
+        }
+    }
 
-                        switch (instr.branchType)
-                        {
-                            case VERTEX_BRANCH_CALL:
-                            case VERTEX_BRANCH_INDIRECT_CALL:
-                                entry.type = Debugger::XrefType::Call;
-                                break;
-                            case VERTEX_BRANCH_CONDITIONAL:
-                                entry.type = Debugger::XrefType::ConditionalJump;
-                                break;
-                            case VERTEX_BRANCH_LOOP:
-                                entry.type = Debugger::XrefType::Loop;
-                                break;
-                            default:
-                                entry.type = Debugger::XrefType::UnconditionalJump;
-                                break;
-                        }
+    void DebuggerModel::query_function_at(const std::uint64_t address, FunctionRangeCallback callback) const
+    {
+        std::optional<Debugger::ModuleInfo> module{};
+        {
+            std::scoped_lock lock{m_cacheMutex};
+            const auto it = std::ranges::find_if(m_cachedModules, [address](const Debugger::ModuleInfo& mod)
+            {
+                return address >= mod.baseAddress && address < mod.baseAddress + mod.size;
+            });
+            if (it != m_cachedModules.end() && it->baseAddress != 0 && it->size != 0)
+            {
+                module = *it;
+            }
+        }
+
+        if (!module.has_value())
+        {
+            wxTheApp->CallAfter([cb = std::move(callback)]() { cb(std::nullopt); });
+            return;
+        }
+
+        auto sharedCallback = std::make_shared<FunctionRangeCallback>(std::move(callback));
+
+        std::packaged_task<StatusCode()> task(
+            [this, address, sharedCallback, mod = std::move(*module)]() -> StatusCode
+            {
+                auto pluginOpt = m_loaderService.get_active_plugin();
+                if (!pluginOpt.has_value())
+                {
+                    wxTheApp->CallAfter([cb = sharedCallback]() { (*cb)(std::nullopt); });
+                    return StatusCode::STATUS_ERROR_PLUGIN_NOT_LOADED;
+                }
+
+                const auto functions = acquire_function_table(pluginOpt.value().get(), mod);
+                wxTheApp->CallAfter([cb = sharedCallback, function = functions->find(address)]() { (*cb)(function); });
+                return StatusCode::STATUS_OK;
+            });
+
+        const auto result = m_dispatcher.dispatch_with_priority(
+            Thread::ThreadChannel::Scanner,
+            Thread::DispatchPriority::Normal,
+            std::move(task));
+
+        if (!result.has_value())
+        {
+            m_loggerService.log_error(fmt::format("{}: Failed to dispatch function lookup", MODEL_NAME));
+            wxTheApp->CallAfter([cb = sharedCallback]() { (*cb)(std::nullopt); });
+        }
+    }
+
+    void DebuggerModel::query_control_flow(const std::uint64_t address, ControlFlowCallback callback) const
+    {
+        std::optional<Debugger::ModuleInfo> module{};
+        {
+            std::scoped_lock lock{m_cacheMutex};
+            const auto it = std::ranges::find_if(m_cachedModules, [address](const Debugger::ModuleInfo& mod)
+            {
+                return address >= mod.baseAddress && address < mod.baseAddress + mod.size;
+            });
+            if (it != m_cachedModules.end() && it->baseAddress != 0 && it->size != 0)
+            {
+                module = *it;
+            }
+        }
+
+        if (!module.has_value())
+        {
+            wxTheApp->CallAfter([cb = std::move(callback)]() { cb(nullptr); });
+            return;
+        }
+
+        auto sharedCallback = std::make_shared<ControlFlowCallback>(std::move(callback));
+
+        std::packaged_task<StatusCode()> task(
+            [this, address, sharedCallback, mod = std::move(*module)]() -> StatusCode
+            {
+                auto pluginOpt = m_loaderService.get_active_plugin();
+                if (!pluginOpt.has_value())
+                {
+                    wxTheApp->CallAfter([cb = sharedCallback]() { (*cb)(nullptr); });
+                    return StatusCode::STATUS_ERROR_PLUGIN_NOT_LOADED;
+                }
+
+                auto graph = acquire_control_flow(pluginOpt.value().get(), mod, address);
+                wxTheApp->CallAfter([cb = sharedCallback, graph = std::move(graph)]() { (*cb)(graph); });
+                return StatusCode::STATUS_OK;
+            });
+
+        const auto result = m_dispatcher.dispatch_with_priority(
+            Thread::ThreadChannel::Scanner,
+            Thread::DispatchPriority::Normal,
+            std::move(task));
+
+        if (!result.has_value())
+        {
+            m_loggerService.log_error(fmt::format("{}: Failed to dispatch control flow query", MODEL_NAME));
+            wxTheApp->CallAfter([cb = sharedCallback]() { (*cb)(nullptr); });
+        }
+    }
+
+    void DebuggerModel::generate_signature(const std::uint64_t address, SignatureCallback callback) const
+    {
+        std::optional<Debugger::ModuleInfo> module{};
+        {
+            std::scoped_lock lock{m_cacheMutex};
+            const auto it = std::ranges::find_if(m_cachedModules, [address](const Debugger::ModuleInfo& mod)
+            {
+                return address >= mod.baseAddress && address < mod.baseAddress + mod.size;
+            });
+            if (it != m_cachedModules.end() && it->baseAddress != 0 && it->size != 0)
+            {
+                module = *it;
+            }
+        }
+
+        if (!module.has_value())
+        {
+            wxTheApp->CallAfter([cb = std::move(callback)]() { cb(std::unexpected{StatusCode::STATUS_ERROR_INVALID_PARAMETER}); });
+            return;
+        }
+
+        auto sharedCallback = std::make_shared<SignatureCallback>(std::move(callback));
+
+        std::packaged_task<StatusCode()> task(
+            [this, address, sharedCallback, mod = std::move(*module)]() -> StatusCode
+            {
+                auto pluginOpt = m_loaderService.get_active_plugin();
+                if (!pluginOpt.has_value())
+                {
+                    wxTheApp->CallAfter([cb = sharedCallback]() { (*cb)(std::unexpected{StatusCode::STATUS_ERROR_PLUGIN_NOT_LOADED}); });
+                    return StatusCode::STATUS_ERROR_PLUGIN_NOT_LOADED;
+                }
+                auto& plugin = pluginOpt.value().get();
+
+                const auto start = std::chrono::steady_clock::now();
+                const Debugger::CodeSignatureGenerator generator{mod.baseAddress, mod.size,
+                    [&plugin](const std::uint64_t readAddress, const std::uint64_t size, std::uint8_t* buffer)
+                    {
+                        return Runtime::get_status(Runtime::safe_call(
+                            plugin.internal_vertex_memory_read_process, readAddress, size, reinterpret_cast<char*>(buffer)));
+                    },
+                    {.workerCount = std::max(1u, std::thread::hardware_concurrency())}};
+
+                auto signature = generator.generate(address, Debugger::plugin_disassembler(plugin));
+                const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+                if (signature.has_value())
+                {
+                    m_loggerService.log_info(fmt::format("{}: Generated {}-byte signature for {:#x} in module {} ({} matches) in {} ms",
+                        MODEL_NAME, signature->bytes.size(), address, mod.name, signature->matchCount, elapsed.count()));
+                }
+
+                const auto status = signature.has_value() ? StatusCode::STATUS_OK : signature.error();
+                wxTheApp->CallAfter([cb = sharedCallback, signature = std::move(signature)]() { (*cb)(signature); });
+                return status;
+            });
+
+        const auto result = m_dispatcher.dispatch_with_priority(
+            Thread::ThreadChannel::Scanner,
+            Thread::DispatchPriority::Normal,
+            std::move(task));
+
+        if (!result.has_value())
+        {
+            m_loggerService.log_error(fmt::format("{}: Failed to dispatch signature generation", MODEL_NAME));
+            wxTheApp->CallAfter([cb = sharedCallback]() { (*cb)(std::unexpected{StatusCode::STATUS_ERROR_GENERAL}); });
+        }
+    }
+
+    void DebuggerModel::query_xrefs_to(const std::uint64_t address, XrefResultCallback callback) const
+    {
+        std::vector<Debugger::ModuleInfo> searchModules{};
+        std::shared_ptr<const Debugger::SymbolIndex> symbols{};
+
+        {
+            std::scoped_lock lock{m_cacheMutex};
+            symbols = m_symbolIndex;
+            for (const auto& mod : m_cachedModules)
+            {
+                if (address >= mod.baseAddress && address < mod.baseAddress + mod.size)
+                {
+                    searchModules.push_back(mod);
+                    break;
+                }
+            }
 
-                        results.push_back(std::move(entry));
+            // Heap and other unmapped-image addresses, typically scan results, can only be referenced by
+            // absolute operands, so the main image and every module indexed so far are searched instead.
+            if (searchModules.empty() && !m_cachedModules.empty())
+            {
+                std::scoped_lock xrefLock{m_xrefIndexMutex};
+                for (const auto& mod : m_cachedModules)
+                {
+                    if (&mod == &m_cachedModules.front() || m_xrefIndices.contains(mod.baseAddress))
+                    {
+                        searchModules.push_back(mod);
                     }
+                }
+            }
+        }
+
+        std::erase_if(searchModules, [](const Debugger::ModuleInfo& mod)
+        {
+            return mod.baseAddress == 0 || mod.size == 0;
+        });
+
+        if (searchModules.empty())
+        {
+            m_loggerService.log_warn(fmt::format("{}: Xref query for 0x{:X} - no module to search", MODEL_NAME, address));
+            wxTheApp->CallAfter([cb = std::move(callback)]() { cb({}); });
+            return;
+        }
+
+        auto sharedCallback = std::make_shared<XrefResultCallback>(std::move(callback));
 
-                    const auto& lastInstr = disasmResults.results[disasmResults.count - 1];
-                    const auto nextAddr = lastInstr.address + lastInstr.size;
-                    scanAddr = (nextAddr > scanAddr) ? nextAddr : scanAddr + chunkSize;
+        std::packaged_task<StatusCode()> task(
+            [this, address, sharedCallback, modules = std::move(searchModules), symbols = std::move(symbols)]() -> StatusCode
+            {
+                auto pluginOpt = m_loaderService.get_active_plugin();
+                if (!pluginOpt.has_value())
+                {
+                    wxTheApp->CallAfter([cb = sharedCallback]() { (*cb)({}); });
+                    return StatusCode::STATUS_ERROR_PLUGIN_NOT_LOADED;
+                }
+
+                std::vector<Debugger::XrefEntry> results{};
+                for (const auto& mod : modules)
+                {
+                    const auto index = acquire_xref_index(pluginOpt.value().get(), mod);
+                    const std::array functions{acquire_function_table(pluginOpt.value().get(), mod)};
+                    for (const auto& record : index->references_to(address))
+                    {
+                        results.push_back(Debugger::XrefEntry{
+                            .address = record.source,
+                            .targetAddress = record.target,
+                            .type = record.type,
+                            .symbolName = describe_code_address(symbols.get(), functions, record.source),
+                            .moduleName = mod.name,
+                            .access = record.access,
+                            .operandSize = record.operandSize
+                        });
+                    }
                 }
 
                 wxTheApp->CallAfter([cb = sharedCallback, res = std::move(results)]() mutable
@@ -4495,7 +5106,7 @@ namespace Vertex::Model
 
         if (!result.has_value())
         {
-            m_loggerService.log_error(fmt::format("{}: Failed to dispatch xref-to scan", MODEL_NAME));
+            m_loggerService.log_error(fmt::format("{}: Failed to dispatch xref-to query", MODEL_NAME));
             wxTheApp->CallAfter([cb = sharedCallback]() { (*cb)({}); });
         }
     }
@@ -4503,13 +5114,13 @@ namespace Vertex::Model
     void DebuggerModel::query_xrefs_from(const std::uint64_t address, XrefResultCallback callback)
     {
         std::uint64_t functionStart{};
-        std::uint64_t moduleBase{};
-        std::uint64_t moduleSize{};
-        std::unordered_map<std::uint64_t, std::string> symbolTableCopy{};
-        std::vector<Debugger::ModuleInfo> modulesCopy{};
+        std::uint64_t functionEnd{};
+        std::optional<Debugger::ModuleInfo> module{};
+        std::shared_ptr<const Debugger::SymbolIndex> symbols{};
 
         {
             std::scoped_lock lock{m_cacheMutex};
+            symbols = m_symbolIndex;
 
             for (const auto& line : m_cachedDisassembly.lines)
             {
@@ -4524,59 +5135,57 @@ namespace Vertex::Model
             {
                 if (address >= mod.baseAddress && address < mod.baseAddress + mod.size)
                 {
-                    moduleBase = mod.baseAddress;
-                    moduleSize = mod.size;
+                    module = mod;
+                    const auto moduleEnd = mod.baseAddress + mod.size;
 
-                    if (functionStart == 0)
+                    std::uint64_t bestSymbol{};
+                    std::uint64_t nextSymbol{moduleEnd};
+                    if (symbols)
                     {
-                        std::uint64_t bestSymbol{};
-                        for (const auto& symAddr : m_symbolTable | std::views::keys)
+                        if (const auto before = symbols->symbol_at_or_before(address); before.value_or(0) >= mod.baseAddress)
                         {
-                            if (symAddr >= mod.baseAddress && symAddr <= address && symAddr > bestSymbol)
-                            {
-                                bestSymbol = symAddr;
-                            }
+                            bestSymbol = *before;
                         }
-                        functionStart = bestSymbol;
+                        nextSymbol = std::min(nextSymbol, symbols->symbol_after(address).value_or(moduleEnd));
                     }
 
-                    if (functionStart == 0)
+                    std::uint64_t bestExport{};
+                    for (const auto& exp : m_cachedExports)
                     {
-                        std::uint64_t bestExport{};
-                        for (const auto& exp : m_cachedExports)
+                        if (exp.address >= mod.baseAddress && exp.address <= address && exp.address > bestExport)
                         {
-                            if (exp.address >= mod.baseAddress && exp.address <= address && exp.address > bestExport)
-                            {
-                                bestExport = exp.address;
-                            }
+                            bestExport = exp.address;
+                        }
+                        else if (exp.address > address && exp.address < nextSymbol)
+                        {
+                            nextSymbol = exp.address;
                         }
-                        functionStart = bestExport;
                     }
 
+                    if (functionStart == 0)
+                    {
+                        functionStart = bestSymbol != 0 ? bestSymbol : bestExport;
+                    }
+                    functionEnd = nextSymbol;
                     break;
                 }
             }
-
-            symbolTableCopy = m_symbolTable;
-            modulesCopy = m_cachedModules;
         }
 
-        if (moduleBase == 0 || moduleSize == 0)
+        if (!module.has_value() || module->baseAddress == 0 || module->size == 0)
         {
             wxTheApp->CallAfter([cb = std::move(callback)]() { cb({}); });
             return;
         }
 
-        const bool needsProbe = (functionStart == 0);
-
-        m_loggerService.log_info(fmt::format("{}: Scanning for outgoing xrefs from 0x{:X} (functionStart=0x{:X}, probe={})",
-            MODEL_NAME, address, functionStart, needsProbe));
+        m_loggerService.log_info(fmt::format("{}: Querying outgoing xrefs from 0x{:X} (functionStart=0x{:X})",
+            MODEL_NAME, address, functionStart));
 
         auto sharedCallback = std::make_shared<XrefResultCallback>(std::move(callback));
 
         std::packaged_task<StatusCode()> task(
-            [this, address, functionStart, moduleBase, moduleSize, needsProbe, sharedCallback,
-             symbols = std::move(symbolTableCopy), modules = std::move(modulesCopy)]() -> StatusCode
+            [this, address, functionStart, functionEnd, sharedCallback, mod = std::move(*module),
+                symbols = std::move(symbols)]() -> StatusCode
             {
                 auto pluginOpt = m_loaderService.get_active_plugin();
                 if (!pluginOpt.has_value())
@@ -4585,168 +5194,42 @@ namespace Vertex::Model
                     return StatusCode::STATUS_ERROR_PLUGIN_NOT_LOADED;
                 }
 
-                auto& plugin = pluginOpt.value().get();
+                const auto index = acquire_xref_index(pluginOpt.value().get(), mod);
+                const auto functions = acquire_function_table(pluginOpt.value().get(), mod);
 
                 auto resolvedStart = functionStart;
-
-                if (needsProbe)
+                auto resolvedEnd = functionEnd;
+                if (const auto function = functions->find(address); function.has_value())
                 {
-                    const auto probeStart = std::max(moduleBase, address - XREF_BACKWARD_PROBE_BYTES);
-                    const auto probeSize = static_cast<std::uint32_t>(address - probeStart + 1);
-
-                    std::vector<::DisassemblerResult> probeBuffer(XREF_SCAN_CHUNK_INSTRUCTIONS);
-                    ::DisassemblerResults probeResults{};
-                    probeResults.results = probeBuffer.data();
-                    probeResults.count = 0;
-                    probeResults.capacity = static_cast<std::uint32_t>(probeBuffer.size());
-                    probeResults.startAddress = probeStart;
-
-                    const auto probeStatus = Runtime::safe_call(
-                        plugin.internal_vertex_process_disassemble_range,
-                        probeStart, probeSize, &probeResults);
-
-                    if (Runtime::status_ok(probeStatus) && probeResults.count > 0)
-                    {
-                        for (const auto& instr : std::span{probeResults.results, probeResults.count})
-                        {
-                            if (instr.address > address)
-                            {
-                                break;
-                            }
-
-                            if ((instr.flags & VERTEX_FLAG_ENTRY_POINT) != 0 ||
-                                (instr.functionStart != 0 && instr.functionStart == instr.address))
-                            {
-                                resolvedStart = instr.address;
-                            }
-                        }
-                    }
-
-                    if (resolvedStart == 0)
-                    {
-                        resolvedStart = probeStart;
-                    }
+                    resolvedStart = function->start;
+                    resolvedEnd = function->end;
                 }
-
-                std::vector<Debugger::XrefEntry> results{};
-
-                struct PairHash final
-                {
-                    std::size_t operator()(const std::pair<std::uint64_t, std::uint64_t>& p) const noexcept
-                    {
-                        return std::hash<std::uint64_t>{}(p.first) ^ (std::hash<std::uint64_t>{}(p.second) << 32);
-                    }
-                };
-                std::unordered_set<std::pair<std::uint64_t, std::uint64_t>, PairHash> seenPairs{};
-
-                const auto moduleEnd = moduleBase + moduleSize;
-                auto scanCursor = resolvedStart;
-                bool pastFunctionStart{};
-                bool hitFunctionBoundary{};
-
-                std::vector<::DisassemblerResult> resultBuffer(XREF_SCAN_CHUNK_INSTRUCTIONS * 2);
-
-                while (scanCursor < moduleEnd && !hitFunctionBoundary)
+                else
                 {
-                    const auto chunkSize = static_cast<std::uint32_t>(
-                        std::min<std::uint64_t>(XREF_SCAN_CHUNK_BYTES, moduleEnd - scanCursor));
-
-                    if (chunkSize == 0)
-                    {
-                        break;
-                    }
-
-                    ::DisassemblerResults disasmResults{};
-                    disasmResults.results = resultBuffer.data();
-                    disasmResults.count = 0;
-                    disasmResults.capacity = static_cast<std::uint32_t>(resultBuffer.size());
-                    disasmResults.startAddress = scanCursor;
-
-                    const auto status = Runtime::safe_call(
-                        plugin.internal_vertex_process_disassemble_range,
-                        scanCursor, chunkSize, &disasmResults);
-
-                    if (!Runtime::status_ok(status) || disasmResults.count == 0)
-                    {
-                        break;
-                    }
-
-                    for (const auto& instr : std::span{disasmResults.results, disasmResults.count})
+                    if (resolvedStart == 0)
                     {
-                        if (instr.address == resolvedStart)
-                        {
-                            pastFunctionStart = true;
-                        }
-                        else if (pastFunctionStart && instr.address > address &&
-                                 ((instr.flags & VERTEX_FLAG_ENTRY_POINT) != 0 ||
-                                  (instr.functionStart != 0 && instr.functionStart == instr.address)))
-                        {
-                            hitFunctionBoundary = true;
-                            break;
-                        }
-
-                        if (!pastFunctionStart || instr.targetAddress == 0)
-                        {
-                            continue;
-                        }
-
-                        if (!seenPairs.emplace(instr.address, instr.targetAddress).second)
-                        {
-                            continue;
-                        }
-
-                        Debugger::XrefEntry entry{};
-                        entry.address = instr.address;
-                        entry.targetAddress = instr.targetAddress;
-
-                        if (auto it = symbols.find(instr.targetAddress); it != symbols.end())
-                        {
-                            entry.symbolName = it->second;
-                        }
-                        else if (instr.targetSymbol[0] != '\0')
-                        {
-                            entry.symbolName = instr.targetSymbol;
-                        }
-
-                        for (const auto& mod : modules)
-                        {
-                            if (instr.address >= mod.baseAddress &&
-                                instr.address < mod.baseAddress + mod.size)
-                            {
-                                entry.moduleName = mod.name;
-                                break;
-                            }
-                        }
-
-                        switch (instr.branchType)
-                        {
-                            case VERTEX_BRANCH_CALL:
-                            case VERTEX_BRANCH_INDIRECT_CALL:
-                                entry.type = Debugger::XrefType::Call;
-                                break;
-                            case VERTEX_BRANCH_CONDITIONAL:
-                                entry.type = Debugger::XrefType::ConditionalJump;
-                                break;
-                            case VERTEX_BRANCH_LOOP:
-                                entry.type = Debugger::XrefType::Loop;
-                                break;
-                            default:
-                                entry.type = Debugger::XrefType::UnconditionalJump;
-                                break;
-                        }
-
-                        results.push_back(std::move(entry));
+                        resolvedStart = index->function_start_at_or_before(address).value_or(
+                            std::max(mod.baseAddress, address - std::min<std::uint64_t>(address, XREF_BACKWARD_PROBE_BYTES)));
                     }
 
-                    const auto& lastInstr = resultBuffer[disasmResults.count - 1];
-                    const auto nextAddress = lastInstr.address + lastInstr.size;
-
-                    if (nextAddress <= scanCursor)
+                    if (const auto nextStart = index->function_start_after(address); nextStart.has_value())
                     {
-                        break;
+                        resolvedEnd = std::min(resolvedEnd, *nextStart);
                     }
+                }
 
-                    scanCursor = nextAddress;
+                std::vector<Debugger::XrefEntry> results{};
+                for (const auto& record : index->references_from(resolvedStart, resolvedEnd))
+                {
+                    results.push_back(Debugger::XrefEntry{
+                        .address = record.source,
+                        .targetAddress = record.target,
+                        .type = record.type,
+                        .symbolName = target_symbol_name(symbols.get(), *index, record.target),
+                        .moduleName = mod.name,
+                        .access = record.access,
+                        .operandSize = record.operandSize
+                    });
                 }
 
                 wxTheApp->CallAfter([cb = sharedCallback, res = std::move(results)]() mutable
@@ -4764,7 +5247,7 @@ namespace Vertex::Model
 
         if (!result.has_value())
         {
-            m_loggerService.log_error(fmt::format("{}: Failed to dispatch xref-from scan", MODEL_NAME));
+            m_loggerService.log_error(fmt::format("{}: Failed to dispatch xref-from query", MODEL_NAME));
             wxTheApp->CallAfter([cb = sharedCallback]() { (*cb)({}); });
         }
     }
@@ -4779,6 +5262,12 @@ namespace Vertex::Model
         return m_cachedExports;
     }
 
+    std::shared_ptr<const Debugger::SymbolIndex> DebuggerModel::get_symbol_index() const
+    {
+        std::scoped_lock lock{m_cacheMutex};
+        return m_symbolIndex;
+    }
+
     bool DebuggerModel::get_ui_state_bool(const std::string_view key, const bool defaultValue) const
     {
         const std::string keyStr{key};
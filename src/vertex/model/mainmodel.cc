@@ -15,6 +15,7 @@
 #include <vertex/thread/threadchannel.hh>
 #include <sdk/memory.h>
 #include <array>
+#include <cstdlib>
 #include <ranges>
 #include <algorithm>
 #include <limits>
@@ -985,6 +986,40 @@ namespace Vertex::Model
         return StatusCode::STATUS_OK;
     }
 
+    StatusCode MainModel::extend_scan() const
+    {
+        std::vector<MemoryRegion> regions{};
+        const auto queryStatus = query_memory_regions(regions);
+        if (queryStatus != StatusCode::STATUS_OK)
+        {
+            m_loggerService.log_error(fmt::format("{}: Failed to query memory regions", MODEL_NAME));
+            return queryStatus;
+        }
+
+        auto scanRegions = regions |
+                           std::views::transform(
+                             [](const auto& region)
+                             {
+                                 return Scanner::ScanRegion{.baseAddress = region.baseAddress, .size = region.regionSize};
+                             }) |
+                           std::ranges::to<std::vector>();
+
+        ensure_memory_reader_setup();
+
+        const auto commandId = m_scannerService.send_command(
+            Scanner::service::CmdExtendScan{.regions = std::move(scanRegions)});
+        if (commandId == Runtime::INVALID_COMMAND_ID)
+        {
+            return StatusCode::STATUS_SHUTDOWN;
+        }
+        const auto immediate = m_scannerService.await_result(commandId, std::chrono::milliseconds{0});
+        if (immediate.code != StatusCode::STATUS_TIMEOUT)
+        {
+            return immediate.code;
+        }
+        return StatusCode::STATUS_OK;
+    }
+
     StatusCode MainModel::undo_scan() const
     {
         const auto commandId = m_scannerService.send_command(Scanner::service::CmdUndoScan{});
@@ -1000,6 +1035,50 @@ namespace Vertex::Model
         return StatusCode::STATUS_OK;
     }
 
+    StatusCode MainModel::export_scan_session(const std::filesystem::path& path) const
+    {
+        std::vector<Scanner::ScanRegion> modules{};
+        if (query_session_modules(modules) != StatusCode::STATUS_OK)
+        {
+            m_loggerService.log_warn(fmt::format("{}: Exporting scan session without module table", MODEL_NAME));
+            modules.clear();
+        }
+
+        const auto commandId = m_scannerService.send_command(
+            Scanner::service::CmdExportSession{.path = path, .modules = std::move(modules)});
+        if (commandId == Runtime::INVALID_COMMAND_ID)
+        {
+            return StatusCode::STATUS_SHUTDOWN;
+        }
+        return m_scannerService.await_result(commandId).code;
+    }
+
+    StatusCode MainModel::import_scan_session(const std::filesystem::path& path, Scanner::TypeId& importedTypeId) const
+    {
+        std::vector<Scanner::ScanRegion> modules{};
+        if (query_session_modules(modules) != StatusCode::STATUS_OK)
+        {
+            m_loggerService.log_warn(fmt::format("{}: Importing scan session without module table, module-relative results will be dropped", MODEL_NAME));
+            modules.clear();
+        }
+
+        ensure_memory_reader_setup();
+
+        const auto commandId = m_scannerService.send_command(
+            Scanner::service::CmdImportSession{.path = path, .modules = std::move(modules)});
+        if (commandId == Runtime::INVALID_COMMAND_ID)
+        {
+            return StatusCode::STATUS_SHUTDOWN;
+        }
+
+        const auto result = m_scannerService.await_result(commandId);
+        if (const auto* payload = std::get_if<Scanner::service::ImportSessionResultPayload>(&result.payload))
+        {
+            importedTypeId = payload->id;
+        }
+        return result.code;
+    }
+
     StatusCode MainModel::stop_scan() const
     {
         const auto commandId = m_scannerService.send_command(Scanner::service::CmdStopScan{});
@@ -1035,6 +1114,11 @@ namespace Vertex::Model
         return m_scannerService.snapshot_results(results, startIndex, count);
     }
 
+    StatusCode MainModel::get_scan_results_page(Scanner::ScanResultPage& page, const std::size_t startIndex, const std::size_t count) const
+    {
+        return m_scannerService.snapshot_results_page(page, startIndex, count);
+    }
+
     StatusCode MainModel::get_file_executable_extensions(std::vector<std::string>& extensions) const
     {
         extensions.clear();
@@ -1202,6 +1286,61 @@ namespace Vertex::Model
         return dispatchResult.value().get();
     }
 
+    StatusCode MainModel::query_session_modules(std::vector<Scanner::ScanRegion>& modules) const
+    {
+        if (m_loaderService.has_plugin_loaded() != StatusCode::STATUS_OK)
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_NOT_ACTIVE;
+        }
+
+        std::vector<::ModuleInformation> internalModules{};
+
+        std::packaged_task<StatusCode()> task(
+          [this, &internalModules]() -> StatusCode
+          {
+              auto pluginRef = m_loaderService.get_active_plugin().value();
+              auto& plugin = pluginRef.get();
+
+              std::uint32_t count{};
+              const auto countResult = Runtime::safe_call(plugin.internal_vertex_process_get_modules_list, nullptr, &count);
+              if (!Runtime::status_ok(countResult))
+              {
+                  return Runtime::get_status(countResult);
+              }
+
+              internalModules.resize(count);
+              auto* modulesPtr = internalModules.data();
+              const auto result = Runtime::safe_call(plugin.internal_vertex_process_get_modules_list, &modulesPtr, &count);
+              if (!Runtime::status_ok(result))
+              {
+                  return Runtime::get_status(result);
+              }
+              internalModules.resize(count);
+              return StatusCode::STATUS_OK;
+          });
+
+        auto dispatchResult = m_dispatcher.dispatch(Thread::ThreadChannel::Scanner, std::move(task));
+        if (!dispatchResult.has_value())
+        {
+            return dispatchResult.error();
+        }
+
+        const auto status = dispatchResult.value().get();
+        if (status != StatusCode::STATUS_OK)
+        {
+            return status;
+        }
+
+        modules = internalModules |
+                  std::views::transform(
+                    [](const ::ModuleInformation& module)
+                    {
+                        return Scanner::ScanRegion{.moduleName = module.moduleName, .baseAddress = module.baseAddress, .size = module.size};
+                    }) |
+                  std::ranges::to<std::vector>();
+        return StatusCode::STATUS_OK;
+    }
+
     StatusCode MainModel::query_memory_regions(std::vector<MemoryRegion>& regions) const
     {
         if (m_loaderService.has_plugin_loaded() != StatusCode::STATUS_OK)
@@ -1265,6 +1404,46 @@ namespace Vertex::Model
         return status;
     }
 
+    StatusCode MainModel::query_region_changes(const std::uint64_t sinceGeneration, RegionChangesCallback onComplete) const
+    {
+        if (m_loaderService.has_plugin_loaded() != StatusCode::STATUS_OK)
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_NOT_ACTIVE;
+        }
+
+        std::packaged_task<StatusCode()> task(
+          [this, sinceGeneration, onComplete = std::move(onComplete)]() mutable -> StatusCode
+          {
+              auto pluginRef = m_loaderService.get_active_plugin().value();
+              auto& plugin = pluginRef.get();
+
+              if (plugin.internal_vertex_memory_query_region_changes == nullptr)
+              {
+                  onComplete(StatusCode::STATUS_ERROR_PLUGIN_FUNCTION_NOT_IMPLEMENTED, {}, sinceGeneration);
+                  return StatusCode::STATUS_ERROR_PLUGIN_FUNCTION_NOT_IMPLEMENTED;
+              }
+
+              RegionChange* internalChanges{};
+              std::uint32_t internalChangesCount{};
+              std::uint64_t internalGeneration{};
+              const auto result = Runtime::safe_call(plugin.internal_vertex_memory_query_region_changes, sinceGeneration, &internalChanges, &internalChangesCount,
+                                                     &internalGeneration);
+              const auto status = Runtime::get_status(result);
+
+              std::vector<RegionChange> changes{};
+              if (status == StatusCode::STATUS_OK)
+              {
+                  changes.assign(internalChanges, internalChanges + internalChangesCount);
+              }
+              std::free(internalChanges);
+
+              onComplete(status, std::move(changes), status == StatusCode::STATUS_OK ? internalGeneration : sinceGeneration);
+              return status;
+          });
+
+        return m_dispatcher.dispatch_fire_and_forget(Thread::ThreadChannel::Scanner, std::move(task));
+    }
+
     Log::ILog* MainModel::get_log_service() const { return &m_loggerService; }
 
     int MainModel::get_ui_state_int(const std::string_view key, const int defaultValue) const
@@ -8,6 +8,7 @@
 #include <chrono>
 #include <algorithm>
 #include <new>
+#include <utility>
 #include <fmt/format.h>
 #include <vertex/scanner/memoryscanner/memoryscanner.hh>
 #include <vertex/scanner/comparators.hh>
@@ -15,6 +16,68 @@
 
 namespace Vertex::Scanner
 {
+    namespace
+    {
+        // Sorted, non-overlapping address ranges; adjacent ranges are coalesced and module names dropped.
+        [[nodiscard]] std::vector<ScanRegion> merge_regions(const std::vector<ScanRegion>& regions)
+        {
+            std::vector<ScanRegion> sorted{};
+            sorted.reserve(regions.size());
+            for (const auto& region : regions)
+            {
+                if (region.size != 0)
+                {
+                    sorted.push_back(ScanRegion{.baseAddress = region.baseAddress, .size = region.size});
+                }
+            }
+            std::ranges::sort(sorted, {}, &ScanRegion::baseAddress);
+
+            std::vector<ScanRegion> merged{};
+            for (const auto& region : sorted)
+            {
+                if (!merged.empty() && region.baseAddress <= merged.back().baseAddress + merged.back().size)
+                {
+                    auto& last = merged.back();
+                    last.size = std::max(last.baseAddress + last.size, region.baseAddress + region.size) - last.baseAddress;
+                    continue;
+                }
+                merged.push_back(region);
+            }
+            return merged;
+        }
+
+        // The parts of regions not covered by the merged ranges in covered.
+        [[nodiscard]] std::vector<ScanRegion> subtract_regions(const std::vector<ScanRegion>& regions, const std::vector<ScanRegion>& covered)
+        {
+            std::vector<ScanRegion> uncovered{};
+            for (const auto& region : regions)
+            {
+                std::uint64_t start = region.baseAddress;
+                const std::uint64_t end = region.baseAddress + region.size;
+
+                auto it = std::ranges::upper_bound(covered, start, {},
+                                                   [](const ScanRegion& range)
+                                                   {
+                                                       return range.baseAddress + range.size;
+                                                   });
+                for (; it != covered.end() && it->baseAddress < end && start < end; ++it)
+                {
+                    if (it->baseAddress > start)
+                    {
+                        uncovered.push_back(ScanRegion{.moduleName = region.moduleName, .baseAddress = start, .size = it->baseAddress - start});
+                    }
+                    start = std::max(start, it->baseAddress + it->size);
+                }
+
+                if (start < end)
+                {
+                    uncovered.push_back(ScanRegion{.moduleName = region.moduleName, .baseAddress = start, .size = end - start});
+                }
+            }
+            return uncovered;
+        }
+    }
+
     MemoryScanner::MemoryScanner(Configuration::ISettings& settingsService, Log::ILog& logService, Thread::IThreadDispatcher& dispatcher)
         : m_settingsService(settingsService),
           m_logService(logService),
@@ -45,6 +108,7 @@ namespace Vertex::Scanner
         {
             std::scoped_lock lock(m_writerRegionsMutex);
             cleanup_writer_regions(m_writerRegions);
+            m_resultIndex.clear();
         }
 
         {
@@ -61,6 +125,7 @@ namespace Vertex::Scanner
     {
         std::scoped_lock lock(m_memoryReaderMutex);
         m_memoryReader = std::move(reader);
+        m_dirtyEpochValid.store(false, std::memory_order_release);
     }
 
     void MemoryScanner::set_scan_completion_callback(std::move_only_function<void()> callback)
@@ -173,6 +238,10 @@ namespace Vertex::Scanner
         }
 
         resolve_comparator();
+        resolve_page_filters();
+
+        m_firstScanConfig = m_scanConfig;
+        m_scannedRegions = merge_regions(memoryRegions);
 
         m_scanIteration = 0;
         // Initialized in distribute_regions_to_readers() using per-chunk work units.
@@ -185,8 +254,12 @@ namespace Vertex::Scanner
         m_lastProgressNotifyTick.store(0, std::memory_order_relaxed);
         m_allChunks.clear();
         m_sortedNextScanRecords.clear();
+        m_budget.reset(load_budget_limits());
+        m_cleanRecordBits.clear();
         m_resultsReconciled.store(false, std::memory_order_release);
 
+        begin_dirty_epoch();
+
         const int configuredThreads = m_settingsService.get_int("memoryScan.readerThreads");
         const int readerThreads = m_dispatcher.is_single_threaded() ? 1 : configuredThreads;
 
@@ -273,6 +346,23 @@ namespace Vertex::Scanner
         m_pluginCallStatus.store(StatusCode::STATUS_OK, std::memory_order_release);
         m_lastProgressNotifyTick.store(0, std::memory_order_relaxed);
 
+        // Size the previous-result index against the memory budget before the current results
+        // move into the undo history, so an abort leaves them untouched.
+        m_budget.reset(load_budget_limits(), retained_store_bytes(max_undo_depth()));
+        const std::uint64_t indexBytes = m_resultsCount.load(std::memory_order_acquire) * sizeof(SortedRecordRef);
+        const auto indexSampleShift = m_budget.admit_memory(indexBytes);
+        if (!indexSampleShift.has_value())
+        {
+            m_logService.log_error(fmt::format("[Scanner] Next scan needs {} MB for its result index, which exceeds the memory budget", indexBytes / (1024 * 1024)));
+            return StatusCode::STATUS_ERROR_MEMORY_ALLOCATION_FAILED;
+        }
+        if (*indexSampleShift > 0)
+        {
+            m_logService.log_warn(fmt::format("[Scanner] Memory budget exceeded, next scan keeps 1 of every {} previous results", std::uint64_t{1} << *indexSampleShift));
+        }
+        m_nextScanSampleShift = *indexSampleShift;
+        m_sortedIndexBudgetBytes = indexBytes >> *indexSampleShift;
+
         save_snapshot_for_undo();
 
         std::shared_ptr<std::vector<WriterRegionMetadata>> previousRegions;
@@ -305,6 +395,7 @@ namespace Vertex::Scanner
                 std::scoped_lock regionsLock(m_writerRegionsMutex);
                 cleanup_writer_regions(m_writerRegions);
                 m_writerRegions.clear();
+                m_resultIndex.clear();
             }
             m_resultsReconciled.store(true, std::memory_order_release);
             return StatusCode::STATUS_OK;
@@ -361,6 +452,15 @@ namespace Vertex::Scanner
             return status;
         }
 
+        // There is no atomic query-and-reset, so a write landing between the two would be lost and its stale value
+        // carried on. The epoch therefore stays open while results are carried forward and restarts only before a
+        // scan that reads every result, once fewer than half of them still sit on clean pages.
+        if (prepare_dirty_page_filter(previousDataSize) * 2 < m_sortedNextScanRecords.size())
+        {
+            m_cleanRecordBits.clear();
+            begin_dirty_epoch();
+        }
+
         const std::size_t sortedResultCount = m_sortedNextScanRecords.size();
         m_totalRegions.store(static_cast<std::uint64_t>(sortedResultCount), std::memory_order_relaxed);
 
@@ -381,6 +481,13 @@ namespace Vertex::Scanner
             return status;
         }
 
+        status = reserve_scan_buffers(static_cast<std::size_t>(readerThreads), configured_thread_buffer_size());
+        if (status != StatusCode::STATUS_OK)
+        {
+            m_resultsReconciled.store(true, std::memory_order_release);
+            return status;
+        }
+
         const auto readerCount = static_cast<std::size_t>(readerThreads);
         const std::size_t totalNextScanChunks = (sortedResultCount + NEXT_SCAN_CHUNK_SIZE - 1) / NEXT_SCAN_CHUNK_SIZE;
         m_totalChunks.store(totalNextScanChunks, std::memory_order_relaxed);
@@ -495,6 +602,110 @@ namespace Vertex::Scanner
         return StatusCode::STATUS_OK;
     }
 
+    StatusCode MemoryScanner::extend_scan(std::shared_ptr<const TypeSchema> schema, const std::vector<ScanRegion>& memoryRegions)
+    {
+        std::scoped_lock lifecycleLock(m_scanLifecycleMutex);
+        if (!drain_active_scan())
+        {
+            return StatusCode::STATUS_ERROR_THREAD_IS_BUSY;
+        }
+
+        if (!schema)
+        {
+            m_logService.log_error("[Scanner] extend_scan called with null TypeSchema");
+            return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        if (m_firstScanConfig.dataSize == 0)
+        {
+            m_logService.log_error("[Scanner] extend_scan requires a first scan of this session");
+            return StatusCode::STATUS_ERROR_GENERAL;
+        }
+
+        if ((m_lastScanTypeId != TypeId::Invalid && m_lastScanTypeId != schema->id) || m_scanConfig.dataSize != m_firstScanConfig.dataSize ||
+            (m_scanConfig.firstValueSize != 0 && m_scanConfig.firstValueSize != m_firstScanConfig.dataSize))
+        {
+            m_logService.log_error("[Scanner] extend_scan: result layout differs from the first scan");
+            return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        if (schema->kind == TypeKind::PluginDefined &&
+            (!schema->sdkType || !schema->sdkType->extractor || m_firstScanConfig.scanMode >= schema->sdkType->scanModeCount ||
+             !schema->sdkType->scanModes[m_firstScanConfig.scanMode].comparator))
+        {
+            m_logService.log_error("[Scanner] PluginDefined schema is malformed");
+            return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        if (!has_memory_reader())
+        {
+            m_logService.log_error("[Scanner] No memory reader available for extend scan");
+            return StatusCode::STATUS_ERROR_PLUGIN_NOT_ACTIVE;
+        }
+
+        const std::vector<ScanRegion> newRegions = subtract_regions(memoryRegions, m_scannedRegions);
+
+        std::uint64_t newBytes{};
+        for (const auto& region : newRegions)
+        {
+            newBytes += region.size;
+        }
+        m_logService.log_info(fmt::format("[Scanner] extend_scan: {} new or grown ranges ({} KB)", newRegions.size(), newBytes / 1024));
+
+        m_activeSchema = schema;
+        m_scanAbort.store(false, std::memory_order_seq_cst);
+        m_pluginCallStatus.store(StatusCode::STATUS_OK, std::memory_order_release);
+
+        // Run the first-scan predicate, but write records in the layout of the current results so the
+        // new matches can sit next to them. The dirty epoch is left alone: the existing results were
+        // read in it and a restart would hide writes made since.
+        const std::size_t firstValueSize = m_scanConfig.firstValueSize;
+        m_scanConfig = m_firstScanConfig;
+        m_scanConfig.firstValueSize = firstValueSize;
+
+        resolve_comparator();
+        resolve_page_filters();
+
+        m_regionsScanned.store(0, std::memory_order_relaxed);
+        m_activeReaders.store(0, std::memory_order_relaxed);
+        m_nextChunkIndex.store(0, std::memory_order_relaxed);
+        m_totalChunks.store(0, std::memory_order_relaxed);
+        m_lastProgressNotifyTick.store(0, std::memory_order_relaxed);
+        m_allChunks.clear();
+        m_sortedNextScanRecords.clear();
+        m_budget.reset(load_budget_limits(), retained_store_bytes(max_undo_depth() + 1));
+        m_resultsReconciled.store(false, std::memory_order_release);
+
+        m_scannedRegions = merge_regions(memoryRegions);
+
+        const int configuredThreads = m_settingsService.get_int("memoryScan.readerThreads");
+        const int readerThreads = m_dispatcher.is_single_threaded() ? 1 : configuredThreads;
+
+        StatusCode status = append_writer_regions(static_cast<std::size_t>(readerThreads));
+        if (status != StatusCode::STATUS_OK)
+        {
+            m_logService.log_error(fmt::format("[Scanner] Failed to create writer regions: {}", static_cast<int>(status)));
+            m_resultsReconciled.store(true, std::memory_order_release);
+            return status;
+        }
+
+        status = create_worker_pool(static_cast<std::size_t>(readerThreads));
+        if (status != StatusCode::STATUS_OK)
+        {
+            m_logService.log_error(fmt::format("[Scanner] Failed to create worker pool: {}", static_cast<int>(status)));
+            m_resultsReconciled.store(true, std::memory_order_release);
+            return status;
+        }
+
+        status = distribute_regions_to_readers(newRegions);
+        if (status != StatusCode::STATUS_OK)
+        {
+            m_resultsReconciled.store(true, std::memory_order_release);
+        }
+
+        return status;
+    }
+
     StatusCode MemoryScanner::undo_scan()
     {
         std::scoped_lock lifecycleLock(m_scanLifecycleMutex);
@@ -510,7 +721,7 @@ namespace Vertex::Scanner
             return StatusCode::STATUS_ERROR_GENERAL;
         }
 
-        auto& [iteration, writerRegions, resultsCount, config] = m_undoHistory.back();
+        auto& [iteration, writerRegions, resultsCount, config, scannedRegions] = m_undoHistory.back();
 
         {
             std::scoped_lock regionsLock(m_writerRegionsMutex);
@@ -519,11 +730,14 @@ namespace Vertex::Scanner
             {
                 m_writerRegions = std::move(*writerRegions);
             }
+            rebuild_result_index_locked();
         }
 
         m_resultsCount.store(resultsCount, std::memory_order_relaxed);
         m_scanConfig = config;
+        m_scannedRegions = std::move(scannedRegions);
         m_scanIteration = iteration;
+        m_dirtyEpochValid.store(false, std::memory_order_release);
 
         m_undoHistory.pop_back();
 
@@ -636,19 +850,19 @@ namespace Vertex::Scanner
     StatusCode MemoryScanner::finalize_writer_store(const std::size_t writerIndex)
     {
         std::shared_lock regionsLock(m_writerRegionsMutex);
-        if (writerIndex >= m_writerRegions.size())
+        if (m_writerBase + writerIndex >= m_writerRegions.size())
         {
-            m_logService.log_error(fmt::format("[Scanner] finalize_writer_store out of range: {} >= {}", writerIndex, m_writerRegions.size()));
+            m_logService.log_error(fmt::format("[Scanner] finalize_writer_store out of range: {} >= {}", m_writerBase + writerIndex, m_writerRegions.size()));
             return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
         }
 
-        return m_writerRegions[writerIndex].store.finalize();
+        return m_writerRegions[m_writerBase + writerIndex].store.finalize();
     }
 
     void MemoryScanner::reconcile_result_count()
     {
         {
-            std::shared_lock regionsLock(m_writerRegionsMutex);
+            std::scoped_lock regionsLock(m_writerRegionsMutex);
             std::uint64_t validCount{};
             for (const auto& writerMeta : m_writerRegions)
             {
@@ -658,10 +872,24 @@ namespace Vertex::Scanner
                 }
             }
             m_resultsCount.store(validCount, std::memory_order_release);
+            rebuild_result_index_locked();
         }
 
         decltype(m_sortedNextScanRecords){}.swap(m_sortedNextScanRecords);
         decltype(m_allChunks){}.swap(m_allChunks);
+        m_budget.release_memory(std::exchange(m_sortedIndexBudgetBytes, 0));
+
+        const auto usage = m_budget.usage();
+        if (usage.exceeded)
+        {
+            m_logService.log_warn(fmt::format("[Scanner] Scan stopped at its {} budget, results are partial ({} MB on disk)",
+                                              m_budget.policy() == ScanBudgetPolicy::Downsample ? "downsampling" : "disk",
+                                              usage.diskBytes / (1024 * 1024)));
+        }
+        else if (usage.sampleShift > 0)
+        {
+            m_logService.log_warn(fmt::format("[Scanner] Scan results were downsampled to 1 of every {} matches", std::uint64_t{1} << usage.sampleShift));
+        }
     }
 
     void MemoryScanner::notify_scan_completion()
@@ -715,6 +943,21 @@ namespace Vertex::Scanner
         return m_pluginCallStatus.load(std::memory_order_acquire);
     }
 
+    ScanBudgetUsage MemoryScanner::get_budget_usage() const noexcept { return m_budget.usage(); }
+
+    ScanBudgetLimits MemoryScanner::load_budget_limits() const
+    {
+        constexpr std::uint64_t BYTES_PER_MB = 1024ULL * 1024;
+        const int diskBudgetMB = std::max(0, m_settingsService.get_int("memoryScan.diskBudgetMB", 0));
+        const int memoryBudgetMB = std::max(0, m_settingsService.get_int("memoryScan.memoryBudgetMB", 0));
+        const int policy = m_settingsService.get_int("memoryScan.budgetPolicy", 0);
+
+        return ScanBudgetLimits{.diskBytes = static_cast<std::uint64_t>(diskBudgetMB) * BYTES_PER_MB,
+                                .memoryBytes = static_cast<std::uint64_t>(memoryBudgetMB) * BYTES_PER_MB,
+                                .policy = policy == static_cast<int>(ScanBudgetPolicy::Downsample) ? ScanBudgetPolicy::Downsample
+                                                                                                    : ScanBudgetPolicy::AbortWithPartialResults};
+    }
+
     std::uint64_t MemoryScanner::get_results_count() const
     {
         if (m_resultsReconciled.load(std::memory_order_acquire))
@@ -763,14 +1006,15 @@ namespace Vertex::Scanner
 
         auto sharedRegions = std::make_shared<std::vector<WriterRegionMetadata>>(std::move(m_writerRegions));
         m_writerRegions.clear();
+        m_resultIndex.clear();
         regionsLock.unlock();
 
-        ScanSnapshot snapshot{.iteration = m_scanIteration, .writerRegions = std::move(sharedRegions), .resultsCount = m_resultsCount.load(std::memory_order_acquire), .config = m_scanConfig};
+        ScanSnapshot snapshot{.iteration = m_scanIteration, .writerRegions = std::move(sharedRegions), .resultsCount = m_resultsCount.load(std::memory_order_acquire), .config = m_scanConfig,
+                              .scannedRegions = m_scannedRegions};
 
         m_undoHistory.push_back(std::move(snapshot));
 
-        const std::size_t maxUndoDepth = static_cast<std::size_t>(
-          std::clamp(m_settingsService.get_int("memoryScan.maxUndoDepth", 3), 1, static_cast<int>(MAX_UNDO_DEPTH)));
+        const std::size_t maxUndoDepth = max_undo_depth();
         while (m_undoHistory.size() > maxUndoDepth)
         {
             cleanup_snapshot_regions(m_undoHistory.front());
@@ -778,6 +1022,45 @@ namespace Vertex::Scanner
         }
     }
 
+    std::size_t MemoryScanner::max_undo_depth() const
+    {
+        return static_cast<std::size_t>(std::clamp(m_settingsService.get_int("memoryScan.maxUndoDepth", 3), 1, static_cast<int>(MAX_UNDO_DEPTH)));
+    }
+
+    // Bytes held by the newest levelLimit result levels, counting the current results as the newest one.
+    std::uint64_t MemoryScanner::retained_store_bytes(const std::size_t levelLimit) const
+    {
+        const auto levelBytes = [](const std::vector<WriterRegionMetadata>& regions)
+        {
+            std::uint64_t bytes{};
+            for (const auto& region : regions)
+            {
+                bytes += region.store.data_size();
+            }
+            return bytes;
+        };
+
+        std::scoped_lock undoLock(m_undoHistoryMutex);
+        std::uint64_t retained{};
+        std::size_t levels{};
+        {
+            std::shared_lock regionsLock(m_writerRegionsMutex);
+            if (levelLimit > 0)
+            {
+                retained = levelBytes(m_writerRegions);
+                levels = 1;
+            }
+        }
+        for (auto it = m_undoHistory.rbegin(); it != m_undoHistory.rend() && levels < levelLimit; ++it, ++levels)
+        {
+            if (it->writerRegions)
+            {
+                retained += levelBytes(*it->writerRegions);
+            }
+        }
+        return retained;
+    }
+
     StatusCode MemoryScanner::build_sorted_next_scan_records(const std::vector<WriterRegionMetadata>& previousRegions, const std::size_t previousValueSize, const std::size_t previousFirstValueSize)
     {
         const std::size_t recordSize = sizeof(std::uint64_t) + previousValueSize + previousFirstValueSize;
@@ -791,7 +1074,7 @@ namespace Vertex::Scanner
 
         try
         {
-            m_sortedNextScanRecords.reserve(totalRecords);
+            m_sortedNextScanRecords.reserve((totalRecords >> m_nextScanSampleShift) + 1);
         }
         catch (const std::bad_alloc&)
         {
@@ -799,6 +1082,7 @@ namespace Vertex::Scanner
             return StatusCode::STATUS_ERROR_MEMORY_ALLOCATION_FAILED;
         }
 
+        std::uint64_t sampleSequence{};
         for (const auto& writerMeta : previousRegions)
         {
             const std::size_t writerResultCount = writerMeta.atomics->resultCount.load(std::memory_order_acquire);
@@ -815,6 +1099,11 @@ namespace Vertex::Scanner
             const auto* regionBase = static_cast<const std::byte*>(writerMeta.store.base());
             for (std::size_t recordIndex = 0; recordIndex < writerResultCount; ++recordIndex)
             {
+                if (!ScanBudgetGovernor::keep_sample(sampleSequence++, m_nextScanSampleShift))
+                {
+                    continue;
+                }
+
                 const std::byte* recordPtr = regionBase + (recordIndex * recordSize);
                 std::array<std::byte, sizeof(std::uint64_t)> addressBytes{};
                 std::copy_n(recordPtr, addressBytes.size(), addressBytes.begin());
@@ -837,6 +1126,119 @@ namespace Vertex::Scanner
         return StatusCode::STATUS_OK;
     }
 
+    void MemoryScanner::begin_dirty_epoch()
+    {
+        m_dirtyEpochValid.store(false, std::memory_order_release);
+
+        if (!m_settingsService.get_bool("memoryScan.softDirtyTracking", false))
+        {
+            return;
+        }
+
+        std::shared_ptr<IMemoryReader> reader;
+        {
+            std::scoped_lock lock(m_memoryReaderMutex);
+            reader = m_memoryReader;
+        }
+
+        if (!reader || !reader->supports_dirty_tracking())
+        {
+            return;
+        }
+
+        const StatusCode status = reader->reset_dirty_tracking();
+        if (status != StatusCode::STATUS_OK)
+        {
+            m_logService.log_warn(fmt::format("[Scanner] Could not reset dirty page tracking (status: {}), next scan reads every result", static_cast<int>(status)));
+            return;
+        }
+
+        m_dirtyEpochValid.store(true, std::memory_order_release);
+    }
+
+    std::size_t MemoryScanner::prepare_dirty_page_filter(const std::size_t previousValueSize)
+    {
+        m_cleanRecordBits.clear();
+
+        if (!m_dirtyEpochValid.load(std::memory_order_acquire) || previousValueSize != m_scanConfig.dataSize || m_sortedNextScanRecords.empty())
+        {
+            return 0;
+        }
+
+        std::shared_ptr<IMemoryReader> reader;
+        {
+            std::scoped_lock lock(m_memoryReaderMutex);
+            reader = m_memoryReader;
+        }
+
+        std::uint64_t pageSize{};
+        if (!reader || reader->query_dirty_pages(0, 0, {}, pageSize) != StatusCode::STATUS_OK || pageSize == 0)
+        {
+            return 0;
+        }
+
+        const std::size_t recordCount = m_sortedNextScanRecords.size();
+        std::vector<std::uint64_t> cleanBits((recordCount + 63) / 64);
+        std::vector<std::uint8_t> bitmap{};
+        std::size_t cleanCount{};
+
+        std::size_t windowStart{};
+        while (windowStart < recordCount)
+        {
+            const std::uint64_t firstPage = m_sortedNextScanRecords[windowStart].address / pageSize;
+            std::uint64_t lastPage = (m_sortedNextScanRecords[windowStart].address + previousValueSize - 1) / pageSize;
+
+            std::size_t windowEnd = windowStart + 1;
+            while (windowEnd < recordCount)
+            {
+                const std::uint64_t address = m_sortedNextScanRecords[windowEnd].address;
+                const std::uint64_t endPage = (address + previousValueSize - 1) / pageSize;
+                if (address / pageSize > lastPage + DIRTY_QUERY_MAX_GAP_PAGES || endPage - firstPage >= DIRTY_QUERY_MAX_WINDOW_PAGES)
+                {
+                    break;
+                }
+                lastPage = std::max(lastPage, endPage);
+                ++windowEnd;
+            }
+
+            const std::uint64_t pageCount = lastPage - firstPage + 1;
+            bitmap.assign(static_cast<std::size_t>((pageCount + 7) / 8), 0);
+
+            std::uint64_t queriedPageSize{};
+            const StatusCode status = reader->query_dirty_pages(firstPage * pageSize, pageCount * pageSize, bitmap, queriedPageSize);
+            if (status != StatusCode::STATUS_OK || queriedPageSize != pageSize)
+            {
+                m_logService.log_warn(fmt::format("[Scanner] Dirty page query failed (status: {}), next scan reads every result", static_cast<int>(status)));
+                return 0;
+            }
+
+            for (std::size_t i = windowStart; i < windowEnd; ++i)
+            {
+                const std::uint64_t address = m_sortedNextScanRecords[i].address;
+                const std::uint64_t beginBit = address / pageSize - firstPage;
+                const std::uint64_t endBit = (address + previousValueSize - 1) / pageSize - firstPage;
+
+                bool dirty{};
+                for (std::uint64_t bit = beginBit; bit <= endBit && !dirty; ++bit)
+                {
+                    dirty = ((bitmap[bit / 8] >> (bit % 8)) & 1) != 0;
+                }
+
+                if (!dirty)
+                {
+                    cleanBits[i / 64] |= std::uint64_t{1} << (i % 64);
+                    ++cleanCount;
+                }
+            }
+
+            windowStart = windowEnd;
+        }
+
+        m_cleanRecordBits = std::move(cleanBits);
+        m_logService.log_info(fmt::format("[Scanner] {} of {} previous results sit on pages unchanged since they were read", cleanCount, recordCount));
+        return cleanCount;
+    }
+
     StatusCode MemoryScanner::create_worker_pool(const std::size_t workerCount)
     {
         const StatusCode destroyStatus = m_dispatcher.destroy_worker_pool(Thread::ThreadChannel::Scanner);
@@ -861,6 +1263,30 @@ namespace Vertex::Scanner
         return StatusCode::STATUS_OK;
     }
 
+    std::size_t MemoryScanner::configured_thread_buffer_size() const
+    {
+        constexpr std::size_t MIB = 1024ULL * 1024ULL;
+        const int configuredBufferSizeMB = m_settingsService.get_int("memoryScan.threadBufferSizeMB", 8);
+        return static_cast<std::size_t>(std::max(1, configuredBufferSizeMB)) * MIB;
+    }
+
+    StatusCode MemoryScanner::reserve_scan_buffers(const std::size_t workerCount, const std::size_t bufferSize)
+    {
+        const bool useHugePages = m_settingsService.get_bool("memoryScan.hugePageBuffers", true);
+        const StatusCode status = m_scanBuffers.reserve(workerCount, bufferSize, useHugePages);
+        if (status != StatusCode::STATUS_OK)
+        {
+            m_logService.log_error(fmt::format("[Scanner] Failed to reserve {} scan buffers of {} bytes (status: {})", workerCount, bufferSize, static_cast<int>(status)));
+            return status;
+        }
+
+        while (m_workerScratch.size() < workerCount)
+        {
+            m_workerScratch.push_back(std::make_unique<WorkerScratch>(WORKER_ARENA_SIZE));
+        }
+        return StatusCode::STATUS_OK;
+    }
+
     StatusCode MemoryScanner::distribute_regions_to_readers(const std::vector<ScanRegion>& memoryRegions)
     {
         if (m_workerCount == 0)
@@ -872,12 +1298,19 @@ namespace Vertex::Scanner
         m_logService.log_info(fmt::format("[Scanner] Distributing {} regions across {} workers", memoryRegions.size(), m_workerCount));
 
         constexpr std::size_t MIB = 1024ULL * 1024ULL;
-        const int configuredBufferSizeMB = m_settingsService.get_int("memoryScan.threadBufferSizeMB", 8);
         const int configuredWorkerChunkSizeMB = m_settingsService.get_int("memoryScan.workerChunkSizeMB", 8);
-        const std::size_t threadBufferSize = static_cast<std::size_t>(std::max(1, configuredBufferSizeMB)) * MIB;
+        const std::size_t threadBufferSize = configured_thread_buffer_size();
         const std::size_t requestedWorkerChunkSize = static_cast<std::size_t>(std::max(1, configuredWorkerChunkSizeMB)) * MIB;
         const std::size_t workerChunkSize = std::min(threadBufferSize, requestedWorkerChunkSize);
 
+        const auto asyncReadDepth = static_cast<std::uint32_t>(std::clamp(m_settingsService.get_int("memoryScan.asyncReadDepth", 0), 0, static_cast<int>(MAX_ASYNC_READ_DEPTH)));
+
+        const StatusCode bufferStatus = reserve_scan_buffers(m_workerCount, threadBufferSize);
+        if (bufferStatus != StatusCode::STATUS_OK)
+        {
+            return bufferStatus;
+        }
+
         std::vector<ScanRegion> sortedRegions = memoryRegions;
         std::ranges::sort(sortedRegions,
                           [](const ScanRegion& lhs, const ScanRegion& rhs)
@@ -922,15 +1355,10 @@ namespace Vertex::Scanner
         for (std::size_t i = 0; i < m_workerCount; ++i)
         {
             std::packaged_task<StatusCode()> task(
-              [this, i, threadBufferSize]() -> StatusCode
+              [this, i, threadBufferSize, asyncReadDepth]() -> StatusCode
               {
-                  thread_local Memory::AlignedByteVector regionBuffer{};
-                  if (regionBuffer.size() < threadBufferSize)
-                  {
-                      regionBuffer.resize(threadBufferSize);
-                  }
-
                   const std::size_t myWriterIndex = i;
+                  const std::span<char> regionBuffer = m_scanBuffers.acquire(myWriterIndex, threadBufferSize).first(threadBufferSize);
 
                   std::shared_ptr<IMemoryReader> reader;
                   {
@@ -944,6 +1372,13 @@ namespace Vertex::Scanner
                       workerStatus = StatusCode::STATUS_ERROR_PLUGIN_NOT_ACTIVE;
                       m_scanAbort.store(true, std::memory_order_release);
                   }
+                  else if (std::uint64_t readQueue{};
+                           asyncReadDepth > 0 && reader->supports_async_read() && !(m_skipNonResidentPages && reader->supports_residency_query()) &&
+                           reader->open_read_queue(asyncReadDepth, readQueue) == StatusCode::STATUS_OK)
+                  {
+                      workerStatus = scan_chunks_async(myWriterIndex, *reader, readQueue, asyncReadDepth, threadBufferSize);
+                      static_cast<void>(reader->close_read_queue(readQueue));
+                  }
                   else
                   {
                       const std::size_t totalChunks = m_totalChunks.load(std::memory_order_relaxed);
@@ -971,9 +1406,6 @@ namespace Vertex::Scanner
                       }
                   }
 
-                  regionBuffer.clear();
-                  regionBuffer.shrink_to_fit();
-
                   const StatusCode finalizeStatus = finalize_writer_store(myWriterIndex);
                   if (finalizeStatus != StatusCode::STATUS_OK)
                   {
@@ -3,7 +3,10 @@
 // Licensed under GPLv3.0 with Plugin Interface exceptions.
 //
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <cstring>
+#include <limits>
 #include <span>
 #include <vector>
 #include <vertex/scanner/memoryscanner/memoryscanner.hh>
@@ -15,6 +18,40 @@ namespace Vertex::Scanner
 {
     namespace
     {
+        [[nodiscard]] bool is_zero_page(const std::uint8_t* data, const std::size_t size) noexcept
+        {
+            constexpr std::size_t WORDS_PER_BLOCK = 8;
+            constexpr std::size_t BLOCK_SIZE = WORDS_PER_BLOCK * sizeof(std::uint64_t);
+
+            std::size_t offset{};
+            for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE)
+            {
+                std::array<std::uint64_t, WORDS_PER_BLOCK> words{};
+                std::memcpy(words.data(), data + offset, BLOCK_SIZE);
+
+                std::uint64_t accumulator{};
+                for (const std::uint64_t word : words)
+                {
+                    accumulator |= word;
+                }
+
+                if (accumulator != 0)
+                {
+                    return false;
+                }
+            }
+
+            for (; offset < size; ++offset)
+            {
+                if (data[offset] != 0)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
         thread_local std::vector<char> tl_pluginCurrent{};
         thread_local std::vector<char> tl_pluginPrevious{};
 
@@ -202,19 +239,147 @@ namespace Vertex::Scanner
         return m_resolvedComparator(currentData, m_resolvedInput, m_resolvedInput2, previousData);
     }
 
-    StatusCode MemoryScanner::scan_memory_region(const ScanRegion& region, const std::size_t writerIndex, IMemoryReader& reader, Memory::AlignedByteVector& regionBuffer)
+    void MemoryScanner::resolve_page_filters()
+    {
+        m_skipNonResidentPages = m_settingsService.get_bool("memoryScan.skipNonResidentPages", false);
+
+        // A page of zeros can only be skipped when a zero value is not itself a match.
+        const std::vector<std::uint8_t> zeroValue(m_scanConfig.dataSize);
+        m_skipZeroPages = !m_resolvedIsPluginDefined && !check_value_matches(zeroValue.data());
+    }
+
+    bool MemoryScanner::scan_chunk_range(const std::uint8_t* chunkData, const std::size_t from, const std::size_t to, const std::size_t limit, const std::uint64_t chunkBaseAddress,
+                                         const std::size_t writerIndex, ScanResult& batchResult)
     {
         constexpr std::size_t BATCH_THRESHOLD = Simd::BATCH_CHECK_INTERVAL;
         const std::size_t dataSize = m_scanConfig.dataSize;
+        const std::size_t firstValueSize = m_scanConfig.firstValueSize;
         const std::size_t alignment = m_scanConfig.alignmentRequired ? m_scanConfig.alignment : 1;
 
-        ScanResult batchResult;
-        batchResult.reserve(BATCH_THRESHOLD, dataSize);
+        const std::size_t start = (from + alignment - 1) / alignment * alignment;
+        const std::size_t end = std::min(to + dataSize - 1, limit);
+        if (start >= end || end - start < dataSize)
+        {
+            return true;
+        }
+
+        if (m_simdCapability.available && alignment == dataSize && firstValueSize == 0)
+        {
+            std::size_t offset = start;
+            while (offset < end)
+            {
+                const std::size_t consumed = m_simdCapability.scanFn(chunkData + offset, end - offset, alignment, dataSize, static_cast<const std::uint8_t*>(m_resolvedInput),
+                                                                     static_cast<const std::uint8_t*>(m_resolvedInput2), batchResult, chunkBaseAddress + offset);
+
+                offset += consumed;
+
+                if (batchResult.matchesFound >= BATCH_THRESHOLD)
+                {
+                    if (write_results_direct(batchResult, writerIndex) != StatusCode::STATUS_OK)
+                    {
+                        m_scanAbort.store(true, std::memory_order_release);
+                        return false;
+                    }
+                    batchResult.clear();
+                }
+            }
+
+            return true;
+        }
+
+        const std::size_t scanEnd = end - dataSize + 1;
+        for (std::size_t offset = start; offset < scanEnd; offset += alignment)
+        {
+            if (m_scanAbort.load(std::memory_order_acquire)) [[unlikely]]
+            {
+                return false;
+            }
+
+            const std::uint8_t* currentData = chunkData + offset;
+
+            if (check_value_matches(currentData))
+            {
+                // Extend scans into a narrowed session record the value found now as the first value too.
+                batchResult.add_match(chunkBaseAddress + offset, currentData, dataSize, currentData, firstValueSize);
+
+                if (batchResult.matchesFound >= BATCH_THRESHOLD)
+                {
+                    if (write_results_direct(batchResult, writerIndex) != StatusCode::STATUS_OK)
+                    {
+                        m_scanAbort.store(true, std::memory_order_release);
+                        return false;
+                    }
+                    batchResult.clear();
+                }
+            }
+        }
+
+        return true;
+    }
+
+    bool MemoryScanner::scan_non_zero_pages(const std::uint8_t* chunkData, const std::size_t from, const std::size_t to, const std::size_t limit, const std::uint64_t chunkBaseAddress,
+                                            const std::size_t writerIndex, ScanResult& batchResult)
+    {
+        if (!m_skipZeroPages)
+        {
+            return scan_chunk_range(chunkData, from, to, limit, chunkBaseAddress, writerIndex, batchResult);
+        }
+
+        const std::size_t overlap = m_scanConfig.dataSize - 1;
+        std::size_t scannedUpTo = from;
+        std::size_t runStart = from;
+        std::size_t pageStart = from;
+
+        while (pageStart < to)
+        {
+            const std::uint64_t pageAddress = chunkBaseAddress + pageStart;
+            const std::size_t pageEnd = std::min<std::size_t>(to, pageStart + (ZERO_PAGE_PROBE_SIZE - pageAddress % ZERO_PAGE_PROBE_SIZE));
+
+            if (is_zero_page(chunkData + pageStart, pageEnd - pageStart))
+            {
+                if (runStart < pageStart)
+                {
+                    // Values may start in the last bytes before a zero page and run into it.
+                    if (!scan_chunk_range(chunkData, std::max(scannedUpTo, runStart > from ? runStart - std::min(overlap, runStart - from) : from), pageStart, limit, chunkBaseAddress,
+                                          writerIndex, batchResult))
+                    {
+                        return false;
+                    }
+                    scannedUpTo = pageStart;
+                }
+                runStart = pageEnd;
+            }
+
+            pageStart = pageEnd;
+        }
+
+        if (runStart < to)
+        {
+            return scan_chunk_range(chunkData, std::max(scannedUpTo, runStart > from ? runStart - std::min(overlap, runStart - from) : from), to, limit, chunkBaseAddress, writerIndex,
+                                    batchResult);
+        }
+
+        return true;
+    }
+
+    StatusCode MemoryScanner::scan_memory_region(const ScanRegion& region, const std::size_t writerIndex, IMemoryReader& reader, const std::span<char> regionBuffer)
+    {
+        WorkerScratch& scratch = *m_workerScratch[writerIndex];
+        ScanResult& batchResult = scratch.batch;
+        batchResult.reserve(Simd::BATCH_CHECK_INTERVAL, m_scanConfig.dataSize, m_scanConfig.firstValueSize);
+
+        const bool filterResidency = m_skipNonResidentPages && reader.supports_residency_query();
+        std::uint64_t pageSize{};
+        if (filterResidency && (reader.query_resident_pages(0, 0, {}, pageSize) != StatusCode::STATUS_OK || pageSize == 0))
+        {
+            pageSize = 0;
+        }
 
         if (!m_scanAbort.load(std::memory_order_acquire))
         {
             const std::size_t threadBufferSize = regionBuffer.size();
             const std::size_t numChunks = (region.size + threadBufferSize - 1) / threadBufferSize;
+            auto* chunkData = reinterpret_cast<std::uint8_t*>(regionBuffer.data());
 
             for (std::size_t chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
             {
@@ -227,59 +392,62 @@ namespace Vertex::Scanner
                 const std::size_t chunkSize = std::min<std::size_t>(threadBufferSize, region.size - chunkOffset);
                 const std::uint64_t chunkBaseAddress = region.baseAddress + chunkOffset;
 
-                const StatusCode status = reader.read_memory(chunkBaseAddress, chunkSize, regionBuffer.data());
-
-                if (status == StatusCode::STATUS_OK)
+                const std::uint8_t* residentPages{};
+                if (pageSize != 0)
                 {
-                    const std::size_t scanEnd = (chunkSize >= dataSize) ? chunkSize - dataSize + 1 : 0;
-                    const auto* chunkData = reinterpret_cast<const std::uint8_t*>(regionBuffer.data());
+                    const std::uint64_t pageCount = (chunkBaseAddress + chunkSize - 1) / pageSize - chunkBaseAddress / pageSize + 1;
+                    const auto bitmapSize = static_cast<std::size_t>((pageCount + 7) / 8);
 
-                    if (m_simdCapability.available && alignment == dataSize && chunkSize >= dataSize)
+                    scratch.context.reset();
+                    auto* bitmap = scratch.context.arena_allocate_array_nothrow<std::uint8_t>(bitmapSize);
+                    if (bitmap && reader.query_resident_pages(chunkBaseAddress, chunkSize, std::span{bitmap, bitmapSize}, pageSize) == StatusCode::STATUS_OK)
                     {
-                        std::size_t offset{};
-                        while (offset < chunkSize)
-                        {
-                            const std::size_t consumed = m_simdCapability.scanFn(chunkData + offset, chunkSize - offset, alignment, dataSize, static_cast<const std::uint8_t*>(m_resolvedInput),
-                                                                                 static_cast<const std::uint8_t*>(m_resolvedInput2), batchResult, chunkBaseAddress + offset);
-
-                            offset += consumed;
+                        residentPages = bitmap;
+                    }
+                }
 
-                            if (batchResult.matchesFound >= BATCH_THRESHOLD)
-                            {
-                                if (write_results_direct(batchResult, writerIndex) != StatusCode::STATUS_OK)
-                                {
-                                    m_scanAbort.store(true, std::memory_order_release);
-                                    break;
-                                }
-                                batchResult.clear();
-                            }
-                        }
+                if (!residentPages)
+                {
+                    if (reader.read_memory(chunkBaseAddress, chunkSize, regionBuffer.data()) == StatusCode::STATUS_OK)
+                    {
+                        static_cast<void>(scan_non_zero_pages(chunkData, 0, chunkSize, chunkSize, chunkBaseAddress, writerIndex, batchResult));
                     }
-                    else
+                }
+                else
+                {
+                    // Only read runs of pages the target has touched; reading the rest would fault them in just to find zeros.
+                    const std::uint64_t firstPageAddress = chunkBaseAddress / pageSize * pageSize;
+                    std::size_t runStart{};
+                    std::size_t bit{};
+                    std::size_t offset{};
+
+                    while (offset < chunkSize && !m_scanAbort.load(std::memory_order_acquire))
                     {
-                        for (std::size_t offset = 0; offset < scanEnd; offset += alignment)
+                        const std::size_t pageEnd = std::min<std::size_t>(chunkSize, firstPageAddress + (bit + 1) * pageSize - chunkBaseAddress);
+                        const bool resident = ((residentPages[bit / 8] >> (bit % 8)) & 1) != 0;
+
+                        if (!resident && runStart < offset)
                         {
-                            if (m_scanAbort.load(std::memory_order_acquire)) [[unlikely]]
+                            if (reader.read_memory(chunkBaseAddress + runStart, offset - runStart, regionBuffer.data() + runStart) == StatusCode::STATUS_OK)
                             {
-                                break;
+                                static_cast<void>(scan_non_zero_pages(chunkData, runStart, offset, offset, chunkBaseAddress, writerIndex, batchResult));
                             }
+                        }
 
-                            const std::uint8_t* currentData = chunkData + offset;
+                        if (!resident)
+                        {
+                            runStart = pageEnd;
+                        }
 
-                            if (check_value_matches(currentData))
-                            {
-                                batchResult.add_match(chunkBaseAddress + offset, currentData, dataSize);
+                        offset = pageEnd;
+                        ++bit;
+                    }
 
-                                if (batchResult.matchesFound >= BATCH_THRESHOLD)
-                                {
-                                    if (write_results_direct(batchResult, writerIndex) != StatusCode::STATUS_OK)
-                                    {
-                                        m_scanAbort.store(true, std::memory_order_release);
-                                        break;
-                                    }
-                                    batchResult.clear();
-                                }
-                            }
+                    if (runStart < chunkSize && !m_scanAbort.load(std::memory_order_acquire))
+                    {
+                        if (reader.read_memory(chunkBaseAddress + runStart, chunkSize - runStart, regionBuffer.data() + runStart) == StatusCode::STATUS_OK)
+                        {
+                            static_cast<void>(scan_non_zero_pages(chunkData, runStart, chunkSize, chunkSize, chunkBaseAddress, writerIndex, batchResult));
                         }
                     }
                 }
@@ -300,6 +468,153 @@ namespace Vertex::Scanner
         return StatusCode::STATUS_OK;
     }
 
+    StatusCode MemoryScanner::scan_chunks_async(const std::size_t writerIndex, IMemoryReader& reader, const std::uint64_t readQueue, const std::uint32_t depth, const std::size_t threadBufferSize)
+    {
+        constexpr std::size_t SLOT_GRANULARITY = 4096;
+        constexpr std::size_t NO_CHUNK = std::numeric_limits<std::size_t>::max();
+
+        // Pieces of a chunk overlap by dataSize - 1 bytes so values crossing a piece boundary are still seen.
+        // The slots split the worker's reserved buffer, so the pipeline never forces the pool to remap it.
+        const std::size_t overlap = m_scanConfig.dataSize - 1;
+        const std::size_t overlapPadding = (overlap + SLOT_GRANULARITY - 1) / SLOT_GRANULARITY * SLOT_GRANULARITY;
+        const std::size_t slotStride = std::max(overlapPadding + SLOT_GRANULARITY, threadBufferSize / depth / SLOT_GRANULARITY * SLOT_GRANULARITY);
+        const std::size_t pieceSize = slotStride - overlapPadding;
+
+        const std::span<char> buffer = m_scanBuffers.acquire(writerIndex, slotStride * depth);
+        if (buffer.size() < slotStride * depth)
+        {
+            return StatusCode::STATUS_ERROR_MEMORY_ALLOCATION_FAILED;
+        }
+
+        WorkerScratch& scratch = *m_workerScratch[writerIndex];
+        ScanResult& batchResult = scratch.batch;
+        batchResult.reserve(Simd::BATCH_CHECK_INTERVAL, m_scanConfig.dataSize, m_scanConfig.firstValueSize);
+
+        scratch.context.reset();
+        auto* requests = scratch.context.arena_allocate_array_nothrow<AsyncReadRequest>(depth);
+        auto* completions = scratch.context.arena_allocate_array_nothrow<AsyncReadCompletion>(depth);
+        auto* slots = scratch.context.arena_allocate_array_nothrow<AsyncReadSlot>(depth);
+        auto* freeSlots = scratch.context.arena_allocate_array_nothrow<std::uint32_t>(depth);
+        if (!requests || !completions || !slots || !freeSlots)
+        {
+            return StatusCode::STATUS_ERROR_MEMORY_ALLOCATION_FAILED;
+        }
+
+        std::uint32_t freeCount = depth;
+        for (std::uint32_t i = 0; i < depth; ++i)
+        {
+            freeSlots[i] = i;
+        }
+
+        const std::size_t totalChunks = m_totalChunks.load(std::memory_order_relaxed);
+        std::size_t chunkIndex = NO_CHUNK;
+        std::size_t pieceOffset{};
+        bool exhausted{};
+        std::uint32_t inFlight{};
+        StatusCode status = StatusCode::STATUS_OK;
+
+        while (true)
+        {
+            std::uint32_t count{};
+            while (!exhausted && freeCount > 0 && !m_scanAbort.load(std::memory_order_acquire))
+            {
+                if (chunkIndex == NO_CHUNK)
+                {
+                    chunkIndex = m_nextChunkIndex.fetch_add(1, std::memory_order_relaxed);
+                    if (chunkIndex >= totalChunks)
+                    {
+                        exhausted = true;
+                        break;
+                    }
+                    pieceOffset = 0;
+                }
+
+                const ChunkDescriptor& chunk = m_allChunks[chunkIndex];
+                const std::uint64_t address = chunk.region.baseAddress + chunk.chunkOffset + pieceOffset;
+                const std::size_t scanSize = std::min(pieceSize, chunk.chunkSize - pieceOffset);
+                const std::size_t readSize = std::min(scanSize + overlap, chunk.chunkSize - pieceOffset);
+                const bool lastPiece = pieceOffset + scanSize >= chunk.chunkSize;
+
+                const std::uint32_t slot = freeSlots[--freeCount];
+                slots[slot] = AsyncReadSlot{.address = address, .scanSize = scanSize, .readSize = readSize, .lastPieceOfChunk = lastPiece};
+                requests[count++] = AsyncReadRequest{.address = address, .size = readSize, .buffer = buffer.data() + slot * slotStride, .userData = slot};
+
+                pieceOffset += scanSize;
+                if (lastPiece)
+                {
+                    chunkIndex = NO_CHUNK;
+                }
+            }
+
+            if (count > 0)
+            {
+                status = reader.submit_reads(readQueue, std::span<const AsyncReadRequest>{requests, count});
+                if (status != StatusCode::STATUS_OK)
+                {
+                    m_scanAbort.store(true, std::memory_order_release);
+                    break;
+                }
+                inFlight += count;
+            }
+
+            if (inFlight == 0)
+            {
+                break;
+            }
+
+            std::uint32_t completed{};
+            status = reader.complete_reads(readQueue, std::span{completions, depth}, true, completed);
+            if (status != StatusCode::STATUS_OK)
+            {
+                m_scanAbort.store(true, std::memory_order_release);
+                break;
+            }
+
+            // The remaining reads keep the kernel busy while this piece is compared.
+            for (std::uint32_t i = 0; i < completed; ++i)
+            {
+                const auto slot = static_cast<std::uint32_t>(completions[i].userData);
+                const AsyncReadSlot& piece = slots[slot];
+
+                if (completions[i].status == StatusCode::STATUS_OK && !m_scanAbort.load(std::memory_order_acquire))
+                {
+                    const auto* pieceData = reinterpret_cast<const std::uint8_t*>(buffer.data() + slot * slotStride);
+                    static_cast<void>(scan_non_zero_pages(pieceData, 0, piece.scanSize, piece.readSize, piece.address, writerIndex, batchResult));
+                }
+
+                if (piece.lastPieceOfChunk)
+                {
+                    m_regionsScanned.fetch_add(1, std::memory_order_relaxed);
+                    notify_scan_progress_throttled();
+                }
+
+                freeSlots[freeCount++] = slot;
+            }
+            inFlight -= completed;
+        }
+
+        // Buffers stay owned by the queue until every submitted read has completed.
+        while (inFlight > 0)
+        {
+            std::uint32_t completed{};
+            if (reader.complete_reads(readQueue, std::span{completions, depth}, true, completed) != StatusCode::STATUS_OK)
+            {
+                break;
+            }
+            inFlight -= completed;
+        }
+
+        if (batchResult.matchesFound > 0 && !m_scanAbort.load(std::memory_order_acquire))
+        {
+            if (write_results_direct(batchResult, writerIndex) != StatusCode::STATUS_OK)
+            {
+                m_scanAbort.store(true, std::memory_order_release);
+            }
+        }
+
+        return status;
+    }
+
     StatusCode
     MemoryScanner::scan_previous_results_from_regions(const std::size_t sortedStartIndex, const std::size_t totalCount, const std::size_t previousValueSize, const std::size_t previousFirstValueSize, const std::size_t writerIndex)
     {
@@ -308,7 +623,10 @@ namespace Vertex::Scanner
         const std::size_t firstValueSize = m_scanConfig.firstValueSize;
         const bool needsPreviousValue = m_scanConfig.needs_previous_value();
 
-        ScanResult batchResult;
+        WorkerScratch& scratch = *m_workerScratch[writerIndex];
+        scratch.context.reset();
+
+        ScanResult& batchResult = scratch.batch;
         batchResult.reserve(std::min(WRITE_THRESHOLD, totalCount), dataSize, firstValueSize);
 
         std::shared_ptr<IMemoryReader> reader;
@@ -329,7 +647,6 @@ namespace Vertex::Scanner
 
         const std::size_t sortedEndIndex = std::min(sortedStartIndex + totalCount, m_sortedNextScanRecords.size());
 
-        Memory::AlignedByteVector readBuffer{};
         const bool supportsBulkRead = reader->supports_bulk_read();
         std::size_t maxBulkRequests = static_cast<std::size_t>(std::max(1, m_settingsService.get_int("bulk.maxRequestSize", 4096)));
         if (supportsBulkRead)
@@ -342,26 +659,86 @@ namespace Vertex::Scanner
             maxBulkRequests = std::max<std::size_t>(1, maxBulkRequests);
         }
 
-        std::vector<std::uint64_t> addresses;
-        std::vector<const std::uint8_t*> previousValuePtrs;
-        std::vector<const std::uint8_t*> firstValuePtrs;
-        addresses.reserve(256);
-        previousValuePtrs.reserve(256);
-        firstValuePtrs.reserve(256);
+        auto* addresses = scratch.context.arena_allocate_array_nothrow<std::uint64_t>(NEXT_SCAN_BUNDLE_SIZE);
+        auto* previousValuePtrs = scratch.context.arena_allocate_array_nothrow<const std::uint8_t*>(NEXT_SCAN_BUNDLE_SIZE);
+        auto* firstValuePtrs = scratch.context.arena_allocate_array_nothrow<const std::uint8_t*>(NEXT_SCAN_BUNDLE_SIZE);
+        BulkReadRequest* requests{};
+        BulkReadResult* results{};
+        std::uint8_t* bulkReadBuffer{};
+        if (supportsBulkRead)
+        {
+            requests = scratch.context.arena_allocate_array_nothrow<BulkReadRequest>(NEXT_SCAN_BUNDLE_SIZE);
+            results = scratch.context.arena_allocate_array_nothrow<BulkReadResult>(NEXT_SCAN_BUNDLE_SIZE);
+            bulkReadBuffer = scratch.context.arena_allocate_array_nothrow<std::uint8_t>(NEXT_SCAN_BUNDLE_SIZE * std::max<std::size_t>(1, dataSize));
+        }
+
+        if (!addresses || !previousValuePtrs || !firstValuePtrs || (supportsBulkRead && (!requests || !results || !bulkReadBuffer)))
+        {
+            return StatusCode::STATUS_ERROR_MEMORY_ALLOCATION_FAILED;
+        }
+
+        auto process_match = [&](const std::uint64_t address, const std::uint8_t* currentData, const std::uint8_t* previousValue, const std::uint8_t* firstValue) -> bool
+        {
+            if (m_scanAbort.load(std::memory_order_acquire)) [[unlikely]]
+            {
+                return false;
+            }
+
+            bool matches = false;
+
+            if (needsPreviousValue && previousValue != nullptr)
+            {
+                matches = check_value_matches_with_previous(currentData, previousValue);
+            }
+            else
+            {
+                matches = check_value_matches(currentData);
+            }
+
+            if (matches)
+            {
+                batchResult.add_match(address, currentData, dataSize, firstValue, firstValueSize);
+
+                if (batchResult.matchesFound >= WRITE_THRESHOLD)
+                {
+                    if (write_results_direct(batchResult, writerIndex) != StatusCode::STATUS_OK)
+                    {
+                        m_scanAbort.store(true, std::memory_order_release);
+                        return false;
+                    }
+                    batchResult.clear();
+                }
+            }
+
+            return true;
+        };
 
         std::size_t cursor = sortedStartIndex;
         while (cursor < sortedEndIndex && !m_scanAbort.load(std::memory_order_acquire))
         {
-            addresses.clear();
-            previousValuePtrs.clear();
-            firstValuePtrs.clear();
+            std::size_t bundleCount{};
+            std::size_t carried{};
 
-            while (cursor < sortedEndIndex && addresses.size() < 256)
+            while (cursor < sortedEndIndex && bundleCount < NEXT_SCAN_BUNDLE_SIZE)
             {
                 const auto& recordRef = m_sortedNextScanRecords[cursor];
-                if (!addresses.empty())
+                if (is_clean_record(cursor))
                 {
-                    const std::uint64_t gap = recordRef.address - addresses.back();
+                    // The page was not written since this value was read, so the previous value is still current.
+                    const auto* previousValue = reinterpret_cast<const std::uint8_t*>(recordRef.recordPtr + sizeof(std::uint64_t));
+                    const auto* firstValue = (previousFirstValueSize == 0) ? previousValue : (previousValue + previousValueSize);
+                    if (!process_match(recordRef.address, previousValue, previousValue, firstValue))
+                    {
+                        break;
+                    }
+                    ++carried;
+                    ++cursor;
+                    continue;
+                }
+
+                if (bundleCount > 0)
+                {
+                    const std::uint64_t gap = recordRef.address - addresses[bundleCount - 1];
                     if (gap > 512)
                     {
                         break;
@@ -370,60 +747,32 @@ namespace Vertex::Scanner
 
                 const auto* previousValue = reinterpret_cast<const std::uint8_t*>(recordRef.recordPtr + sizeof(std::uint64_t));
                 const auto* firstValue = (previousFirstValueSize == 0) ? previousValue : (previousValue + previousValueSize);
-                addresses.push_back(recordRef.address);
-                previousValuePtrs.push_back(previousValue);
-                firstValuePtrs.push_back(firstValue);
+                addresses[bundleCount] = recordRef.address;
+                previousValuePtrs[bundleCount] = previousValue;
+                firstValuePtrs[bundleCount] = firstValue;
+                ++bundleCount;
                 ++cursor;
             }
 
-            if (addresses.empty())
+            if (carried > 0)
             {
-                continue;
+                m_regionsScanned.fetch_add(carried, std::memory_order_relaxed);
             }
 
-            auto process_match = [&](const std::uint64_t address, const std::uint8_t* currentData, const std::uint8_t* previousValue, const std::uint8_t* firstValue) -> bool
+            if (bundleCount == 0)
             {
-                if (m_scanAbort.load(std::memory_order_acquire)) [[unlikely]]
-                {
-                    return false;
-                }
-
-                bool matches = false;
-
-                if (needsPreviousValue && previousValue != nullptr)
-                {
-                    matches = check_value_matches_with_previous(currentData, previousValue);
-                }
-                else
-                {
-                    matches = check_value_matches(currentData);
-                }
-
-                if (matches)
-                {
-                    batchResult.add_match(address, currentData, dataSize, firstValue, firstValueSize);
-
-                    if (batchResult.matchesFound >= WRITE_THRESHOLD)
-                    {
-                        if (write_results_direct(batchResult, writerIndex) != StatusCode::STATUS_OK)
-                        {
-                            m_scanAbort.store(true, std::memory_order_release);
-                            return false;
-                        }
-                        batchResult.clear();
-                    }
-                }
-
-                return true;
-            };
+                notify_scan_progress_throttled();
+                continue;
+            }
 
-            const std::uint64_t startAddress = addresses.front();
-            const std::uint64_t endAddress = addresses.back();
+            const std::uint64_t startAddress = addresses[0];
+            const std::uint64_t endAddress = addresses[bundleCount - 1];
             const std::size_t bundleReadSize = (endAddress - startAddress) + dataSize;
 
+            const std::span<char> readBuffer = m_scanBuffers.acquire(writerIndex, bundleReadSize);
             if (readBuffer.size() < bundleReadSize)
             {
-                readBuffer.resize(bundleReadSize);
+                return StatusCode::STATUS_ERROR_MEMORY_ALLOCATION_FAILED;
             }
 
             const StatusCode readStatus = reader->read_memory(startAddress, bundleReadSize, readBuffer.data());
@@ -432,22 +781,18 @@ namespace Vertex::Scanner
             {
                 if (supportsBulkRead)
                 {
-                    std::vector<std::uint8_t> bulkReadBuffer(addresses.size() * dataSize);
-                    std::vector<BulkReadRequest> requests(addresses.size());
-                    std::vector<BulkReadResult> results(addresses.size());
-
-                    for (std::size_t idx = 0; idx < addresses.size(); ++idx)
+                    for (std::size_t idx = 0; idx < bundleCount; ++idx)
                     {
-                        requests[idx] = {addresses[idx], dataSize, bulkReadBuffer.data() + (idx * dataSize)};
+                        requests[idx] = {addresses[idx], dataSize, bulkReadBuffer + (idx * dataSize)};
                         results[idx].status = StatusCode::STATUS_OK;
                     }
 
                     std::size_t offset{};
-                    while (offset < addresses.size() && !m_scanAbort.load(std::memory_order_acquire))
+                    while (offset < bundleCount && !m_scanAbort.load(std::memory_order_acquire))
                     {
-                        const std::size_t chunkCount = std::min(maxBulkRequests, addresses.size() - offset);
-                        const auto requestSpan = std::span<const BulkReadRequest>(requests.data() + offset, chunkCount);
-                        auto resultSpan = std::span<BulkReadResult>(results.data() + offset, chunkCount);
+                        const std::size_t chunkCount = std::min(maxBulkRequests, bundleCount - offset);
+                        const auto requestSpan = std::span<const BulkReadRequest>(requests + offset, chunkCount);
+                        auto resultSpan = std::span<BulkReadResult>(results + offset, chunkCount);
                         const StatusCode bulkStatus = reader->read_memory_bulk(requestSpan, resultSpan);
 
                         if (bulkStatus != StatusCode::STATUS_OK)
@@ -463,11 +808,6 @@ namespace Vertex::Scanner
                                 const auto* previousValue = previousValuePtrs[idx];
                                 const auto* firstValue = firstValuePtrs[idx];
 
-                                if (readBuffer.size() < dataSize)
-                                {
-                                    readBuffer.resize(dataSize);
-                                }
-
                                 const StatusCode individualRead = reader->read_memory(address, dataSize, readBuffer.data());
                                 if (individualRead != StatusCode::STATUS_OK)
                                 {
@@ -493,7 +833,7 @@ namespace Vertex::Scanner
                                 const std::uint64_t address = addresses[idx];
                                 const auto* previousValue = previousValuePtrs[idx];
                                 const auto* firstValue = firstValuePtrs[idx];
-                                const auto* currentData = bulkReadBuffer.data() + (idx * dataSize);
+                                const auto* currentData = bulkReadBuffer + (idx * dataSize);
                                 if (!process_match(address, currentData, previousValue, firstValue))
                                 {
                                     break;
@@ -506,17 +846,12 @@ namespace Vertex::Scanner
                 }
                 else
                 {
-                    for (std::size_t idx = 0; idx < addresses.size(); ++idx)
+                    for (std::size_t idx = 0; idx < bundleCount; ++idx)
                     {
                         const std::uint64_t address = addresses[idx];
                         const auto* previousValue = previousValuePtrs[idx];
                         const auto* firstValue = firstValuePtrs[idx];
 
-                        if (readBuffer.size() < dataSize)
-                        {
-                            readBuffer.resize(dataSize);
-                        }
-
                         const StatusCode individualRead = reader->read_memory(address, dataSize, readBuffer.data());
                         if (individualRead != StatusCode::STATUS_OK)
                         {
@@ -531,12 +866,12 @@ namespace Vertex::Scanner
                     }
                 }
 
-                m_regionsScanned.fetch_add(addresses.size(), std::memory_order_relaxed);
+                m_regionsScanned.fetch_add(bundleCount, std::memory_order_relaxed);
                 notify_scan_progress_throttled();
                 continue;
             }
 
-            for (std::size_t idx = 0; idx < addresses.size(); ++idx)
+            for (std::size_t idx = 0; idx < bundleCount; ++idx)
             {
                 const std::uint64_t address = addresses[idx];
                 const auto* previousValue = previousValuePtrs[idx];
@@ -550,7 +885,7 @@ namespace Vertex::Scanner
                 }
             }
 
-            m_regionsScanned.fetch_add(addresses.size(), std::memory_order_relaxed);
+            m_regionsScanned.fetch_add(bundleCount, std::memory_order_relaxed);
             notify_scan_progress_throttled();
         }
 
@@ -0,0 +1,849 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <fmt/format.h>
+#include <vertex/scanner/memoryscanner/memoryscanner.hh>
+#include <vertex/scanner/scansession.hh>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <span>
+
+namespace Vertex::Scanner
+{
+    namespace
+    {
+        template <class T>
+        void write_pod(std::ostream& out, const T& value)
+        {
+            out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <class T>
+        [[nodiscard]] bool read_pod(std::istream& in, T& value)
+        {
+            in.read(reinterpret_cast<char*>(&value), sizeof(T));
+            return static_cast<bool>(in);
+        }
+
+        void write_bytes(std::ostream& out, const std::span<const std::uint8_t> bytes)
+        {
+            write_pod(out, static_cast<std::uint32_t>(bytes.size()));
+            out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        }
+
+        [[nodiscard]] bool read_bytes(std::istream& in, std::vector<std::uint8_t>& bytes)
+        {
+            std::uint32_t size{};
+            if (!read_pod(in, size) || size > SCAN_SESSION_MAX_VALUE_SIZE)
+            {
+                return false;
+            }
+            bytes.resize(size);
+            in.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(size));
+            return static_cast<bool>(in);
+        }
+
+        [[nodiscard]] std::uint8_t encode_optional(const std::optional<bool>& value)
+        {
+            if (!value.has_value())
+            {
+                return 0;
+            }
+            return *value ? 2 : 1;
+        }
+
+        [[nodiscard]] std::optional<bool> decode_optional(const std::uint8_t value)
+        {
+            if (value == 0)
+            {
+                return std::nullopt;
+            }
+            return value == 2;
+        }
+
+        void write_config(std::ostream& out, const ScanConfiguration& config)
+        {
+            write_pod(out, static_cast<std::uint32_t>(config.typeId));
+            write_pod(out, static_cast<std::uint8_t>(config.valueType));
+            write_pod(out, config.scanMode);
+            write_pod(out, static_cast<std::uint8_t>(config.endianness));
+            write_pod(out, static_cast<std::uint8_t>(config.alignmentRequired));
+            write_pod(out, static_cast<std::uint8_t>(config.hexDisplay));
+            write_pod(out, encode_optional(config.pluginNeedsInput));
+            write_pod(out, encode_optional(config.pluginNeedsPrevious));
+            write_pod(out, static_cast<std::uint64_t>(config.alignment));
+            write_pod(out, static_cast<std::uint64_t>(config.dataSize));
+            write_pod(out, static_cast<std::uint64_t>(config.firstValueSize));
+            write_pod(out, static_cast<std::uint8_t>(config.maxResults.has_value()));
+            write_pod(out, config.maxResults.value_or(0));
+            write_bytes(out, config.input);
+            write_bytes(out, config.input2);
+        }
+
+        [[nodiscard]] bool read_config(std::istream& in, ScanConfiguration& config)
+        {
+            std::uint32_t typeId{};
+            std::uint8_t valueType{};
+            std::uint8_t endianness{};
+            std::uint8_t alignmentRequired{};
+            std::uint8_t hexDisplay{};
+            std::uint8_t pluginNeedsInput{};
+            std::uint8_t pluginNeedsPrevious{};
+            std::uint64_t alignment{};
+            std::uint64_t dataSize{};
+            std::uint64_t firstValueSize{};
+            std::uint8_t hasMaxResults{};
+            std::uint64_t maxResults{};
+
+            const bool ok = read_pod(in, typeId) && read_pod(in, valueType) && read_pod(in, config.scanMode) &&
+                            read_pod(in, endianness) && read_pod(in, alignmentRequired) && read_pod(in, hexDisplay) &&
+                            read_pod(in, pluginNeedsInput) && read_pod(in, pluginNeedsPrevious) && read_pod(in, alignment) &&
+                            read_pod(in, dataSize) && read_pod(in, firstValueSize) && read_pod(in, hasMaxResults) &&
+                            read_pod(in, maxResults) && read_bytes(in, config.input) && read_bytes(in, config.input2);
+            if (!ok || dataSize > SCAN_SESSION_MAX_VALUE_SIZE || firstValueSize > SCAN_SESSION_MAX_VALUE_SIZE ||
+                valueType > static_cast<std::uint8_t>(ValueType::COUNT) || endianness > static_cast<std::uint8_t>(Endianness::Big))
+            {
+                return false;
+            }
+
+            config.typeId = static_cast<TypeId>(typeId);
+            config.valueType = static_cast<ValueType>(valueType);
+            config.endianness = static_cast<Endianness>(endianness);
+            config.alignmentRequired = alignmentRequired != 0;
+            config.hexDisplay = hexDisplay != 0;
+            config.pluginNeedsInput = decode_optional(pluginNeedsInput);
+            config.pluginNeedsPrevious = decode_optional(pluginNeedsPrevious);
+            config.alignment = static_cast<std::size_t>(alignment);
+            config.dataSize = static_cast<std::size_t>(dataSize);
+            config.firstValueSize = static_cast<std::size_t>(firstValueSize);
+            config.maxResults = hasMaxResults != 0 ? std::optional{maxResults} : std::nullopt;
+            return true;
+        }
+
+        class SectionWriter final
+        {
+          public:
+            SectionWriter(std::ostream& out, const ScanSessionCompression compression)
+                : m_out(out),
+                  m_compression(compression)
+            {
+            }
+
+            ~SectionWriter()
+            {
+                if (m_streamInitialized)
+                {
+                    deflateEnd(&m_stream);
+                }
+            }
+
+            SectionWriter(const SectionWriter&) = delete;
+            SectionWriter& operator=(const SectionWriter&) = delete;
+
+            [[nodiscard]] StatusCode open()
+            {
+                m_staging.reserve(SCAN_SESSION_IO_CHUNK_SIZE);
+                if (m_compression == ScanSessionCompression::None)
+                {
+                    return StatusCode::STATUS_OK;
+                }
+
+                if (deflateInit(&m_stream, Z_DEFAULT_COMPRESSION) != Z_OK)
+                {
+                    return StatusCode::STATUS_ERROR_GENERAL;
+                }
+                m_streamInitialized = true;
+                m_compressed.resize(SCAN_SESSION_IO_CHUNK_SIZE);
+                return StatusCode::STATUS_OK;
+            }
+
+            [[nodiscard]] StatusCode write(const void* data, const std::size_t size)
+            {
+                const auto* src = static_cast<const char*>(data);
+                std::size_t remaining = size;
+                while (remaining > 0)
+                {
+                    const std::size_t toCopy = std::min(remaining, SCAN_SESSION_IO_CHUNK_SIZE - m_staging.size());
+                    m_staging.insert(m_staging.end(), src, src + toCopy);
+                    src += toCopy;
+                    remaining -= toCopy;
+
+                    if (m_staging.size() == SCAN_SESSION_IO_CHUNK_SIZE)
+                    {
+                        const StatusCode status = flush(false);
+                        if (status != StatusCode::STATUS_OK)
+                        {
+                            return status;
+                        }
+                    }
+                }
+                return StatusCode::STATUS_OK;
+            }
+
+            [[nodiscard]] StatusCode finish() { return flush(true); }
+
+            [[nodiscard]] std::uint64_t stored_size() const noexcept { return m_storedSize; }
+
+          private:
+            [[nodiscard]] StatusCode flush(const bool finalChunk)
+            {
+                if (m_compression == ScanSessionCompression::None)
+                {
+                    m_out.write(m_staging.data(), static_cast<std::streamsize>(m_staging.size()));
+                    m_storedSize += m_staging.size();
+                    m_staging.clear();
+                    return m_out ? StatusCode::STATUS_OK : StatusCode::STATUS_ERROR_FS_FILE_WRITE_FAILED;
+                }
+
+                m_stream.next_in = reinterpret_cast<Bytef*>(m_staging.data());
+                m_stream.avail_in = static_cast<uInt>(m_staging.size());
+                const int flushMode = finalChunk ? Z_FINISH : Z_NO_FLUSH;
+
+                do
+                {
+                    m_stream.next_out = reinterpret_cast<Bytef*>(m_compressed.data());
+                    m_stream.avail_out = static_cast<uInt>(m_compressed.size());
+                    if (deflate(&m_stream, flushMode) == Z_STREAM_ERROR)
+                    {
+                        return StatusCode::STATUS_ERROR_GENERAL;
+                    }
+
+                    const std::size_t produced = m_compressed.size() - m_stream.avail_out;
+                    m_out.write(m_compressed.data(), static_cast<std::streamsize>(produced));
+                    m_storedSize += produced;
+                } while (m_stream.avail_out == 0);
+
+                m_staging.clear();
+                return m_out ? StatusCode::STATUS_OK : StatusCode::STATUS_ERROR_FS_FILE_WRITE_FAILED;
+            }
+
+            std::ostream& m_out;
+            ScanSessionCompression m_compression{};
+            z_stream m_stream{};
+            bool m_streamInitialized{};
+            std::vector<char> m_staging{};
+            std::vector<char> m_compressed{};
+            std::uint64_t m_storedSize{};
+        };
+
+        class SectionReader final
+        {
+          public:
+            SectionReader(std::istream& in, const ScanSessionCompression compression, const std::uint64_t storedSize)
+                : m_in(in),
+                  m_compression(compression),
+                  m_storedRemaining(storedSize)
+            {
+            }
+
+            ~SectionReader()
+            {
+                if (m_streamInitialized)
+                {
+                    inflateEnd(&m_stream);
+                }
+            }
+
+            SectionReader(const SectionReader&) = delete;
+            SectionReader& operator=(const SectionReader&) = delete;
+
+            [[nodiscard]] StatusCode open()
+            {
+                m_decoded.resize(SCAN_SESSION_IO_CHUNK_SIZE);
+                if (m_compression == ScanSessionCompression::None)
+                {
+                    return StatusCode::STATUS_OK;
+                }
+
+                if (inflateInit(&m_stream) != Z_OK)
+                {
+                    return StatusCode::STATUS_ERROR_GENERAL;
+                }
+                m_streamInitialized = true;
+                m_compressed.resize(SCAN_SESSION_IO_CHUNK_SIZE);
+                return StatusCode::STATUS_OK;
+            }
+
+            [[nodiscard]] StatusCode read(void* buffer, const std::size_t size)
+            {
+                auto* dst = static_cast<char*>(buffer);
+                std::size_t remaining = size;
+                while (remaining > 0)
+                {
+                    if (m_decodedOffset == m_decodedSize)
+                    {
+                        const StatusCode status = refill();
+                        if (status != StatusCode::STATUS_OK)
+                        {
+                            return status;
+                        }
+                    }
+
+                    const std::size_t toCopy = std::min(remaining, m_decodedSize - m_decodedOffset);
+                    std::memcpy(dst, m_decoded.data() + m_decodedOffset, toCopy);
+                    m_decodedOffset += toCopy;
+                    dst += toCopy;
+                    remaining -= toCopy;
+                }
+                return StatusCode::STATUS_OK;
+            }
+
+            [[nodiscard]] StatusCode skip_remaining()
+            {
+                m_in.seekg(static_cast<std::streamoff>(m_storedRemaining), std::ios::cur);
+                m_storedRemaining = 0;
+                return m_in ? StatusCode::STATUS_OK : StatusCode::STATUS_ERROR_FS_FILE_READ_FAILED;
+            }
+
+          private:
+            [[nodiscard]] StatusCode read_stored(char* buffer, std::size_t& size)
+            {
+                size = static_cast<std::size_t>(std::min<std::uint64_t>(size, m_storedRemaining));
+                m_in.read(buffer, static_cast<std::streamsize>(size));
+                m_storedRemaining -= size;
+                return m_in ? StatusCode::STATUS_OK : StatusCode::STATUS_ERROR_FS_FILE_READ_FAILED;
+            }
+
+            [[nodiscard]] StatusCode refill()
+            {
+                m_decodedOffset = 0;
+                m_decodedSize = 0;
+
+                if (m_compression == ScanSessionCompression::None)
+                {
+                    std::size_t size = m_decoded.size();
+                    const StatusCode status = read_stored(m_decoded.data(), size);
+                    m_decodedSize = size;
+                    if (status != StatusCode::STATUS_OK || size == 0)
+                    {
+                        return StatusCode::STATUS_ERROR_FS_FILE_INVALID_CONTENT;
+                    }
+                    return StatusCode::STATUS_OK;
+                }
+
+                m_stream.next_out = reinterpret_cast<Bytef*>(m_decoded.data());
+                m_stream.avail_out = static_cast<uInt>(m_decoded.size());
+
+                while (m_stream.avail_out == m_decoded.size())
+                {
+                    if (m_stream.avail_in == 0)
+                    {
+                        std::size_t size = m_compressed.size();
+                        const StatusCode status = read_stored(m_compressed.data(), size);
+                        if (status != StatusCode::STATUS_OK || size == 0)
+                        {
+                            return StatusCode::STATUS_ERROR_FS_FILE_INVALID_CONTENT;
+                        }
+                        m_stream.next_in = reinterpret_cast<Bytef*>(m_compressed.data());
+                        m_stream.avail_in = static_cast<uInt>(size);
+                    }
+
+                    const int result = inflate(&m_stream, Z_NO_FLUSH);
+                    if (result == Z_STREAM_END && m_stream.avail_out == m_decoded.size())
+                    {
+                        return StatusCode::STATUS_ERROR_FS_FILE_INVALID_CONTENT;
+                    }
+                    if (result != Z_OK && result != Z_STREAM_END)
+                    {
+                        return StatusCode::STATUS_ERROR_FS_FILE_INVALID_CONTENT;
+                    }
+                }
+
+                m_decodedSize = m_decoded.size() - m_stream.avail_out;
+                return StatusCode::STATUS_OK;
+            }
+
+            std::istream& m_in;
+            ScanSessionCompression m_compression{};
+            std::uint64_t m_storedRemaining{};
+            z_stream m_stream{};
+            bool m_streamInitialized{};
+            std::vector<char> m_compressed{};
+            std::vector<char> m_decoded{};
+            std::size_t m_decodedOffset{};
+            std::size_t m_decodedSize{};
+        };
+
+        [[nodiscard]] std::uint64_t read_record_address(const std::byte* record)
+        {
+            std::uint64_t address{};
+            std::memcpy(&address, record, sizeof(address));
+            return address;
+        }
+
+        [[nodiscard]] std::size_t stored_record_count(const WriterRegionMetadata& writerMeta, const std::size_t recordSize)
+        {
+            if (!writerMeta.store.is_valid() || writerMeta.store.base() == nullptr || recordSize == 0)
+            {
+                return 0;
+            }
+            return std::min(writerMeta.atomics->resultCount.load(std::memory_order_acquire), writerMeta.store.data_size() / recordSize);
+        }
+    }
+
+    StatusCode MemoryScanner::export_session(const std::filesystem::path& path, const std::vector<ScanRegion>& modules, const ScanSessionCompression compression)
+    {
+        std::scoped_lock lifecycleLock(m_scanLifecycleMutex);
+        if (is_scan_active() != StatusCode::STATUS_OK)
+        {
+            return StatusCode::STATUS_ERROR_THREAD_IS_BUSY;
+        }
+
+        std::vector<ScanRegion> sortedModules{modules};
+        std::erase_if(sortedModules,
+                      [](const ScanRegion& module)
+                      {
+                          return module.size == 0;
+                      });
+        std::ranges::sort(sortedModules, {}, &ScanRegion::baseAddress);
+
+        auto tempPath = path;
+        tempPath += ".tmp";
+
+        std::ofstream out{tempPath, std::ios::out | std::ios::binary | std::ios::trunc};
+        if (!out)
+        {
+            m_logService.log_error(fmt::format("[Scanner] Failed to create session file {}", tempPath.string()));
+            return StatusCode::STATUS_ERROR_FILE_CREATION_FAILED;
+        }
+
+        std::scoped_lock undoLock(m_undoHistoryMutex);
+        std::shared_lock regionsLock(m_writerRegionsMutex);
+
+        const auto levelCount = static_cast<std::uint32_t>(m_undoHistory.size() + 1);
+        write_pod(out, SCAN_SESSION_MAGIC);
+        write_pod(out, SCAN_SESSION_VERSION);
+        write_pod(out, SCAN_SESSION_BYTE_ORDER_MARK);
+        write_pod(out, static_cast<std::uint32_t>(compression));
+        write_pod(out, static_cast<std::uint32_t>(sortedModules.size()));
+        write_pod(out, levelCount);
+        write_config(out, m_firstScanConfig);
+
+        for (const auto& module : sortedModules)
+        {
+            write_bytes(out, std::span{reinterpret_cast<const std::uint8_t*>(module.moduleName.data()), module.moduleName.size()});
+            write_pod(out, module.size);
+        }
+
+        const auto locate = [&sortedModules](const std::uint64_t address, const std::uint64_t size) -> std::pair<std::uint32_t, std::uint64_t>
+        {
+            const auto it = std::ranges::upper_bound(sortedModules, address, {}, &ScanRegion::baseAddress);
+            if (it != sortedModules.begin())
+            {
+                const auto& module = *std::prev(it);
+                if (address - module.baseAddress < module.size && size <= module.size - (address - module.baseAddress))
+                {
+                    return {static_cast<std::uint32_t>(std::distance(sortedModules.begin(), std::prev(it))), address - module.baseAddress};
+                }
+            }
+            return {SCAN_SESSION_ABSOLUTE_MODULE, address};
+        };
+
+        write_pod(out, static_cast<std::uint32_t>(m_scannedRegions.size()));
+        for (const auto& region : m_scannedRegions)
+        {
+            const auto [moduleIndex, offset] = locate(region.baseAddress, region.size);
+            write_pod(out, moduleIndex);
+            write_pod(out, offset);
+            write_pod(out, region.size);
+        }
+
+        const auto write_level = [&](const int iteration, const ScanConfiguration& config, const std::vector<WriterRegionMetadata>& regions) -> StatusCode
+        {
+            const std::size_t valueBytes = config.dataSize + config.firstValueSize;
+            const std::size_t recordSize = sizeof(std::uint64_t) + valueBytes;
+            const std::size_t diskRecordSize = sizeof(std::uint32_t) + sizeof(std::uint64_t) + valueBytes;
+
+            std::uint64_t recordCount{};
+            for (const auto& writerMeta : regions)
+            {
+                recordCount += stored_record_count(writerMeta, recordSize);
+            }
+
+            write_pod(out, static_cast<std::int32_t>(iteration));
+            write_config(out, config);
+            write_pod(out, recordCount);
+            write_pod(out, recordCount * diskRecordSize);
+            const auto storedSizePos = out.tellp();
+            write_pod(out, std::uint64_t{});
+
+            SectionWriter writer{out, compression};
+            StatusCode status = writer.open();
+            if (status != StatusCode::STATUS_OK)
+            {
+                return status;
+            }
+
+            std::vector<std::byte> diskRecord(diskRecordSize);
+            for (const auto& writerMeta : regions)
+            {
+                const std::size_t count = stored_record_count(writerMeta, recordSize);
+                const auto* base = static_cast<const std::byte*>(writerMeta.store.base());
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const std::byte* record = base + (i * recordSize);
+                    const auto [moduleIndex, offset] = locate(read_record_address(record), config.dataSize);
+
+                    std::memcpy(diskRecord.data(), &moduleIndex, sizeof(moduleIndex));
+                    std::memcpy(diskRecord.data() + sizeof(moduleIndex), &offset, sizeof(offset));
+                    std::memcpy(diskRecord.data() + sizeof(moduleIndex) + sizeof(offset), record + sizeof(std::uint64_t), valueBytes);
+
+                    status = writer.write(diskRecord.data(), diskRecord.size());
+                    if (status != StatusCode::STATUS_OK)
+                    {
+                        return status;
+                    }
+                }
+            }
+
+            status = writer.finish();
+            if (status != StatusCode::STATUS_OK)
+            {
+                return status;
+            }
+
+            const auto endPos = out.tellp();
+            out.seekp(storedSizePos);
+            write_pod(out, writer.stored_size());
+            out.seekp(endPos);
+            return out ? StatusCode::STATUS_OK : StatusCode::STATUS_ERROR_FS_FILE_WRITE_FAILED;
+        };
+
+        StatusCode status = StatusCode::STATUS_OK;
+        const std::vector<WriterRegionMetadata> noRegions{};
+        for (const auto& snapshot : m_undoHistory)
+        {
+            status = write_level(snapshot.iteration, snapshot.config, snapshot.writerRegions ? *snapshot.writerRegions : noRegions);
+            if (status != StatusCode::STATUS_OK)
+            {
+                break;
+            }
+        }
+
+        if (status == StatusCode::STATUS_OK)
+        {
+            status = write_level(m_scanIteration, m_scanConfig, m_writerRegions);
+        }
+
+        out.close();
+        std::error_code ec{};
+        if (status != StatusCode::STATUS_OK || !out)
+        {
+            m_logService.log_error(fmt::format("[Scanner] Failed to write session file {}", path.string()));
+            std::filesystem::remove(tempPath, ec);
+            return status != StatusCode::STATUS_OK ? status : StatusCode::STATUS_ERROR_FS_FILE_WRITE_FAILED;
+        }
+
+        std::filesystem::rename(tempPath, path, ec);
+        if (ec)
+        {
+            std::filesystem::remove(tempPath, ec);
+            return StatusCode::STATUS_ERROR_FS_FILE_WRITE_FAILED;
+        }
+
+        m_logService.log_info(fmt::format("[Scanner] Exported session with {} level(s) and {} module(s) to {}", levelCount, sortedModules.size(), path.string()));
+        return StatusCode::STATUS_OK;
+    }
+
+    StatusCode MemoryScanner::import_session(const std::filesystem::path& path, const std::vector<ScanRegion>& modules,
+                                           const SchemaResolver& resolveSchema)
+    {
+        std::scoped_lock lifecycleLock(m_scanLifecycleMutex);
+        if (!drain_active_scan())
+        {
+            return StatusCode::STATUS_ERROR_THREAD_IS_BUSY;
+        }
+
+        std::ifstream in{path, std::ios::in | std::ios::binary};
+        if (!in)
+        {
+            m_logService.log_error(fmt::format("[Scanner] Failed to open session file {}", path.string()));
+            return StatusCode::STATUS_ERROR_FS_FILE_OPEN_FAILED;
+        }
+
+        std::uint32_t magic{};
+        std::uint16_t version{};
+        std::uint16_t byteOrderMark{};
+        std::uint32_t compressionValue{};
+        std::uint32_t moduleCount{};
+        std::uint32_t levelCount{};
+        if (!read_pod(in, magic) || !read_pod(in, version) || !read_pod(in, byteOrderMark) || !read_pod(in, compressionValue) ||
+            !read_pod(in, moduleCount) || !read_pod(in, levelCount))
+        {
+            return StatusCode::STATUS_ERROR_FS_FILE_INVALID_CONTENT;
+        }
+
+        if (magic != SCAN_SESSION_MAGIC || byteOrderMark != SCAN_SESSION_BYTE_ORDER_MARK || version != SCAN_SESSION_VERSION ||
+            compressionValue > static_cast<std::uint32_t>(ScanSessionCompression::Zlib) || levelCount == 0)
+        {
+            m_logService.log_error(fmt::format("[Scanner] Unsupported session file {}", path.string()));
+            return StatusCode::STATUS_ERROR_FS_FILE_INVALID_CONTENT;
+        }
+        const auto compression = static_cast<ScanSessionCompression>(compressionValue);
+
+        ScanConfiguration firstScanConfig{};
+        if (!read_config(in, firstScanConfig))
+        {
+            return StatusCode::STATUS_ERROR_FS_FILE_INVALID_CONTENT;
+        }
+
+        // Exported modules are matched by name so results land on the re-attached process's load addresses. A name
+        // loaded more than once resolves to the mapping of the exported size; if that is still ambiguous the module
+        // is left unresolved rather than guessed.
+        std::vector<std::optional<ScanRegion>> importedModules{};
+        importedModules.reserve(moduleCount);
+        std::vector<std::uint8_t> nameBytes{};
+        std::uint32_t ambiguousModules{};
+        for (std::uint32_t i = 0; i < moduleCount; ++i)
+        {
+            std::uint64_t moduleSize{};
+            if (!read_bytes(in, nameBytes) || !read_pod(in, moduleSize))
+            {
+                return StatusCode::STATUS_ERROR_FS_FILE_INVALID_CONTENT;
+            }
+
+            const std::string_view name{reinterpret_cast<const char*>(nameBytes.data()), nameBytes.size()};
+            const ScanRegion* match{};
+            std::size_t nameMatches{};
+            std::size_t sizeMatches{};
+            const ScanRegion* sizeMatch{};
+            for (const auto& module : modules)
+            {
+                if (module.moduleName != name || module.size == 0)
+                {
+                    continue;
+                }
+                ++nameMatches;
+                match = &module;
+                if (module.size == moduleSize)
+                {
+                    ++sizeMatches;
+                    sizeMatch = &module;
+                }
+            }
+
+            if (sizeMatches == 1)
+            {
+                importedModules.emplace_back(*sizeMatch);
+            }
+            else if (sizeMatches == 0 && nameMatches == 1)
+            {
+                importedModules.emplace_back(*match);
+            }
+            else
+            {
+                ambiguousModules += nameMatches > 1 ? 1 : 0;
+                importedModules.emplace_back(std::nullopt);
+            }
+        }
+        if (ambiguousModules > 0)
+        {
+            m_logService.log_warn(fmt::format("[Scanner] {} session module(s) are loaded more than once and were not rebased", ambiguousModules));
+        }
+
+        // Resolves a module-relative range; ranges that no longer fit inside the module are dropped.
+        const auto rebase = [&importedModules](const std::uint32_t moduleIndex, const std::uint64_t offset, const std::uint64_t size) -> std::optional<std::uint64_t>
+        {
+            if (moduleIndex == SCAN_SESSION_ABSOLUTE_MODULE)
+            {
+                return offset;
+            }
+            if (moduleIndex >= importedModules.size() || !importedModules[moduleIndex].has_value())
+            {
+                return std::nullopt;
+            }
+            const auto& module = *importedModules[moduleIndex];
+            if (offset >= module.size || size > module.size - offset)
+            {
+                return std::nullopt;
+            }
+            return module.baseAddress + offset;
+        };
+
+        std::uint32_t scannedRegionCount{};
+        if (!read_pod(in, scannedRegionCount))
+        {
+            return StatusCode::STATUS_ERROR_FS_FILE_INVALID_CONTENT;
+        }
+        std::vector<ScanRegion> scannedRegions{};
+        scannedRegions.reserve(scannedRegionCount);
+        for (std::uint32_t i = 0; i < scannedRegionCount; ++i)
+        {
+            std::uint32_t moduleIndex{};
+            std::uint64_t offset{};
+            std::uint64_t size{};
+            if (!read_pod(in, moduleIndex) || !read_pod(in, offset) || !read_pod(in, size))
+            {
+                return StatusCode::STATUS_ERROR_FS_FILE_INVALID_CONTENT;
+            }
+            if (const auto address = rebase(moduleIndex, offset, size); address.has_value() && size > 0)
+            {
+                scannedRegions.push_back(ScanRegion{.baseAddress = *address, .size = size});
+            }
+        }
+
+        // Older undo levels than the configured depth are skipped, exactly as a live scan would have evicted them.
+        const std::uint32_t skippedLevels = levelCount - 1 > max_undo_depth() ? levelCount - 1 - static_cast<std::uint32_t>(max_undo_depth()) : 0;
+
+        std::vector<ScanSnapshot> levels{};
+        levels.reserve(levelCount - skippedLevels);
+        std::uint64_t droppedRecords{};
+
+        for (std::uint32_t level = 0; level < levelCount; ++level)
+        {
+            std::int32_t iteration{};
+            ScanConfiguration config{};
+            std::uint64_t recordCount{};
+            std::uint64_t rawSize{};
+            std::uint64_t storedSize{};
+            if (!read_pod(in, iteration) || !read_config(in, config) || !read_pod(in, recordCount) || !read_pod(in, rawSize) ||
+                !read_pod(in, storedSize))
+            {
+                return StatusCode::STATUS_ERROR_FS_FILE_INVALID_CONTENT;
+            }
+
+            const std::size_t valueBytes = config.dataSize + config.firstValueSize;
+            const std::size_t diskRecordSize = sizeof(std::uint32_t) + sizeof(std::uint64_t) + valueBytes;
+            if (recordCount > std::numeric_limits<std::uint64_t>::max() / diskRecordSize || recordCount * diskRecordSize != rawSize)
+            {
+                return StatusCode::STATUS_ERROR_FS_FILE_INVALID_CONTENT;
+            }
+
+            SectionReader reader{in, compression, storedSize};
+            if (level < skippedLevels)
+            {
+                if (reader.skip_remaining() != StatusCode::STATUS_OK)
+                {
+                    return StatusCode::STATUS_ERROR_FS_FILE_INVALID_CONTENT;
+                }
+                continue;
+            }
+
+            IO::ScanResultStore store{};
+            StatusCode status = store.open();
+            if (status != StatusCode::STATUS_OK)
+            {
+                return status;
+            }
+
+            status = reader.open();
+            if (status != StatusCode::STATUS_OK)
+            {
+                return status;
+            }
+
+            std::vector<std::byte> diskRecord(diskRecordSize);
+            std::vector<std::byte> record(sizeof(std::uint64_t) + valueBytes);
+            std::size_t keptRecords{};
+            for (std::uint64_t i = 0; i < recordCount; ++i)
+            {
+                status = reader.read(diskRecord.data(), diskRecord.size());
+                if (status != StatusCode::STATUS_OK)
+                {
+                    return status;
+                }
+
+                std::uint32_t moduleIndex{};
+                std::uint64_t offset{};
+                std::memcpy(&moduleIndex, diskRecord.data(), sizeof(moduleIndex));
+                std::memcpy(&offset, diskRecord.data() + sizeof(moduleIndex), sizeof(offset));
+
+                const auto rebased = rebase(moduleIndex, offset, config.dataSize);
+                if (!rebased.has_value())
+                {
+                    ++droppedRecords;
+                    continue;
+                }
+                const std::uint64_t address = *rebased;
+
+                std::memcpy(record.data(), &address, sizeof(address));
+                std::memcpy(record.data() + sizeof(address), diskRecord.data() + sizeof(moduleIndex) + sizeof(offset), valueBytes);
+                status = store.append(record.data(), record.size());
+                if (status != StatusCode::STATUS_OK)
+                {
+                    return status;
+                }
+                ++keptRecords;
+            }
+
+            status = reader.skip_remaining();
+            if (status != StatusCode::STATUS_OK)
+            {
+                return status;
+            }
+
+            status = store.finalize();
+            if (status != StatusCode::STATUS_OK)
+            {
+                return status;
+            }
+
+            auto regions = std::make_shared<std::vector<WriterRegionMetadata>>();
+            regions->push_back(WriterRegionMetadata{.writerIndex = 0, .store = std::move(store)});
+            regions->back().atomics->resultCount.store(keptRecords, std::memory_order_release);
+
+            levels.push_back(ScanSnapshot{.iteration = iteration, .writerRegions = std::move(regions), .resultsCount = keptRecords, .config = std::move(config)});
+        }
+
+        if (droppedRecords > 0)
+        {
+            m_logService.log_warn(fmt::format("[Scanner] Dropped {} session result(s) whose module is not loaded or no longer covers them", droppedRecords));
+        }
+
+        auto current = std::move(levels.back());
+        levels.pop_back();
+
+        // Next scans compare against the imported records, so the type they were written with must still
+        // be registered and still provide the comparator of its scan mode.
+        const auto schema = resolveSchema ? resolveSchema(current.config.typeId) : nullptr;
+        if (!schema)
+        {
+            m_logService.log_error(fmt::format("[Scanner] Session {} uses a value type that is not registered", path.string()));
+            return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+        }
+        if (schema->kind == TypeKind::PluginDefined &&
+            (!schema->sdkType || !schema->sdkType->extractor ||
+             current.config.scanMode >= schema->sdkType->scanModeCount || !schema->sdkType->scanModes[current.config.scanMode].comparator))
+        {
+            m_logService.log_error(fmt::format("[Scanner] Session {} does not match the registered layout of its value type", path.string()));
+            return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        {
+            std::scoped_lock undoLock(m_undoHistoryMutex);
+            for (auto& snapshot : m_undoHistory)
+            {
+                cleanup_snapshot_regions(snapshot);
+            }
+            m_undoHistory.assign(std::make_move_iterator(levels.begin()), std::make_move_iterator(levels.end()));
+
+            std::scoped_lock regionsLock(m_writerRegionsMutex);
+            cleanup_writer_regions(m_writerRegions);
+            m_writerRegions = std::move(*current.writerRegions);
+            rebuild_result_index_locked();
+        }
+
+        m_resultsCount.store(current.resultsCount, std::memory_order_release);
+        m_regionsScanned.store(0, std::memory_order_relaxed);
+        m_totalRegions.store(0, std::memory_order_relaxed);
+        m_scanConfig = std::move(current.config);
+        m_firstScanConfig = std::move(firstScanConfig);
+        std::ranges::sort(scannedRegions, {}, &ScanRegion::baseAddress);
+        m_scannedRegions = std::move(scannedRegions);
+        m_scanIteration = current.iteration;
+        release_active_schema();
+        m_lastScanTypeId = schema->id;
+        m_dirtyEpochValid.store(false, std::memory_order_release);
+        m_resultsReconciled.store(true, std::memory_order_release);
+
+        m_logService.log_info(fmt::format("[Scanner] Imported session with {} result(s) from {}", current.resultsCount, path.string()));
+        return StatusCode::STATUS_OK;
+    }
+} // namespace Vertex::Scanner
@@ -17,7 +17,21 @@ namespace Vertex::Scanner
 
         cleanup_writer_regions(m_writerRegions);
         m_writerRegions.clear();
-        m_writerRegions.reserve(writerCount);
+        m_resultIndex.clear();
+
+        return open_writer_regions_locked(writerCount);
+    }
+
+    StatusCode MemoryScanner::append_writer_regions(const std::size_t writerCount)
+    {
+        std::scoped_lock regionsLock(m_writerRegionsMutex);
+        return open_writer_regions_locked(writerCount);
+    }
+
+    StatusCode MemoryScanner::open_writer_regions_locked(const std::size_t writerCount)
+    {
+        const std::size_t base = m_writerRegions.size();
+        m_writerRegions.reserve(base + writerCount);
 
         for (std::size_t i = 0; i < writerCount; ++i)
         {
@@ -25,13 +39,14 @@ namespace Vertex::Scanner
             const StatusCode status = store.open();
             if (status != StatusCode::STATUS_OK)
             {
-                cleanup_writer_regions(m_writerRegions);
+                m_writerRegions.erase(m_writerRegions.begin() + static_cast<std::ptrdiff_t>(base), m_writerRegions.end());
                 return status;
             }
 
             m_writerRegions.push_back(WriterRegionMetadata{.writerIndex = i, .store = std::move(store)});
         }
 
+        m_writerBase = base;
         return StatusCode::STATUS_OK;
     }
 
@@ -49,17 +64,48 @@ namespace Vertex::Scanner
             return StatusCode::STATUS_OK;
         }
 
-        WriterRegionMetadata& writerMeta = m_writerRegions[writerIndex];
+        WriterRegionMetadata& writerMeta = m_writerRegions[m_writerBase + writerIndex];
 
         const std::size_t totalDataSize = results.total_data_size();
-        const StatusCode appendStatus = writerMeta.store.append(results.data(), totalDataSize);
-        if (appendStatus != StatusCode::STATUS_OK)
+        const auto sampleShift = m_budget.admit_disk_batch(totalDataSize);
+        if (!sampleShift.has_value())
         {
-            return appendStatus;
+            // Over budget: stop the scan but keep what has been written so far.
+            m_scanAbort.store(true, std::memory_order_release);
+            return StatusCode::STATUS_OK;
         }
 
-        writerMeta.atomics->resultCount.fetch_add(results.matchesFound, std::memory_order_release);
+        if (*sampleShift == 0)
+        {
+            const StatusCode appendStatus = writerMeta.store.append(results.data(), totalDataSize);
+            if (appendStatus != StatusCode::STATUS_OK)
+            {
+                return appendStatus;
+            }
+
+            writerMeta.atomics->resultCount.fetch_add(results.matchesFound, std::memory_order_release);
+            return StatusCode::STATUS_OK;
+        }
+
+        const std::size_t recordSize = totalDataSize / results.matchesFound;
+        const std::uint64_t sequence = m_budget.next_sample_sequence(results.matchesFound);
+        std::uint64_t keptCount{};
+        for (std::uint64_t i = 0; i < results.matchesFound; ++i)
+        {
+            if (!ScanBudgetGovernor::keep_sample(sequence + i, *sampleShift))
+            {
+                continue;
+            }
+
+            const StatusCode appendStatus = writerMeta.store.append(results.data() + (i * recordSize), recordSize);
+            if (appendStatus != StatusCode::STATUS_OK)
+            {
+                return appendStatus;
+            }
+            ++keptCount;
+        }
 
+        writerMeta.atomics->resultCount.fetch_add(keptCount, std::memory_order_release);
         return StatusCode::STATUS_OK;
     }
 
@@ -83,9 +129,90 @@ namespace Vertex::Scanner
         return get_scan_results_locked(results, startIndex, count);
     }
 
-    StatusCode MemoryScanner::get_scan_results_locked(std::vector<ScanResultEntry>& results, const std::size_t startIndex, const std::size_t count) const
+    StatusCode MemoryScanner::read_scan_results_page(ScanResultPage& page, const std::size_t startIndex, const std::size_t count, const bool readCurrentValues) const
     {
-        std::uint64_t readableResults = 0;
+        std::shared_lock regionsLock(m_writerRegionsMutex);
+        const StatusCode status = copy_result_records_locked(page, startIndex, count);
+        if (status != StatusCode::STATUS_OK)
+        {
+            return status;
+        }
+
+        if (readCurrentValues && !page.empty())
+        {
+            read_current_values(page);
+        }
+
+        return StatusCode::STATUS_OK;
+    }
+
+    void MemoryScanner::rebuild_result_index_locked()
+    {
+        m_resultIndex.clear();
+
+        std::uint64_t runningCount{};
+        for (const auto& writerMeta : m_writerRegions)
+        {
+            if (!writerMeta.store.is_valid() || writerMeta.store.base() == nullptr)
+            {
+                continue;
+            }
+
+            const std::size_t writerResultCount = writerMeta.atomics->resultCount.load(std::memory_order_acquire);
+            if (writerResultCount == 0)
+            {
+                continue;
+            }
+
+            runningCount += writerResultCount;
+            m_resultIndex.push_back(ResultIndexEntry{.endIndex = runningCount, .base = static_cast<const std::byte*>(writerMeta.store.base())});
+        }
+    }
+
+    StatusCode MemoryScanner::copy_result_records_locked(ScanResultPage& page, const std::size_t startIndex, const std::size_t count) const
+    {
+        const std::size_t dataSize = m_scanConfig.dataSize;
+        const std::size_t firstValueSize = m_scanConfig.firstValueSize;
+        const std::size_t recordSize = sizeof(std::uint64_t) + dataSize + firstValueSize;
+
+        page.clear();
+
+        auto copy_records = [&](const std::byte* regionBase, const std::size_t localStart, const std::size_t recordCount)
+        {
+            std::copy_n(regionBase + (localStart * recordSize), recordCount * recordSize, reinterpret_cast<std::byte*>(page.records.data()) + (page.count * recordSize));
+            page.count += recordCount;
+        };
+
+        if (!m_resultIndex.empty())
+        {
+            const std::uint64_t readableResults = m_resultIndex.back().endIndex;
+            if (startIndex >= readableResults)
+            {
+                return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+            }
+
+            const std::size_t actualCount = std::min(count, static_cast<std::size_t>(readableResults - startIndex));
+            page.prepare(actualCount, dataSize, firstValueSize);
+
+            auto it = std::ranges::upper_bound(m_resultIndex, static_cast<std::uint64_t>(startIndex), {}, &ResultIndexEntry::endIndex);
+            std::uint64_t currentIndex = startIndex;
+            while (it != m_resultIndex.end() && page.count < actualCount)
+            {
+                const std::uint64_t beginIndex = (it == m_resultIndex.begin()) ? 0 : std::prev(it)->endIndex;
+                const auto localStart = static_cast<std::size_t>(currentIndex - beginIndex);
+                const std::size_t recordCount = std::min(actualCount - page.count, static_cast<std::size_t>(it->endIndex - currentIndex));
+
+                copy_records(it->base, localStart, recordCount);
+                currentIndex += recordCount;
+                ++it;
+            }
+
+            return StatusCode::STATUS_OK;
+        }
+
+        // The index is built once the scan reconciles; until then walk whichever
+        // writer stores have already been finalized.
+        std::uint64_t readableResults{};
         for (const auto& writerMeta : m_writerRegions)
         {
             if (writerMeta.store.is_valid() && writerMeta.store.base() != nullptr)
@@ -96,7 +223,6 @@ namespace Vertex::Scanner
 
         if (readableResults == 0)
         {
-            results.clear();
             return StatusCode::STATUS_OK;
         }
 
@@ -106,202 +232,177 @@ namespace Vertex::Scanner
         }
 
         const std::size_t actualCount = std::min(count, static_cast<std::size_t>(readableResults - startIndex));
-        results.clear();
-        results.reserve(actualCount);
-
-        const std::size_t dataSize = m_scanConfig.dataSize;
-        const std::size_t firstValueSize = m_scanConfig.firstValueSize;
-        const std::size_t recordSize = sizeof(std::uint64_t) + dataSize + firstValueSize;
-        std::size_t remainingToRead = actualCount;
-        std::size_t currentGlobalIndex = startIndex;
-        std::size_t cumulativeResults = 0;
-
-        std::shared_ptr<IMemoryReader> reader;
-        {
-            std::scoped_lock lock(m_memoryReaderMutex);
-            reader = m_memoryReader;
-        }
+        page.prepare(actualCount, dataSize, firstValueSize);
 
+        std::size_t cumulativeResults{};
         for (const auto& writerMeta : m_writerRegions)
         {
-            if (!writerMeta.store.is_valid())
-            {
-                continue;
-            }
-
-            const auto* regionBase = static_cast<const char*>(writerMeta.store.base());
-            if (regionBase == nullptr)
+            if (!writerMeta.store.is_valid() || writerMeta.store.base() == nullptr)
             {
                 continue;
             }
 
             const std::size_t writerResultCount = writerMeta.atomics->resultCount.load(std::memory_order_acquire);
-
-            if (cumulativeResults + writerResultCount <= startIndex)
+            const std::size_t currentIndex = startIndex + page.count;
+            if (cumulativeResults + writerResultCount <= currentIndex)
             {
                 cumulativeResults += writerResultCount;
                 continue;
             }
 
-            const std::size_t localStartIndex = (currentGlobalIndex >= cumulativeResults) ? (currentGlobalIndex - cumulativeResults) : 0;
-            const std::size_t resultsInThisRegion = std::min(remainingToRead, writerResultCount - localStartIndex);
+            const std::size_t localStart = currentIndex - cumulativeResults;
+            const std::size_t recordCount = std::min(actualCount - page.count, writerResultCount - localStart);
+            copy_records(static_cast<const std::byte*>(writerMeta.store.base()), localStart, recordCount);
+            cumulativeResults += writerResultCount;
 
-            if (resultsInThisRegion == 0)
+            if (page.count == actualCount)
+            {
                 break;
+            }
+        }
 
-            const std::size_t byteOffset = localStartIndex * recordSize;
-            auto readPtr = regionBase + byteOffset;
+        return StatusCode::STATUS_OK;
+    }
 
-            for (std::size_t i = 0; i < resultsInThisRegion; ++i)
-            {
-                ScanResultEntry entry;
+    void MemoryScanner::read_current_values(ScanResultPage& page) const
+    {
+        std::shared_ptr<IMemoryReader> reader;
+        {
+            std::scoped_lock lock(m_memoryReaderMutex);
+            reader = m_memoryReader;
+        }
 
-                std::copy_n(readPtr, sizeof(std::uint64_t), reinterpret_cast<char*>(&entry.address));
-                readPtr += sizeof(std::uint64_t);
+        const std::size_t dataSize = page.valueSize;
+        if (!reader || dataSize == 0)
+        {
+            return;
+        }
 
-                entry.previousValue.assign(reinterpret_cast<const std::uint8_t*>(readPtr), reinterpret_cast<const std::uint8_t*>(readPtr) + dataSize);
-                readPtr += dataSize;
+        page.prepare_current_values();
+        auto* valueBase = page.currentValues.data();
 
-                if (firstValueSize > 0)
+        if (!reader->supports_bulk_read())
+        {
+            for (std::size_t i{}; i < page.count; ++i)
+            {
+                if (reader->read_memory(page.address_at(i), dataSize, valueBase + (i * dataSize)) == StatusCode::STATUS_OK)
                 {
-                    entry.firstValue.assign(reinterpret_cast<const std::uint8_t*>(readPtr), reinterpret_cast<const std::uint8_t*>(readPtr) + firstValueSize);
-                    readPtr += firstValueSize;
+                    page.currentValid[i] = 1;
                 }
-
-                results.push_back(std::move(entry));
             }
+            return;
+        }
 
-            remainingToRead -= resultsInThisRegion;
-            currentGlobalIndex += resultsInThisRegion;
-            cumulativeResults += writerResultCount;
+        std::size_t maxBulkRequests = static_cast<std::size_t>(std::max(1, m_settingsService.get_int("bulk.maxRequestSize", 4096)));
+        const std::uint32_t readerLimit = reader->bulk_request_limit();
+        if (readerLimit > 0)
+        {
+            maxBulkRequests = std::min(maxBulkRequests, static_cast<std::size_t>(readerLimit));
+        }
+        maxBulkRequests = std::max<std::size_t>(1, maxBulkRequests);
 
-            if (remainingToRead == 0)
-                break;
+        if (page.bulkRequests.size() < page.count)
+        {
+            page.bulkRequests.resize(page.count);
+            page.bulkResults.resize(page.count);
         }
 
-        if (reader && !results.empty() && dataSize > 0)
+        for (std::size_t i{}; i < page.count; ++i)
         {
-            if (reader->supports_bulk_read())
+            page.bulkRequests[i] = {page.address_at(i), dataSize, valueBase + (i * dataSize)};
+            page.bulkResults[i].status = StatusCode::STATUS_OK;
+        }
+
+        std::size_t offset{};
+        while (offset < page.count)
+        {
+            const std::size_t chunkCount = std::min(maxBulkRequests, page.count - offset);
+            const auto requestSpan = std::span<const BulkReadRequest>(page.bulkRequests.data() + offset, chunkCount);
+            auto resultSpan = std::span<BulkReadResult>(page.bulkResults.data() + offset, chunkCount);
+            const StatusCode bulkStatus = reader->read_memory_bulk(requestSpan, resultSpan);
+
+            for (std::size_t i = offset; i < offset + chunkCount; ++i)
             {
-                std::size_t maxBulkRequests = static_cast<std::size_t>(std::max(1, m_settingsService.get_int("bulk.maxRequestSize", 4096)));
-                const std::uint32_t readerLimit = reader->bulk_request_limit();
-                if (readerLimit > 0)
+                if (bulkStatus != StatusCode::STATUS_OK)
                 {
-                    maxBulkRequests = std::min(maxBulkRequests, static_cast<std::size_t>(readerLimit));
+                    if (reader->read_memory(page.bulkRequests[i].address, dataSize, page.bulkRequests[i].buffer) == StatusCode::STATUS_OK)
+                    {
+                        page.currentValid[i] = 1;
+                    }
                 }
-                maxBulkRequests = std::max<std::size_t>(1, maxBulkRequests);
-
-                std::vector<std::vector<std::uint8_t>> bulkValueBuffers(results.size(), std::vector<std::uint8_t>(dataSize));
-                std::vector<BulkReadRequest> bulkRequests(results.size());
-                std::vector<BulkReadResult> bulkResults(results.size());
-                std::vector<std::uint8_t> readSuccess(results.size(), 0);
-
-                for (std::size_t i{}; i < results.size(); ++i)
+                else if (page.bulkResults[i].status == StatusCode::STATUS_OK)
                 {
-                    bulkRequests[i] = {
-                        results[i].address,
-                        dataSize,
-                        bulkValueBuffers[i].data()
-                    };
-                    bulkResults[i].status = StatusCode::STATUS_OK;
+                    page.currentValid[i] = 1;
                 }
+            }
 
-                std::size_t offset{};
-                while (offset < results.size())
-                {
-                    const std::size_t chunkCount = std::min(maxBulkRequests, results.size() - offset);
-                    const auto requestSpan = std::span<const BulkReadRequest>(bulkRequests.data() + offset, chunkCount);
-                    auto resultSpan = std::span<BulkReadResult>(bulkResults.data() + offset, chunkCount);
-                    const StatusCode bulkStatus = reader->read_memory_bulk(requestSpan, resultSpan);
+            offset += chunkCount;
+        }
+    }
 
-                    if (bulkStatus != StatusCode::STATUS_OK)
-                    {
-                        Memory::AlignedByteVector singleReadBuffer(dataSize);
-                        for (std::size_t i = offset; i < offset + chunkCount; ++i)
-                        {
-                            const StatusCode readStatus = reader->read_memory(results[i].address, dataSize, singleReadBuffer.data());
-                            if (readStatus != StatusCode::STATUS_OK)
-                            {
-                                continue;
-                            }
-
-                            std::copy_n(singleReadBuffer.begin(), dataSize, bulkValueBuffers[i].begin());
-                            readSuccess[i] = 1;
-                        }
-                    }
-                    else
-                    {
-                        for (std::size_t i = offset; i < offset + chunkCount; ++i)
-                        {
-                            if (bulkResults[i].status == StatusCode::STATUS_OK)
-                            {
-                                readSuccess[i] = 1;
-                            }
-                        }
-                    }
+    StatusCode MemoryScanner::get_scan_results_locked(std::vector<ScanResultEntry>& results, const std::size_t startIndex, const std::size_t count) const
+    {
+        // Reused per calling thread so repeated paging stops reallocating the record and bulk buffers.
+        // A one-off oversized page is released again rather than pinned to the thread for its lifetime.
+        thread_local ScanResultPage page{};
+        const StatusCode status = fill_scan_results_locked(page, results, startIndex, count);
+        if (page.capacity_bytes() > MAX_RETAINED_PAGE_BYTES)
+        {
+            page.release();
+        }
+        return status;
+    }
 
-                    offset += chunkCount;
-                }
+    StatusCode MemoryScanner::fill_scan_results_locked(ScanResultPage& page, std::vector<ScanResultEntry>& results, const std::size_t startIndex,
+                                                       const std::size_t count) const
+    {
+        const StatusCode copyStatus = copy_result_records_locked(page, startIndex, count);
+        if (copyStatus != StatusCode::STATUS_OK)
+        {
+            return copyStatus;
+        }
 
-                const bool isPlugin = m_activeSchema && m_activeSchema->kind == TypeKind::PluginDefined;
-                for (std::size_t i{}; i < results.size(); ++i)
-                {
-                    if (readSuccess[i] == 0)
-                    {
-                        continue;
-                    }
+        results.clear();
+        if (page.empty())
+        {
+            return StatusCode::STATUS_OK;
+        }
 
-                    results[i].value = bulkValueBuffers[i];
-                    if (isPlugin)
-                    {
-                        results[i].formattedValue = format_plugin_bytes(
-                            *m_activeSchema, bulkValueBuffers[i].data(), dataSize);
-                    }
-                    else
-                    {
-                        results[i].formattedValue = ValueConverter::format(
-                            m_scanConfig.valueType,
-                            bulkValueBuffers[i].data(),
-                            dataSize,
-                            m_scanConfig.hexDisplay,
-                            m_scanConfig.endianness);
-                    }
-                }
-            }
-            else
+        if (m_scanConfig.dataSize > 0)
+        {
+            read_current_values(page);
+        }
+
+        const bool isPlugin = m_activeSchema && m_activeSchema->kind == TypeKind::PluginDefined;
+        results.reserve(page.size());
+        for (std::size_t i{}; i < page.size(); ++i)
+        {
+            const ScanResultRecordView record = page[i];
+
+            ScanResultEntry entry{};
+            entry.address = record.address;
+            entry.previousValue.assign(record.previousValue.begin(), record.previousValue.end());
+            entry.firstValue.assign(record.firstValue.begin(), record.firstValue.end());
+
+            if (!record.currentValue.empty())
             {
-                const bool isPlugin = m_activeSchema && m_activeSchema->kind == TypeKind::PluginDefined;
-                Memory::AlignedByteVector currentValueBuffer(dataSize);
-                for (auto& entry : results)
+                entry.value.assign(record.currentValue.begin(), record.currentValue.end());
+                if (isPlugin)
                 {
-                    const StatusCode memReadStatus = reader->read_memory(entry.address, dataSize, currentValueBuffer.data());
-                    if (memReadStatus != StatusCode::STATUS_OK)
-                    {
-                        continue;
-                    }
-
-                    entry.value.assign(currentValueBuffer.begin(), currentValueBuffer.begin() + dataSize);
-                    if (isPlugin)
-                    {
-                        entry.formattedValue = format_plugin_bytes(
-                            *m_activeSchema, currentValueBuffer.data(), dataSize);
-                    }
-                    else
-                    {
-                        entry.formattedValue = ValueConverter::format(
-                            m_scanConfig.valueType,
-                            currentValueBuffer.data(),
-                            dataSize,
-                            m_scanConfig.hexDisplay,
-                            m_scanConfig.endianness);
-                    }
+                    entry.formattedValue = format_plugin_bytes(*m_activeSchema, record.currentValue.data(), record.currentValue.size());
+                }
+                else
+                {
+                    entry.formattedValue = ValueConverter::format(
+                        m_scanConfig.valueType,
+                        record.currentValue.data(),
+                        record.currentValue.size(),
+                        m_scanConfig.hexDisplay,
+                        m_scanConfig.endianness);
                 }
             }
-        }
 
-        if (results.size() != actualCount)
-        {
-            return StatusCode::STATUS_ERROR_THREAD_IS_BUSY;
+            results.push_back(std::move(entry));
         }
 
         return StatusCode::STATUS_OK;
@@ -153,4 +153,221 @@ namespace Vertex::Scanner
 
         return StatusCode::STATUS_OK;
     }
+
+    bool PluginMemoryReader::supports_dirty_tracking() const noexcept
+    {
+        const auto pluginOpt = m_loaderService.get_active_plugin();
+        if (!pluginOpt.has_value())
+        {
+            return false;
+        }
+
+        const auto& plugin = pluginOpt.value().get();
+        return plugin.internal_vertex_memory_reset_dirty_tracking != nullptr &&
+               plugin.internal_vertex_memory_query_dirty_pages != nullptr &&
+               m_dirtyTrackingUnavailable.load(std::memory_order_acquire) != &plugin;
+    }
+
+    StatusCode PluginMemoryReader::reset_dirty_tracking()
+    {
+        const auto pluginOpt = m_loaderService.get_active_plugin();
+        if (!pluginOpt.has_value())
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_NOT_ACTIVE;
+        }
+
+        const auto& plugin = pluginOpt.value().get();
+        if (plugin.internal_vertex_memory_reset_dirty_tracking == nullptr)
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_FUNCTION_NOT_IMPLEMENTED;
+        }
+
+        const auto status = Runtime::get_status(Runtime::safe_call(plugin.internal_vertex_memory_reset_dirty_tracking));
+        if (status == StatusCode::STATUS_ERROR_NOT_IMPLEMENTED)
+        {
+            m_dirtyTrackingUnavailable.store(&plugin, std::memory_order_release);
+        }
+        return status;
+    }
+
+    StatusCode PluginMemoryReader::query_dirty_pages(const std::uint64_t address, const std::uint64_t size, const std::span<std::uint8_t> bitmap, std::uint64_t& pageSize)
+    {
+        const auto pluginOpt = m_loaderService.get_active_plugin();
+        if (!pluginOpt.has_value())
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_NOT_ACTIVE;
+        }
+
+        const auto& plugin = pluginOpt.value().get();
+        if (plugin.internal_vertex_memory_query_dirty_pages == nullptr)
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_FUNCTION_NOT_IMPLEMENTED;
+        }
+
+        return Runtime::get_status(Runtime::safe_call(plugin.internal_vertex_memory_query_dirty_pages,
+                                                      address,
+                                                      size,
+                                                      bitmap.empty() ? nullptr : bitmap.data(),
+                                                      static_cast<std::uint64_t>(bitmap.size()),
+                                                      &pageSize));
+    }
+
+    bool PluginMemoryReader::supports_residency_query() const noexcept
+    {
+        const auto pluginOpt = m_loaderService.get_active_plugin();
+        if (!pluginOpt.has_value())
+        {
+            return false;
+        }
+
+        return pluginOpt.value().get().internal_vertex_memory_query_resident_pages != nullptr;
+    }
+
+    StatusCode PluginMemoryReader::query_resident_pages(const std::uint64_t address, const std::uint64_t size, const std::span<std::uint8_t> bitmap, std::uint64_t& pageSize)
+    {
+        const auto pluginOpt = m_loaderService.get_active_plugin();
+        if (!pluginOpt.has_value())
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_NOT_ACTIVE;
+        }
+
+        const auto& plugin = pluginOpt.value().get();
+        if (plugin.internal_vertex_memory_query_resident_pages == nullptr)
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_FUNCTION_NOT_IMPLEMENTED;
+        }
+
+        return Runtime::get_status(Runtime::safe_call(plugin.internal_vertex_memory_query_resident_pages,
+                                                      address,
+                                                      size,
+                                                      bitmap.empty() ? nullptr : bitmap.data(),
+                                                      static_cast<std::uint64_t>(bitmap.size()),
+                                                      &pageSize));
+    }
+
+    bool PluginMemoryReader::supports_async_read() const noexcept
+    {
+        const auto pluginOpt = m_loaderService.get_active_plugin();
+        if (!pluginOpt.has_value())
+        {
+            return false;
+        }
+
+        const auto& plugin = pluginOpt.value().get();
+        return plugin.internal_vertex_memory_read_queue_create != nullptr &&
+               plugin.internal_vertex_memory_read_queue_submit != nullptr &&
+               plugin.internal_vertex_memory_read_queue_complete != nullptr &&
+               plugin.internal_vertex_memory_read_queue_destroy != nullptr;
+    }
+
+    StatusCode PluginMemoryReader::open_read_queue(const std::uint32_t depth, std::uint64_t& queue)
+    {
+        const auto pluginOpt = m_loaderService.get_active_plugin();
+        if (!pluginOpt.has_value())
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_NOT_ACTIVE;
+        }
+
+        const auto& plugin = pluginOpt.value().get();
+        if (plugin.internal_vertex_memory_read_queue_create == nullptr)
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_FUNCTION_NOT_IMPLEMENTED;
+        }
+
+        return Runtime::get_status(Runtime::safe_call(plugin.internal_vertex_memory_read_queue_create, depth, &queue));
+    }
+
+    StatusCode PluginMemoryReader::submit_reads(const std::uint64_t queue, const std::span<const AsyncReadRequest> requests)
+    {
+        if (requests.size() > std::numeric_limits<std::uint32_t>::max())
+        {
+            return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        const auto pluginOpt = m_loaderService.get_active_plugin();
+        if (!pluginOpt.has_value())
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_NOT_ACTIVE;
+        }
+
+        const auto& plugin = pluginOpt.value().get();
+        if (plugin.internal_vertex_memory_read_queue_submit == nullptr)
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_FUNCTION_NOT_IMPLEMENTED;
+        }
+
+        thread_local std::vector<::AsyncReadRequest> sdkRequests{};
+        sdkRequests.resize(requests.size());
+        for (std::size_t index{}; index < requests.size(); ++index)
+        {
+            sdkRequests[index] = {requests[index].address, requests[index].size, requests[index].buffer, requests[index].userData};
+        }
+
+        return Runtime::get_status(Runtime::safe_call(plugin.internal_vertex_memory_read_queue_submit,
+                                                      queue,
+                                                      sdkRequests.data(),
+                                                      static_cast<std::uint32_t>(sdkRequests.size())));
+    }
+
+    StatusCode PluginMemoryReader::complete_reads(const std::uint64_t queue, const std::span<AsyncReadCompletion> completions, const bool wait, std::uint32_t& completed)
+    {
+        completed = 0;
+
+        if (completions.size() > std::numeric_limits<std::uint32_t>::max())
+        {
+            return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        const auto pluginOpt = m_loaderService.get_active_plugin();
+        if (!pluginOpt.has_value())
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_NOT_ACTIVE;
+        }
+
+        const auto& plugin = pluginOpt.value().get();
+        if (plugin.internal_vertex_memory_read_queue_complete == nullptr)
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_FUNCTION_NOT_IMPLEMENTED;
+        }
+
+        thread_local std::vector<::AsyncReadCompletion> sdkCompletions{};
+        sdkCompletions.resize(completions.size());
+
+        std::uint32_t sdkCompleted{};
+        const auto status = Runtime::get_status(Runtime::safe_call(plugin.internal_vertex_memory_read_queue_complete,
+                                                                   queue,
+                                                                   sdkCompletions.data(),
+                                                                   static_cast<std::uint32_t>(sdkCompletions.size()),
+                                                                   static_cast<std::uint8_t>(wait ? 1 : 0),
+                                                                   &sdkCompleted));
+        if (status != StatusCode::STATUS_OK)
+        {
+            return status;
+        }
+
+        completed = std::min<std::uint32_t>(sdkCompleted, static_cast<std::uint32_t>(completions.size()));
+        for (std::uint32_t index{}; index < completed; ++index)
+        {
+            completions[index] = {sdkCompletions[index].userData, sdkCompletions[index].status};
+        }
+
+        return StatusCode::STATUS_OK;
+    }
+
+    StatusCode PluginMemoryReader::close_read_queue(const std::uint64_t queue)
+    {
+        const auto pluginOpt = m_loaderService.get_active_plugin();
+        if (!pluginOpt.has_value())
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_NOT_ACTIVE;
+        }
+
+        const auto& plugin = pluginOpt.value().get();
+        if (plugin.internal_vertex_memory_read_queue_destroy == nullptr)
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_FUNCTION_NOT_IMPLEMENTED;
+        }
+
+        return Runtime::get_status(Runtime::safe_call(plugin.internal_vertex_memory_read_queue_destroy, queue));
+    }
 } // namespace Vertex::Scanner
@@ -0,0 +1,116 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <vertex/scanner/scanbudget.hh>
+
+#include <algorithm>
+
+namespace Vertex::Scanner
+{
+    void ScanBudgetGovernor::reset(const ScanBudgetLimits& limits, const std::uint64_t retainedDiskBytes) noexcept
+    {
+        std::scoped_lock lock(m_thresholdMutex);
+        m_limits = limits;
+        m_nextDiskThreshold = limits.diskBytes;
+        m_diskUsed.store(retainedDiskBytes, std::memory_order_relaxed);
+        m_memoryUsed.store(0, std::memory_order_relaxed);
+        m_sampleSequence.store(0, std::memory_order_relaxed);
+        m_diskSampleShift.store(0, std::memory_order_relaxed);
+        m_memorySampleShift.store(0, std::memory_order_relaxed);
+        m_exceeded.store(false, std::memory_order_release);
+    }
+
+    std::optional<std::uint32_t> ScanBudgetGovernor::admit_disk_batch(const std::uint64_t batchBytes) noexcept
+    {
+        if (m_limits.diskBytes == 0)
+        {
+            m_diskUsed.fetch_add(batchBytes, std::memory_order_relaxed);
+            return 0;
+        }
+
+        if (m_exceeded.load(std::memory_order_acquire))
+        {
+            return std::nullopt;
+        }
+
+        std::scoped_lock lock(m_thresholdMutex);
+        const std::uint64_t used = m_diskUsed.load(std::memory_order_relaxed);
+
+        if (m_limits.policy == ScanBudgetPolicy::AbortWithPartialResults)
+        {
+            if (used + batchBytes > m_limits.diskBytes)
+            {
+                m_exceeded.store(true, std::memory_order_release);
+                return std::nullopt;
+            }
+            m_diskUsed.store(used + batchBytes, std::memory_order_relaxed);
+            return 0;
+        }
+
+        std::uint32_t shift = m_diskSampleShift.load(std::memory_order_relaxed);
+        while (used + (batchBytes >> shift) > m_nextDiskThreshold)
+        {
+            if (shift == MAX_SAMPLE_SHIFT)
+            {
+                m_exceeded.store(true, std::memory_order_release);
+                return std::nullopt;
+            }
+            ++shift;
+            m_nextDiskThreshold += m_limits.diskBytes >> shift;
+        }
+
+        m_diskSampleShift.store(shift, std::memory_order_relaxed);
+        m_diskUsed.store(used + (batchBytes >> shift), std::memory_order_relaxed);
+        return shift;
+    }
+
+    std::optional<std::uint32_t> ScanBudgetGovernor::admit_memory(const std::uint64_t bytes) noexcept
+    {
+        if (m_limits.memoryBytes == 0)
+        {
+            m_memoryUsed.fetch_add(bytes, std::memory_order_relaxed);
+            return 0;
+        }
+
+        std::scoped_lock lock(m_thresholdMutex);
+        const std::uint64_t used = m_memoryUsed.load(std::memory_order_relaxed);
+        const std::uint64_t headroom = m_limits.memoryBytes > used ? m_limits.memoryBytes - used : 0;
+
+        std::uint32_t shift = 0;
+        while ((bytes >> shift) > headroom)
+        {
+            if (m_limits.policy == ScanBudgetPolicy::AbortWithPartialResults || shift == MAX_SAMPLE_SHIFT)
+            {
+                m_exceeded.store(true, std::memory_order_release);
+                return std::nullopt;
+            }
+            ++shift;
+        }
+
+        m_memoryUsed.store(used + (bytes >> shift), std::memory_order_relaxed);
+        m_memorySampleShift.store(std::max(shift, m_memorySampleShift.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+        return shift;
+    }
+
+    void ScanBudgetGovernor::release_memory(const std::uint64_t bytes) noexcept
+    {
+        std::uint64_t used = m_memoryUsed.load(std::memory_order_relaxed);
+        while (!m_memoryUsed.compare_exchange_weak(used, used > bytes ? used - bytes : 0, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    std::uint64_t ScanBudgetGovernor::next_sample_sequence(const std::uint64_t count) noexcept
+    {
+        return m_sampleSequence.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    ScanBudgetUsage ScanBudgetGovernor::usage() const noexcept
+    {
+        return ScanBudgetUsage{.diskBytes = m_diskUsed.load(std::memory_order_relaxed),
+                               .memoryBytes = m_memoryUsed.load(std::memory_order_relaxed),
+                               .sampleShift = m_diskSampleShift.load(std::memory_order_relaxed) + m_memorySampleShift.load(std::memory_order_relaxed),
+                               .exceeded = m_exceeded.load(std::memory_order_acquire)};
+    }
+} // namespace Vertex::Scanner
@@ -150,6 +150,10 @@ namespace Vertex::Scanner
                 {
                     return dispatch_next_scan(std::forward<TCommand>(cmd), timeout);
                 }
+                else if constexpr (std::is_same_v<Decayed, service::CmdExtendScan>)
+                {
+                    return dispatch_extend_scan(std::forward<TCommand>(cmd), timeout);
+                }
                 else if constexpr (std::is_same_v<Decayed, service::CmdUndoScan>)
                 {
                     return dispatch_undo_scan(std::forward<TCommand>(cmd), timeout);
@@ -158,6 +162,14 @@ namespace Vertex::Scanner
                 {
                     return dispatch_stop_scan(std::forward<TCommand>(cmd), timeout);
                 }
+                else if constexpr (std::is_same_v<Decayed, service::CmdExportSession>)
+                {
+                    return dispatch_export_session(std::forward<TCommand>(cmd), timeout);
+                }
+                else if constexpr (std::is_same_v<Decayed, service::CmdImportSession>)
+                {
+                    return dispatch_import_session(std::forward<TCommand>(cmd), timeout);
+                }
                 else if constexpr (std::is_same_v<Decayed, service::CmdCancel>)
                 {
                     return dispatch_cancel(std::forward<TCommand>(cmd), timeout);
@@ -290,6 +302,44 @@ namespace Vertex::Scanner
         return id;
     }
 
+    Runtime::CommandId
+    ScannerRuntimeService::dispatch_extend_scan(service::CmdExtendScan command,
+                                                  std::chrono::milliseconds timeout)
+    {
+        const auto id = allocate_command_id();
+        if (!register_pending(id, timeout))
+        {
+            return Runtime::INVALID_COMMAND_ID;
+        }
+
+        Runtime::CommandId expected = Runtime::INVALID_COMMAND_ID;
+        if (!m_activeScanId.compare_exchange_strong(expected, id, std::memory_order_acq_rel))
+        {
+            synthesise_rejection(id, STATUS_ERROR_THREAD_IS_BUSY);
+            return id;
+        }
+
+        auto schema = resolve_schema(m_activeScanTypeId.load(std::memory_order_acquire));
+        if (!schema)
+        {
+            m_activeScanId.store(Runtime::INVALID_COMMAND_ID, std::memory_order_release);
+            synthesise_rejection(id, STATUS_ERROR_GENERAL_NOT_FOUND);
+            return id;
+        }
+
+        m_activeScanStart.store(std::chrono::steady_clock::now(), std::memory_order_release);
+
+        const auto status = m_scanner.extend_scan(schema, command.regions);
+        if (status != STATUS_OK)
+        {
+            m_activeScanId.store(Runtime::INVALID_COMMAND_ID, std::memory_order_release);
+            synthesise_rejection(id, status);
+            return id;
+        }
+        m_backendScanActive.store(true, std::memory_order_release);
+        return id;
+    }
+
     Runtime::CommandId
     ScannerRuntimeService::dispatch_undo_scan(service::CmdUndoScan /*command*/,
                                                 std::chrono::milliseconds timeout)
@@ -320,6 +370,66 @@ namespace Vertex::Scanner
         return id;
     }
 
+    Runtime::CommandId
+    ScannerRuntimeService::dispatch_export_session(service::CmdExportSession command,
+                                                    std::chrono::milliseconds timeout)
+    {
+        const auto id = allocate_command_id();
+        if (!register_pending(id, timeout))
+        {
+            return Runtime::INVALID_COMMAND_ID;
+        }
+
+        if (m_activeScanId.load(std::memory_order_acquire) != Runtime::INVALID_COMMAND_ID)
+        {
+            synthesise_rejection(id, STATUS_ERROR_THREAD_IS_BUSY);
+            return id;
+        }
+
+        const auto status = m_scanner.export_session(command.path, command.modules, command.compression);
+        post_result(id, status);
+        return id;
+    }
+
+    Runtime::CommandId
+    ScannerRuntimeService::dispatch_import_session(service::CmdImportSession command,
+                                                    std::chrono::milliseconds timeout)
+    {
+        const auto id = allocate_command_id();
+        if (!register_pending(id, timeout))
+        {
+            return Runtime::INVALID_COMMAND_ID;
+        }
+
+        Runtime::CommandId expected = Runtime::INVALID_COMMAND_ID;
+        if (!m_activeScanId.compare_exchange_strong(expected, id, std::memory_order_acq_rel))
+        {
+            synthesise_rejection(id, STATUS_ERROR_THREAD_IS_BUSY);
+            return id;
+        }
+
+        TypeId importedTypeId{TypeId::Invalid};
+        const auto status = m_scanner.import_session(command.path, command.modules,
+                                                     [this, &importedTypeId](const TypeId typeId)
+                                                     {
+                                                         importedTypeId = typeId;
+                                                         return resolve_schema(typeId);
+                                                     });
+        if (status == STATUS_OK)
+        {
+            // The scanner pins the restored session's type; drop ours so the next scan is checked there.
+            m_activeScanTypeId.store(TypeId::Invalid, std::memory_order_release);
+        }
+        m_activeScanId.store(Runtime::INVALID_COMMAND_ID, std::memory_order_release);
+        if (status != STATUS_OK)
+        {
+            post_result(id, status);
+            return id;
+        }
+        post_result(id, status, service::ImportSessionResultPayload{.id = importedTypeId});
+        return id;
+    }
+
     Runtime::CommandId
     ScannerRuntimeService::dispatch_cancel(service::CmdCancel command,
                                             std::chrono::milliseconds timeout)
@@ -556,6 +666,13 @@ namespace Vertex::Scanner
         return m_scanner.get_scan_results_range(out, startIndex, count);
     }
 
+    StatusCode ScannerRuntimeService::snapshot_results_page(ScanResultPage& page,
+                                                             std::size_t startIndex,
+                                                             std::size_t count) const
+    {
+        return m_scanner.read_scan_results_page(page, startIndex, count, true);
+    }
+
     bool ScannerRuntimeService::can_undo() const
     {
         return m_scanner.can_undo();
@@ -866,10 +983,16 @@ namespace Vertex::Scanner
             ? static_cast<std::uint8_t>(std::min<std::uint64_t>(100, (scanned * 100) / total))
             : std::uint8_t{0};
 
+        const auto budget = m_scanner.get_budget_usage();
+
         ScannerEvent event{.kind = ScannerEventKind::ScanProgress,
                            .detail = ScanProgressInfo{.percentComplete = percent,
                                                        .addressesScanned = scanned,
-                                                       .matchesSoFar = m_scanner.get_results_count()}};
+                                                       .matchesSoFar = m_scanner.get_results_count(),
+                                                       .diskBytesUsed = budget.diskBytes,
+                                                       .memoryBytesUsed = budget.memoryBytes,
+                                                       .sampleShift = budget.sampleShift,
+                                                       .budgetExceeded = budget.exceeded}};
         m_fanout.fire(event);
     }
 }
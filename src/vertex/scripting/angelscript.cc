@@ -678,8 +678,12 @@ namespace Vertex::Scripting
     AngelScript::AngelScript(Log::ILog& logService, Runtime::ILoader& loader, Event::EventBus& eventBus, Thread::IThreadDispatcher& dispatcher)
         : m_logService{logService}, m_loader{loader}, m_messageContext{&logService, &eventBus}, m_scriptLogger{logService, eventBus},
           m_scriptProcess{loader, eventBus, dispatcher}, m_scriptMemory{loader, dispatcher},
-          m_scriptUtility{loader}
+          m_scriptUtility{loader}, m_scriptAnalysis{loader, eventBus, dispatcher}
     {
+        m_scriptMemory.set_write_observer([this](const std::uint64_t address, const std::uint64_t size)
+        {
+            m_scriptAnalysis.invalidate(address, size);
+        });
         m_initialized = (initialize_engine() == StatusCode::STATUS_OK);
     }
 
@@ -805,6 +809,12 @@ namespace Vertex::Scripting
             return status;
         }
 
+        if (const auto status = m_scriptAnalysis.register_api(*m_engine);
+            status != StatusCode::STATUS_OK)
+        {
+            return status;
+        }
+
         return m_scriptUI.register_api(*m_engine);
     }
 
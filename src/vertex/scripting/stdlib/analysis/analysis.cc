@@ -0,0 +1,548 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+
+#include <vertex/scripting/stdlib/analysis.hh>
+#include <vertex/event/eventid.hh>
+#include <vertex/event/types/processopenevent.hh>
+#include <vertex/event/types/processcloseevent.hh>
+#include <vertex/event/types/debuggerevent.hh>
+#include <vertex/event/types/regionchangeevent.hh>
+#include <vertex/runtime/caller.hh>
+
+#include <sdk/process.h>
+
+#include <angelscript.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace Vertex::Scripting::Stdlib
+{
+    static constexpr std::string_view SUBSCRIBER_NAME{"ScriptAnalysis"};
+
+    static void basic_block_default_construct(void* memory)
+    {
+        new (memory) ScriptBasicBlock();
+    }
+
+    static void basic_block_copy_construct(const ScriptBasicBlock& other, void* memory)
+    {
+        new (memory) ScriptBasicBlock(other);
+    }
+
+    static void basic_block_destruct(ScriptBasicBlock* self)
+    {
+        self->~ScriptBasicBlock();
+    }
+
+    static ScriptBasicBlock& basic_block_assign(const ScriptBasicBlock& other, ScriptBasicBlock* self)
+    {
+        *self = other;
+        return *self;
+    }
+
+    static void flow_edge_default_construct(void* memory)
+    {
+        new (memory) ScriptFlowEdge();
+    }
+
+    static void flow_edge_copy_construct(const ScriptFlowEdge& other, void* memory)
+    {
+        new (memory) ScriptFlowEdge(other);
+    }
+
+    static void flow_edge_destruct(ScriptFlowEdge* self)
+    {
+        self->~ScriptFlowEdge();
+    }
+
+    static ScriptFlowEdge& flow_edge_assign(const ScriptFlowEdge& other, ScriptFlowEdge* self)
+    {
+        *self = other;
+        return *self;
+    }
+
+    ScriptAnalysis::ScriptAnalysis(Runtime::ILoader& loader, Event::EventBus& eventBus, Thread::IThreadDispatcher& dispatcher)
+        : m_loader{loader}, m_eventBus{eventBus}, m_dispatcher{dispatcher}
+    {
+        // A reattached non-PIE image lands at the same base with the same path, so nothing cached may outlive the process.
+        m_openSubscriptionId = m_eventBus.get().subscribe<Event::ProcessOpenEvent>(
+            SUBSCRIBER_NAME, Event::PROCESS_OPEN_EVENT,
+            [this](const Event::ProcessOpenEvent&)
+            {
+                forget_process();
+            });
+
+        m_closeSubscriptionId = m_eventBus.get().subscribe<Event::ProcessCloseEvent>(
+            SUBSCRIBER_NAME, Event::PROCESS_CLOSED_EVENT,
+            [this](const Event::ProcessCloseEvent&)
+            {
+                forget_process();
+            });
+
+        // Patches made from the debugger and remapped images go around the script memory API.
+        m_memoryChangedSubscriptionId = m_eventBus.get().subscribe<Event::DebuggerMemoryChangedEvent>(
+            SUBSCRIBER_NAME, Event::DEBUGGER_MEMORY_CHANGED_EVENT,
+            [this](const Event::DebuggerMemoryChangedEvent& event)
+            {
+                invalidate(event.get_address(), event.get_size());
+            });
+
+        m_regionsChangedSubscriptionId = m_eventBus.get().subscribe<Event::RegionChangeEvent>(
+            SUBSCRIBER_NAME, Event::MEMORY_REGIONS_CHANGED_EVENT,
+            [this](const Event::RegionChangeEvent& event)
+            {
+                if (event.is_reset())
+                {
+                    forget_process();
+                    return;
+                }
+                for (const auto& change : event.get_changes())
+                {
+                    invalidate(change.baseAddress, change.regionSize);
+                }
+            });
+    }
+
+    ScriptAnalysis::~ScriptAnalysis()
+    {
+        std::ignore = m_eventBus.get().unsubscribe(m_openSubscriptionId);
+        std::ignore = m_eventBus.get().unsubscribe(m_closeSubscriptionId);
+        std::ignore = m_eventBus.get().unsubscribe(m_memoryChangedSubscriptionId);
+        std::ignore = m_eventBus.get().unsubscribe(m_regionsChangedSubscriptionId);
+    }
+
+    void ScriptAnalysis::forget_process()
+    {
+        {
+            std::scoped_lock lock{m_modulesMutex};
+            m_modules.clear();
+        }
+
+        std::scoped_lock lock{m_graphMutex};
+        m_graph.reset();
+    }
+
+    void ScriptAnalysis::invalidate(const std::uint64_t address, const std::uint64_t size)
+    {
+        std::scoped_lock lock{m_modulesMutex};
+        std::erase_if(m_modules, [address, size](const auto& entry)
+        {
+            const auto& [base, analysis] = entry;
+            return address < base + analysis.size && base < address + size;
+        });
+    }
+
+    StatusCode ScriptAnalysis::register_api(asIScriptEngine& engine)
+    {
+        if (const auto status = register_flow_enums(engine);
+            status != StatusCode::STATUS_OK)
+        {
+            return status;
+        }
+
+        if (const auto status = register_basic_block_type(engine);
+            status != StatusCode::STATUS_OK)
+        {
+            return status;
+        }
+
+        if (const auto status = register_flow_edge_type(engine);
+            status != StatusCode::STATUS_OK)
+        {
+            return status;
+        }
+
+        if (engine.RegisterGlobalFunction(
+                "int analyze_function(uint64)",
+                asMETHOD(ScriptAnalysis, analyze_function),
+                asCALL_THISCALL_ASGLOBAL, this) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterGlobalFunction(
+                "uint64 get_function_start()",
+                asMETHOD(ScriptAnalysis, get_function_start),
+                asCALL_THISCALL_ASGLOBAL, this) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterGlobalFunction(
+                "uint64 get_function_end()",
+                asMETHOD(ScriptAnalysis, get_function_end),
+                asCALL_THISCALL_ASGLOBAL, this) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterGlobalFunction(
+                "uint get_block_count()",
+                asMETHOD(ScriptAnalysis, get_block_count),
+                asCALL_THISCALL_ASGLOBAL, this) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterGlobalFunction(
+                "BasicBlock get_block_at(uint)",
+                asMETHOD(ScriptAnalysis, get_block_at),
+                asCALL_THISCALL_ASGLOBAL, this) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterGlobalFunction(
+                "int get_block_index(uint64)",
+                asMETHOD(ScriptAnalysis, get_block_index),
+                asCALL_THISCALL_ASGLOBAL, this) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterGlobalFunction(
+                "uint get_edge_count()",
+                asMETHOD(ScriptAnalysis, get_edge_count),
+                asCALL_THISCALL_ASGLOBAL, this) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterGlobalFunction(
+                "FlowEdge get_edge_at(uint)",
+                asMETHOD(ScriptAnalysis, get_edge_at),
+                asCALL_THISCALL_ASGLOBAL, this) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterGlobalFunction(
+                "bool block_dominates(uint, uint)",
+                asMETHOD(ScriptAnalysis, block_dominates),
+                asCALL_THISCALL_ASGLOBAL, this) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        return StatusCode::STATUS_OK;
+    }
+
+    StatusCode ScriptAnalysis::register_flow_enums(asIScriptEngine& engine)
+    {
+        if (engine.RegisterEnum("BlockExit") < 0 || engine.RegisterEnum("FlowEdgeKind") < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        const auto exit = [&engine](const char* name, const Debugger::BlockExit value)
+        {
+            return engine.RegisterEnumValue("BlockExit", name, static_cast<int>(value)) >= 0;
+        };
+        const auto kind = [&engine](const char* name, const Debugger::FlowEdgeKind value)
+        {
+            return engine.RegisterEnumValue("FlowEdgeKind", name, static_cast<int>(value)) >= 0;
+        };
+
+        if (!exit("BLOCK_EXIT_FALL_THROUGH", Debugger::BlockExit::FallThrough) ||
+            !exit("BLOCK_EXIT_JUMP", Debugger::BlockExit::Jump) ||
+            !exit("BLOCK_EXIT_CONDITIONAL", Debugger::BlockExit::Conditional) ||
+            !exit("BLOCK_EXIT_RETURN", Debugger::BlockExit::Return) ||
+            !exit("BLOCK_EXIT_INDIRECT_JUMP", Debugger::BlockExit::IndirectJump) ||
+            !exit("BLOCK_EXIT_TAIL_CALL", Debugger::BlockExit::TailCall) ||
+            !exit("BLOCK_EXIT_HALT", Debugger::BlockExit::Halt) ||
+            !kind("FLOW_EDGE_FALL_THROUGH", Debugger::FlowEdgeKind::FallThrough) ||
+            !kind("FLOW_EDGE_JUMP", Debugger::FlowEdgeKind::Jump) ||
+            !kind("FLOW_EDGE_TAKEN", Debugger::FlowEdgeKind::Taken) ||
+            !kind("FLOW_EDGE_NOT_TAKEN", Debugger::FlowEdgeKind::NotTaken))
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        return StatusCode::STATUS_OK;
+    }
+
+    StatusCode ScriptAnalysis::register_basic_block_type(asIScriptEngine& engine)
+    {
+        if (engine.RegisterObjectType(
+                "BasicBlock", sizeof(ScriptBasicBlock),
+                asOBJ_VALUE | asGetTypeTraits<ScriptBasicBlock>()) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterObjectBehaviour(
+                "BasicBlock", asBEHAVE_CONSTRUCT, "void f()",
+                asFUNCTION(basic_block_default_construct), asCALL_CDECL_OBJLAST) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterObjectBehaviour(
+                "BasicBlock", asBEHAVE_CONSTRUCT, "void f(const BasicBlock &in)",
+                asFUNCTION(basic_block_copy_construct), asCALL_CDECL_OBJLAST) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterObjectBehaviour(
+                "BasicBlock", asBEHAVE_DESTRUCT, "void f()",
+                asFUNCTION(basic_block_destruct), asCALL_CDECL_OBJLAST) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterObjectMethod(
+                "BasicBlock", "BasicBlock &opAssign(const BasicBlock &in)",
+                asFUNCTION(basic_block_assign), asCALL_CDECL_OBJLAST) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterObjectProperty("BasicBlock", "uint64 start", asOFFSET(ScriptBasicBlock, start)) < 0 ||
+            engine.RegisterObjectProperty("BasicBlock", "uint64 end", asOFFSET(ScriptBasicBlock, end)) < 0 ||
+            engine.RegisterObjectProperty("BasicBlock", "uint instructionCount", asOFFSET(ScriptBasicBlock, instructionCount)) < 0 ||
+            engine.RegisterObjectProperty("BasicBlock", "int immediateDominator", asOFFSET(ScriptBasicBlock, immediateDominator)) < 0 ||
+            engine.RegisterObjectProperty("BasicBlock", "BlockExit exit", asOFFSET(ScriptBasicBlock, exit)) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        return StatusCode::STATUS_OK;
+    }
+
+    StatusCode ScriptAnalysis::register_flow_edge_type(asIScriptEngine& engine)
+    {
+        if (engine.RegisterObjectType(
+                "FlowEdge", sizeof(ScriptFlowEdge),
+                asOBJ_VALUE | asGetTypeTraits<ScriptFlowEdge>()) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterObjectBehaviour(
+                "FlowEdge", asBEHAVE_CONSTRUCT, "void f()",
+                asFUNCTION(flow_edge_default_construct), asCALL_CDECL_OBJLAST) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterObjectBehaviour(
+                "FlowEdge", asBEHAVE_CONSTRUCT, "void f(const FlowEdge &in)",
+                asFUNCTION(flow_edge_copy_construct), asCALL_CDECL_OBJLAST) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterObjectBehaviour(
+                "FlowEdge", asBEHAVE_DESTRUCT, "void f()",
+                asFUNCTION(flow_edge_destruct), asCALL_CDECL_OBJLAST) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterObjectMethod(
+                "FlowEdge", "FlowEdge &opAssign(const FlowEdge &in)",
+                asFUNCTION(flow_edge_assign), asCALL_CDECL_OBJLAST) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        if (engine.RegisterObjectProperty("FlowEdge", "uint from", asOFFSET(ScriptFlowEdge, from)) < 0 ||
+            engine.RegisterObjectProperty("FlowEdge", "uint to", asOFFSET(ScriptFlowEdge, to)) < 0 ||
+            engine.RegisterObjectProperty("FlowEdge", "FlowEdgeKind kind", asOFFSET(ScriptFlowEdge, kind)) < 0 ||
+            engine.RegisterObjectProperty("FlowEdge", "bool backEdge", asOFFSET(ScriptFlowEdge, backEdge)) < 0)
+        {
+            return StatusCode::STATUS_ERROR_SCRIPT_ENGINE_INIT_FAILED;
+        }
+
+        return StatusCode::STATUS_OK;
+    }
+
+    StatusCode ScriptAnalysis::analyze_function(const std::uint64_t address)
+    {
+        if (m_loader.get().has_plugin_loaded() != StatusCode::STATUS_OK)
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_NOT_ACTIVE;
+        }
+
+        const auto pluginRef = m_loader.get().get_active_plugin();
+        if (!pluginRef || !pluginRef->get().is_loaded())
+        {
+            return StatusCode::STATUS_ERROR_PLUGIN_NOT_LOADED;
+        }
+
+        std::shared_ptr<const Debugger::ControlFlowGraph> graph{};
+
+        std::packaged_task<StatusCode()> task(
+            [this, address, &graph]() -> StatusCode
+            {
+                const auto ref = m_loader.get().get_active_plugin();
+                if (!ref)
+                {
+                    return StatusCode::STATUS_ERROR_PLUGIN_NOT_ACTIVE;
+                }
+                auto& plugin = ref->get();
+
+                std::uint32_t count{};
+                const auto countResult = Runtime::safe_call(plugin.internal_vertex_process_get_modules_list, nullptr, &count);
+                if (!Runtime::status_ok(countResult))
+                {
+                    return Runtime::get_status(countResult);
+                }
+
+                std::vector<ModuleInformation> modules(count);
+                auto* modulesPtr = modules.data();
+                const auto listResult = Runtime::safe_call(plugin.internal_vertex_process_get_modules_list, &modulesPtr, &count);
+                if (!Runtime::status_ok(listResult))
+                {
+                    return Runtime::get_status(listResult);
+                }
+                modules.resize(std::min<std::size_t>(count, modules.size()));
+
+                const auto moduleIt = std::ranges::find_if(modules, [address](const ModuleInformation& mod)
+                {
+                    return address >= mod.baseAddress && address < mod.baseAddress + mod.size;
+                });
+                if (moduleIt == modules.end())
+                {
+                    return StatusCode::STATUS_ERROR_GENERAL_NOT_FOUND;
+                }
+
+                // Function tables and graphs are kept per module until the process changes or a script writes
+                // into the module, so walking many functions of one module reads its unwind tables once.
+                ModuleAnalysis analysis{};
+                {
+                    std::scoped_lock lock{m_modulesMutex};
+                    if (const auto it = m_modules.find(moduleIt->baseAddress);
+                        it != m_modules.end() && it->second.size == moduleIt->size && it->second.path == moduleIt->modulePath)
+                    {
+                        analysis = it->second;
+                    }
+                }
+
+                if (!analysis.functions)
+                {
+                    analysis.path = moduleIt->modulePath;
+                    analysis.size = moduleIt->size;
+                    analysis.graphs = std::make_shared<Debugger::ModuleControlFlowCache>();
+                    analysis.functions = Debugger::ModuleFunctionTable::build(moduleIt->baseAddress, moduleIt->size,
+                        [&plugin](const std::uint64_t start, const std::uint64_t size, std::uint8_t* buffer)
+                        {
+                            return Runtime::get_status(Runtime::safe_call(
+                                plugin.internal_vertex_memory_read_process, start, size, reinterpret_cast<char*>(buffer)));
+                        },
+                        {});
+
+                    std::scoped_lock lock{m_modulesMutex};
+                    m_modules.insert_or_assign(moduleIt->baseAddress, analysis);
+                }
+
+                const auto function = analysis.functions->find(address);
+                if (!function.has_value())
+                {
+                    return StatusCode::STATUS_ERROR_GENERAL_NOT_FOUND;
+                }
+
+                graph = analysis.graphs->acquire(*function, Debugger::plugin_disassembler(plugin));
+
+                return graph->blocks().empty() ? StatusCode::STATUS_ERROR_GENERAL : StatusCode::STATUS_OK;
+            });
+
+        auto dispatchResult = m_dispatcher.get().dispatch(Thread::ThreadChannel::Scanner, std::move(task));
+        if (!dispatchResult.has_value())
+        {
+            return dispatchResult.error();
+        }
+
+        const auto status = dispatchResult.value().get();
+        if (status == StatusCode::STATUS_OK)
+        {
+            std::scoped_lock lock{m_graphMutex};
+            m_graph = std::move(graph);
+        }
+
+        return status;
+    }
+
+    std::uint64_t ScriptAnalysis::get_function_start() const
+    {
+        std::scoped_lock lock{m_graphMutex};
+        return m_graph ? m_graph->function().start : 0;
+    }
+
+    std::uint64_t ScriptAnalysis::get_function_end() const
+    {
+        std::scoped_lock lock{m_graphMutex};
+        return m_graph ? m_graph->function().end : 0;
+    }
+
+    std::uint32_t ScriptAnalysis::get_block_count() const
+    {
+        std::scoped_lock lock{m_graphMutex};
+        return m_graph ? static_cast<std::uint32_t>(m_graph->blocks().size()) : 0;
+    }
+
+    ScriptBasicBlock ScriptAnalysis::get_block_at(const std::uint32_t index) const
+    {
+        std::scoped_lock lock{m_graphMutex};
+        if (!m_graph || index >= m_graph->blocks().size())
+        {
+            return {};
+        }
+
+        const auto& block = m_graph->blocks()[index];
+        return ScriptBasicBlock{
+            .start = block.start,
+            .end = block.end,
+            .instructionCount = block.instructionCount,
+            .immediateDominator = block.immediateDominator == Debugger::ControlFlowGraph::NO_BLOCK
+                ? -1
+                : static_cast<std::int32_t>(block.immediateDominator),
+            .exit = static_cast<std::int32_t>(block.exit)
+        };
+    }
+
+    std::int32_t ScriptAnalysis::get_block_index(const std::uint64_t address) const
+    {
+        std::scoped_lock lock{m_graphMutex};
+        if (!m_graph)
+        {
+            return -1;
+        }
+
+        const auto block = m_graph->block_at(address);
+        return block.has_value() ? static_cast<std::int32_t>(*block) : -1;
+    }
+
+    std::uint32_t ScriptAnalysis::get_edge_count() const
+    {
+        std::scoped_lock lock{m_graphMutex};
+        return m_graph ? static_cast<std::uint32_t>(m_graph->edges().size()) : 0;
+    }
+
+    ScriptFlowEdge ScriptAnalysis::get_edge_at(const std::uint32_t index) const
+    {
+        std::scoped_lock lock{m_graphMutex};
+        if (!m_graph || index >= m_graph->edges().size())
+        {
+            return {};
+        }
+
+        const auto& edge = m_graph->edges()[index];
+        return ScriptFlowEdge{
+            .from = edge.from,
+            .to = edge.to,
+            .kind = static_cast<std::int32_t>(edge.kind),
+            .backEdge = edge.backEdge
+        };
+    }
+
+    bool ScriptAnalysis::block_dominates(const std::uint32_t dominator, const std::uint32_t block) const
+    {
+        std::scoped_lock lock{m_graphMutex};
+        return m_graph && m_graph->dominates(dominator, block);
+    }
+}
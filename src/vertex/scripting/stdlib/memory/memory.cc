@@ -176,6 +176,11 @@ namespace Vertex::Scripting::Stdlib
     {
     }
 
+    void ScriptMemory::set_write_observer(WriteObserver observer)
+    {
+        m_writeObserver = std::move(observer);
+    }
+
     StatusCode ScriptMemory::register_api(asIScriptEngine& engine)
     {
         if (const auto status = register_bulk_types(engine);
@@ -376,7 +381,12 @@ namespace Vertex::Scripting::Stdlib
             return dispatchResult.error();
         }
 
-        return dispatchResult.value().get();
+        const auto status = dispatchResult.value().get();
+        if (status == StatusCode::STATUS_OK && m_writeObserver)
+        {
+            m_writeObserver(address, data.size());
+        }
+        return status;
     }
 
     StatusCode ScriptMemory::bulk_read(CScriptArray* entries, CScriptArray*& outResults) const
@@ -671,6 +681,10 @@ namespace Vertex::Scripting::Stdlib
                 continue;
             }
             resultEntry->status = static_cast<std::int32_t>(results[index].status);
+            if (results[index].status == StatusCode::STATUS_OK && m_writeObserver)
+            {
+                m_writeObserver(requests[index].address, requests[index].size);
+            }
         }
 
         return StatusCode::STATUS_OK;
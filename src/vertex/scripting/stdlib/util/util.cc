@@ -25,6 +25,7 @@ namespace Vertex::Scripting::Stdlib
 
             if (!reg("STATUS_OK", StatusCode::STATUS_OK) ||
                 !reg("STATUS_ERROR_GENERAL", StatusCode::STATUS_ERROR_GENERAL) ||
+                !reg("STATUS_ERROR_GENERAL_NOT_FOUND", StatusCode::STATUS_ERROR_GENERAL_NOT_FOUND) ||
                 !reg("STATUS_ERROR_INVALID_PARAMETER", StatusCode::STATUS_ERROR_INVALID_PARAMETER) ||
                 !reg("STATUS_ERROR_NOT_IMPLEMENTED", StatusCode::STATUS_ERROR_NOT_IMPLEMENTED) ||
                 !reg("STATUS_ERROR_FUNCTION_NOT_FOUND", StatusCode::STATUS_ERROR_FUNCTION_NOT_FOUND) ||
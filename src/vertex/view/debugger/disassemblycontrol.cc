@@ -747,6 +747,16 @@ namespace Vertex::View::Debugger
         m_xrefQueryCallback = std::move(callback);
     }
 
+    void DisassemblyControl::set_function_start_callback(FunctionStartCallback callback)
+    {
+        m_functionStartCallback = std::move(callback);
+    }
+
+    void DisassemblyControl::set_copy_signature_callback(CopySignatureCallback callback)
+    {
+        m_copySignatureCallback = std::move(callback);
+    }
+
     void DisassemblyControl::set_extension_result(const bool isTop, const ::Vertex::Debugger::ExtensionResult result)
     {
         auto& edgeState = isTop ? m_topEdgeState : m_bottomEdgeState;
@@ -1016,11 +1026,13 @@ namespace Vertex::View::Debugger
 
             menu.Append(MENU_ID_XREFS_TO, wxString::FromUTF8(m_languageService.fetch_translation("debugger.contextMenu.xrefsTo")));
             menu.Append(MENU_ID_XREFS_FROM, wxString::FromUTF8(m_languageService.fetch_translation("debugger.contextMenu.xrefsFrom")));
+            menu.Append(MENU_ID_GO_TO_FUNCTION_START, wxString::FromUTF8(m_languageService.fetch_translation("debugger.contextMenu.goToFunctionStart")));
             menu.Append(MENU_ID_SHOW_IN_MEMORY, wxString::FromUTF8("Show in Memory View"));
             menu.AppendSeparator();
 
             menu.Append(MENU_ID_COPY_ADDRESS, wxString::FromUTF8(m_languageService.fetch_translation("debugger.contextMenu.copyAddress")));
             menu.Append(MENU_ID_COPY_LINE, wxString::FromUTF8(m_languageService.fetch_translation("debugger.contextMenu.copyLine")));
+            menu.Append(MENU_ID_COPY_SIGNATURE, wxString::FromUTF8(m_languageService.fetch_translation("debugger.contextMenu.copySignature")));
 
             const int selection = GetPopupMenuSelectionFromUser(menu, event.GetPosition());
             switch (selection)
@@ -1098,6 +1110,18 @@ namespace Vertex::View::Debugger
                     }
                     break;
                 }
+                case MENU_ID_GO_TO_FUNCTION_START:
+                    if (m_functionStartCallback)
+                    {
+                        m_functionStartCallback(line.address);
+                    }
+                    break;
+                case MENU_ID_COPY_SIGNATURE:
+                    if (m_copySignatureCallback)
+                    {
+                        m_copySignatureCallback(line.address);
+                    }
+                    break;
                 case MENU_ID_SHOW_IN_MEMORY:
                 {
                     if (m_showInMemoryCallback)
@@ -2169,6 +2193,11 @@ namespace Vertex::View::Debugger
         const auto typeJumpStr = wxString::FromUTF8(m_languageService.fetch_translation("debugger.xrefs.typeJump"));
         const auto typeCondJumpStr = wxString::FromUTF8(m_languageService.fetch_translation("debugger.xrefs.typeCondJump"));
         const auto typeLoopStr = wxString::FromUTF8(m_languageService.fetch_translation("debugger.xrefs.typeLoop"));
+        const auto typeDataStr = wxString::FromUTF8(m_languageService.fetch_translation("debugger.xrefs.typeData"));
+        const auto typeDataReadStr = wxString::FromUTF8(m_languageService.fetch_translation("debugger.xrefs.typeDataRead"));
+        const auto typeDataWriteStr = wxString::FromUTF8(m_languageService.fetch_translation("debugger.xrefs.typeDataWrite"));
+        const auto typeDataReadWriteStr = wxString::FromUTF8(m_languageService.fetch_translation("debugger.xrefs.typeDataReadWrite"));
+        const auto typeDataAddressStr = wxString::FromUTF8(m_languageService.fetch_translation("debugger.xrefs.typeDataAddress"));
 
         for (std::size_t i{}; i < xrefs.size(); ++i)
         {
@@ -2189,6 +2218,39 @@ namespace Vertex::View::Debugger
                 case ::Vertex::Debugger::XrefType::Loop:
                     typeStr = typeLoopStr;
                     break;
+                case ::Vertex::Debugger::XrefType::Data:
+                {
+                    const auto access = std::to_underlying(xref.access);
+                    const bool reads = (access & std::to_underlying(::Vertex::Debugger::XrefAccess::Read)) != 0;
+                    const bool writes = (access & std::to_underlying(::Vertex::Debugger::XrefAccess::Write)) != 0;
+
+                    if (reads && writes)
+                    {
+                        typeStr = typeDataReadWriteStr;
+                    }
+                    else if (writes)
+                    {
+                        typeStr = typeDataWriteStr;
+                    }
+                    else if (reads)
+                    {
+                        typeStr = typeDataReadStr;
+                    }
+                    else if ((access & std::to_underlying(::Vertex::Debugger::XrefAccess::AddressOf)) != 0)
+                    {
+                        typeStr = typeDataAddressStr;
+                    }
+                    else
+                    {
+                        typeStr = typeDataStr;
+                    }
+
+                    if (xref.operandSize != 0)
+                    {
+                        typeStr += wxString::Format(" (%u)", static_cast<unsigned>(xref.operandSize));
+                    }
+                    break;
+                }
             }
 
             const auto idx = listCtrl->InsertItem(static_cast<long>(i), typeStr);
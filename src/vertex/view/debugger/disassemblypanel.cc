@@ -149,6 +149,16 @@ namespace Vertex::View::Debugger
         m_disassemblyControl->set_xref_query_callback(std::move(callback));
     }
 
+    void DisassemblyPanel::set_function_start_callback(FunctionStartCallback callback)
+    {
+        m_disassemblyControl->set_function_start_callback(std::move(callback));
+    }
+
+    void DisassemblyPanel::set_copy_signature_callback(CopySignatureCallback callback)
+    {
+        m_disassemblyControl->set_copy_signature_callback(std::move(callback));
+    }
+
     std::uint64_t DisassemblyPanel::get_selected_address() const
     {
         return m_disassemblyControl->get_selected_address();
@@ -21,6 +21,7 @@
 
 #include <logo.hh>
 
+#include <wx/clipbrd.h>
 #include <wx/mstream.h>
 #include <wx/msgdlg.h>
 #include <wx/textdlg.h>
@@ -579,6 +580,45 @@ namespace Vertex::View
                 }
             });
 
+        m_disassemblyPanel->set_function_start_callback([this](const std::uint64_t address)
+        {
+            m_viewModel->navigate_to_function_start(address);
+        });
+
+        m_disassemblyPanel->set_copy_signature_callback([this](const std::uint64_t address)
+        {
+            m_viewModel->generate_signature(address, [this, address](const std::expected<::Vertex::Debugger::CodeSignature, StatusCode>& signature)
+            {
+                if (!signature.has_value())
+                {
+                    wxMessageBox(
+                        wxString::FromUTF8(fmt::format(fmt::runtime(m_languageService.fetch_translation("debugger.errors.signatureFailed")),
+                            address, static_cast<int>(signature.error()))),
+                        wxString::FromUTF8(m_languageService.fetch_translation("debugger.ui.error")),
+                        wxOK | wxICON_ERROR,
+                        this);
+                    return;
+                }
+
+                const auto pattern = signature->to_pattern();
+                if (wxTheClipboard->Open())
+                {
+                    wxTheClipboard->SetData(new wxTextDataObject(wxString::FromUTF8(pattern)));
+                    wxTheClipboard->Close();
+                }
+
+                ::Vertex::Debugger::LogEntry logEntry{};
+                logEntry.level = signature->unique() ? ::Vertex::Debugger::LogLevel::Info : ::Vertex::Debugger::LogLevel::Warning;
+                logEntry.source = "debugger.signature";
+                logEntry.timestamp = static_cast<std::uint64_t>(
+                    std::chrono::system_clock::now().time_since_epoch().count());
+                logEntry.message = signature->unique()
+                    ? fmt::format("Signature for 0x{:016X}: {}", address, pattern)
+                    : fmt::format("Signature for 0x{:016X} is not unique ({} matches): {}", address, signature->matchCount, pattern);
+                m_consolePanel->append_log(logEntry);
+            });
+        });
+
         m_disassemblyPanel->set_show_in_memory_callback([this](const std::uint64_t address)
         {
             auto show_pane = [this](const int menuId, const char* paneName)
@@ -11,7 +11,9 @@
 #include <vertex/view/newprocessdialog.hh>
 #include <vertex/customwidgets/addaddressdialog.hh>
 
+#include <wx/filedlg.h>
 #include <wx/spinctrl.h>
+#include <wx/utils.h>
 
 namespace Vertex::View
 {
@@ -54,6 +56,11 @@ namespace Vertex::View
         m_fileMenu->Append(StandardMenuIds::MainViewIds::ID_OPEN_PROJECT, wxString::Format("&%s\tCTRL+O", wxString::FromUTF8(m_languageService.fetch_translation("mainWindow.ui.openProject"))),
                            wxString::FromUTF8(m_languageService.fetch_translation("mainWindow.ui.openProjectDescription")));
         m_fileMenu->AppendSeparator();
+        m_fileMenu->Append(StandardMenuIds::MainViewIds::ID_EXPORT_SCAN_SESSION, wxString::Format("%s...", wxString::FromUTF8(m_languageService.fetch_translation("mainWindow.ui.exportScanSession"))),
+                           wxString::FromUTF8(m_languageService.fetch_translation("mainWindow.ui.exportScanSessionDescription")));
+        m_fileMenu->Append(StandardMenuIds::MainViewIds::ID_IMPORT_SCAN_SESSION, wxString::Format("%s...", wxString::FromUTF8(m_languageService.fetch_translation("mainWindow.ui.importScanSession"))),
+                           wxString::FromUTF8(m_languageService.fetch_translation("mainWindow.ui.importScanSessionDescription")));
+        m_fileMenu->AppendSeparator();
         m_fileMenu->Append(StandardMenuIds::MainViewIds::ID_EXIT_APPLICATION, wxString::Format("&%s\tALT+F4", wxString::FromUTF8(m_languageService.fetch_translation("mainWindow.ui.exitApplication"))),
                            wxString::FromUTF8(m_languageService.fetch_translation("mainWindow.ui.exitApplicationDescription")));
         m_helpMenu->Append(StandardMenuIds::MainViewIds::ID_HELP_ABOUT, wxString::Format("&%s", wxString::FromUTF8(m_languageService.fetch_translation("mainWindow.ui.about"))),
@@ -358,6 +365,8 @@ namespace Vertex::View
           StandardMenuIds::MainViewIds::ID_INJECTOR);
 
         m_auiToolBar->Bind(wxEVT_MENU, &MainView::on_activity_clicked, this, StandardMenuIds::MainViewIds::ID_ANALYTICS);
+        Bind(wxEVT_MENU, &MainView::on_export_scan_session, this, StandardMenuIds::MainViewIds::ID_EXPORT_SCAN_SESSION);
+        Bind(wxEVT_MENU, &MainView::on_import_scan_session, this, StandardMenuIds::MainViewIds::ID_IMPORT_SCAN_SESSION);
 
         m_auiToolBar->Bind(
           wxEVT_MENU,
@@ -955,6 +964,53 @@ namespace Vertex::View
 
     void MainView::on_open_project([[maybe_unused]] wxCommandEvent& event) { m_viewModel->open_project(); }
 
+    void MainView::on_export_scan_session([[maybe_unused]] wxCommandEvent& event)
+    {
+        wxFileDialog dialog(this,
+            wxString::FromUTF8(m_languageService.fetch_translation("mainWindow.ui.exportScanSession")),
+            wxEmptyString, wxEmptyString,
+            wxString::FromUTF8(fmt::format("{} (*.vxs)|*.vxs", m_languageService.fetch_translation("mainWindow.ui.scanSessionFiles"))),
+            wxFD_SAVE | wxFD_OVERWRITE_PROMPT);
+        if (dialog.ShowModal() != wxID_OK)
+        {
+            return;
+        }
+
+        wxBusyCursor busy{};
+        if (m_viewModel->export_scan_session(std::filesystem::path{dialog.GetPath().utf8_string()}) != StatusCode::STATUS_OK)
+        {
+            wxMessageBox(wxString::FromUTF8(m_languageService.fetch_translation("mainWindow.ui.scanSessionExportFailed")),
+                         wxString::FromUTF8(m_languageService.fetch_translation("general.error")), wxICON_ERROR | wxOK);
+        }
+    }
+
+    void MainView::on_import_scan_session([[maybe_unused]] wxCommandEvent& event)
+    {
+        if (!m_viewModel->is_process_opened())
+        {
+            wxMessageBox(wxString::FromUTF8(m_languageService.fetch_translation("mainWindow.ui.noProcessOpenedMessage")),
+                         wxString::FromUTF8(m_languageService.fetch_translation("general.error")), wxICON_ERROR | wxOK);
+            return;
+        }
+
+        wxFileDialog dialog(this,
+            wxString::FromUTF8(m_languageService.fetch_translation("mainWindow.ui.importScanSession")),
+            wxEmptyString, wxEmptyString,
+            wxString::FromUTF8(fmt::format("{} (*.vxs)|*.vxs", m_languageService.fetch_translation("mainWindow.ui.scanSessionFiles"))),
+            wxFD_OPEN | wxFD_FILE_MUST_EXIST);
+        if (dialog.ShowModal() != wxID_OK)
+        {
+            return;
+        }
+
+        wxBusyCursor busy{};
+        if (m_viewModel->import_scan_session(std::filesystem::path{dialog.GetPath().utf8_string()}) != StatusCode::STATUS_OK)
+        {
+            wxMessageBox(wxString::FromUTF8(m_languageService.fetch_translation("mainWindow.ui.scanSessionImportFailed")),
+                         wxString::FromUTF8(m_languageService.fetch_translation("general.error")), wxICON_ERROR | wxOK);
+        }
+    }
+
     void MainView::on_exit([[maybe_unused]] wxCommandEvent& event) { m_viewModel->exit_application(); }
 
     void MainView::on_activity_clicked([[maybe_unused]] wxCommandEvent& event) { m_viewModel->open_activity_window(); }
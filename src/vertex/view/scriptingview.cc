@@ -478,7 +478,7 @@ namespace Vertex::View
             };
 
             constexpr std::array statusCodeCompletions{
-                "STATUS_OK", "STATUS_ERROR_GENERAL", "STATUS_ERROR_INVALID_PARAMETER",
+                "STATUS_OK", "STATUS_ERROR_GENERAL", "STATUS_ERROR_GENERAL_NOT_FOUND", "STATUS_ERROR_INVALID_PARAMETER",
                 "STATUS_ERROR_NOT_IMPLEMENTED", "STATUS_ERROR_FUNCTION_NOT_FOUND",
                 "STATUS_ERROR_PLUGIN_NOT_ACTIVE", "STATUS_ERROR_PLUGIN_NOT_LOADED",
                 "STATUS_ERROR_PLUGIN_FUNCTION_NOT_IMPLEMENTED", "STATUS_ERROR_PROCESS_ACCESS_DENIED",
@@ -709,7 +709,7 @@ namespace Vertex::ViewModel
         std::packaged_task<StatusCode()> task {
             [queue = std::move(queue), shared = std::move(shared)]() mutable -> StatusCode
             {
-                while (auto job = queue->pop_next())
+                for (auto jobs = queue->pop_batch(); !jobs.empty(); jobs = queue->pop_batch())
                 {
                     struct Completer final
                     {
@@ -721,7 +721,7 @@ namespace Vertex::ViewModel
                     {
                         continue;
                     }
-                    run_enrichment_job(*shared, *job);
+                    run_enrichment_batch(*shared, jobs);
                 }
                 return StatusCode::STATUS_OK;
             }
@@ -731,8 +731,42 @@ namespace Vertex::ViewModel
             Thread::ThreadChannel::Script, std::move(task));
     }
 
+    void AccessTrackerViewModel::run_enrichment_batch(AccessTrackerSharedState& state,
+                                                       const std::span<const EnrichmentJob> jobs)
+    {
+        const auto sessionEpoch = state.sessionEpoch.load();
+        std::vector<EnrichmentJob> live {};
+        std::vector<std::uint64_t> pcs {};
+        for (const auto& job : jobs)
+        {
+            if (job.sessionEpoch == sessionEpoch)
+            {
+                live.push_back(job);
+                pcs.push_back(job.pc);
+            }
+        }
+        if (live.empty())
+        {
+            return;
+        }
+
+        // Every pending pc is decoded in one engine round trip instead of one per hit.
+        auto disassembly = state.runtime.disassemble_many(pcs);
+        disassembly.resize(live.size());
+
+        for (std::size_t i {}; i < live.size(); ++i)
+        {
+            if (state.disabled.load(std::memory_order_acquire))
+            {
+                return;
+            }
+            run_enrichment_job(state, live[i], std::move(disassembly[i]));
+        }
+    }
+
     void AccessTrackerViewModel::run_enrichment_job(AccessTrackerSharedState& state,
-                                                     const EnrichmentJob& job)
+                                                     const EnrichmentJob& job,
+                                                     std::optional<Debugger::DisassemblyLine> disassembly)
     {
         if (state.disabled.load(std::memory_order_acquire))
         {
@@ -745,7 +779,6 @@ namespace Vertex::ViewModel
 
         auto registers = state.runtime.snapshot_registers(job.threadId);
         auto callStack = state.runtime.snapshot_call_stack(job.threadId);
-        auto disassembly = state.runtime.disassemble_one(job.pc);
 
         bool changed {};
         {
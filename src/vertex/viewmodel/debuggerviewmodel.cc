@@ -148,6 +148,12 @@ namespace Vertex::ViewModel
                                                            on_process_closed();
                                                        });
 
+        m_eventBus.subscribe<Event::RegionChangeEvent>(m_viewModelName, Event::MEMORY_REGIONS_CHANGED_EVENT,
+                                                       [this](const Event::RegionChangeEvent& evt)
+                                                       {
+                                                           on_regions_changed(evt);
+                                                       });
+
         m_eventBus.subscribe<Event::DebuggerNavigateEvent>(m_viewModelName, Event::DEBUGGER_NAVIGATE_EVENT,
                                                           [this](const Event::DebuggerNavigateEvent& evt)
                                                           {
@@ -193,6 +199,22 @@ namespace Vertex::ViewModel
           });
     }
 
+    // Loading or unloading a module always maps or unmaps an executable segment; heap growth and
+    // protection flips leave the module list alone.
+    void DebuggerViewModel::on_regions_changed(const Event::RegionChangeEvent& event) const
+    {
+        const bool modulesMayHaveChanged = event.is_reset() || std::ranges::any_of(event.get_changes(),
+            [](const ::RegionChange& change)
+            {
+                return change.kind != VERTEX_REGION_PROTECTION_CHANGED && (change.protection & VERTEX_REGION_EXECUTE) != 0;
+            });
+
+        if (modulesMayHaveChanged)
+        {
+            m_model->request_modules();
+        }
+    }
+
     void DebuggerViewModel::on_process_closed()
     {
         detach_debugger();
@@ -239,6 +261,21 @@ namespace Vertex::ViewModel
 
     void DebuggerViewModel::query_xrefs_from(const std::uint64_t address, Model::XrefResultCallback callback) const { m_model->query_xrefs_from(address, std::move(callback)); }
 
+    void DebuggerViewModel::navigate_to_function_start(const std::uint64_t address) const
+    {
+        m_model->query_function_at(address, [model = m_model.get()](const std::optional<Debugger::FunctionRange> function)
+        {
+            if (function.has_value())
+            {
+                model->navigate_to_address(function->start);
+            }
+        });
+    }
+
+    void DebuggerViewModel::query_control_flow(const std::uint64_t address, Model::ControlFlowCallback callback) const { m_model->query_control_flow(address, std::move(callback)); }
+
+    void DebuggerViewModel::generate_signature(const std::uint64_t address, Model::SignatureCallback callback) const { m_model->generate_signature(address, std::move(callback)); }
+
     void DebuggerViewModel::load_modules_and_disassemble() const { m_model->request_modules(); }
 
     void DebuggerViewModel::request_registers() const { m_model->request_registers(); }
@@ -278,7 +315,15 @@ namespace Vertex::ViewModel
 
     void DebuggerViewModel::request_memory(const std::uint64_t address, const std::size_t size) const { m_model->request_memory(address, size); }
 
-    StatusCode DebuggerViewModel::write_memory(const std::uint64_t address, const std::span<const std::uint8_t> data) const { return m_model->write_memory(address, data); }
+    StatusCode DebuggerViewModel::write_memory(const std::uint64_t address, const std::span<const std::uint8_t> data) const
+    {
+        const auto status = m_model->write_memory(address, data);
+        if (status == StatusCode::STATUS_OK)
+        {
+            m_eventBus.broadcast(Event::DebuggerMemoryChangedEvent{address, data.size()});
+        }
+        return status;
+    }
 
     void DebuggerViewModel::ensure_data_loaded() const
     {
@@ -100,6 +100,27 @@ namespace Vertex::ViewModel
         return job;
     }
 
+    std::vector<EnrichmentJob> EnrichmentQueue::pop_batch(const std::size_t maxJobs)
+    {
+        std::scoped_lock lock {m_mutex};
+
+        std::vector<EnrichmentJob> jobs {};
+        if (m_inFlight >= MAX_IN_FLIGHT || !m_head || maxJobs == 0)
+        {
+            return jobs;
+        }
+
+        while (m_head && jobs.size() < maxJobs)
+        {
+            Node* const node = m_head;
+            jobs.push_back(node->job);
+            unlink_locked(node);
+            m_nodesByPc.erase(jobs.back().pc);
+        }
+        ++m_inFlight;
+        return jobs;
+    }
+
     void EnrichmentQueue::complete_job() noexcept
     {
         {
@@ -16,6 +16,7 @@
 
 #include <vertex/event/eventid.hh>
 #include <vertex/event/types/processcloseevent.hh>
+#include <vertex/event/types/regionchangeevent.hh>
 #include <vertex/event/types/viewevent.hh>
 #include <vertex/event/types/viewupdateevent.hh>
 #include <vertex/model/mainmodel.hh>
@@ -144,7 +145,7 @@ namespace Vertex::ViewModel
                             {
                                 return STATUS_OK;
                             }
-                            self->m_cacheWindow = {};
+                            self->m_cacheWindow.reset();
                             self->m_visibleCache.clear();
                             self->notify_view_update(ViewUpdateFlags::SCANNED_VALUES);
                             return STATUS_OK;
@@ -224,6 +225,38 @@ namespace Vertex::ViewModel
 
     void MainViewModel::notify_property_changed() const { notify_view_update(ViewUpdateFlags::DATATYPES); }
 
+    void MainViewModel::publish_region_changes()
+    {
+        std::ignore = m_model->query_region_changes(m_regionGeneration.load(std::memory_order_acquire),
+          [self = this,
+           weak = std::weak_ptr<std::atomic<bool>>{m_alive},
+           &dispatcher = m_dispatcher](const StatusCode status, std::vector<RegionChange> changes, const std::uint64_t generation)
+          {
+              if (status != StatusCode::STATUS_OK)
+              {
+                  return;
+              }
+
+              std::packaged_task<StatusCode()> task{
+                  [self, weak, changes = std::move(changes), generation]() mutable -> StatusCode
+                  {
+                      const auto alive = weak.lock();
+                      if (!alive || !alive->load(std::memory_order_acquire))
+                      {
+                          return STATUS_OK;
+                      }
+
+                      self->m_regionGeneration.store(generation, std::memory_order_release);
+                      if (!changes.empty())
+                      {
+                          self->m_eventBus.broadcast(Event::RegionChangeEvent{std::move(changes), generation});
+                      }
+                      return STATUS_OK;
+                  }};
+              std::ignore = dispatcher.dispatch_fire_and_forget(Thread::ThreadChannel::UI, std::move(task));
+          });
+    }
+
     void MainViewModel::notify_view_update(const ViewUpdateFlags flags) const
     {
         if (m_eventCallback)
@@ -469,6 +502,7 @@ namespace Vertex::ViewModel
             }
         }
 
+        publish_region_changes();
         m_scannedValues.clear();
 
         m_scanProgress = {0, 0, "Scanning..."};
@@ -534,6 +568,8 @@ namespace Vertex::ViewModel
         const auto alignmentValue = static_cast<std::size_t>(m_alignmentValue);
         const auto endianness = static_cast<Scanner::Endianness>(m_endiannessTypeIndex);
 
+        publish_region_changes();
+
         std::packaged_task<StatusCode()> task(
           [this, typeId, scanMode, hexDisplay = m_isHexadecimal, alignmentEnabled = m_alignmentEnabled, alignmentValue, endianness, input = std::move(inputBuffer), input2 = std::move(inputBuffer2)]() mutable -> StatusCode
           {
@@ -565,6 +601,45 @@ namespace Vertex::ViewModel
         notify_property_changed();
     }
 
+    StatusCode MainViewModel::export_scan_session(const std::filesystem::path& path) const
+    {
+        return m_model->export_scan_session(path);
+    }
+
+    StatusCode MainViewModel::import_scan_session(const std::filesystem::path& path)
+    {
+        Scanner::TypeId importedTypeId{Scanner::TypeId::Invalid};
+        const auto status = m_model->import_scan_session(path, importedTypeId);
+        if (status != StatusCode::STATUS_OK)
+        {
+            return status;
+        }
+
+        // Follow the session's value type so the next scan continues it instead of being rejected as a type change.
+        std::optional<int> typeIndex{};
+        {
+            std::scoped_lock lock{m_typeEntriesMutex};
+            const auto it = std::ranges::find(m_typeEntries, importedTypeId, &Scanner::TypeSchema::id);
+            if (it != m_typeEntries.end())
+            {
+                typeIndex = static_cast<int>(std::distance(m_typeEntries.begin(), it));
+            }
+        }
+        if (typeIndex.has_value())
+        {
+            set_value_type_index(*typeIndex);
+            const bool isPlugin = current_type_is_plugin();
+            m_scannedValueTypeIndex = m_valueTypeIndex;
+            m_scannedEndiannessIndex = m_endiannessTypeIndex;
+            m_scannedTypeId = importedTypeId;
+            m_scannedTypeIsPlugin = isPlugin;
+            m_scannedPluginSchema = isPlugin ? m_model->find_scanner_type(importedTypeId) : std::nullopt;
+        }
+
+        notify_view_update(ViewUpdateFlags::SCAN_COMPLETED);
+        return status;
+    }
+
     void MainViewModel::update_scan_progress()
     {
         if (m_nextScanInitFuture.valid())
@@ -684,6 +759,7 @@ namespace Vertex::ViewModel
         m_scanInitializationFailed = false;
         m_minProcessAddress = {};
         m_maxProcessAddress = {};
+        m_regionGeneration.store(0, std::memory_order_release);
         update_available_scan_modes();
         m_scanTypeIndex = 0;
 
@@ -721,6 +797,31 @@ namespace Vertex::ViewModel
         return size > 0 ? static_cast<std::uint32_t>(size) : 0;
     }
 
+    std::string MainViewModel::format_scanned_bytes(const std::span<const std::uint8_t> bytes) const
+    {
+        if (bytes.empty())
+        {
+            return {};
+        }
+
+        if (m_scannedTypeIsPlugin)
+        {
+            return m_scannedPluginSchema ? Scanner::format_plugin_bytes(*m_scannedPluginSchema, bytes.data(), bytes.size()) : std::string{};
+        }
+
+        return Scanner::ValueConverter::format(get_scanned_value_type(), bytes.data(), bytes.size(), m_isHexadecimal, static_cast<Scanner::Endianness>(m_scannedEndiannessIndex));
+    }
+
+    ScannedValue MainViewModel::make_scanned_value(const Scanner::ScanResultRecordView& record) const
+    {
+        ScannedValue value{};
+        value.address = fmt::format("{:016X}", record.address);
+        value.value = format_scanned_bytes(record.currentValue);
+        value.previousValue = format_scanned_bytes(record.previousValue);
+        value.firstValue = format_scanned_bytes(record.firstValue.empty() ? record.previousValue : record.firstValue);
+        return value;
+    }
+
     ScannedValue MainViewModel::get_scanned_value_at(const int index)
     {
         const auto it = m_visibleCache.find(index);
@@ -731,127 +832,23 @@ namespace Vertex::ViewModel
 
         if (m_cacheWindow.startIndex >= 0 && index >= m_cacheWindow.startIndex && index < m_cacheWindow.endIndex)
         {
-            const int cacheIndex = index - m_cacheWindow.startIndex;
-            if (cacheIndex >= 0 && cacheIndex < static_cast<int>(m_cacheWindow.addresses.size())) [[likely]]
+            const auto cacheIndex = static_cast<std::size_t>(index - m_cacheWindow.startIndex);
+            if (cacheIndex < m_cacheWindow.page.size()) [[likely]]
             {
-                const auto& entry = m_cacheWindow.addresses[cacheIndex];
-
-                ScannedValue value{};
-                value.address = fmt::format("{:016X}", entry.address);
-
-                if (m_scannedTypeIsPlugin)
-                {
-                    if (m_scannedPluginSchema)
-                    {
-                        const auto& schema = *m_scannedPluginSchema;
-                        if (!entry.value.empty())
-                        {
-                            value.value = Scanner::format_plugin_bytes(schema, entry.value.data(), entry.value.size());
-                        }
-                        if (!entry.previousValue.empty())
-                        {
-                            value.previousValue = Scanner::format_plugin_bytes(schema, entry.previousValue.data(), entry.previousValue.size());
-                        }
-                        if (!entry.firstValue.empty())
-                        {
-                            value.firstValue = Scanner::format_plugin_bytes(schema, entry.firstValue.data(), entry.firstValue.size());
-                        }
-                        else if (!entry.previousValue.empty())
-                        {
-                            value.firstValue = Scanner::format_plugin_bytes(schema, entry.previousValue.data(), entry.previousValue.size());
-                        }
-                    }
-                    m_visibleCache[index] = value;
-                    return value;
-                }
-
-                const auto valueType = get_scanned_value_type();
-                const auto scannedEndianness = static_cast<Scanner::Endianness>(m_scannedEndiannessIndex);
-                if (!entry.value.empty())
-                {
-                    value.value = Scanner::ValueConverter::format(valueType, entry.value.data(), entry.value.size(), m_isHexadecimal, scannedEndianness);
-                }
-
-                if (!entry.previousValue.empty())
-                {
-                    value.previousValue = Scanner::ValueConverter::format(valueType, entry.previousValue.data(), entry.previousValue.size(), m_isHexadecimal, scannedEndianness);
-                }
-
-                if (!entry.firstValue.empty())
-                {
-                    value.firstValue = Scanner::ValueConverter::format(valueType, entry.firstValue.data(), entry.firstValue.size(), m_isHexadecimal, scannedEndianness);
-                }
-                else if (!entry.previousValue.empty())
-                {
-                    value.firstValue = Scanner::ValueConverter::format(valueType, entry.previousValue.data(), entry.previousValue.size(), m_isHexadecimal, scannedEndianness);
-                }
-
+                ScannedValue value = make_scanned_value(m_cacheWindow.page[cacheIndex]);
                 m_visibleCache[index] = value;
-
                 return value;
             }
         }
 
-        std::vector<Scanner::IMemoryScanner::ScanResultEntry> scanResults;
-        const StatusCode status = m_model->get_scan_results_range(scanResults, index, 1);
-
-        if (status != StatusCode::STATUS_OK || scanResults.empty()) [[unlikely]]
+        const StatusCode status = m_model->get_scan_results_page(m_lookupPage, static_cast<std::size_t>(index), 1);
+        if (status != StatusCode::STATUS_OK || m_lookupPage.empty()) [[unlikely]]
         {
             return ScannedValue{};
         }
 
-        ScannedValue value{};
-        value.address = fmt::format("{:016X}", scanResults[0].address);
-
-        if (m_scannedTypeIsPlugin)
-        {
-            if (m_scannedPluginSchema)
-            {
-                const auto& schema = *m_scannedPluginSchema;
-                if (!scanResults[0].value.empty())
-                {
-                    value.value = Scanner::format_plugin_bytes(schema, scanResults[0].value.data(), scanResults[0].value.size());
-                }
-                if (!scanResults[0].previousValue.empty())
-                {
-                    value.previousValue = Scanner::format_plugin_bytes(schema, scanResults[0].previousValue.data(), scanResults[0].previousValue.size());
-                }
-                if (!scanResults[0].firstValue.empty())
-                {
-                    value.firstValue = Scanner::format_plugin_bytes(schema, scanResults[0].firstValue.data(), scanResults[0].firstValue.size());
-                }
-                else if (!scanResults[0].previousValue.empty())
-                {
-                    value.firstValue = Scanner::format_plugin_bytes(schema, scanResults[0].previousValue.data(), scanResults[0].previousValue.size());
-                }
-            }
-            m_visibleCache[index] = value;
-            return value;
-        }
-
-        const auto valueType = get_scanned_value_type();
-        const auto scannedEndianness = static_cast<Scanner::Endianness>(m_scannedEndiannessIndex);
-        if (!scanResults[0].value.empty())
-        {
-            value.value = Scanner::ValueConverter::format(valueType, scanResults[0].value.data(), scanResults[0].value.size(), m_isHexadecimal, scannedEndianness);
-        }
-
-        if (!scanResults[0].previousValue.empty())
-        {
-            value.previousValue = Scanner::ValueConverter::format(valueType, scanResults[0].previousValue.data(), scanResults[0].previousValue.size(), m_isHexadecimal, scannedEndianness);
-        }
-
-        if (!scanResults[0].firstValue.empty())
-        {
-            value.firstValue = Scanner::ValueConverter::format(valueType, scanResults[0].firstValue.data(), scanResults[0].firstValue.size(), m_isHexadecimal, scannedEndianness);
-        }
-        else if (!scanResults[0].previousValue.empty())
-        {
-            value.firstValue = Scanner::ValueConverter::format(valueType, scanResults[0].previousValue.data(), scanResults[0].previousValue.size(), m_isHexadecimal, scannedEndianness);
-        }
-
+        ScannedValue value = make_scanned_value(m_lookupPage[0]);
         m_visibleCache[index] = value;
-
         return value;
     }
 
@@ -863,7 +860,7 @@ namespace Vertex::ViewModel
         const int newEndIndex = std::min(totalResults, visibleEnd + BUFFER_SIZE);
 
         const int expectedCount = newEndIndex - newStartIndex;
-        const bool cacheWindowFullyPopulated = static_cast<int>(m_cacheWindow.addresses.size()) == expectedCount;
+        const bool cacheWindowFullyPopulated = static_cast<int>(m_cacheWindow.page.size()) == expectedCount;
 
         if (newStartIndex == m_cacheWindow.startIndex && newEndIndex == m_cacheWindow.endIndex && cacheWindowFullyPopulated) [[unlikely]]
         {
@@ -872,27 +869,22 @@ namespace Vertex::ViewModel
 
         if (expectedCount <= 0) [[unlikely]]
         {
-            m_cacheWindow.startIndex = -1;
-            m_cacheWindow.endIndex = -1;
-            m_cacheWindow.addresses.clear();
+            m_cacheWindow.reset();
             return;
         }
 
-        std::vector<Scanner::IMemoryScanner::ScanResultEntry> newAddresses;
-        const StatusCode status = m_model->get_scan_results_range(newAddresses, newStartIndex, expectedCount);
+        // Fill the spare page and swap it in, so a failed fetch leaves the current window intact
+        // and both pages keep their buffers warm across scrolls.
+        const StatusCode status = m_model->get_scan_results_page(m_cacheWindow.sparePage, static_cast<std::size_t>(newStartIndex), static_cast<std::size_t>(expectedCount));
         if (status != StatusCode::STATUS_OK)
         {
             return;
         }
 
-        const int actualCount = std::min(expectedCount, static_cast<int>(newAddresses.size()));
-        newAddresses.resize(static_cast<std::size_t>(actualCount));
-
+        const int actualCount = std::min(expectedCount, static_cast<int>(m_cacheWindow.sparePage.size()));
         if (actualCount <= 0)
         {
-            m_cacheWindow.startIndex = -1;
-            m_cacheWindow.endIndex = -1;
-            m_cacheWindow.addresses.clear();
+            m_cacheWindow.reset();
             return;
         }
 
@@ -901,7 +893,7 @@ namespace Vertex::ViewModel
 
         m_cacheWindow.startIndex = newStartIndex;
         m_cacheWindow.endIndex = newStartIndex + actualCount;
-        m_cacheWindow.addresses = std::move(newAddresses);
+        std::swap(m_cacheWindow.page, m_cacheWindow.sparePage);
 
         if (prevStart >= 0 && prevEnd > prevStart)
         {
@@ -926,128 +918,77 @@ namespace Vertex::ViewModel
             return;
         }
 
-        const auto valueType = get_scanned_value_type();
-        const auto scannedEndianness = static_cast<Scanner::Endianness>(m_scannedEndiannessIndex);
-
-        struct VisibleRefreshEntry final
+        const Scanner::ScanResultPage& page = m_cacheWindow.page;
+        const auto firstCacheIndex = static_cast<std::size_t>(startIndex - m_cacheWindow.startIndex);
+        if (firstCacheIndex >= page.size())
         {
-            int visibleIndex{};
-            const Scanner::IMemoryScanner::ScanResultEntry* cacheEntry{};
-            std::vector<char> currentValue{};
-            bool readOk{};
-        };
+            return;
+        }
 
-        std::vector<VisibleRefreshEntry> pendingReads{};
-        pendingReads.reserve(static_cast<std::size_t>(count));
+        const std::size_t rowCount = std::min(static_cast<std::size_t>(count), page.size() - firstCacheIndex);
+        const std::size_t valueSize = page.valueSize;
 
-        for (const int i : std::views::iota(startIndex, endIndex + 1))
+        auto& scratch = m_visibleRefresh;
+        if (scratch.values.size() < rowCount * valueSize)
         {
-            const int cacheIndex = i - m_cacheWindow.startIndex;
-            if (cacheIndex < 0 || cacheIndex >= static_cast<int>(m_cacheWindow.addresses.size()))
-            {
-                continue;
-            }
-
-            const auto& entry = m_cacheWindow.addresses[cacheIndex];
-            auto& pending = pendingReads.emplace_back();
-            pending.visibleIndex = i;
-            pending.cacheEntry = &entry;
-            pending.currentValue.resize(entry.value.size());
+            scratch.values.resize(rowCount * valueSize);
+        }
+        if (scratch.readOk.size() < rowCount)
+        {
+            scratch.readOk.resize(rowCount);
+            scratch.bulkEntries.resize(rowCount);
+            scratch.bulkResults.resize(rowCount);
         }
+        std::fill_n(scratch.readOk.begin(), rowCount, std::uint8_t{});
 
         bool usedBulkRead = false;
-        if (!pendingReads.empty() && m_model->supports_bulk_read())
+        if (valueSize > 0 && m_model->supports_bulk_read())
         {
-            std::vector<Model::BulkReadEntry> bulkEntries(pendingReads.size());
-            std::vector<BulkReadResult> bulkResults(pendingReads.size());
-
-            for (std::size_t i{}; i < pendingReads.size(); ++i)
+            for (std::size_t i{}; i < rowCount; ++i)
             {
-                bulkEntries[i] = {pendingReads[i].cacheEntry->address, pendingReads[i].currentValue.size(), pendingReads[i].currentValue.data()};
+                scratch.bulkEntries[i] = {page.address_at(firstCacheIndex + i), valueSize, scratch.values.data() + (i * valueSize)};
             }
 
-            const StatusCode bulkStatus = m_model->read_process_memory_bulk(bulkEntries, bulkResults);
+            const StatusCode bulkStatus = m_model->read_process_memory_bulk(std::span{scratch.bulkEntries.data(), rowCount}, std::span{scratch.bulkResults.data(), rowCount});
             if (bulkStatus == StatusCode::STATUS_OK)
             {
                 usedBulkRead = true;
-                for (std::size_t i{}; i < pendingReads.size(); ++i)
+                for (std::size_t i{}; i < rowCount; ++i)
                 {
-                    pendingReads[i].readOk = bulkResults[i].status == StatusCode::STATUS_OK && !pendingReads[i].currentValue.empty();
+                    scratch.readOk[i] = scratch.bulkResults[i].status == StatusCode::STATUS_OK ? 1 : 0;
                 }
             }
         }
 
-        if (!usedBulkRead)
+        if (!usedBulkRead && valueSize > 0)
         {
-            for (auto& pending : pendingReads)
+            for (std::size_t i{}; i < rowCount; ++i)
             {
-                const StatusCode readStatus = m_model->read_process_memory(pending.cacheEntry->address, pending.currentValue.size(), pending.currentValue);
-                pending.readOk = readStatus == StatusCode::STATUS_OK && !pending.currentValue.empty();
+                const StatusCode readStatus = m_model->read_process_memory(page.address_at(firstCacheIndex + i), valueSize, scratch.singleValue);
+                if (readStatus == StatusCode::STATUS_OK && scratch.singleValue.size() >= valueSize)
+                {
+                    std::copy_n(scratch.singleValue.begin(), valueSize, scratch.values.begin() + static_cast<std::ptrdiff_t>(i * valueSize));
+                    scratch.readOk[i] = 1;
+                }
             }
         }
 
-        const bool isPlugin = m_scannedTypeIsPlugin && m_scannedPluginSchema.has_value();
-        const Scanner::TypeSchema* pluginSchema = isPlugin ? &*m_scannedPluginSchema : nullptr;
-
-        for (const auto& [visibleIndex, cacheEntry, currentValue, readOk] : pendingReads)
+        for (std::size_t i{}; i < rowCount; ++i)
         {
-            const auto& entry = *cacheEntry;
+            Scanner::ScanResultRecordView record = page[firstCacheIndex + i];
+            record.currentValue = {};
 
-            ScannedValue value{};
-            value.address = fmt::format("{:016X}", entry.address);
-
-            if (isPlugin)
+            ScannedValue value = make_scanned_value(record);
+            if (scratch.readOk[i] != 0)
             {
-                if (readOk)
-                {
-                    value.value = Scanner::format_plugin_bytes(*pluginSchema, currentValue.data(), currentValue.size());
-                }
-                else
-                {
-                    value.value = "???";
-                }
-
-                if (!entry.previousValue.empty())
-                {
-                    value.previousValue = Scanner::format_plugin_bytes(*pluginSchema, entry.previousValue.data(), entry.previousValue.size());
-                }
-
-                if (!entry.firstValue.empty())
-                {
-                    value.firstValue = Scanner::format_plugin_bytes(*pluginSchema, entry.firstValue.data(), entry.firstValue.size());
-                }
-                else if (!entry.previousValue.empty())
-                {
-                    value.firstValue = Scanner::format_plugin_bytes(*pluginSchema, entry.previousValue.data(), entry.previousValue.size());
-                }
+                value.value = format_scanned_bytes({reinterpret_cast<const std::uint8_t*>(scratch.values.data()) + (i * valueSize), valueSize});
             }
             else
             {
-                if (readOk)
-                {
-                    value.value = Scanner::ValueConverter::format(valueType, reinterpret_cast<const std::uint8_t*>(currentValue.data()), currentValue.size(), m_isHexadecimal, scannedEndianness);
-                }
-                else
-                {
-                    value.value = "???";
-                }
-
-                if (!entry.previousValue.empty())
-                {
-                    value.previousValue = Scanner::ValueConverter::format(valueType, entry.previousValue.data(), entry.previousValue.size(), m_isHexadecimal, scannedEndianness);
-                }
-
-                if (!entry.firstValue.empty())
-                {
-                    value.firstValue = Scanner::ValueConverter::format(valueType, entry.firstValue.data(), entry.firstValue.size(), m_isHexadecimal, scannedEndianness);
-                }
-                else if (!entry.previousValue.empty())
-                {
-                    value.firstValue = Scanner::ValueConverter::format(valueType, entry.previousValue.data(), entry.previousValue.size(), m_isHexadecimal, scannedEndianness);
-                }
+                value.value = "???";
             }
 
-            m_visibleCache[visibleIndex] = value;
+            m_visibleCache[startIndex + static_cast<int>(i)] = std::move(value);
         }
     }
 
@@ -1057,10 +998,7 @@ namespace Vertex::ViewModel
 
         m_visibleCache.clear();
         m_scannedValues.clear();
-
-        m_cacheWindow.startIndex = -1;
-        m_cacheWindow.endIndex = -1;
-        m_cacheWindow.addresses.clear();
+        m_cacheWindow.reset();
 
         notify_property_changed();
     }
@@ -1076,21 +1014,20 @@ namespace Vertex::ViewModel
 
         if (m_cacheWindow.startIndex >= 0 && index >= m_cacheWindow.startIndex && index < m_cacheWindow.endIndex)
         {
-            const int cacheIndex = index - m_cacheWindow.startIndex;
-            if (cacheIndex >= 0 && cacheIndex < static_cast<int>(m_cacheWindow.addresses.size()))
+            const auto cacheIndex = static_cast<std::size_t>(index - m_cacheWindow.startIndex);
+            if (cacheIndex < m_cacheWindow.page.size())
             {
-                return m_cacheWindow.addresses[cacheIndex].address;
+                return m_cacheWindow.page.address_at(cacheIndex);
             }
         }
 
-        std::vector<Scanner::IMemoryScanner::ScanResultEntry> scanResults{};
-        const StatusCode status = m_model->get_scan_results_range(scanResults, index, 1);
-        if (status != StatusCode::STATUS_OK || scanResults.empty())
+        const StatusCode status = m_model->get_scan_results_page(m_lookupPage, static_cast<std::size_t>(index), 1);
+        if (status != StatusCode::STATUS_OK || m_lookupPage.empty())
         {
             return std::nullopt;
         }
 
-        return scanResults[0].address;
+        return m_lookupPage.address_at(0);
     }
 
     std::string MainViewModel::get_value_input() const { return m_valueInput; }
@@ -2002,7 +1939,7 @@ namespace Vertex::ViewModel
         m_scanInitializationFailed = false;
         m_scannedValues.clear();
         m_visibleCache.clear();
-        m_cacheWindow = CacheWindow{};
+        m_cacheWindow.reset();
         update_available_scan_modes();
         m_model->set_ui_state_int("uiState.mainView.scanTypeIndex", 0);
         notify_view_update(ViewUpdateFlags::SCAN_MODES | ViewUpdateFlags::BUTTON_STATES | ViewUpdateFlags::SCANNED_VALUES);
@@ -6,60 +6,105 @@
 
 #include <capstone/capstone.h>
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstring>
+#include <initializer_list>
 #include <mutex>
-#include <unordered_set>
+#include <optional>
+#include <utility>
 #include <string_view>
 
 namespace PluginRuntime
 {
     namespace
     {
-        std::mutex g_capstone_mutex;
+        // Guards g_current_mode. Decoding never takes it: every thread owns a Capstone handle and only
+        // comes here to reopen it after g_config_epoch moved.
+        std::mutex g_config_mutex;
 
-        csh g_capstone_handle{0};
         auto g_current_mode{DisasmMode::X86_64};
-        bool g_initialized{false};
-        cs_err g_last_capstone_error{CS_ERR_OK};
+        std::atomic<std::uint64_t> g_config_epoch{1};
+        std::atomic<bool> g_initialized{false};
+        std::atomic<cs_err> g_last_capstone_error{CS_ERR_OK};
 
-        const std::unordered_set<std::string_view> x86_unconditional_jumps{
-            "jmp"
-        };
-
-        const std::unordered_set<std::string_view> x86_conditional_jumps{
-            "jo", "jno",
-            "js", "jns",
-            "je", "jz", "jne", "jnz",
-            "jl", "jnge", "jge", "jnl",
-            "jle", "jng", "jg", "jnle",
-            "jb", "jnae", "jc",
-            "jnb", "jae", "jnc",
-            "jbe", "jna",
-            "ja", "jnbe",
-            "jp", "jpe",
-            "jnp", "jpo",
-            "jcxz", "jecxz", "jrcxz"
-        };
-
-        const std::unordered_set<std::string_view> x86_loop_instructions{
-            "loop", "loope", "loopz", "loopne", "loopnz"
-        };
+        // Branch class per Capstone instruction ID, built once per architecture. IDs without an entry fall back
+        // to the instruction's CS_GRP_* groups. Direct/indirect and ARM64 b.cond are resolved from operands.
+        template <std::size_t N>
+        using BranchTable = std::array<std::uint8_t, N>;
 
-        const std::unordered_set<std::string_view> x86_call_instructions{
-            "call"
-        };
-
-        const std::unordered_set<std::string_view> x86_return_instructions{
-            "ret", "retn", "retf", "iret", "iretd", "iretq"
-        };
-
-        const std::unordered_set<std::string_view> x86_interrupt_instructions{
-            "int", "int1", "int3", "into", "syscall", "sysenter", "sysexit", "sysret"
-        };
+        template <std::size_t N>
+        constexpr void assign_branch(BranchTable<N>& table, const std::initializer_list<unsigned int> ids, const BranchType type)
+        {
+            for (const unsigned int id : ids)
+            {
+                table[id] = static_cast<std::uint8_t>(type);
+            }
+        }
 
-        bool is_in_set(const char* mnem, const std::unordered_set<std::string_view>& set)
+        constexpr auto x86_branch_table = []
+        {
+            BranchTable<X86_INS_ENDING> table{};
+
+            assign_branch(table, {X86_INS_JMP, X86_INS_LJMP}, VERTEX_BRANCH_UNCONDITIONAL);
+            assign_branch(table, {
+                X86_INS_JO, X86_INS_JNO, X86_INS_JS, X86_INS_JNS,
+                X86_INS_JE, X86_INS_JNE, X86_INS_JL, X86_INS_JGE,
+                X86_INS_JLE, X86_INS_JG, X86_INS_JB, X86_INS_JAE,
+                X86_INS_JBE, X86_INS_JA, X86_INS_JP, X86_INS_JNP,
+                X86_INS_JCXZ, X86_INS_JECXZ, X86_INS_JRCXZ
+            }, VERTEX_BRANCH_CONDITIONAL);
+            assign_branch(table, {X86_INS_LOOP, X86_INS_LOOPE, X86_INS_LOOPNE}, VERTEX_BRANCH_LOOP);
+            assign_branch(table, {X86_INS_CALL, X86_INS_LCALL}, VERTEX_BRANCH_CALL);
+            assign_branch(table, {
+                X86_INS_RET, X86_INS_RETF, X86_INS_RETFQ,
+                X86_INS_IRET, X86_INS_IRETD, X86_INS_IRETQ
+            }, VERTEX_BRANCH_RETURN);
+            assign_branch(table, {
+                X86_INS_INT, X86_INS_INT1, X86_INS_SYSCALL,
+                X86_INS_SYSENTER, X86_INS_SYSEXIT, X86_INS_SYSRET
+            }, VERTEX_BRANCH_INTERRUPT);
+            assign_branch(table, {X86_INS_INT3, X86_INS_INTO, X86_INS_UD2}, VERTEX_BRANCH_EXCEPTION);
+            assign_branch(table, {
+                X86_INS_CMOVO, X86_INS_CMOVNO, X86_INS_CMOVS, X86_INS_CMOVNS,
+                X86_INS_CMOVE, X86_INS_CMOVNE, X86_INS_CMOVL, X86_INS_CMOVGE,
+                X86_INS_CMOVLE, X86_INS_CMOVG, X86_INS_CMOVB, X86_INS_CMOVAE,
+                X86_INS_CMOVBE, X86_INS_CMOVA, X86_INS_CMOVP, X86_INS_CMOVNP
+            }, VERTEX_BRANCH_CONDITIONAL_MOVE);
+
+            return table;
+        }();
+
+        constexpr auto arm64_branch_table = []
         {
-            return mnem && set.contains(mnem);
+            BranchTable<ARM64_INS_ENDING> table{};
+
+            assign_branch(table, {ARM64_INS_B}, VERTEX_BRANCH_UNCONDITIONAL);
+            assign_branch(table, {
+                ARM64_INS_BR, ARM64_INS_BRAA, ARM64_INS_BRAAZ, ARM64_INS_BRAB, ARM64_INS_BRABZ
+            }, VERTEX_BRANCH_INDIRECT_JUMP);
+            assign_branch(table, {ARM64_INS_CBZ, ARM64_INS_CBNZ, ARM64_INS_TBZ, ARM64_INS_TBNZ}, VERTEX_BRANCH_CONDITIONAL);
+            assign_branch(table, {ARM64_INS_BL}, VERTEX_BRANCH_CALL);
+            assign_branch(table, {
+                ARM64_INS_BLR, ARM64_INS_BLRAA, ARM64_INS_BLRAAZ, ARM64_INS_BLRAB, ARM64_INS_BLRABZ
+            }, VERTEX_BRANCH_INDIRECT_CALL);
+            assign_branch(table, {
+                ARM64_INS_RET, ARM64_INS_RETAA, ARM64_INS_RETAB,
+                ARM64_INS_ERET, ARM64_INS_ERETAA, ARM64_INS_ERETAB
+            }, VERTEX_BRANCH_RETURN);
+            assign_branch(table, {ARM64_INS_SVC, ARM64_INS_HVC, ARM64_INS_SMC}, VERTEX_BRANCH_INTERRUPT);
+            assign_branch(table, {ARM64_INS_BRK, ARM64_INS_HLT}, VERTEX_BRANCH_EXCEPTION);
+            assign_branch(table, {
+                ARM64_INS_CSEL, ARM64_INS_CSINC, ARM64_INS_CSINV, ARM64_INS_CSNEG, ARM64_INS_FCSEL
+            }, VERTEX_BRANCH_CONDITIONAL_MOVE);
+
+            return table;
+        }();
+
+        template <std::size_t N>
+        [[nodiscard]] BranchType lookup_branch(const BranchTable<N>& table, const unsigned int id)
+        {
+            return id < N ? static_cast<BranchType>(table[id]) : VERTEX_BRANCH_NONE;
         }
 
         template<std::size_t N>
@@ -216,80 +261,48 @@ namespace PluginRuntime
             return VERTEX_INSTRUCTION_UNKNOWN;
         }
 
-        BranchType map_branch_type(const cs_insn* insn, cs_arch arch)
+        [[nodiscard]] bool x86_has_indirect_operand(const cs_detail* detail)
         {
-            const cs_detail* detail = insn->detail;
-            const char* mnem = insn->mnemonic;
-
-            if (arch == CS_ARCH_X86 && mnem)
+            if (!detail || detail->x86.op_count == 0)
             {
-                if (is_in_set(mnem, x86_return_instructions))
-                {
-                    return VERTEX_BRANCH_RETURN;
-                }
-
-                if (is_in_set(mnem, x86_loop_instructions))
-                {
-                    return VERTEX_BRANCH_LOOP;
-                }
-
-                if (is_in_set(mnem, x86_interrupt_instructions))
-                {
-                    const std::string_view mnemSv{mnem};
-                    if (mnemSv == "int3" || mnemSv == "into")
-                    {
-                        return VERTEX_BRANCH_EXCEPTION;
-                    }
-                    return VERTEX_BRANCH_INTERRUPT;
-                }
-
-                if (is_in_set(mnem, x86_call_instructions))
-                {
-                    if (detail && detail->x86.op_count > 0)
-                    {
-                        const cs_x86_op& op = detail->x86.operands[0];
-                        if (op.type == X86_OP_REG || op.type == X86_OP_MEM)
-                        {
-                            return VERTEX_BRANCH_INDIRECT_CALL;
-                        }
-                    }
-                    return VERTEX_BRANCH_CALL;
-                }
+                return false;
+            }
 
-                if (is_in_set(mnem, x86_conditional_jumps))
-                {
-                    if (detail && detail->x86.op_count > 0)
-                    {
-                        const cs_x86_op& op = detail->x86.operands[0];
-                        if (op.type == X86_OP_REG || op.type == X86_OP_MEM)
-                        {
-                            return VERTEX_BRANCH_INDIRECT_JUMP;
-                        }
-                    }
-                    return VERTEX_BRANCH_CONDITIONAL;
-                }
+            const cs_x86_op& op = detail->x86.operands[0];
+            return op.type == X86_OP_REG || op.type == X86_OP_MEM;
+        }
 
-                if (is_in_set(mnem, x86_unconditional_jumps))
-                {
-                    if (detail && detail->x86.op_count > 0)
-                    {
-                        const cs_x86_op& op = detail->x86.operands[0];
-                        if (op.type == X86_OP_REG || op.type == X86_OP_MEM)
-                        {
-                            return VERTEX_BRANCH_INDIRECT_JUMP;
-                        }
-                    }
-                    return VERTEX_BRANCH_UNCONDITIONAL;
-                }
+        BranchType map_branch_type(const cs_insn* insn, cs_arch arch)
+        {
+            const cs_detail* detail = insn->detail;
 
-                if (std::string_view{mnem}.starts_with("cmov"))
+            if (arch == CS_ARCH_X86)
+            {
+                switch (const BranchType type = lookup_branch(x86_branch_table, insn->id))
                 {
-                    return VERTEX_BRANCH_CONDITIONAL_MOVE;
+                    case VERTEX_BRANCH_NONE:
+                        break;
+                    case VERTEX_BRANCH_CALL:
+                        return x86_has_indirect_operand(detail) ? VERTEX_BRANCH_INDIRECT_CALL : VERTEX_BRANCH_CALL;
+                    case VERTEX_BRANCH_UNCONDITIONAL:
+                    case VERTEX_BRANCH_CONDITIONAL:
+                        return x86_has_indirect_operand(detail) ? VERTEX_BRANCH_INDIRECT_JUMP : type;
+                    default:
+                        return type;
                 }
-
-                if (std::string_view{mnem} == "ud2")
+            }
+            else if (arch == CS_ARCH_ARM64)
+            {
+                switch (const BranchType type = lookup_branch(arm64_branch_table, insn->id))
                 {
-                    return VERTEX_BRANCH_EXCEPTION;
+                    case VERTEX_BRANCH_NONE:
+                        break;
+                    case VERTEX_BRANCH_UNCONDITIONAL:
+                        return detail && detail->arm64.cc != ARM64_CC_INVALID && detail->arm64.cc != ARM64_CC_AL
+                            ? VERTEX_BRANCH_CONDITIONAL
+                            : VERTEX_BRANCH_UNCONDITIONAL;
+                    default:
+                        return type;
                 }
             }
 
@@ -302,7 +315,6 @@ namespace PluginRuntime
             bool isCall{false};
             bool isRet{false};
             bool isInt{false};
-            bool isIndirect{false};
 
             for (std::uint8_t i = 0; i < detail->groups_count; ++i)
             {
@@ -319,18 +331,9 @@ namespace PluginRuntime
                 }
             }
 
-            if (arch == CS_ARCH_ARM64)
-            {
-                const cs_arm64& arm64 = detail->arm64;
-                if (arm64.op_count > 0)
-                {
-                    const cs_arm64_op& op = arm64.operands[0];
-                    if (op.type == ARM64_OP_REG)
-                    {
-                        isIndirect = true;
-                    }
-                }
-            }
+            const bool isIndirect = arch == CS_ARCH_X86
+                ? x86_has_indirect_operand(detail)
+                : arch == CS_ARCH_ARM64 && detail->arm64.op_count > 0 && detail->arm64.operands[0].type == ARM64_OP_REG;
 
             if (isRet)
             {
@@ -339,10 +342,6 @@ namespace PluginRuntime
 
             if (isInt)
             {
-                if (mnem && std::string_view{mnem} == "brk")
-                {
-                    return VERTEX_BRANCH_EXCEPTION;
-                }
                 return VERTEX_BRANCH_INTERRUPT;
             }
 
@@ -353,23 +352,7 @@ namespace PluginRuntime
 
             if (isJump)
             {
-                if (isIndirect)
-                {
-                    return VERTEX_BRANCH_INDIRECT_JUMP;
-                }
-
-                if (arch == CS_ARCH_ARM64 && mnem)
-                {
-                    const std::string_view mnemSv{mnem};
-                    if (mnemSv.starts_with("b.") ||
-                        mnemSv.starts_with("cb") ||
-                        mnemSv.starts_with("tb"))
-                    {
-                        return VERTEX_BRANCH_CONDITIONAL;
-                    }
-                }
-
-                return VERTEX_BRANCH_UNCONDITIONAL;
+                return isIndirect ? VERTEX_BRANCH_INDIRECT_JUMP : VERTEX_BRANCH_UNCONDITIONAL;
             }
 
             return VERTEX_BRANCH_NONE;
@@ -536,134 +519,223 @@ namespace PluginRuntime
             return 0;
         }
 
-    }
-
-    StatusCode init_disassembler(const DisasmMode mode)
-    {
-        std::scoped_lock lock{g_capstone_mutex};
-
-        if (g_initialized)
+        // Resolves the first RIP-relative or absolute memory operand, which is what data xrefs are keyed on.
+        // Segment-relative operands are thread-local and index-scaled operands have no single address.
+        template <class Result>
+        void fill_data_reference(const cs_insn* insn, const cs_arch arch, const bool is32Bit, Result& res)
         {
-            if (g_current_mode == mode)
+            res.dataAddress = 0;
+            res.dataAccess = VERTEX_DATA_ACCESS_NONE;
+            res.dataSize = 0;
+            res.reserved0 = 0;
+
+            const cs_detail* detail = insn->detail;
+            if (!detail)
             {
-                return STATUS_OK;
+                return;
             }
 
-            if (g_capstone_handle)
+            if (arch == CS_ARCH_X86)
             {
-                cs_close(&g_capstone_handle);
-                g_capstone_handle = 0;
-                g_initialized = false;
+                const cs_x86& x86 = detail->x86;
+                for (std::uint8_t i = 0; i < x86.op_count; ++i)
+                {
+                    const cs_x86_op& op = x86.operands[i];
+                    if (op.type != X86_OP_MEM || op.mem.index != X86_REG_INVALID ||
+                        op.mem.segment == X86_REG_FS || op.mem.segment == X86_REG_GS)
+                    {
+                        continue;
+                    }
+
+                    std::uint64_t address{};
+                    if (op.mem.base == X86_REG_RIP)
+                    {
+                        address = insn->address + insn->size + static_cast<std::uint64_t>(op.mem.disp);
+                    }
+                    else if (op.mem.base == X86_REG_INVALID)
+                    {
+                        address = static_cast<std::uint64_t>(op.mem.disp);
+                        if (is32Bit)
+                        {
+                            address &= 0xFFFFFFFFull;
+                        }
+                    }
+                    else
+                    {
+                        continue;
+                    }
+
+                    std::uint8_t access{VERTEX_DATA_ACCESS_NONE};
+                    if (insn->id == X86_INS_LEA)
+                    {
+                        access = VERTEX_DATA_ACCESS_ADDRESS_OF;
+                    }
+                    else
+                    {
+                        if ((op.access & CS_AC_READ) != 0)
+                        {
+                            access |= VERTEX_DATA_ACCESS_READ;
+                        }
+                        if ((op.access & CS_AC_WRITE) != 0)
+                        {
+                            access |= VERTEX_DATA_ACCESS_WRITE;
+                        }
+                        if (access == VERTEX_DATA_ACCESS_NONE)
+                        {
+                            access = (i == 0 && x86.op_count > 1) ? VERTEX_DATA_ACCESS_WRITE : VERTEX_DATA_ACCESS_READ;
+                        }
+                    }
+
+                    res.dataAddress = address;
+                    res.dataAccess = access;
+                    res.dataSize = insn->id == X86_INS_LEA ? 0 : op.size;
+                    return;
+                }
             }
-        }
+            else if (arch == CS_ARCH_ARM64)
+            {
+                const cs_arm64& arm64 = detail->arm64;
+                if (arm64.op_count != 2 || arm64.operands[1].type != ARM64_OP_IMM)
+                {
+                    return;
+                }
 
-        cs_arch arch;
-        cs_mode cs_m;
+                switch (insn->id)
+                {
+                    case ARM64_INS_ADR:
+                        res.dataAccess = VERTEX_DATA_ACCESS_ADDRESS_OF;
+                        break;
+                    case ARM64_INS_LDR:
+                        res.dataAccess = VERTEX_DATA_ACCESS_READ;
+                        break;
+                    case ARM64_INS_LDRSW:
+                        res.dataAccess = VERTEX_DATA_ACCESS_READ;
+                        res.dataSize = 4;
+                        break;
+                    default:
+                        return;
+                }
 
-        switch (mode)
-        {
-            case DisasmMode::X86_32:
-                arch = CS_ARCH_X86;
-                cs_m = CS_MODE_32;
-                break;
-            case DisasmMode::X86_64:
-                arch = CS_ARCH_X86;
-                cs_m = CS_MODE_64;
-                break;
-            case DisasmMode::ARM64:
-                arch = CS_ARCH_ARM64;
-                cs_m = CS_MODE_ARM;
-                break;
-            default:
-                return STATUS_ERROR_INVALID_PARAMETER;
+                res.dataAddress = static_cast<std::uint64_t>(arm64.operands[1].imm);
+            }
         }
 
-        const cs_err err = cs_open(arch, cs_m, &g_capstone_handle);
-        if (err != CS_ERR_OK)
+        struct ThreadDisassembler final
         {
-            g_last_capstone_error = err;
-            return STATUS_ERROR_GENERAL;
-        }
+            csh handle{0};
+            cs_insn* insn{nullptr};
+            cs_arch arch{CS_ARCH_X86};
+            bool is32Bit{};
+            std::uint64_t epoch{};
 
-        cs_option(g_capstone_handle, CS_OPT_DETAIL, CS_OPT_ON);
-        cs_option(g_capstone_handle, CS_OPT_SKIPDATA, CS_OPT_ON);
+            ThreadDisassembler() = default;
+            ThreadDisassembler(const ThreadDisassembler&) = delete;
+            ThreadDisassembler& operator=(const ThreadDisassembler&) = delete;
 
-        g_current_mode = mode;
-        g_initialized = true;
-        return STATUS_OK;
-    }
+            ~ThreadDisassembler()
+            {
+                reset();
+            }
 
-    void cleanup_disassembler()
-    {
-        std::scoped_lock lock{g_capstone_mutex};
+            void reset()
+            {
+                if (insn)
+                {
+                    cs_free(insn, 1);
+                    insn = nullptr;
+                }
+                if (handle)
+                {
+                    cs_close(&handle);
+                    handle = 0;
+                }
+                epoch = 0;
+            }
+        };
 
-        if (g_initialized && g_capstone_handle)
+        [[nodiscard]] std::optional<std::pair<cs_arch, cs_mode>> to_capstone_mode(const DisasmMode mode)
         {
-            cs_close(&g_capstone_handle);
-            g_capstone_handle = 0;
-            g_initialized = false;
+            switch (mode)
+            {
+                case DisasmMode::X86_32:
+                    return std::pair{CS_ARCH_X86, CS_MODE_32};
+                case DisasmMode::X86_64:
+                    return std::pair{CS_ARCH_X86, CS_MODE_64};
+                case DisasmMode::ARM64:
+                    return std::pair{CS_ARCH_ARM64, CS_MODE_ARM};
+                default:
+                    return std::nullopt;
+            }
         }
-    }
-
-    bool is_disassembler_initialized()
-    {
-        std::scoped_lock lock{g_capstone_mutex};
-        return g_initialized;
-    }
 
-    const char* get_last_disassembler_error()
-    {
-        std::scoped_lock lock{g_capstone_mutex};
-        return cs_strerror(g_last_capstone_error);
-    }
+        [[nodiscard]] cs_err open_handle(const cs_arch arch, const cs_mode mode, csh& handle)
+        {
+            const cs_err err = cs_open(arch, mode, &handle);
+            if (err != CS_ERR_OK)
+            {
+                handle = 0;
+                return err;
+            }
 
-    DisasmMode get_disassembler_mode()
-    {
-        std::scoped_lock lock{g_capstone_mutex};
-        return g_current_mode;
-    }
+            cs_option(handle, CS_OPT_DETAIL, CS_OPT_ON);
+            cs_option(handle, CS_OPT_SKIPDATA, CS_OPT_ON);
+            return CS_ERR_OK;
+        }
 
-    StatusCode disassemble(std::uint64_t address, std::span<const std::uint8_t> code, DisassemblerResults* results)
-    {
-        if (!results)
+        // Returns this thread's handle, reopened with the current mode whenever init or cleanup moved the
+        // epoch since the last call. Returns nullptr while the disassembler is not initialized.
+        [[nodiscard]] ThreadDisassembler* acquire_thread_disassembler()
         {
-            return STATUS_ERROR_INVALID_PARAMETER;
-        }
+            thread_local ThreadDisassembler local{};
 
-        std::scoped_lock lock{g_capstone_mutex};
+            if (local.handle != 0 && local.epoch == g_config_epoch.load(std::memory_order_acquire))
+            {
+                return &local;
+            }
 
-        if (!g_initialized)
-        {
-            return STATUS_ERROR_INVALID_PARAMETER;
-        }
+            DisasmMode mode{};
+            std::uint64_t epoch{};
+            {
+                std::scoped_lock lock{g_config_mutex};
+                if (!g_initialized.load(std::memory_order_relaxed))
+                {
+                    local.reset();
+                    return nullptr;
+                }
+                mode = g_current_mode;
+                epoch = g_config_epoch.load(std::memory_order_relaxed);
+            }
 
-        if (code.empty())
-        {
-            results->count = 0;
-            return STATUS_OK;
-        }
+            local.reset();
 
-        cs_insn* insn{nullptr};
-        const std::size_t count = cs_disasm(g_capstone_handle, code.data(), code.size(), address, 0, &insn);
+            const auto capstoneMode = to_capstone_mode(mode);
+            if (!capstoneMode.has_value())
+            {
+                return nullptr;
+            }
 
-        if (count == 0)
-        {
-            results->count = 0;
-            return STATUS_OK;
-        }
+            const cs_err err = open_handle(capstoneMode->first, capstoneMode->second, local.handle);
+            if (err != CS_ERR_OK)
+            {
+                g_last_capstone_error.store(err, std::memory_order_relaxed);
+                return nullptr;
+            }
 
-        const cs_arch arch = (g_current_mode == DisasmMode::ARM64) ? CS_ARCH_ARM64 : CS_ARCH_X86;
+            local.insn = cs_malloc(local.handle);
+            if (!local.insn)
+            {
+                local.reset();
+                return nullptr;
+            }
 
-        const std::uint32_t to_copy = std::min(static_cast<std::uint32_t>(count), results->capacity);
-        results->count = to_copy;
-        results->startAddress = address;
-        results->totalSize = 0;
+            local.arch = capstoneMode->first;
+            local.is32Bit = mode == DisasmMode::X86_32;
+            local.epoch = epoch;
+            return &local;
+        }
 
-        for (std::uint32_t i = 0; i < to_copy; ++i)
+        void fill_result(const cs_insn& ins, const cs_arch arch, const bool is32Bit, const std::uint32_t index, DisassemblerResult& res)
         {
-            DisassemblerResult& res = results->results[i];
-            const cs_insn& ins = insn[i];
-
             res.address = ins.address;
             res.physicalAddress = 0;
             res.size = static_cast<std::uint32_t>(ins.size);
@@ -692,6 +764,7 @@ namespace PluginRuntime
             }
 
             res.fallthroughAddress = ins.address + ins.size;
+            fill_data_reference(&ins, arch, is32Bit, res);
 
             res.targetSymbol[0] = '\0';
             res.sectionName[0] = '\0';
@@ -699,81 +772,236 @@ namespace PluginRuntime
             res.timestamp = 0;
             res.xrefCount = 0;
             res.functionStart = 0;
-            res.instructionIndex = i;
+            res.instructionIndex = index;
+        }
+
+        // Numeric part of fill_result for the compact format. Strings are appended by the caller when requested.
+        void fill_compact(const cs_insn& ins, const cs_arch arch, const bool is32Bit, CompactInstruction& res)
+        {
+            res.address = ins.address;
+            res.size = static_cast<std::uint8_t>(ins.size);
+
+            std::memset(res.rawBytes, 0, VERTEX_MAX_BYTES_LENGTH);
+            std::copy_n(ins.bytes, std::min(static_cast<std::size_t>(ins.size),
+                        static_cast<std::size_t>(VERTEX_MAX_BYTES_LENGTH)), res.rawBytes);
 
-            results->totalSize += ins.size;
+            const auto branchType = map_branch_type(&ins, arch);
+            res.category = static_cast<std::uint8_t>(map_category(&ins, arch));
+            res.branchType = static_cast<std::uint8_t>(branchType);
+            res.flags = build_flags(&ins, branchType, arch);
+
+            if (branchType != VERTEX_BRANCH_NONE && branchType != VERTEX_BRANCH_RETURN)
+            {
+                res.targetAddress = extract_target_address(&ins, arch);
+                res.branchDirection = static_cast<std::uint8_t>(compute_branch_direction(ins.address, res.targetAddress));
+            }
+            else
+            {
+                res.targetAddress = 0;
+                res.branchDirection = VERTEX_DIRECTION_NONE;
+            }
+
+            fill_data_reference(&ins, arch, is32Bit, res);
+
+            res.functionStart = 0;
+            res.mnemonic = VERTEX_COMPACT_NO_STRING;
+            res.operands = VERTEX_COMPACT_NO_STRING;
+            res.comment = VERTEX_COMPACT_NO_STRING;
+            res.targetSymbol = VERTEX_COMPACT_NO_STRING;
+            res.sectionName = VERTEX_COMPACT_NO_STRING;
         }
+    }
 
-        results->endAddress = address + results->totalSize;
+    StatusCode init_disassembler(const DisasmMode mode)
+    {
+        std::scoped_lock lock{g_config_mutex};
+
+        if (g_initialized.load(std::memory_order_relaxed) && g_current_mode == mode)
+        {
+            return STATUS_OK;
+        }
+
+        const auto capstoneMode = to_capstone_mode(mode);
+        if (!capstoneMode.has_value())
+        {
+            return STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        // Opened once here so an unsupported mode still fails at init rather than on the first decode.
+        csh probe{0};
+        const cs_err err = open_handle(capstoneMode->first, capstoneMode->second, probe);
+        if (err != CS_ERR_OK)
+        {
+            g_last_capstone_error.store(err, std::memory_order_relaxed);
+            return STATUS_ERROR_GENERAL;
+        }
+        cs_close(&probe);
 
-        cs_free(insn, count);
+        g_current_mode = mode;
+        g_initialized.store(true, std::memory_order_relaxed);
+        g_config_epoch.fetch_add(1, std::memory_order_release);
         return STATUS_OK;
     }
 
-    std::uint32_t disassemble_single(const std::uint64_t address, const std::span<const std::uint8_t> code, DisassemblerResult* result)
+    void cleanup_disassembler()
     {
-        if (!result || code.empty())
+        std::scoped_lock lock{g_config_mutex};
+
+        if (g_initialized.load(std::memory_order_relaxed))
         {
-            return 0;
+            g_initialized.store(false, std::memory_order_relaxed);
+            g_config_epoch.fetch_add(1, std::memory_order_release);
         }
+    }
 
-        std::scoped_lock lock{g_capstone_mutex};
+    bool is_disassembler_initialized()
+    {
+        return g_initialized.load(std::memory_order_acquire);
+    }
+
+    const char* get_last_disassembler_error()
+    {
+        return cs_strerror(g_last_capstone_error.load(std::memory_order_relaxed));
+    }
 
-        if (!g_initialized)
+    DisasmMode get_disassembler_mode()
+    {
+        std::scoped_lock lock{g_config_mutex};
+        return g_current_mode;
+    }
+
+    StatusCode disassemble(std::uint64_t address, std::span<const std::uint8_t> code, DisassemblerResults* results)
+    {
+        if (!results)
         {
-            return 0;
+            return STATUS_ERROR_INVALID_PARAMETER;
         }
 
-        cs_insn* insn{nullptr};
-        const std::size_t count = cs_disasm(g_capstone_handle, code.data(), code.size(), address, 1, &insn);
+        ThreadDisassembler* local = acquire_thread_disassembler();
+        if (!local)
+        {
+            return STATUS_ERROR_INVALID_PARAMETER;
+        }
 
-        if (count == 0)
+        results->count = 0;
+        results->startAddress = address;
+        results->totalSize = 0;
+
+        // Decoding stops at the caller's capacity instead of decoding the whole buffer and dropping the tail.
+        const std::uint8_t* cursor = code.data();
+        std::size_t remaining = code.size();
+        std::uint64_t nextAddress = address;
+        std::uint32_t count{};
+
+        while (count < results->capacity &&
+               cs_disasm_iter(local->handle, &cursor, &remaining, &nextAddress, local->insn))
         {
-            return 0;
+            fill_result(*local->insn, local->arch, local->is32Bit, count, results->results[count]);
+            results->totalSize += local->insn->size;
+            ++count;
+        }
+
+        results->count = count;
+        results->endAddress = address + results->totalSize;
+        return STATUS_OK;
+    }
+
+    std::optional<std::uint32_t> append_compact_string(CompactDisassembly& results, const std::string_view text)
+    {
+        if (text.empty())
+        {
+            return VERTEX_COMPACT_NO_STRING;
+        }
+        if (results.stringCapacity - results.stringSize <= text.size())
+        {
+            return std::nullopt;
         }
 
-        const cs_arch arch = (g_current_mode == DisasmMode::ARM64) ? CS_ARCH_ARM64 : CS_ARCH_X86;
-        const cs_insn& ins = *insn;
+        const auto offset = results.stringSize;
+        std::memcpy(results.strings + offset, text.data(), text.size());
+        results.strings[offset + text.size()] = '\0';
+        results.stringSize += static_cast<std::uint32_t>(text.size() + 1);
+        return offset;
+    }
 
-        result->address = ins.address;
-        result->physicalAddress = 0;
-        result->size = static_cast<std::uint32_t>(ins.size);
+    StatusCode disassemble_compact(const std::uint64_t address, const std::span<const std::uint8_t> code, CompactDisassembly* results)
+    {
+        if (!results || results->version == 0 || results->version > VERTEX_COMPACT_DISASSEMBLY_VERSION ||
+            (!results->instructions && results->capacity > 0) || (!results->strings && results->stringCapacity > 0))
+        {
+            return STATUS_ERROR_INVALID_PARAMETER;
+        }
 
-        std::memset(result->rawBytes, 0, VERTEX_MAX_BYTES_LENGTH);
-        std::copy_n(ins.bytes, std::min(static_cast<std::size_t>(ins.size),
-                    static_cast<std::size_t>(VERTEX_MAX_BYTES_LENGTH)), result->rawBytes);
+        ThreadDisassembler* local = acquire_thread_disassembler();
+        if (!local)
+        {
+            return STATUS_ERROR_INVALID_PARAMETER;
+        }
 
-        copy_string(result->mnemonic, ins.mnemonic);
-        copy_string(result->operands, ins.op_str);
-        result->comment[0] = '\0';
+        results->count = 0;
+        results->stringSize = 0;
+        results->startAddress = address;
+        results->endAddress = address;
 
-        result->category = map_category(&ins, arch);
-        result->branchType = map_branch_type(&ins, arch);
-        result->flags = build_flags(&ins, result->branchType, arch);
+        const bool wantText = (results->fields & VERTEX_COMPACT_FIELD_TEXT) != 0;
+        const std::uint8_t* cursor = code.data();
+        std::size_t remaining = code.size();
+        std::uint64_t nextAddress = address;
+        std::uint32_t count{};
 
-        if (result->branchType != VERTEX_BRANCH_NONE && result->branchType != VERTEX_BRANCH_RETURN)
+        while (count < results->capacity &&
+               cs_disasm_iter(local->handle, &cursor, &remaining, &nextAddress, local->insn))
         {
-            result->targetAddress = extract_target_address(&ins, arch);
-            result->branchDirection = compute_branch_direction(ins.address, result->targetAddress);
+            auto& res = results->instructions[count];
+            fill_compact(*local->insn, local->arch, local->is32Bit, res);
+
+            // An instruction whose text does not fit ends the call, so every returned record is complete.
+            if (wantText)
+            {
+                const auto mark = results->stringSize;
+                const auto mnemonic = append_compact_string(*results, local->insn->mnemonic);
+                const auto operands = mnemonic.has_value() ? append_compact_string(*results, local->insn->op_str) : std::nullopt;
+                if (!operands.has_value())
+                {
+                    results->stringSize = mark;
+                    break;
+                }
+                res.mnemonic = *mnemonic;
+                res.operands = *operands;
+            }
+
+            results->endAddress = local->insn->address + local->insn->size;
+            ++count;
         }
-        else
+
+        results->count = count;
+        return STATUS_OK;
+    }
+
+    std::uint32_t disassemble_single(const std::uint64_t address, const std::span<const std::uint8_t> code, DisassemblerResult* result)
+    {
+        if (!result || code.empty())
         {
-            result->targetAddress = 0;
-            result->branchDirection = VERTEX_DIRECTION_NONE;
+            return 0;
+        }
+
+        ThreadDisassembler* local = acquire_thread_disassembler();
+        if (!local)
+        {
+            return 0;
         }
 
-        result->fallthroughAddress = ins.address + ins.size;
-        result->targetSymbol[0] = '\0';
-        result->sectionName[0] = '\0';
-        result->executionCount = 0;
-        result->timestamp = 0;
-        result->xrefCount = 0;
-        result->functionStart = 0;
-        result->instructionIndex = 0;
+        const std::uint8_t* cursor = code.data();
+        std::size_t remaining = code.size();
+        std::uint64_t nextAddress = address;
+
+        if (!cs_disasm_iter(local->handle, &cursor, &remaining, &nextAddress, local->insn))
+        {
+            return 0;
+        }
 
-        const std::uint32_t size = result->size;
-        cs_free(insn, 1);
-        return size;
+        fill_result(*local->insn, local->arch, local->is32Bit, 0, *result);
+        return result->size;
     }
 
     BranchDirection compute_branch_direction(std::uint64_t current_address, std::uint64_t target_address, std::uint64_t function_start, std::uint64_t function_end)
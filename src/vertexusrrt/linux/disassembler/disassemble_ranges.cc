@@ -0,0 +1,199 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under LGPLv3.0+
+//
+#include <vertexusrrt/disassembler.hh>
+#include <vertexusrrt/process_internal.hh>
+#include <sdk/api.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <unistd.h>
+
+namespace
+{
+    const std::uint64_t PAGE_SIZE = static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+
+    // Longest x86 encoding; ARM64 instructions are shorter, so this bounds every supported mode.
+    constexpr std::uint64_t MAX_INSTRUCTION_BYTES = 15;
+
+    [[nodiscard]] std::uint64_t page_of(const std::uint64_t address)
+    {
+        return address & ~(PAGE_SIZE - 1);
+    }
+
+    [[nodiscard]] std::uint64_t window_end(const DisassemblerRangeRequest& request, const std::uint32_t capacity)
+    {
+        const auto window = static_cast<std::uint64_t>(std::min(request.maxInstructions, capacity)) * MAX_INSTRUCTION_BYTES;
+        return request.address > std::numeric_limits<std::uint64_t>::max() - window
+            ? std::numeric_limits<std::uint64_t>::max()
+            : request.address + window;
+    }
+
+    // Section lookups re-read the module map, so the last module is reused while its sections keep
+    // covering the decoded addresses.
+    void fill_section_names(const std::span<DisassemblerResult> decoded, std::optional<ProcessInternal::ResolvedModule>& module)
+    {
+        if (decoded.empty())
+        {
+            return;
+        }
+
+        const auto covers = [&module](const std::uint64_t address)
+        {
+            return module.has_value() && address >= module->baseAddress &&
+                ProcessInternal::find_section_for_rva(module->sections, address - module->baseAddress) != nullptr;
+        };
+
+        if (!covers(decoded.front().address))
+        {
+            module = ProcessInternal::resolve_module_sections(decoded.front().address);
+            if (!module.has_value())
+            {
+                return;
+            }
+        }
+
+        for (auto& res : decoded)
+        {
+            if (res.sectionName[0] != '\0' || res.address < module->baseAddress)
+            {
+                continue;
+            }
+
+            const auto* name = ProcessInternal::find_section_for_rva(module->sections, res.address - module->baseAddress);
+            if (name)
+            {
+                ProcessInternal::vertex_cpy(res.sectionName, name, VERTEX_MAX_SECTION_LENGTH);
+            }
+        }
+    }
+}
+
+extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_process_disassemble_ranges(const DisassemblerRangeRequest* requests,
+                                                                                   DisassemblerRangeResult* rangeResults,
+                                                                                   const std::uint32_t count,
+                                                                                   DisassemblerResults* results)
+{
+    if (!requests || !rangeResults || !results || (!results->results && results->capacity > 0))
+    {
+        return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+    }
+
+    if (!PluginRuntime::is_disassembler_initialized())
+    {
+        return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+    }
+
+    results->count = 0;
+    results->totalSize = 0;
+    results->startAddress = count > 0 ? requests[0].address : 0;
+    results->endAddress = 0;
+
+    // Every range reads whole pages, so one unreadable page only truncates the ranges that reach it.
+    // Pages shared by neighbouring ranges are read once, and runs of adjacent pages coalesce into a
+    // single remote read inside the bulk reader.
+    std::vector<std::uint64_t> pages{};
+    for (const auto& request : std::span{requests, count})
+    {
+        if (request.maxInstructions == 0 || results->capacity == 0)
+        {
+            continue;
+        }
+
+        const auto last = page_of(window_end(request, results->capacity) - 1);
+        for (auto page = page_of(request.address); page <= last && page >= page_of(request.address); page += PAGE_SIZE)
+        {
+            pages.push_back(page);
+        }
+    }
+    std::ranges::sort(pages);
+    pages.erase(std::ranges::unique(pages).begin(), pages.end());
+
+    if (pages.size() > std::numeric_limits<std::uint32_t>::max())
+    {
+        return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+    }
+
+    std::vector<std::uint8_t> buffer(pages.size() * PAGE_SIZE);
+    std::vector<BulkReadRequest> reads(pages.size());
+    std::vector<BulkReadResult> readResults(pages.size());
+    for (std::size_t i{}; i < pages.size(); ++i)
+    {
+        reads[i] = BulkReadRequest{pages[i], PAGE_SIZE, buffer.data() + i * PAGE_SIZE};
+    }
+
+    if (!pages.empty())
+    {
+        const auto status = vertex_memory_read_process_bulk(reads.data(), readResults.data(), static_cast<std::uint32_t>(pages.size()));
+        if (status != StatusCode::STATUS_OK)
+        {
+            return status;
+        }
+    }
+
+    std::optional<ProcessInternal::ResolvedModule> module{};
+
+    for (std::uint32_t i{}; i < count; ++i)
+    {
+        const auto& request = requests[i];
+        auto& outcome = rangeResults[i];
+        outcome = DisassemblerRangeResult{results->count, 0, StatusCode::STATUS_OK};
+
+        if (request.maxInstructions == 0)
+        {
+            continue;
+        }
+
+        const auto remaining = results->capacity - results->count;
+        if (remaining == 0)
+        {
+            outcome.status = StatusCode::STATUS_ERROR_MEMORY_BUFFER_TOO_SMALL;
+            continue;
+        }
+
+        const auto first = static_cast<std::size_t>(std::ranges::lower_bound(pages, page_of(request.address)) - pages.begin());
+        if (readResults[first].status != StatusCode::STATUS_OK)
+        {
+            outcome.status = readResults[first].status;
+            continue;
+        }
+
+        // The readable bytes of a range end at its window or at the first page that failed.
+        const auto offset = request.address - pages[first];
+        const auto wanted = window_end(request, results->capacity) - request.address;
+        std::size_t last = first + 1;
+        while (last < pages.size() && (last - first) * PAGE_SIZE < offset + wanted &&
+               pages[last] == pages[last - 1] + PAGE_SIZE && readResults[last].status == StatusCode::STATUS_OK)
+        {
+            ++last;
+        }
+        const auto available = std::min<std::uint64_t>((last - first) * PAGE_SIZE - offset, wanted);
+
+        DisassemblerResults view{};
+        view.results = results->results + results->count;
+        view.capacity = std::min(request.maxInstructions, remaining);
+
+        const auto status = PluginRuntime::disassemble(request.address,
+            std::span<const std::uint8_t>(buffer.data() + first * PAGE_SIZE + offset, available), &view);
+        if (status != StatusCode::STATUS_OK)
+        {
+            outcome.status = status;
+            continue;
+        }
+
+        fill_section_names(std::span{view.results, view.count}, module);
+
+        outcome.count = view.count;
+        results->count += view.count;
+        results->totalSize += view.totalSize;
+        results->endAddress = std::max(results->endAddress, view.endAddress);
+    }
+
+    return StatusCode::STATUS_OK;
+}
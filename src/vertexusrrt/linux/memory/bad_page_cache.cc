@@ -0,0 +1,84 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under LGPLv3.0+
+//
+#include <vertexusrrt/linux/bad_page_cache.hh>
+
+#include <mutex>
+
+#include <unistd.h>
+
+namespace MemoryInternal
+{
+    namespace
+    {
+        const std::uint64_t PAGE_SIZE = static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+    }
+
+    std::uint64_t BadPageCache::page_of(const std::uint64_t address) noexcept
+    {
+        return address & ~(PAGE_SIZE - 1);
+    }
+
+    void BadPageCache::begin_batch(const native_handle pid)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        {
+            std::shared_lock lock(m_mutex);
+            if (m_pid == pid && now - m_epochStart < EPOCH_LIFETIME)
+            {
+                return;
+            }
+        }
+
+        std::unique_lock lock(m_mutex);
+        if (m_pid != pid || now - m_epochStart >= EPOCH_LIFETIME)
+        {
+            m_pages.clear();
+            m_pid = pid;
+            m_epochStart = now;
+        }
+    }
+
+    void BadPageCache::invalidate()
+    {
+        std::unique_lock lock(m_mutex);
+        m_pages.clear();
+        m_pid = INVALID_HANDLE_VALUE;
+    }
+
+    bool BadPageCache::touches_bad_page(const std::uint64_t address, const std::uint64_t size) const
+    {
+        std::shared_lock lock(m_mutex);
+        if (m_pages.empty() || size == 0)
+        {
+            return false;
+        }
+
+        const std::uint64_t lastPage = page_of(address + size - 1);
+        for (std::uint64_t page = page_of(address); page <= lastPage; page += PAGE_SIZE)
+        {
+            if (m_pages.contains(page))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void BadPageCache::add(const std::uint64_t address)
+    {
+        std::unique_lock lock(m_mutex);
+        if (m_pages.size() >= MAX_PAGES)
+        {
+            m_pages.clear();
+        }
+        m_pages.insert(page_of(address));
+    }
+
+    BadPageCache& bad_read_pages()
+    {
+        static BadPageCache cache{};
+        return cache;
+    }
+}
@@ -0,0 +1,56 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under LGPLv3.0+
+//
+#include <vertexusrrt/linux/pagemap.hh>
+#include <sdk/api.h>
+
+#include <cstdint>
+
+extern native_handle& get_native_handle();
+
+extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_reset_dirty_tracking()
+{
+    const auto& nativeHandle = get_native_handle();
+    if (nativeHandle == INVALID_HANDLE_VALUE)
+    {
+        return StatusCode::STATUS_ERROR_PROCESS_INVALID;
+    }
+
+    if (!Pagemap::soft_dirty_supported())
+    {
+        return StatusCode::STATUS_ERROR_NOT_IMPLEMENTED;
+    }
+
+    return Pagemap::clear_soft_dirty(nativeHandle);
+}
+
+extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_query_dirty_pages(const std::uint64_t address, const std::uint64_t size, std::uint8_t* bitmap,
+                                                                                 const std::uint64_t bitmapSize, std::uint64_t* pageSize)
+{
+    if (pageSize == nullptr)
+    {
+        return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+    }
+
+    *pageSize = Pagemap::page_size();
+
+    if (bitmap == nullptr)
+    {
+        return StatusCode::STATUS_OK;
+    }
+
+    const auto& nativeHandle = get_native_handle();
+    if (nativeHandle == INVALID_HANDLE_VALUE)
+    {
+        return StatusCode::STATUS_ERROR_PROCESS_INVALID;
+    }
+
+    if (!Pagemap::soft_dirty_supported())
+    {
+        return StatusCode::STATUS_ERROR_NOT_IMPLEMENTED;
+    }
+
+    // MADV_DONTNEED and hole punching drop a page without setting its soft-dirty bit, although it now reads differently.
+    return Pagemap::fill_bitmap(nativeHandle, address, size, Pagemap::ENTRY_SOFT_DIRTY, bitmap, bitmapSize, true);
+}
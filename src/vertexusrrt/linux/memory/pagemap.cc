@@ -0,0 +1,206 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under LGPLv3.0+
+//
+#include <vertexusrrt/linux/pagemap.hh>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <format>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace
+{
+    constexpr std::size_t PAGEMAP_BATCH_ENTRIES = 4096;
+
+    [[nodiscard]] StatusCode status_from_errno(const int error)
+    {
+        switch (error)
+        {
+            case ENOENT:
+            case ESRCH:
+                return StatusCode::STATUS_ERROR_PROCESS_INVALID;
+            case EACCES:
+            case EPERM:
+                return StatusCode::STATUS_ERROR_PROCESS_ACCESS_DENIED;
+            case EINVAL:
+                return StatusCode::STATUS_ERROR_NOT_IMPLEMENTED;
+            default:
+                return StatusCode::STATUS_ERROR_MEMORY_READ;
+        }
+    }
+
+    [[nodiscard]] int open_pagemap(const native_handle pid)
+    {
+        if (pid == INVALID_HANDLE_VALUE)
+        {
+            return -1;
+        }
+
+        const auto path = std::format("/proc/{}/pagemap", pid);
+        return open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    }
+
+    [[nodiscard]] StatusCode read_entries_from(const int fd, const std::uint64_t firstPage, const std::span<std::uint64_t> entries)
+    {
+        auto* out = reinterpret_cast<char*>(entries.data());
+        const std::size_t totalBytes = entries.size_bytes();
+        std::size_t done{};
+
+        while (done < totalBytes)
+        {
+            const auto offset = static_cast<off_t>(firstPage * sizeof(std::uint64_t) + done);
+            const ssize_t bytesRead = pread(fd, out + done, totalBytes - done, offset);
+            if (bytesRead < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return status_from_errno(errno);
+            }
+
+            if (bytesRead == 0)
+            {
+                std::fill(out + done, out + totalBytes, 0);
+                break;
+            }
+
+            done += static_cast<std::size_t>(bytesRead);
+        }
+
+        return StatusCode::STATUS_OK;
+    }
+}
+
+namespace Pagemap
+{
+    std::uint64_t page_size() noexcept
+    {
+        static const auto size = static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+        return size;
+    }
+
+    StatusCode read_entries(const native_handle pid, const std::uint64_t firstPage, const std::span<std::uint64_t> entries)
+    {
+        const int fd = open_pagemap(pid);
+        if (fd == -1)
+        {
+            return pid == INVALID_HANDLE_VALUE ? StatusCode::STATUS_ERROR_PROCESS_INVALID : status_from_errno(errno);
+        }
+
+        const StatusCode status = read_entries_from(fd, firstPage, entries);
+        close(fd);
+        return status;
+    }
+
+    StatusCode fill_bitmap(const native_handle pid, const std::uint64_t address, const std::uint64_t size, const std::uint64_t mask, std::uint8_t* bitmap,
+                           const std::uint64_t bitmapSize, const bool markAbsent)
+    {
+        if (bitmap == nullptr || size == 0 || address + size < address)
+        {
+            return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        const std::uint64_t granularity = page_size();
+        const std::uint64_t firstPage = address / granularity;
+        const std::uint64_t pageCount = (address + size - 1) / granularity - firstPage + 1;
+        if (bitmapSize < (pageCount + 7) / 8)
+        {
+            return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        std::fill_n(bitmap, (pageCount + 7) / 8, std::uint8_t{});
+
+        const int fd = open_pagemap(pid);
+        if (fd == -1)
+        {
+            return pid == INVALID_HANDLE_VALUE ? StatusCode::STATUS_ERROR_PROCESS_INVALID : status_from_errno(errno);
+        }
+
+        std::array<std::uint64_t, PAGEMAP_BATCH_ENTRIES> entries{};
+        for (std::uint64_t done{}; done < pageCount;)
+        {
+            const auto batch = static_cast<std::size_t>(std::min<std::uint64_t>(PAGEMAP_BATCH_ENTRIES, pageCount - done));
+            const StatusCode status = read_entries_from(fd, firstPage + done, std::span{entries.data(), batch});
+            if (status != StatusCode::STATUS_OK)
+            {
+                close(fd);
+                return status;
+            }
+
+            for (std::size_t i{}; i < batch; ++i)
+            {
+                if ((entries[i] & mask) != 0 || (markAbsent && (entries[i] & (ENTRY_PRESENT | ENTRY_SWAPPED)) == 0))
+                {
+                    const std::uint64_t bit = done + i;
+                    bitmap[bit / 8] |= static_cast<std::uint8_t>(1U << (bit % 8));
+                }
+            }
+
+            done += batch;
+        }
+
+        close(fd);
+        return StatusCode::STATUS_OK;
+    }
+
+    StatusCode clear_soft_dirty(const native_handle pid)
+    {
+        if (pid == INVALID_HANDLE_VALUE)
+        {
+            return StatusCode::STATUS_ERROR_PROCESS_INVALID;
+        }
+
+        const auto path = std::format("/proc/{}/clear_refs", pid);
+        const int fd = open(path.c_str(), O_WRONLY | O_CLOEXEC);
+        if (fd == -1)
+        {
+            return status_from_errno(errno);
+        }
+
+        constexpr char CLEAR_SOFT_DIRTY[] = "4";
+        const ssize_t written = write(fd, CLEAR_SOFT_DIRTY, sizeof(CLEAR_SOFT_DIRTY) - 1);
+        const int error = errno;
+        close(fd);
+
+        return written == sizeof(CLEAR_SOFT_DIRTY) - 1 ? StatusCode::STATUS_OK : status_from_errno(error);
+    }
+
+    bool soft_dirty_supported()
+    {
+        // clear_refs accepts "4" even on kernels without CONFIG_MEM_SOFT_DIRTY (and on architectures that
+        // never set the bit), so support is probed on a page of our own: it has to read clean right after
+        // clearing and dirty after one write. Kernel support does not change while we are loaded.
+        static const bool supported = []
+        {
+            const std::uint64_t granularity = page_size();
+            void* page = mmap(nullptr, granularity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (page == MAP_FAILED)
+            {
+                return false;
+            }
+
+            auto* byte = static_cast<volatile std::uint8_t*>(page);
+            const native_handle self = getpid();
+            const std::uint64_t pageIndex = reinterpret_cast<std::uintptr_t>(page) / granularity;
+            std::array<std::uint64_t, 1> entry{};
+
+            *byte = 1;
+            bool result = clear_soft_dirty(self) == StatusCode::STATUS_OK &&
+                          read_entries(self, pageIndex, entry) == StatusCode::STATUS_OK && (entry[0] & ENTRY_SOFT_DIRTY) == 0;
+
+            *byte = 2;
+            result = result && read_entries(self, pageIndex, entry) == StatusCode::STATUS_OK &&
+                     (entry[0] & (ENTRY_PRESENT | ENTRY_SOFT_DIRTY)) == (ENTRY_PRESENT | ENTRY_SOFT_DIRTY);
+
+            munmap(page, granularity);
+            return result;
+        }();
+        return supported;
+    }
+}
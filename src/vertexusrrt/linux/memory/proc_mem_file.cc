@@ -0,0 +1,76 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under LGPLv3.0+
+//
+#include <vertexusrrt/linux/proc_mem_file.hh>
+
+#include <cerrno>
+#include <format>
+#include <mutex>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace MemoryInternal
+{
+    ProcMemFile::~ProcMemFile()
+    {
+        close();
+    }
+
+    bool ProcMemFile::open_for(const native_handle pid)
+    {
+        if (m_fd != -1)
+        {
+            ::close(m_fd);
+            m_fd = -1;
+        }
+        m_pid = INVALID_HANDLE_VALUE;
+
+        const auto path = std::format("/proc/{}/mem", pid);
+        m_fd = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+        if (m_fd == -1)
+        {
+            return false;
+        }
+
+        m_pid = pid;
+        return true;
+    }
+
+    ssize_t ProcMemFile::write(const native_handle pid, const iovec* iovs, const int count, const std::uint64_t address)
+    {
+        const auto offset = static_cast<off_t>(address);
+        {
+            std::shared_lock lock(m_mutex);
+            if (m_pid == pid && m_fd != -1)
+            {
+                return ::pwritev(m_fd, iovs, count, offset);
+            }
+        }
+
+        std::unique_lock lock(m_mutex);
+        if ((m_pid != pid || m_fd == -1) && !open_for(pid))
+        {
+            return -1;
+        }
+        return ::pwritev(m_fd, iovs, count, offset);
+    }
+
+    void ProcMemFile::close()
+    {
+        std::unique_lock lock(m_mutex);
+        if (m_fd != -1)
+        {
+            ::close(m_fd);
+            m_fd = -1;
+        }
+        m_pid = INVALID_HANDLE_VALUE;
+    }
+
+    ProcMemFile& proc_mem_file()
+    {
+        static ProcMemFile file{};
+        return file;
+    }
+}
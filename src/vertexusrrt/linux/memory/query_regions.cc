@@ -3,110 +3,21 @@
 // Licensed under LGPLv3.0+
 //
 #include <vertexusrrt/memory_internal.hh>
+#include <vertexusrrt/linux/bad_page_cache.hh>
+#include <vertexusrrt/linux/region_map.hh>
 
-#include <charconv>
-#include <format>
-#include <fstream>
-#include <optional>
-#include <string>
-#include <string_view>
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
 #include <vector>
 
 extern native_handle& get_native_handle();
 
 namespace
 {
-    struct MapsEntry final
-    {
-        std::uint64_t start{};
-        std::uint64_t end{};
-        bool readable{};
-        bool writable{};
-        bool executable{};
-        bool isPrivate{};
-        bool isFileBacked{};
-        std::uint64_t offset{};
-        std::string path{};
-
-        [[nodiscard]] bool same_permissions(const MapsEntry& other) const
-        {
-            return writable == other.writable
-                && executable == other.executable
-                && isPrivate == other.isPrivate
-                && isFileBacked == other.isFileBacked;
-        }
-    };
-
-    [[nodiscard]] std::optional<MapsEntry> parse_maps_line(std::string_view sv)
-    {
-        MapsEntry entry{};
-
-        const auto dashPos = sv.find('-');
-        if (dashPos == std::string_view::npos)
-        {
-            return std::nullopt;
-        }
-
-        std::from_chars(sv.data(), sv.data() + dashPos, entry.start, 16);
-        sv.remove_prefix(dashPos + 1);
-
-        const auto spacePos = sv.find(' ');
-        if (spacePos == std::string_view::npos)
-        {
-            return std::nullopt;
-        }
-
-        std::from_chars(sv.data(), sv.data() + spacePos, entry.end, 16);
-        sv.remove_prefix(spacePos + 1);
+    using MemoryInternal::MapsEntry;
 
-        if (sv.size() < 4)
-        {
-            return std::nullopt;
-        }
-
-        entry.readable = sv[0] == 'r';
-        entry.writable = sv[1] == 'w';
-        entry.executable = sv[2] == 'x';
-        entry.isPrivate = sv[3] == 'p';
-
-        const auto permsEnd = sv.find(' ');
-        if (permsEnd == std::string_view::npos)
-        {
-            return std::nullopt;
-        }
-        sv.remove_prefix(permsEnd + 1);
-
-        const auto offsetEnd = sv.find(' ');
-        if (offsetEnd == std::string_view::npos)
-        {
-            return std::nullopt;
-        }
-
-        std::from_chars(sv.data(), sv.data() + offsetEnd, entry.offset, 16);
-        sv.remove_prefix(offsetEnd + 1);
-
-        for (int i = 0; i < 2; ++i)
-        {
-            const auto nextSpace = sv.find(' ');
-            if (nextSpace == std::string_view::npos)
-            {
-                return entry;
-            }
-            sv.remove_prefix(nextSpace + 1);
-            while (!sv.empty() && sv.front() == ' ')
-            {
-                sv.remove_prefix(1);
-            }
-        }
-
-        if (!sv.empty() && sv.front() != '[')
-        {
-            entry.isFileBacked = true;
-            entry.path = std::string{sv};
-        }
-
-        return entry;
-    }
+    constexpr std::uint64_t MAX_REGION_SIZE = 32ULL * 1024 * 1024;
 
     [[nodiscard]] bool matches_protection_filter(const MapsEntry& entry)
     {
@@ -180,93 +91,86 @@ extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_query_regions(Memor
         return StatusCode::STATUS_ERROR_PROCESS_INVALID;
     }
 
-    MemoryInternal::g_moduleLookup.build(nativeHandle);
-
-    const auto mapsPath = std::format("/proc/{}/maps", nativeHandle);
-    std::ifstream mapsFile{mapsPath};
-    if (!mapsFile)
+    auto& regionMap = MemoryInternal::region_map();
+    if (regionMap.refresh(nativeHandle) != StatusCode::STATUS_OK)
     {
         *regions = nullptr;
         *size = 0;
         return StatusCode::STATUS_ERROR_PROCESS_INVALID;
     }
-
-    constexpr std::uint64_t MAX_REGION_SIZE = 32ULL * 1024 * 1024;
+    MemoryInternal::bad_read_pages().invalidate();
 
     std::vector<MemoryRegion> tempRegions{};
     tempRegions.reserve(2048);
 
-    MemoryRegion* lastRegion{};
-    std::optional<MapsEntry> lastEntry{};
-
-    std::string line{};
-    while (std::getline(mapsFile, line))
-    {
-        auto parsed = parse_maps_line(line);
-        if (!parsed)
+    regionMap.visit(
+        [&tempRegions](const std::vector<MapsEntry>& entries)
         {
-            continue;
-        }
-
-        auto& entry = *parsed;
+            MemoryInternal::g_moduleLookup.build(entries);
 
-        if (!entry.readable)
-        {
-            lastEntry = std::nullopt;
-            continue;
-        }
+            MemoryRegion* lastRegion{};
+            const MapsEntry* lastEntry{};
 
-        if (!matches_protection_filter(entry))
-        {
-            lastEntry = std::nullopt;
-            continue;
-        }
+            for (const auto& entry : entries)
+            {
+                if (!entry.readable)
+                {
+                    lastEntry = nullptr;
+                    continue;
+                }
 
-        const auto regionSize = entry.end - entry.start;
-        const char* moduleName = MemoryInternal::g_moduleLookup.find(entry.start);
+                if (!matches_protection_filter(entry))
+                {
+                    lastEntry = nullptr;
+                    continue;
+                }
 
-        if (!moduleName && entry.isFileBacked)
-        {
-            moduleName = MemoryInternal::g_moduleLookup.find(entry.start - entry.offset);
-        }
+                const auto regionSize = entry.end - entry.start;
+                const char* moduleName = MemoryInternal::g_moduleLookup.find(entry.start);
 
-        const bool canMerge = lastRegion != nullptr
-            && lastEntry.has_value()
-            && lastRegion->baseAddress + lastRegion->regionSize == entry.start
-            && lastRegion->regionSize + regionSize <= MAX_REGION_SIZE
-            && lastRegion->baseModuleName == moduleName
-            && lastEntry->same_permissions(entry);
+                if (!moduleName && entry.isFileBacked)
+                {
+                    moduleName = MemoryInternal::g_moduleLookup.find(entry.start - entry.offset);
+                }
 
-        if (canMerge)
-        {
-            lastRegion->regionSize += regionSize;
-        }
-        else
-        {
-            if (regionSize > MAX_REGION_SIZE)
-            {
-                std::uint64_t remainingSize = regionSize;
-                std::uint64_t currentBase = entry.start;
+                const bool canMerge = lastRegion != nullptr
+                    && lastEntry != nullptr
+                    && lastRegion->baseAddress + lastRegion->regionSize == entry.start
+                    && lastRegion->regionSize + regionSize <= MAX_REGION_SIZE
+                    && lastRegion->baseModuleName == moduleName
+                    && lastEntry->same_permissions(entry);
 
-                while (remainingSize > 0)
+                if (canMerge)
+                {
+                    lastRegion->regionSize += regionSize;
+                }
+                else
                 {
-                    const std::uint64_t chunkSize = std::min(remainingSize, MAX_REGION_SIZE);
-                    tempRegions.push_back({.baseModuleName = moduleName, .baseAddress = currentBase, .regionSize = chunkSize});
-                    currentBase += chunkSize;
-                    remainingSize -= chunkSize;
+                    if (regionSize > MAX_REGION_SIZE)
+                    {
+                        std::uint64_t remainingSize = regionSize;
+                        std::uint64_t currentBase = entry.start;
+
+                        while (remainingSize > 0)
+                        {
+                            const std::uint64_t chunkSize = std::min(remainingSize, MAX_REGION_SIZE);
+                            tempRegions.push_back({.baseModuleName = moduleName, .baseAddress = currentBase, .regionSize = chunkSize});
+                            currentBase += chunkSize;
+                            remainingSize -= chunkSize;
+                        }
+
+                        lastRegion = &tempRegions.back();
+                    }
+                    else
+                    {
+                        tempRegions.push_back({.baseModuleName = moduleName, .baseAddress = entry.start, .regionSize = regionSize});
+                        lastRegion = &tempRegions.back();
+                    }
                 }
 
-                lastRegion = &tempRegions.back();
-            }
-            else
-            {
-                tempRegions.push_back({.baseModuleName = moduleName, .baseAddress = entry.start, .regionSize = regionSize});
-                lastRegion = &tempRegions.back();
+                lastEntry = &entry;
             }
-        }
-
-        lastEntry = entry;
-    }
+        });
 
     if (tempRegions.empty())
     {
@@ -286,3 +190,50 @@ extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_query_regions(Memor
 
     return StatusCode::STATUS_OK;
 }
+
+extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_query_region_changes(const std::uint64_t sinceGeneration, RegionChange** changes,
+                                                                                    std::uint32_t* count, std::uint64_t* generation)
+{
+    if (!changes || !count || !generation)
+    {
+        return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+    }
+
+    *changes = nullptr;
+    *count = 0;
+
+    const auto& nativeHandle = get_native_handle();
+    if (nativeHandle == INVALID_HANDLE_VALUE)
+    {
+        return StatusCode::STATUS_ERROR_PROCESS_INVALID;
+    }
+
+    auto& regionMap = MemoryInternal::region_map();
+    const StatusCode status = regionMap.refresh(nativeHandle);
+    if (status != StatusCode::STATUS_OK)
+    {
+        return status;
+    }
+
+    thread_local std::vector<RegionChange> pending{};
+    regionMap.changes_since(sinceGeneration, pending, *generation);
+    if (pending.empty())
+    {
+        return StatusCode::STATUS_OK;
+    }
+
+    if (pending.size() > std::numeric_limits<std::uint32_t>::max())
+    {
+        return StatusCode::STATUS_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    *changes = static_cast<RegionChange*>(std::malloc(sizeof(RegionChange) * pending.size()));
+    if (*changes == nullptr)
+    {
+        return StatusCode::STATUS_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    std::copy_n(pending.data(), pending.size(), *changes);
+    *count = static_cast<std::uint32_t>(pending.size());
+    return StatusCode::STATUS_OK;
+}
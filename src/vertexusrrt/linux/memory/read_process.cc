@@ -3,12 +3,15 @@
 // Licensed under LGPLv3.0+
 //
 #include <vertexusrrt/native_handle.hh>
+#include <vertexusrrt/linux/bad_page_cache.hh>
 #include <sdk/api.h>
 
 #include <algorithm>
 #include <cerrno>
 #include <cstdint>
+#include <cstring>
 #include <limits>
+#include <optional>
 #include <vector>
 
 #include <sys/uio.h>
@@ -43,6 +46,172 @@ namespace
     {
         return (addr + PAGE_SIZE) & ~(PAGE_SIZE - 1);
     }
+
+    // A failed copy stops at the first bad byte on either side. Reading the remote page alone into our own
+    // memory tells a faulting target page apart from a bad caller buffer.
+    [[nodiscard]] bool remote_page_readable(const native_handle pid, const std::uint64_t address)
+    {
+        thread_local std::vector<char> probe(PAGE_SIZE);
+        const std::uint64_t page = MemoryInternal::BadPageCache::page_of(address);
+        const iovec localIov{.iov_base = probe.data(), .iov_len = static_cast<std::size_t>(PAGE_SIZE)};
+        const iovec remoteIov{.iov_base = reinterpret_cast<void*>(page), .iov_len = static_cast<std::size_t>(PAGE_SIZE)};
+        return process_vm_readv(pid, &localIov, 1, &remoteIov, 1, 0) == static_cast<ssize_t>(PAGE_SIZE);
+    }
+
+    // Consecutive requests that touch or overlap form one run and become a single remote iovec.
+    // Purely adjacent runs scatter straight into the request buffers; overlapping runs go through a
+    // scratch buffer and are copied out afterwards.
+    struct BulkReadRun final
+    {
+        std::size_t first{};
+        std::size_t last{};
+        std::uint64_t start{};
+        std::uint64_t end{};
+        bool overlapping{};
+        std::size_t scratchOffset{};
+    };
+
+    struct BulkReadBatch final
+    {
+        std::vector<BulkReadRun> runs{};
+        std::vector<iovec> localIovs{};
+        std::vector<iovec> remoteIovs{};
+        std::vector<char> scratch{};
+        std::size_t end{};
+
+        void build(const BulkReadRequest* requests, BulkReadResult* results, const std::size_t begin, const std::size_t count, const std::size_t maxIovecs,
+                   const MemoryInternal::BadPageCache& badPages)
+        {
+            runs.clear();
+            localIovs.clear();
+            remoteIovs.clear();
+
+            std::size_t accepted{};
+            std::size_t index = begin;
+            bool runOpen{};
+            for (; index < count && accepted < maxIovecs; ++index)
+            {
+                const auto& request = requests[index];
+                if (request.size == 0)
+                {
+                    results[index].status = StatusCode::STATUS_OK;
+                    runOpen = false;
+                    continue;
+                }
+
+                if (badPages.touches_bad_page(request.address, request.size))
+                {
+                    results[index].status = StatusCode::STATUS_ERROR_MEMORY_READ;
+                    runOpen = false;
+                    continue;
+                }
+
+                const std::uint64_t requestEnd = request.address + request.size;
+                if (runOpen && request.address >= runs.back().start && request.address <= runs.back().end)
+                {
+                    auto& run = runs.back();
+                    run.overlapping = run.overlapping || request.address < run.end;
+                    run.end = std::max(run.end, requestEnd);
+                    run.last = index;
+                }
+                else
+                {
+                    runs.push_back(BulkReadRun{.first = index, .last = index, .start = request.address, .end = requestEnd});
+                    runOpen = true;
+                }
+                ++accepted;
+            }
+            end = index;
+
+            std::size_t scratchSize{};
+            for (auto& run : runs)
+            {
+                if (run.overlapping)
+                {
+                    run.scratchOffset = scratchSize;
+                    scratchSize += static_cast<std::size_t>(run.end - run.start);
+                }
+            }
+            if (scratch.size() < scratchSize)
+            {
+                scratch.resize(scratchSize);
+            }
+
+            for (const auto& run : runs)
+            {
+                remoteIovs.push_back({.iov_base = reinterpret_cast<void*>(run.start), .iov_len = static_cast<std::size_t>(run.end - run.start)});
+                if (run.overlapping)
+                {
+                    localIovs.push_back({.iov_base = scratch.data() + run.scratchOffset, .iov_len = static_cast<std::size_t>(run.end - run.start)});
+                    continue;
+                }
+
+                for (std::size_t i = run.first; i <= run.last; ++i)
+                {
+                    if (requests[i].size != 0)
+                    {
+                        localIovs.push_back({.iov_base = requests[i].buffer, .iov_len = static_cast<std::size_t>(requests[i].size)});
+                    }
+                }
+            }
+        }
+
+        // Returns the first request that still needs a read, or nullopt when the whole batch is settled.
+        // Requests on the faulting page fail here, so the next call always starts past them whatever the
+        // shared cache holds by then.
+        [[nodiscard]] std::optional<std::size_t> settle(const native_handle pid, const BulkReadRequest* requests, BulkReadResult* results,
+                                                        const std::uint64_t transferred, MemoryInternal::BadPageCache& badPages) const
+        {
+            std::uint64_t consumed{};
+            for (const auto& run : runs)
+            {
+                const std::uint64_t runSize = run.end - run.start;
+                const bool complete = transferred >= consumed + runSize;
+                const std::uint64_t readEnd = complete ? run.end : run.start + (transferred - std::min(transferred, consumed));
+
+                const std::uint64_t badPage = MemoryInternal::BadPageCache::page_of(readEnd);
+                std::optional<std::size_t> firstPending{};
+                for (std::size_t i = run.first; i <= run.last; ++i)
+                {
+                    const auto& request = requests[i];
+                    if (request.size == 0)
+                    {
+                        continue;
+                    }
+
+                    if (request.address + request.size <= readEnd)
+                    {
+                        if (run.overlapping)
+                        {
+                            std::memcpy(request.buffer, scratch.data() + run.scratchOffset + (request.address - run.start), static_cast<std::size_t>(request.size));
+                        }
+                        results[i].status = StatusCode::STATUS_OK;
+                    }
+                    else if (!complete && request.address < badPage + PAGE_SIZE)
+                    {
+                        results[i].status = StatusCode::STATUS_ERROR_MEMORY_READ;
+                    }
+                    else if (!firstPending)
+                    {
+                        firstPending = i;
+                    }
+                }
+
+                if (!complete)
+                {
+                    if (!remote_page_readable(pid, readEnd))
+                    {
+                        badPages.add(readEnd);
+                    }
+                    return firstPending.value_or(run.last + 1);
+                }
+
+                consumed += runSize;
+            }
+
+            return std::nullopt;
+        }
+    };
 }
 
 extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_read_process(const std::uint64_t address, const std::uint64_t size, char* buffer)
@@ -142,48 +311,31 @@ extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_read_process_bulk(c
         }
     }
 
-    const std::size_t maxIovecs = get_iovec_limit();
-    std::vector<iovec> localIovs(maxIovecs);
-    std::vector<iovec> remoteIovs(maxIovecs);
-    std::size_t offset{};
-    while (offset < count)
-    {
-        while (offset < count && requests[offset].size == 0)
-        {
-            results[offset].status = StatusCode::STATUS_OK;
-            ++offset;
-        }
-
-        if (offset >= count)
-        {
-            break;
-        }
+    auto& badPages = MemoryInternal::bad_read_pages();
+    badPages.begin_batch(nativeHandle);
 
-        const std::size_t chunkCount = std::min(maxIovecs, static_cast<std::size_t>(count) - offset);
+    const std::size_t maxIovecs = get_iovec_limit();
+    thread_local BulkReadBatch batch{};
 
-        std::uint64_t expectedBytes{};
-        for (std::size_t i{}; i < chunkCount; ++i)
+    std::size_t next{};
+    while (next < count)
+    {
+        batch.build(requests, results, next, count, maxIovecs, badPages);
+        if (batch.runs.empty())
         {
-            const auto& request = requests[offset + i];
-            localIovs[i] = {
-                .iov_base = request.buffer,
-                .iov_len = static_cast<std::size_t>(request.size)
-            };
-            remoteIovs[i] = {
-                .iov_base = reinterpret_cast<void*>(request.address),
-                .iov_len = static_cast<std::size_t>(request.size)
-            };
-            expectedBytes += request.size;
+            next = batch.end;
+            continue;
         }
 
         const auto bytesRead = process_vm_readv(
             nativeHandle,
-            localIovs.data(),
-            static_cast<unsigned long>(chunkCount),
-            remoteIovs.data(),
-            static_cast<unsigned long>(chunkCount),
+            batch.localIovs.data(),
+            static_cast<unsigned long>(batch.localIovs.size()),
+            batch.remoteIovs.data(),
+            static_cast<unsigned long>(batch.remoteIovs.size()),
             0);
 
+        std::uint64_t transferred{};
         if (bytesRead < 0)
         {
             switch (errno)
@@ -192,52 +344,22 @@ extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_read_process_bulk(c
                     return StatusCode::STATUS_ERROR_PROCESS_INVALID;
                 case EFAULT:
                 case EIO:
-                    results[offset].status = StatusCode::STATUS_ERROR_MEMORY_READ;
-                    ++offset;
-                    continue;
+                    break;
                 case EINVAL:
                 case ENOMEM:
                 default:
                     return StatusCode::STATUS_ERROR_MEMORY_READ;
             }
         }
-
-        const std::uint64_t transferredBytes = static_cast<std::uint64_t>(bytesRead);
-        if (transferredBytes >= expectedBytes)
-        {
-            for (std::size_t i{}; i < chunkCount; ++i)
-            {
-                results[offset + i].status = StatusCode::STATUS_OK;
-            }
-            offset += chunkCount;
-            continue;
-        }
-
-        std::uint64_t accumulated{};
-        std::size_t processed{};
-        for (std::size_t i{}; i < chunkCount; ++i)
-        {
-            const auto entrySize = requests[offset + i].size;
-            if (accumulated + entrySize <= transferredBytes)
-            {
-                results[offset + i].status = StatusCode::STATUS_OK;
-                accumulated += entrySize;
-                ++processed;
-                continue;
-            }
-
-            results[offset + i].status = StatusCode::STATUS_ERROR_MEMORY_READ;
-            ++processed;
-            break;
-        }
-
-        if (processed == 0)
+        else
         {
-            results[offset].status = StatusCode::STATUS_ERROR_MEMORY_READ;
-            processed = 1;
+            transferred = static_cast<std::uint64_t>(bytesRead);
         }
 
-        offset += processed;
+        // The kernel copies page by page and stops at the first fault, so the transferred byte count
+        // pinpoints the bad page. Requests before it are complete, requests on it fail, the rest are retried.
+        const std::optional<std::size_t> resume = batch.settle(nativeHandle, requests, results, transferred, badPages);
+        next = resume.value_or(batch.end);
     }
 
     return StatusCode::STATUS_OK;
@@ -0,0 +1,444 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under LGPLv3.0+
+//
+#include <vertexusrrt/native_handle.hh>
+#include <sdk/api.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+extern native_handle& get_native_handle();
+
+namespace
+{
+    constexpr std::uint32_t MAX_QUEUE_DEPTH = 4096;
+    const std::uint64_t PAGE_SIZE = static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+
+    struct PendingRead final
+    {
+        AsyncReadRequest request{};
+        std::uint64_t done{};
+    };
+
+    // One io_uring per queue. When the kernel refuses io_uring (old kernel, seccomp, io_uring_disabled)
+    // the queue keeps the same contract and serves reads with pread at completion time.
+    class ReadQueue final
+    {
+    public:
+        ReadQueue() = default;
+        ReadQueue(const ReadQueue&) = delete;
+        ReadQueue& operator=(const ReadQueue&) = delete;
+
+        ~ReadQueue()
+        {
+            teardown_ring();
+            if (m_memFd != -1)
+            {
+                close(m_memFd);
+            }
+        }
+
+        [[nodiscard]] StatusCode open(const native_handle pid, const std::uint32_t depth)
+        {
+            const auto path = std::format("/proc/{}/mem", pid);
+            m_memFd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (m_memFd == -1)
+            {
+                return errno == EACCES || errno == EPERM ? StatusCode::STATUS_ERROR_PROCESS_ACCESS_DENIED : StatusCode::STATUS_ERROR_PROCESS_INVALID;
+            }
+
+            m_depth = depth;
+            m_fallback.reserve(depth);
+            if (!setup_ring(depth))
+            {
+                teardown_ring();
+            }
+            return StatusCode::STATUS_OK;
+        }
+
+        [[nodiscard]] StatusCode submit(const AsyncReadRequest* requests, const std::uint32_t count)
+        {
+            if (count > m_depth - m_inFlight)
+            {
+                return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+            }
+
+            for (std::uint32_t i{}; i < count; ++i)
+            {
+                if (requests[i].buffer == nullptr || requests[i].size == 0 || requests[i].size > std::numeric_limits<std::uint32_t>::max())
+                {
+                    return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+                }
+            }
+
+            if (m_ringFd == -1)
+            {
+                for (std::uint32_t i{}; i < count; ++i)
+                {
+                    m_fallback.push_back(PendingRead{.request = requests[i]});
+                }
+                m_inFlight += count;
+                return StatusCode::STATUS_OK;
+            }
+
+            std::uint32_t tail = *m_sqTail;
+            for (std::uint32_t i{}; i < count; ++i)
+            {
+                const std::uint32_t index = tail & *m_sqMask;
+                io_uring_sqe& sqe = m_sqes[index];
+                std::memset(&sqe, 0, sizeof(sqe));
+                sqe.opcode = IORING_OP_READ;
+                sqe.fd = m_memFd;
+                sqe.off = requests[i].address;
+                sqe.addr = reinterpret_cast<std::uint64_t>(requests[i].buffer);
+                sqe.len = static_cast<std::uint32_t>(requests[i].size);
+                sqe.user_data = reinterpret_cast<std::uint64_t>(track(requests[i]));
+                m_sqArray[index] = index;
+                ++tail;
+            }
+            std::atomic_ref(*m_sqTail).store(tail, std::memory_order_release);
+
+            std::uint32_t remaining = count;
+            while (remaining > 0)
+            {
+                const long submitted = syscall(__NR_io_uring_enter, m_ringFd, remaining, 0, 0, nullptr, 0);
+                if (submitted < 0)
+                {
+                    if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+                    {
+                        continue;
+                    }
+                    break;
+                }
+                remaining -= static_cast<std::uint32_t>(submitted);
+            }
+
+            m_inFlight += count;
+            if (remaining > 0)
+            {
+                withdraw_unsubmitted(tail);
+            }
+            return StatusCode::STATUS_OK;
+        }
+
+        [[nodiscard]] StatusCode complete(AsyncReadCompletion* completions, const std::uint32_t capacity, const bool wait, std::uint32_t& completed)
+        {
+            completed = 0;
+            if (m_inFlight == 0 || capacity == 0)
+            {
+                return StatusCode::STATUS_OK;
+            }
+
+            if (!m_fallback.empty())
+            {
+                const auto count = static_cast<std::uint32_t>(std::min<std::size_t>(capacity, m_fallback.size()));
+                for (std::uint32_t i{}; i < count; ++i)
+                {
+                    PendingRead& pending = m_fallback[i];
+                    completions[i] = {.userData = pending.request.userData, .status = finish_read(pending)};
+                }
+                m_fallback.erase(m_fallback.begin(), m_fallback.begin() + count);
+                m_inFlight -= count;
+                completed = count;
+            }
+
+            if (m_ringFd == -1 || completed == capacity || m_inFlight == 0)
+            {
+                return StatusCode::STATUS_OK;
+            }
+
+            std::uint32_t head = *m_cqHead;
+            if (wait && completed == 0 && head == std::atomic_ref(*m_cqTail).load(std::memory_order_acquire))
+            {
+                while (syscall(__NR_io_uring_enter, m_ringFd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0)
+                {
+                    if (errno != EINTR)
+                    {
+                        return StatusCode::STATUS_ERROR_MEMORY_READ;
+                    }
+                }
+            }
+
+            const std::uint32_t reapedBefore = completed;
+            const std::uint32_t tail = std::atomic_ref(*m_cqTail).load(std::memory_order_acquire);
+            while (head != tail && completed < capacity)
+            {
+                const io_uring_cqe& cqe = m_cqes[head & *m_cqMask];
+                auto* pending = reinterpret_cast<PendingRead*>(cqe.user_data);
+
+                // /proc/pid/mem stops at the first unmapped page; finish the rest page by page.
+                if (cqe.res > 0)
+                {
+                    pending->done = static_cast<std::uint64_t>(cqe.res);
+                }
+
+                const StatusCode status = pending->done == pending->request.size ? StatusCode::STATUS_OK : finish_read(*pending);
+                completions[completed++] = {.userData = pending->request.userData, .status = status};
+                release(pending);
+                ++head;
+            }
+            std::atomic_ref(*m_cqHead).store(head, std::memory_order_release);
+
+            m_inFlight -= completed - reapedBefore;
+            return StatusCode::STATUS_OK;
+        }
+
+        [[nodiscard]] std::uint32_t in_flight() const noexcept { return m_inFlight; }
+
+    private:
+        [[nodiscard]] bool setup_ring(const std::uint32_t depth)
+        {
+            io_uring_params params{};
+            const long ringFd = syscall(__NR_io_uring_setup, depth, &params);
+            if (ringFd < 0)
+            {
+                return false;
+            }
+            m_ringFd = static_cast<int>(ringFd);
+
+            m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(std::uint32_t);
+            m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            const bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (singleMmap)
+            {
+                m_sqRingSize = m_cqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+            }
+
+            m_sqRing = mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQ_RING);
+            if (m_sqRing == MAP_FAILED)
+            {
+                return false;
+            }
+
+            m_cqRing = singleMmap ? m_sqRing : mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_CQ_RING);
+            if (m_cqRing == MAP_FAILED)
+            {
+                return false;
+            }
+
+            m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+            m_sqes = static_cast<io_uring_sqe*>(mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQES));
+            if (m_sqes == MAP_FAILED)
+            {
+                return false;
+            }
+
+            auto* sqBase = static_cast<char*>(m_sqRing);
+            auto* cqBase = static_cast<char*>(m_cqRing);
+            m_sqHead = reinterpret_cast<std::uint32_t*>(sqBase + params.sq_off.head);
+            m_sqTail = reinterpret_cast<std::uint32_t*>(sqBase + params.sq_off.tail);
+            m_sqMask = reinterpret_cast<std::uint32_t*>(sqBase + params.sq_off.ring_mask);
+            m_sqArray = reinterpret_cast<std::uint32_t*>(sqBase + params.sq_off.array);
+            m_cqHead = reinterpret_cast<std::uint32_t*>(cqBase + params.cq_off.head);
+            m_cqTail = reinterpret_cast<std::uint32_t*>(cqBase + params.cq_off.tail);
+            m_cqMask = reinterpret_cast<std::uint32_t*>(cqBase + params.cq_off.ring_mask);
+            m_cqes = reinterpret_cast<io_uring_cqe*>(cqBase + params.cq_off.cqes);
+
+            m_slots.resize(depth);
+            m_freeSlots.reserve(depth);
+            for (auto& slot : m_slots)
+            {
+                m_freeSlots.push_back(&slot);
+            }
+            return true;
+        }
+
+        void teardown_ring() noexcept
+        {
+            if (m_sqes != nullptr && m_sqes != MAP_FAILED)
+            {
+                munmap(m_sqes, m_sqesSize);
+            }
+            if (m_cqRing != nullptr && m_cqRing != MAP_FAILED && m_cqRing != m_sqRing)
+            {
+                munmap(m_cqRing, m_cqRingSize);
+            }
+            if (m_sqRing != nullptr && m_sqRing != MAP_FAILED)
+            {
+                munmap(m_sqRing, m_sqRingSize);
+            }
+            if (m_ringFd != -1)
+            {
+                close(m_ringFd);
+            }
+
+            m_sqes = nullptr;
+            m_cqRing = nullptr;
+            m_sqRing = nullptr;
+            m_ringFd = -1;
+        }
+
+        [[nodiscard]] PendingRead* track(const AsyncReadRequest& request)
+        {
+            PendingRead* slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+            *slot = PendingRead{.request = request};
+            return slot;
+        }
+
+        void release(PendingRead* slot) { m_freeSlots.push_back(slot); }
+
+        // The kernel consumes SQEs in order, so everything between its head and our tail was never submitted.
+        // Those entries are taken back out of the ring and served with pread at completion time instead.
+        void withdraw_unsubmitted(const std::uint32_t tail)
+        {
+            const std::uint32_t head = std::atomic_ref(*m_sqHead).load(std::memory_order_acquire);
+            for (std::uint32_t index = head; index != tail; ++index)
+            {
+                auto* pending = reinterpret_cast<PendingRead*>(m_sqes[m_sqArray[index & *m_sqMask]].user_data);
+                m_fallback.push_back(*pending);
+                release(pending);
+            }
+            std::atomic_ref(*m_sqTail).store(head, std::memory_order_release);
+        }
+
+        // Mirrors vertex_memory_read_process: unreadable pages read as zero, the read only fails when nothing was readable.
+        [[nodiscard]] StatusCode finish_read(PendingRead& pending) const
+        {
+            auto* buffer = static_cast<char*>(pending.request.buffer);
+            const std::uint64_t size = pending.request.size;
+            bool anyRead = pending.done > 0;
+
+            while (pending.done < size)
+            {
+                const std::uint64_t address = pending.request.address + pending.done;
+                const ssize_t bytesRead = pread(m_memFd, buffer + pending.done, size - pending.done, static_cast<off_t>(address));
+                if (bytesRead > 0)
+                {
+                    pending.done += static_cast<std::uint64_t>(bytesRead);
+                    anyRead = true;
+                    continue;
+                }
+
+                if (bytesRead < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+
+                const std::uint64_t skip = std::min((address + PAGE_SIZE) / PAGE_SIZE * PAGE_SIZE - address, size - pending.done);
+                std::fill_n(buffer + pending.done, skip, 0);
+                pending.done += skip;
+            }
+
+            return anyRead ? StatusCode::STATUS_OK : StatusCode::STATUS_ERROR_MEMORY_READ;
+        }
+
+        int m_memFd{-1};
+        int m_ringFd{-1};
+        std::uint32_t m_depth{};
+        std::uint32_t m_inFlight{};
+
+        void* m_sqRing{};
+        void* m_cqRing{};
+        io_uring_sqe* m_sqes{};
+        std::size_t m_sqRingSize{};
+        std::size_t m_cqRingSize{};
+        std::size_t m_sqesSize{};
+        std::uint32_t* m_sqHead{};
+        std::uint32_t* m_sqTail{};
+        std::uint32_t* m_sqMask{};
+        std::uint32_t* m_sqArray{};
+        std::uint32_t* m_cqHead{};
+        std::uint32_t* m_cqTail{};
+        std::uint32_t* m_cqMask{};
+        io_uring_cqe* m_cqes{};
+
+        std::vector<PendingRead> m_slots{};
+        std::vector<PendingRead*> m_freeSlots{};
+        std::vector<PendingRead> m_fallback{};
+    };
+
+    [[nodiscard]] ReadQueue* from_handle(const std::uint64_t queue)
+    {
+        return reinterpret_cast<ReadQueue*>(queue);
+    }
+}
+
+extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_read_queue_create(const std::uint32_t depth, std::uint64_t* queue)
+{
+    if (queue == nullptr || depth == 0 || depth > MAX_QUEUE_DEPTH)
+    {
+        return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+    }
+
+    const auto& nativeHandle = get_native_handle();
+    if (nativeHandle == INVALID_HANDLE_VALUE)
+    {
+        return StatusCode::STATUS_ERROR_PROCESS_INVALID;
+    }
+
+    auto readQueue = std::unique_ptr<ReadQueue>(new (std::nothrow) ReadQueue());
+    if (!readQueue)
+    {
+        return StatusCode::STATUS_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    const StatusCode status = readQueue->open(nativeHandle, depth);
+    if (status != StatusCode::STATUS_OK)
+    {
+        return status;
+    }
+
+    *queue = reinterpret_cast<std::uint64_t>(readQueue.release());
+    return StatusCode::STATUS_OK;
+}
+
+extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_read_queue_submit(const std::uint64_t queue, const AsyncReadRequest* requests, const std::uint32_t count)
+{
+    if (queue == 0 || (requests == nullptr && count > 0))
+    {
+        return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+    }
+
+    return count == 0 ? StatusCode::STATUS_OK : from_handle(queue)->submit(requests, count);
+}
+
+extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_read_queue_complete(const std::uint64_t queue, AsyncReadCompletion* completions, const std::uint32_t capacity,
+                                                                                  const std::uint8_t wait, std::uint32_t* completed)
+{
+    if (queue == 0 || completions == nullptr || completed == nullptr)
+    {
+        return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+    }
+
+    return from_handle(queue)->complete(completions, capacity, wait != 0, *completed);
+}
+
+extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_read_queue_destroy(const std::uint64_t queue)
+{
+    if (queue == 0)
+    {
+        return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+    }
+
+    ReadQueue* readQueue = from_handle(queue);
+
+    // The kernel may still be writing into caller buffers; drain before tearing the ring down.
+    std::vector<AsyncReadCompletion> drained(readQueue->in_flight());
+    while (readQueue->in_flight() > 0)
+    {
+        std::uint32_t completed{};
+        if (readQueue->complete(drained.data(), static_cast<std::uint32_t>(drained.size()), true, completed) != StatusCode::STATUS_OK)
+        {
+            break;
+        }
+    }
+
+    delete readQueue;
+    return StatusCode::STATUS_OK;
+}
@@ -0,0 +1,302 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under LGPLv3.0+
+//
+#include <vertexusrrt/linux/region_map.hh>
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <format>
+#include <mutex>
+#include <optional>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace MemoryInternal
+{
+    namespace
+    {
+        constexpr std::size_t MAPS_READ_CHUNK = 256ULL * 1024;
+
+        [[nodiscard]] std::optional<MapsEntry> parse_maps_line(std::string_view sv)
+        {
+            MapsEntry entry{};
+
+            const auto dashPos = sv.find('-');
+            if (dashPos == std::string_view::npos)
+            {
+                return std::nullopt;
+            }
+
+            std::from_chars(sv.data(), sv.data() + dashPos, entry.start, 16);
+            sv.remove_prefix(dashPos + 1);
+
+            const auto spacePos = sv.find(' ');
+            if (spacePos == std::string_view::npos)
+            {
+                return std::nullopt;
+            }
+
+            std::from_chars(sv.data(), sv.data() + spacePos, entry.end, 16);
+            sv.remove_prefix(spacePos + 1);
+
+            if (sv.size() < 4)
+            {
+                return std::nullopt;
+            }
+
+            entry.readable = sv[0] == 'r';
+            entry.writable = sv[1] == 'w';
+            entry.executable = sv[2] == 'x';
+            entry.isPrivate = sv[3] == 'p';
+
+            const auto permsEnd = sv.find(' ');
+            if (permsEnd == std::string_view::npos)
+            {
+                return std::nullopt;
+            }
+            sv.remove_prefix(permsEnd + 1);
+
+            const auto offsetEnd = sv.find(' ');
+            if (offsetEnd == std::string_view::npos)
+            {
+                return std::nullopt;
+            }
+
+            std::from_chars(sv.data(), sv.data() + offsetEnd, entry.offset, 16);
+            sv.remove_prefix(offsetEnd + 1);
+
+            for (int i = 0; i < 2; ++i)
+            {
+                const auto nextSpace = sv.find(' ');
+                if (nextSpace == std::string_view::npos)
+                {
+                    return entry;
+                }
+                sv.remove_prefix(nextSpace + 1);
+                while (!sv.empty() && sv.front() == ' ')
+                {
+                    sv.remove_prefix(1);
+                }
+            }
+
+            if (!sv.empty() && sv.front() != '[')
+            {
+                entry.isFileBacked = true;
+                entry.path = std::string{sv};
+            }
+            entry.isAnonymous = sv.empty() || sv.starts_with("[heap]") || sv.starts_with("[stack") || sv.starts_with("[anon:");
+
+            return entry;
+        }
+
+        [[nodiscard]] StatusCode read_maps(const native_handle pid, std::string& text)
+        {
+            const auto path = std::format("/proc/{}/maps", pid);
+            const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd == -1)
+            {
+                return StatusCode::STATUS_ERROR_PROCESS_INVALID;
+            }
+
+            text.clear();
+            std::size_t used{};
+            while (true)
+            {
+                if (text.size() - used < MAPS_READ_CHUNK)
+                {
+                    text.resize(used + MAPS_READ_CHUNK);
+                }
+
+                const ssize_t bytesRead = read(fd, text.data() + used, text.size() - used);
+                if (bytesRead < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+                    close(fd);
+                    return StatusCode::STATUS_ERROR_PROCESS_INVALID;
+                }
+
+                if (bytesRead == 0)
+                {
+                    break;
+                }
+                used += static_cast<std::size_t>(bytesRead);
+            }
+
+            close(fd);
+            text.resize(used);
+            return StatusCode::STATUS_OK;
+        }
+    }
+
+    std::uint32_t MapsEntry::protection() const
+    {
+        std::uint32_t flags{};
+        flags |= readable ? VERTEX_REGION_READ : 0;
+        flags |= writable ? VERTEX_REGION_WRITE : 0;
+        flags |= executable ? VERTEX_REGION_EXECUTE : 0;
+        flags |= isPrivate ? VERTEX_REGION_PRIVATE : 0;
+        flags |= isFileBacked ? VERTEX_REGION_FILE_BACKED : 0;
+        return flags;
+    }
+
+    void parse_maps(std::string_view text, std::vector<MapsEntry>& entries)
+    {
+        while (!text.empty())
+        {
+            const auto lineEnd = text.find('\n');
+            const auto line = text.substr(0, lineEnd);
+            if (auto entry = parse_maps_line(line))
+            {
+                entries.push_back(std::move(*entry));
+            }
+
+            if (lineEnd == std::string_view::npos)
+            {
+                break;
+            }
+            text.remove_prefix(lineEnd + 1);
+        }
+    }
+
+    StatusCode RegionMap::refresh(const native_handle pid)
+    {
+        if (pid == INVALID_HANDLE_VALUE)
+        {
+            return StatusCode::STATUS_ERROR_PROCESS_INVALID;
+        }
+
+        thread_local std::string text{};
+        const StatusCode status = read_maps(pid, text);
+        if (status != StatusCode::STATUS_OK)
+        {
+            return status;
+        }
+
+        std::vector<MapsEntry> next{};
+        next.reserve(std::ranges::count(text, '\n'));
+        parse_maps(text, next);
+
+        std::unique_lock lock(m_mutex);
+        if (m_pid != pid)
+        {
+            m_history.clear();
+            m_entries.clear();
+            m_pid = pid;
+            m_historyFloor = ++m_generation;
+        }
+
+        diff_against(next);
+        m_entries = std::move(next);
+        return StatusCode::STATUS_OK;
+    }
+
+    bool RegionMap::tracks(const native_handle pid) const
+    {
+        std::shared_lock lock(m_mutex);
+        return m_pid == pid;
+    }
+
+    void RegionMap::reset()
+    {
+        std::unique_lock lock(m_mutex);
+        m_pid = INVALID_HANDLE_VALUE;
+        m_entries.clear();
+        m_history.clear();
+        m_historyFloor = ++m_generation;
+    }
+
+    void RegionMap::record(const MapsEntry& entry, const RegionChangeKind kind, const std::uint64_t generation)
+    {
+        if (m_history.size() >= MAX_CHANGE_HISTORY)
+        {
+            m_historyFloor = std::max(m_historyFloor, m_history.front().generation);
+            m_history.pop_front();
+        }
+
+        m_history.push_back(RecordedChange{
+            .generation = generation,
+            .change = {.baseAddress = entry.start, .regionSize = entry.end - entry.start, .kind = kind, .protection = entry.protection()}});
+    }
+
+    // Both lists are sorted by start address. A mapping that keeps its bounds but changes permissions is a
+    // protection change; anything else that differs is a removal of the old mapping and an addition of the new one.
+    void RegionMap::diff_against(const std::vector<MapsEntry>& next)
+    {
+        const std::uint64_t generation = m_generation + 1;
+        bool changed{};
+
+        std::size_t oldIndex{};
+        std::size_t newIndex{};
+        while (oldIndex < m_entries.size() || newIndex < next.size())
+        {
+            if (newIndex == next.size() || (oldIndex < m_entries.size() && m_entries[oldIndex].start < next[newIndex].start))
+            {
+                record(m_entries[oldIndex++], VERTEX_REGION_REMOVED, generation);
+                changed = true;
+                continue;
+            }
+
+            if (oldIndex == m_entries.size() || next[newIndex].start < m_entries[oldIndex].start)
+            {
+                record(next[newIndex++], VERTEX_REGION_ADDED, generation);
+                changed = true;
+                continue;
+            }
+
+            const auto& before = m_entries[oldIndex++];
+            const auto& after = next[newIndex++];
+            if (before.end != after.end || before.offset != after.offset || before.path != after.path)
+            {
+                record(before, VERTEX_REGION_REMOVED, generation);
+                record(after, VERTEX_REGION_ADDED, generation);
+                changed = true;
+            }
+            else if (before.protection() != after.protection())
+            {
+                record(after, VERTEX_REGION_PROTECTION_CHANGED, generation);
+                changed = true;
+            }
+        }
+
+        if (changed)
+        {
+            m_generation = generation;
+        }
+    }
+
+    void RegionMap::changes_since(const std::uint64_t generation, std::vector<RegionChange>& changes, std::uint64_t& current) const
+    {
+        std::shared_lock lock(m_mutex);
+        changes.clear();
+        current = m_generation;
+
+        if (generation < m_historyFloor || generation > m_generation)
+        {
+            changes.reserve(m_entries.size() + 1);
+            changes.push_back({.baseAddress = 0, .regionSize = 0, .kind = VERTEX_REGION_RESET, .protection = 0});
+            for (const auto& entry : m_entries)
+            {
+                changes.push_back({.baseAddress = entry.start, .regionSize = entry.end - entry.start, .kind = VERTEX_REGION_ADDED, .protection = entry.protection()});
+            }
+            return;
+        }
+
+        const auto first = std::ranges::upper_bound(m_history, generation, {}, &RecordedChange::generation);
+        for (auto it = first; it != m_history.end(); ++it)
+        {
+            changes.push_back(it->change);
+        }
+    }
+
+    RegionMap& region_map()
+    {
+        static RegionMap map{};
+        return map;
+    }
+}
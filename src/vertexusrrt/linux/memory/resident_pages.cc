@@ -0,0 +1,96 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under LGPLv3.0+
+//
+#include <vertexusrrt/linux/pagemap.hh>
+#include <vertexusrrt/linux/region_map.hh>
+#include <sdk/api.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+extern native_handle& get_native_handle();
+
+namespace
+{
+    // A never-touched page reads as zero only in a private anonymous mapping. Pages of file-backed and
+    // shared mappings hold file or page-cache contents the target simply has not faulted in yet, so they
+    // are always reported as resident. Pages outside any known mapping are reported too and left to the read.
+    void mark_backed_pages(const std::uint64_t address, const std::uint64_t size, std::uint8_t* bitmap)
+    {
+        const std::uint64_t granularity = Pagemap::page_size();
+        const std::uint64_t firstPage = address / granularity;
+        const std::uint64_t endPage = (address + size - 1) / granularity + 1;
+
+        const auto mark = [&](const std::uint64_t from, const std::uint64_t to)
+        {
+            for (auto page = from; page < to; ++page)
+            {
+                const std::uint64_t bit = page - firstPage;
+                bitmap[bit / 8] |= static_cast<std::uint8_t>(1U << (bit % 8));
+            }
+        };
+
+        std::uint64_t cursor = firstPage;
+        MemoryInternal::region_map().visit([&](const std::vector<MemoryInternal::MapsEntry>& entries)
+        {
+            auto it = std::ranges::upper_bound(entries, firstPage * granularity, {}, &MemoryInternal::MapsEntry::end);
+            for (; it != entries.end() && it->start < endPage * granularity; ++it)
+            {
+                if (!it->isPrivate || !it->isAnonymous)
+                {
+                    continue;
+                }
+
+                const auto anonymousFirst = std::max(firstPage, it->start / granularity);
+                const auto anonymousEnd = std::min(endPage, it->end / granularity);
+                if (anonymousFirst >= anonymousEnd)
+                {
+                    continue;
+                }
+
+                mark(cursor, anonymousFirst);
+                cursor = std::max(cursor, anonymousEnd);
+            }
+        });
+        mark(cursor, endPage);
+    }
+}
+
+extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_query_resident_pages(const std::uint64_t address, const std::uint64_t size, std::uint8_t* bitmap,
+                                                                                    const std::uint64_t bitmapSize, std::uint64_t* pageSize)
+{
+    if (pageSize == nullptr)
+    {
+        return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+    }
+
+    *pageSize = Pagemap::page_size();
+
+    if (bitmap == nullptr)
+    {
+        return StatusCode::STATUS_OK;
+    }
+
+    const auto& nativeHandle = get_native_handle();
+    if (nativeHandle == INVALID_HANDLE_VALUE)
+    {
+        return StatusCode::STATUS_ERROR_PROCESS_INVALID;
+    }
+
+    // Swapped-out pages still hold data, so only untouched pages of private anonymous mappings are reported as absent.
+    const StatusCode status = Pagemap::fill_bitmap(nativeHandle, address, size, Pagemap::ENTRY_PRESENT | Pagemap::ENTRY_SWAPPED, bitmap, bitmapSize);
+    if (status != StatusCode::STATUS_OK)
+    {
+        return status;
+    }
+
+    if (!MemoryInternal::region_map().tracks(nativeHandle) && MemoryInternal::region_map().refresh(nativeHandle) != StatusCode::STATUS_OK)
+    {
+        return StatusCode::STATUS_ERROR_PROCESS_INVALID;
+    }
+
+    mark_backed_pages(address, size, bitmap);
+    return StatusCode::STATUS_OK;
+}
@@ -3,14 +3,15 @@
 // Licensed under LGPLv3.0+
 //
 #include <vertexusrrt/native_handle.hh>
+#include <vertexusrrt/linux/proc_mem_file.hh>
 #include <sdk/api.h>
 
 #include <algorithm>
 #include <cerrno>
 #include <cstdint>
-#include <fstream>
 #include <limits>
-#include <string>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include <sys/uio.h>
@@ -20,6 +21,8 @@ extern native_handle& get_native_handle();
 
 namespace
 {
+    const std::uint64_t PAGE_SIZE = static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+
     [[nodiscard]] std::size_t get_iovec_limit()
     {
         long iovMax = sysconf(_SC_IOV_MAX);
@@ -38,6 +41,148 @@ namespace
             static_cast<long>(std::numeric_limits<std::uint32_t>::max()));
         return static_cast<std::size_t>(clamped);
     }
+
+    [[nodiscard]] std::uint64_t page_end(const std::uint64_t address)
+    {
+        return (address & ~(PAGE_SIZE - 1)) + PAGE_SIZE;
+    }
+
+    // Requests that continue exactly where the previous one ends form one run and become a single
+    // remote iovec. Overlapping requests are never merged so that later entries still win.
+    struct BulkWriteRun final
+    {
+        std::size_t first{};
+        std::size_t last{};
+        std::uint64_t start{};
+        std::uint64_t end{};
+    };
+
+    struct BulkWriteBatch final
+    {
+        std::vector<BulkWriteRun> runs{};
+        std::vector<iovec> localIovs{};
+        std::vector<iovec> remoteIovs{};
+        std::size_t end{};
+
+        void build(const BulkWriteRequest* requests, BulkWriteResult* results, const std::size_t begin, const std::size_t count, const std::size_t maxIovecs)
+        {
+            runs.clear();
+            localIovs.clear();
+            remoteIovs.clear();
+
+            std::size_t index = begin;
+            bool runOpen{};
+            for (; index < count && localIovs.size() < maxIovecs; ++index)
+            {
+                const auto& request = requests[index];
+                if (request.size == 0)
+                {
+                    results[index].status = StatusCode::STATUS_OK;
+                    runOpen = false;
+                    continue;
+                }
+
+                if (runOpen && request.address == runs.back().end)
+                {
+                    runs.back().end += request.size;
+                    runs.back().last = index;
+                }
+                else
+                {
+                    runs.push_back(BulkWriteRun{.first = index, .last = index, .start = request.address, .end = request.address + request.size});
+                    runOpen = true;
+                }
+                localIovs.push_back({.iov_base = const_cast<void*>(request.buffer), .iov_len = static_cast<std::size_t>(request.size)});
+            }
+            end = index;
+
+            for (const auto& run : runs)
+            {
+                remoteIovs.push_back({.iov_base = reinterpret_cast<void*>(run.start), .iov_len = static_cast<std::size_t>(run.end - run.start)});
+            }
+        }
+
+        // Marks every request the transfer fully covered. Returns the run that stopped short together with
+        // its first unwritten request, or nullopt when the whole batch landed.
+        [[nodiscard]] std::optional<std::pair<const BulkWriteRun*, std::size_t>> settle(const BulkWriteRequest* requests, BulkWriteResult* results,
+                                                                                        const std::uint64_t transferred) const
+        {
+            std::uint64_t consumed{};
+            for (const auto& run : runs)
+            {
+                for (std::size_t i = run.first; i <= run.last; ++i)
+                {
+                    if (consumed + requests[i].size > transferred)
+                    {
+                        return std::pair{&run, i};
+                    }
+                    consumed += requests[i].size;
+                    results[i].status = StatusCode::STATUS_OK;
+                }
+            }
+
+            return std::nullopt;
+        }
+    };
+
+    // Writes requests [from, last] of one run through /proc/pid/mem. A short write pinpoints the faulting
+    // page: the request containing it and every following request that starts on it fail, the rest of
+    // the run is written again from the next request.
+    [[nodiscard]] StatusCode write_run_through_mem(const native_handle pid, const BulkWriteRequest* requests, BulkWriteResult* results, std::size_t from,
+                                                   const std::size_t last, std::vector<iovec>& iovs)
+    {
+        auto& memFile = MemoryInternal::proc_mem_file();
+        while (from <= last)
+        {
+            iovs.clear();
+            for (std::size_t i = from; i <= last; ++i)
+            {
+                iovs.push_back({.iov_base = const_cast<void*>(requests[i].buffer), .iov_len = static_cast<std::size_t>(requests[i].size)});
+            }
+
+            ssize_t written = memFile.write(pid, iovs.data(), static_cast<int>(iovs.size()), requests[from].address);
+            if (written < 0)
+            {
+                switch (errno)
+                {
+                    case EINTR:
+                        continue;
+                    case ESRCH:
+                    case ENOENT:
+                        return StatusCode::STATUS_ERROR_PROCESS_INVALID;
+                    case EFAULT:
+                    case EIO:
+                        written = 0;
+                        break;
+                    default:
+                        for (std::size_t i = from; i <= last; ++i)
+                        {
+                            results[i].status = StatusCode::STATUS_ERROR_MEMORY_WRITE;
+                        }
+                        return StatusCode::STATUS_OK;
+                }
+            }
+
+            const std::uint64_t faultAddress = requests[from].address + static_cast<std::uint64_t>(written);
+            for (; from <= last && requests[from].address + requests[from].size <= faultAddress; ++from)
+            {
+                results[from].status = StatusCode::STATUS_OK;
+            }
+
+            if (from > last)
+            {
+                break;
+            }
+
+            results[from++].status = StatusCode::STATUS_ERROR_MEMORY_WRITE;
+            for (const std::uint64_t badPageEnd = page_end(faultAddress); from <= last && requests[from].address < badPageEnd; ++from)
+            {
+                results[from].status = StatusCode::STATUS_ERROR_MEMORY_WRITE;
+            }
+        }
+
+        return StatusCode::STATUS_OK;
+    }
 }
 
 extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_write_process(const std::uint64_t address, const std::uint64_t size, const char* buffer)
@@ -53,28 +198,38 @@ extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_write_process(const
         return StatusCode::STATUS_ERROR_PROCESS_INVALID;
     }
 
-    iovec localIov{.iov_base = const_cast<char*>(buffer), .iov_len = size};
-    iovec remoteIov{.iov_base = reinterpret_cast<void*>(address), .iov_len = size};
+    const iovec localIov{.iov_base = const_cast<char*>(buffer), .iov_len = size};
+    const iovec remoteIov{.iov_base = reinterpret_cast<void*>(address), .iov_len = size};
 
-    auto bytesWritten = process_vm_writev(nativeHandle, &localIov, 1, &remoteIov, 1, 0);
+    const auto bytesWritten = process_vm_writev(nativeHandle, &localIov, 1, &remoteIov, 1, 0);
 
-    if (bytesWritten == static_cast<ssize_t>(size))
+    if (bytesWritten == static_cast<ssize_t>(size)) [[likely]]
     {
         return StatusCode::STATUS_OK;
     }
 
-    const auto memPath = std::string{"/proc/"} + std::to_string(nativeHandle) + "/mem";
-    std::fstream memFile{memPath, std::ios::in | std::ios::out | std::ios::binary};
-
-    if (!memFile.is_open())
+    // process_vm_writev honours page protection; finish through /proc/pid/mem, which does not.
+    std::uint64_t offset = bytesWritten > 0 ? static_cast<std::uint64_t>(bytesWritten) : 0;
+    auto& memFile = MemoryInternal::proc_mem_file();
+    while (offset < size)
     {
-        return StatusCode::STATUS_ERROR_MEMORY_WRITE;
-    }
+        const iovec remaining{.iov_base = const_cast<char*>(buffer + offset), .iov_len = static_cast<std::size_t>(size - offset)};
+        const auto written = memFile.write(nativeHandle, &remaining, 1, address + offset);
+        if (written > 0)
+        {
+            offset += static_cast<std::uint64_t>(written);
+            continue;
+        }
 
-    memFile.seekp(static_cast<std::streamoff>(address));
-    memFile.write(buffer, static_cast<std::streamsize>(size));
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        return written < 0 && (errno == ESRCH || errno == ENOENT) ? StatusCode::STATUS_ERROR_PROCESS_INVALID : StatusCode::STATUS_ERROR_MEMORY_WRITE;
+    }
 
-    return memFile.good() ? StatusCode::STATUS_OK : StatusCode::STATUS_ERROR_MEMORY_WRITE;
+    return StatusCode::STATUS_OK;
 }
 
 extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_write_process_bulk(const BulkWriteRequest* requests,
@@ -111,101 +266,56 @@ extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_memory_write_process_bulk(
     }
 
     const std::size_t maxIovecs = get_iovec_limit();
-    std::vector<iovec> localIovs(maxIovecs);
-    std::vector<iovec> remoteIovs(maxIovecs);
-    std::size_t offset{};
-    while (offset < count)
-    {
-        while (offset < count && requests[offset].size == 0)
-        {
-            results[offset].status = StatusCode::STATUS_OK;
-            ++offset;
-        }
-
-        if (offset >= count)
-        {
-            break;
-        }
-
-        const std::size_t chunkCount = std::min(maxIovecs, static_cast<std::size_t>(count) - offset);
+    thread_local BulkWriteBatch batch{};
+    thread_local std::vector<iovec> fallbackIovs{};
 
-        std::uint64_t expectedBytes{};
-        for (std::size_t i{}; i < chunkCount; ++i)
+    std::size_t next{};
+    while (next < count)
+    {
+        batch.build(requests, results, next, count, maxIovecs);
+        if (batch.runs.empty())
         {
-            const auto& [address, size, buffer] = requests[offset + i];
-            localIovs[i] = {
-                .iov_base = const_cast<void*>(buffer),
-                .iov_len = static_cast<std::size_t>(size)
-            };
-            remoteIovs[i] = {
-                .iov_base = reinterpret_cast<void*>(address),
-                .iov_len = static_cast<std::size_t>(size)
-            };
-            expectedBytes += size;
+            next = batch.end;
+            continue;
         }
 
         const auto bytesWritten = process_vm_writev(
             nativeHandle,
-            localIovs.data(),
-            static_cast<unsigned long>(chunkCount),
-            remoteIovs.data(),
-            static_cast<unsigned long>(chunkCount),
+            batch.localIovs.data(),
+            static_cast<unsigned long>(batch.localIovs.size()),
+            batch.remoteIovs.data(),
+            static_cast<unsigned long>(batch.remoteIovs.size()),
             0);
 
+        std::uint64_t transferred{};
         if (bytesWritten < 0)
         {
-            switch (errno)
+            if (errno == ESRCH)
             {
-                case ESRCH:
-                    return StatusCode::STATUS_ERROR_PROCESS_INVALID;
-                case EFAULT:
-                case EIO:
-                    results[offset].status = StatusCode::STATUS_ERROR_MEMORY_WRITE;
-                    ++offset;
-                    continue;
-                case EINVAL:
-                case ENOMEM:
-                default:
-                    return StatusCode::STATUS_ERROR_MEMORY_WRITE;
+                return StatusCode::STATUS_ERROR_PROCESS_INVALID;
             }
         }
-
-        const auto transferredBytes = static_cast<std::uint64_t>(bytesWritten);
-        if (transferredBytes >= expectedBytes)
+        else
         {
-            for (std::size_t i{}; i < chunkCount; ++i)
-            {
-                results[offset + i].status = StatusCode::STATUS_OK;
-            }
-            offset += chunkCount;
-            continue;
+            transferred = static_cast<std::uint64_t>(bytesWritten);
         }
 
-        std::uint64_t accumulated{};
-        std::size_t processed{};
-        for (std::size_t i{}; i < chunkCount; ++i)
+        // The kernel stops at the first page it cannot write, typically a read-only code page. Everything
+        // before it landed; the stalled run is finished through /proc/pid/mem and the batch resumes after it.
+        const auto stalled = batch.settle(requests, results, transferred);
+        if (!stalled)
         {
-            const auto entrySize = requests[offset + i].size;
-            if (accumulated + entrySize <= transferredBytes)
-            {
-                results[offset + i].status = StatusCode::STATUS_OK;
-                accumulated += entrySize;
-                ++processed;
-                continue;
-            }
-
-            results[offset + i].status = StatusCode::STATUS_ERROR_MEMORY_WRITE;
-            ++processed;
-            break;
+            next = batch.end;
+            continue;
         }
 
-        if (processed == 0)
+        const auto [run, from] = *stalled;
+        const StatusCode status = write_run_through_mem(nativeHandle, requests, results, from, run->last, fallbackIovs);
+        if (status != StatusCode::STATUS_OK)
         {
-            results[offset].status = StatusCode::STATUS_ERROR_MEMORY_WRITE;
-            processed = 1;
+            return status;
         }
-
-        offset += processed;
+        next = run->last + 1;
     }
 
     return StatusCode::STATUS_OK;
@@ -0,0 +1,790 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under LGPLv3.0+
+//
+#include <vertexusrrt/linux/elf_symbols.hh>
+#include <vertexusrrt/linux/region_map.hh>
+
+#include <elf.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+    constexpr std::array<char, 8> CACHE_MAGIC{'V', 'X', 'S', 'Y', 'M', '\0', '\0', '\1'};
+    constexpr std::size_t MAX_CACHE_FILE_SIZE = 256ULL * 1024 * 1024;
+
+    struct Elf64Types final
+    {
+        using Ehdr = Elf64_Ehdr;
+        using Phdr = Elf64_Phdr;
+        using Shdr = Elf64_Shdr;
+        using Sym = Elf64_Sym;
+        using Dyn = Elf64_Dyn;
+        using Rel = Elf64_Rel;
+        using Rela = Elf64_Rela;
+
+        [[nodiscard]] static std::uint32_t rel_sym(const std::uint64_t info) { return ELF64_R_SYM(info); }
+    };
+
+    struct Elf32Types final
+    {
+        using Ehdr = Elf32_Ehdr;
+        using Phdr = Elf32_Phdr;
+        using Shdr = Elf32_Shdr;
+        using Sym = Elf32_Sym;
+        using Dyn = Elf32_Dyn;
+        using Rel = Elf32_Rel;
+        using Rela = Elf32_Rela;
+
+        [[nodiscard]] static std::uint32_t rel_sym(const std::uint64_t info) { return ELF32_R_SYM(info); }
+    };
+
+    class MappedFile final
+    {
+    public:
+        MappedFile() = default;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        ~MappedFile()
+        {
+            if (m_data != nullptr)
+            {
+                munmap(m_data, m_size);
+            }
+        }
+
+        [[nodiscard]] bool map(const int fd)
+        {
+            struct stat st{};
+            if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size < static_cast<off_t>(EI_NIDENT))
+            {
+                return false;
+            }
+
+            m_size = static_cast<std::size_t>(st.st_size);
+            void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                m_size = 0;
+                return false;
+            }
+
+            m_data = data;
+            return true;
+        }
+
+        [[nodiscard]] std::span<const std::byte> bytes() const
+        {
+            return {static_cast<const std::byte*>(m_data), m_size};
+        }
+
+    private:
+        void* m_data{};
+        std::size_t m_size{};
+    };
+
+    template <class T>
+    [[nodiscard]] bool read_at(const std::span<const std::byte> file, const std::uint64_t offset, T& out)
+    {
+        if (offset > file.size() || file.size() - offset < sizeof(T))
+        {
+            return false;
+        }
+        std::memcpy(&out, file.data() + offset, sizeof(T));
+        return true;
+    }
+
+    [[nodiscard]] std::string_view string_at(const std::span<const std::byte> file, const std::uint64_t tableOffset,
+                                             const std::uint64_t tableSize, const std::uint64_t nameOffset)
+    {
+        if (nameOffset >= tableSize || tableOffset > file.size() || tableSize > file.size() - tableOffset)
+        {
+            return {};
+        }
+
+        const auto* begin = reinterpret_cast<const char*>(file.data() + tableOffset + nameOffset);
+        const std::size_t remaining = static_cast<std::size_t>(tableSize - nameOffset);
+        return {begin, strnlen(begin, remaining)};
+    }
+
+    [[nodiscard]] std::string hex_string(const std::span<const std::byte> bytes)
+    {
+        static constexpr char DIGITS[] = "0123456789abcdef";
+        std::string out(bytes.size() * 2, '\0');
+        for (std::size_t i{}; i < bytes.size(); ++i)
+        {
+            const auto value = std::to_integer<unsigned>(bytes[i]);
+            out[i * 2] = DIGITS[value >> 4];
+            out[i * 2 + 1] = DIGITS[value & 0xF];
+        }
+        return out;
+    }
+
+    [[nodiscard]] std::string find_build_id_in_notes(const std::span<const std::byte> file, const std::uint64_t offset,
+                                                     const std::uint64_t size, const std::uint64_t alignment)
+    {
+        const std::uint64_t align = std::max<std::uint64_t>(alignment, 4);
+        const auto align_up = [align](const std::uint64_t value) { return (value + align - 1) & ~(align - 1); };
+
+        std::uint64_t cursor = offset;
+        const std::uint64_t end = offset + size;
+        while (cursor + sizeof(Elf64_Nhdr) <= end)
+        {
+            Elf64_Nhdr note{};
+            if (!read_at(file, cursor, note))
+            {
+                break;
+            }
+
+            const std::uint64_t nameOffset = cursor + sizeof(Elf64_Nhdr);
+            const std::uint64_t descOffset = nameOffset + align_up(note.n_namesz);
+            const std::uint64_t next = descOffset + align_up(note.n_descsz);
+            if (next > end || next > file.size())
+            {
+                break;
+            }
+
+            if (note.n_type == NT_GNU_BUILD_ID && note.n_namesz == 4 && note.n_descsz != 0
+                && std::memcmp(file.data() + nameOffset, "GNU", 4) == 0)
+            {
+                return hex_string(file.subspan(descOffset, note.n_descsz));
+            }
+
+            cursor = next;
+        }
+
+        return {};
+    }
+
+    template <class Types>
+    class ElfParser final
+    {
+    public:
+        explicit ElfParser(const std::span<const std::byte> file)
+            : m_file{file}
+        {
+        }
+
+        [[nodiscard]] bool parse_headers()
+        {
+            if (!read_at(m_file, 0, m_ehdr))
+            {
+                return false;
+            }
+
+            for (std::uint16_t i{}; i < m_ehdr.e_phnum; ++i)
+            {
+                typename Types::Phdr phdr{};
+                if (read_at(m_file, m_ehdr.e_phoff + static_cast<std::uint64_t>(i) * m_ehdr.e_phentsize, phdr))
+                {
+                    m_phdrs.push_back(phdr);
+                }
+            }
+
+            if (m_ehdr.e_shentsize == sizeof(typename Types::Shdr))
+            {
+                for (std::uint16_t i{}; i < m_ehdr.e_shnum; ++i)
+                {
+                    typename Types::Shdr shdr{};
+                    if (!read_at(m_file, m_ehdr.e_shoff + static_cast<std::uint64_t>(i) * sizeof(shdr), shdr))
+                    {
+                        m_shdrs.clear();
+                        break;
+                    }
+                    m_shdrs.push_back(shdr);
+                }
+            }
+
+            return true;
+        }
+
+        [[nodiscard]] std::string build_id() const
+        {
+            for (const auto& shdr : m_shdrs)
+            {
+                if (shdr.sh_type == SHT_NOTE)
+                {
+                    if (auto id = find_build_id_in_notes(m_file, shdr.sh_offset, shdr.sh_size, shdr.sh_addralign); !id.empty())
+                    {
+                        return id;
+                    }
+                }
+            }
+
+            for (const auto& phdr : m_phdrs)
+            {
+                if (phdr.p_type == PT_NOTE)
+                {
+                    if (auto id = find_build_id_in_notes(m_file, phdr.p_offset, phdr.p_filesz, phdr.p_align); !id.empty())
+                    {
+                        return id;
+                    }
+                }
+            }
+
+            return {};
+        }
+
+        void collect_symbols(ProcessInternal::ElfModuleSymbols& out) const
+        {
+            for (const auto& shdr : m_shdrs)
+            {
+                if ((shdr.sh_type != SHT_SYMTAB && shdr.sh_type != SHT_DYNSYM) || shdr.sh_link >= m_shdrs.size())
+                {
+                    continue;
+                }
+
+                const auto& strtab = m_shdrs[shdr.sh_link];
+                const std::uint64_t entrySize = shdr.sh_entsize != 0 ? shdr.sh_entsize : sizeof(typename Types::Sym);
+                const std::uint64_t symbolCount = shdr.sh_size / entrySize;
+
+                for (std::uint64_t i = 1; i < symbolCount; ++i)
+                {
+                    typename Types::Sym sym{};
+                    if (!read_at(m_file, shdr.sh_offset + i * entrySize, sym))
+                    {
+                        break;
+                    }
+
+                    const auto name = string_at(m_file, strtab.sh_offset, strtab.sh_size, sym.st_name);
+                    if (name.empty())
+                    {
+                        continue;
+                    }
+
+                    out.symbols.push_back({
+                        .name = std::string{name},
+                        .value = sym.st_value,
+                        .size = sym.st_size,
+                        .index = static_cast<std::uint32_t>(i),
+                        .sectionIndex = sym.st_shndx,
+                        .type = static_cast<std::uint8_t>(ELF64_ST_TYPE(sym.st_info)),
+                        .bind = static_cast<std::uint8_t>(ELF64_ST_BIND(sym.st_info)),
+                        .visibility = static_cast<std::uint8_t>(ELF64_ST_VISIBILITY(sym.st_other)),
+                        .dynamic = shdr.sh_type == SHT_DYNSYM,
+                    });
+                }
+            }
+        }
+
+        void collect_dynamic(ProcessInternal::ElfModuleSymbols& out) const
+        {
+            const auto dynamic = std::ranges::find_if(m_phdrs, [](const auto& phdr) { return phdr.p_type == PT_DYNAMIC; });
+            if (dynamic == m_phdrs.end())
+            {
+                return;
+            }
+
+            std::uint64_t strTab{}, strSize{}, symTab{}, symEnt{sizeof(typename Types::Sym)};
+            std::uint64_t jmpRel{}, pltRelSize{}, pltRel{DT_REL};
+            std::vector<std::uint64_t> needed{};
+
+            const std::uint64_t dynCount = dynamic->p_filesz / sizeof(typename Types::Dyn);
+            for (std::uint64_t i{}; i < dynCount; ++i)
+            {
+                typename Types::Dyn dyn{};
+                if (!read_at(m_file, dynamic->p_offset + i * sizeof(dyn), dyn) || dyn.d_tag == DT_NULL)
+                {
+                    break;
+                }
+
+                const std::uint64_t value = dyn.d_un.d_val;
+                switch (dyn.d_tag)
+                {
+                    case DT_NEEDED: needed.push_back(value); break;
+                    case DT_STRTAB: strTab = value; break;
+                    case DT_STRSZ: strSize = value; break;
+                    case DT_SYMTAB: symTab = value; break;
+                    case DT_SYMENT: symEnt = value; break;
+                    case DT_JMPREL: jmpRel = value; break;
+                    case DT_PLTRELSZ: pltRelSize = value; break;
+                    case DT_PLTREL: pltRel = value; break;
+                    default: break;
+                }
+            }
+
+            const auto strTabOffset = file_offset(strTab);
+            if (!strTabOffset)
+            {
+                return;
+            }
+
+            for (const std::uint64_t nameOffset : needed)
+            {
+                if (const auto name = string_at(m_file, *strTabOffset, strSize, nameOffset); !name.empty())
+                {
+                    out.neededLibraries.emplace_back(name);
+                }
+            }
+
+            const auto symTabOffset = file_offset(symTab);
+            const auto relOffset = file_offset(jmpRel);
+            if (!symTabOffset || !relOffset || symEnt == 0)
+            {
+                return;
+            }
+
+            const std::uint64_t relSize = pltRel == DT_RELA ? sizeof(typename Types::Rela) : sizeof(typename Types::Rel);
+            for (std::uint64_t i{}; i < pltRelSize / relSize; ++i)
+            {
+                typename Types::Rel rel{};
+                if (!read_at(m_file, *relOffset + i * relSize, rel))
+                {
+                    break;
+                }
+
+                const std::uint32_t symIndex = Types::rel_sym(rel.r_info);
+                typename Types::Sym sym{};
+                if (symIndex == 0 || !read_at(m_file, *symTabOffset + symIndex * symEnt, sym) || sym.st_shndx != SHN_UNDEF)
+                {
+                    continue;
+                }
+
+                const auto name = string_at(m_file, *strTabOffset, strSize, sym.st_name);
+                if (name.empty())
+                {
+                    continue;
+                }
+
+                out.imports.push_back({
+                    .name = std::string{name},
+                    .offset = rel.r_offset,
+                    .symbolIndex = symIndex,
+                    .type = static_cast<std::uint8_t>(ELF64_ST_TYPE(sym.st_info)),
+                });
+            }
+        }
+
+    private:
+        [[nodiscard]] std::optional<std::uint64_t> file_offset(const std::uint64_t vaddr) const
+        {
+            if (vaddr == 0)
+            {
+                return std::nullopt;
+            }
+
+            for (const auto& phdr : m_phdrs)
+            {
+                if (phdr.p_type == PT_LOAD && vaddr >= phdr.p_vaddr && vaddr - phdr.p_vaddr < phdr.p_filesz)
+                {
+                    return phdr.p_offset + (vaddr - phdr.p_vaddr);
+                }
+            }
+            return std::nullopt;
+        }
+
+        std::span<const std::byte> m_file{};
+        typename Types::Ehdr m_ehdr{};
+        std::vector<typename Types::Phdr> m_phdrs{};
+        std::vector<typename Types::Shdr> m_shdrs{};
+    };
+
+    class CacheWriter final
+    {
+    public:
+        template <class T>
+        void put(const T value)
+        {
+            m_buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        void put(const std::string_view text)
+        {
+            put(static_cast<std::uint32_t>(text.size()));
+            m_buffer.append(text);
+        }
+
+        [[nodiscard]] const std::string& buffer() const { return m_buffer; }
+
+    private:
+        std::string m_buffer{};
+    };
+
+    class CacheReader final
+    {
+    public:
+        explicit CacheReader(const std::string_view data)
+            : m_data{data}
+        {
+        }
+
+        template <class T>
+        [[nodiscard]] bool get(T& value)
+        {
+            if (m_data.size() - m_cursor < sizeof(T))
+            {
+                return false;
+            }
+            std::memcpy(&value, m_data.data() + m_cursor, sizeof(T));
+            m_cursor += sizeof(T);
+            return true;
+        }
+
+        [[nodiscard]] bool get(std::string& text)
+        {
+            std::uint32_t length{};
+            if (!get(length) || m_data.size() - m_cursor < length)
+            {
+                return false;
+            }
+            text.assign(m_data.substr(m_cursor, length));
+            m_cursor += length;
+            return true;
+        }
+
+        [[nodiscard]] bool at_end() const { return m_cursor == m_data.size(); }
+
+    private:
+        std::string_view m_data{};
+        std::size_t m_cursor{};
+    };
+
+    [[nodiscard]] std::string cache_directory()
+    {
+        if (const char* xdg = std::getenv("XDG_CACHE_HOME"); xdg != nullptr && *xdg == '/')
+        {
+            return std::format("{}/vertex/symbols", xdg);
+        }
+        if (const char* home = std::getenv("HOME"); home != nullptr && *home == '/')
+        {
+            return std::format("{}/.cache/vertex/symbols", home);
+        }
+        return {};
+    }
+
+    [[nodiscard]] bool make_directories(const std::string& path)
+    {
+        for (std::size_t slash = path.find('/', 1);; slash = path.find('/', slash + 1))
+        {
+            const std::string prefix = path.substr(0, slash);
+            if (mkdir(prefix.c_str(), 0755) != 0 && errno != EEXIST)
+            {
+                return false;
+            }
+            if (slash == std::string::npos)
+            {
+                return true;
+            }
+        }
+    }
+
+    [[nodiscard]] std::string serialize(const ProcessInternal::ElfModuleSymbols& symbols)
+    {
+        CacheWriter writer{};
+        for (const char c : CACHE_MAGIC)
+        {
+            writer.put(c);
+        }
+        writer.put(std::string_view{symbols.buildId});
+        writer.put(static_cast<std::uint32_t>(symbols.symbols.size()));
+        writer.put(static_cast<std::uint32_t>(symbols.imports.size()));
+        writer.put(static_cast<std::uint32_t>(symbols.neededLibraries.size()));
+
+        for (const auto& symbol : symbols.symbols)
+        {
+            writer.put(std::string_view{symbol.name});
+            writer.put(symbol.value);
+            writer.put(symbol.size);
+            writer.put(symbol.index);
+            writer.put(symbol.sectionIndex);
+            writer.put(symbol.type);
+            writer.put(symbol.bind);
+            writer.put(symbol.visibility);
+            writer.put(static_cast<std::uint8_t>(symbol.dynamic));
+        }
+        for (const auto& import : symbols.imports)
+        {
+            writer.put(std::string_view{import.name});
+            writer.put(import.offset);
+            writer.put(import.symbolIndex);
+            writer.put(import.type);
+        }
+        for (const auto& library : symbols.neededLibraries)
+        {
+            writer.put(std::string_view{library});
+        }
+
+        return writer.buffer();
+    }
+
+    [[nodiscard]] std::optional<ProcessInternal::ElfModuleSymbols> deserialize(const std::string_view data, const std::string_view buildId)
+    {
+        CacheReader reader{data};
+        std::array<char, CACHE_MAGIC.size()> magic{};
+        for (char& c : magic)
+        {
+            if (!reader.get(c))
+            {
+                return std::nullopt;
+            }
+        }
+
+        ProcessInternal::ElfModuleSymbols symbols{};
+        std::uint32_t symbolCount{}, importCount{}, neededCount{};
+        if (magic != CACHE_MAGIC || !reader.get(symbols.buildId) || symbols.buildId != buildId
+            || !reader.get(symbolCount) || !reader.get(importCount) || !reader.get(neededCount))
+        {
+            return std::nullopt;
+        }
+
+        if (static_cast<std::uint64_t>(symbolCount) + importCount + neededCount > data.size())
+        {
+            return std::nullopt;
+        }
+
+        symbols.symbols.resize(symbolCount);
+        for (auto& symbol : symbols.symbols)
+        {
+            std::uint8_t dynamic{};
+            if (!reader.get(symbol.name) || !reader.get(symbol.value) || !reader.get(symbol.size) || !reader.get(symbol.index)
+                || !reader.get(symbol.sectionIndex) || !reader.get(symbol.type) || !reader.get(symbol.bind)
+                || !reader.get(symbol.visibility) || !reader.get(dynamic))
+            {
+                return std::nullopt;
+            }
+            symbol.dynamic = dynamic != 0;
+        }
+
+        symbols.imports.resize(importCount);
+        for (auto& import : symbols.imports)
+        {
+            if (!reader.get(import.name) || !reader.get(import.offset) || !reader.get(import.symbolIndex) || !reader.get(import.type))
+            {
+                return std::nullopt;
+            }
+        }
+
+        symbols.neededLibraries.resize(neededCount);
+        for (auto& library : symbols.neededLibraries)
+        {
+            if (!reader.get(library))
+            {
+                return std::nullopt;
+            }
+        }
+
+        if (!reader.at_end())
+        {
+            return std::nullopt;
+        }
+        return symbols;
+    }
+
+    [[nodiscard]] std::optional<ProcessInternal::ElfModuleSymbols> load_from_disk(const std::string& buildId)
+    {
+        const std::string directory = cache_directory();
+        if (directory.empty())
+        {
+            return std::nullopt;
+        }
+
+        const std::string path = std::format("{}/{}.sym", directory, buildId);
+        const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1)
+        {
+            return std::nullopt;
+        }
+
+        MappedFile mapped{};
+        const bool ok = mapped.map(fd);
+        close(fd);
+        if (!ok || mapped.bytes().size() > MAX_CACHE_FILE_SIZE)
+        {
+            return std::nullopt;
+        }
+
+        const auto bytes = mapped.bytes();
+        return deserialize({reinterpret_cast<const char*>(bytes.data()), bytes.size()}, buildId);
+    }
+
+    void store_to_disk(const ProcessInternal::ElfModuleSymbols& symbols)
+    {
+        const std::string directory = cache_directory();
+        if (directory.empty() || !make_directories(directory))
+        {
+            return;
+        }
+
+        const std::string data = serialize(symbols);
+        const std::string path = std::format("{}/{}.sym", directory, symbols.buildId);
+        const std::string temporary = std::format("{}.{}.tmp", path, getpid());
+
+        const int fd = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd == -1)
+        {
+            return;
+        }
+
+        std::size_t done{};
+        while (done < data.size())
+        {
+            const ssize_t written = write(fd, data.data() + done, data.size() - done);
+            if (written < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (written <= 0)
+            {
+                break;
+            }
+            done += static_cast<std::size_t>(written);
+        }
+        close(fd);
+
+        if (done != data.size() || rename(temporary.c_str(), path.c_str()) != 0)
+        {
+            unlink(temporary.c_str());
+        }
+    }
+
+    [[nodiscard]] int open_module_file(const native_handle pid, const ModuleInformation& module)
+    {
+        const std::string_view modulePath{module.modulePath};
+        std::optional<std::string> mapFile{};
+
+        auto& regions = MemoryInternal::region_map();
+        if (regions.refresh(pid) == StatusCode::STATUS_OK)
+        {
+            regions.visit([&](const std::vector<MemoryInternal::MapsEntry>& entries)
+            {
+                const MemoryInternal::MapsEntry* match{};
+                for (const auto& entry : entries)
+                {
+                    if (!entry.isFileBacked || entry.path != modulePath)
+                    {
+                        continue;
+                    }
+                    if (match == nullptr || entry.start == module.baseAddress)
+                    {
+                        match = &entry;
+                    }
+                }
+                if (match != nullptr)
+                {
+                    mapFile = std::format("/proc/{}/map_files/{:x}-{:x}", pid, match->start, match->end);
+                }
+            });
+        }
+
+        if (mapFile)
+        {
+            if (const int fd = open(mapFile->c_str(), O_RDONLY | O_CLOEXEC); fd != -1)
+            {
+                return fd;
+            }
+        }
+
+        if (modulePath.empty() || modulePath.front() != '/')
+        {
+            return -1;
+        }
+
+        const std::string rootPath = std::format("/proc/{}/root{}", pid, modulePath);
+        if (const int fd = open(rootPath.c_str(), O_RDONLY | O_CLOEXEC); fd != -1)
+        {
+            return fd;
+        }
+        return open(module.modulePath, O_RDONLY | O_CLOEXEC);
+    }
+
+    struct SymbolCache final
+    {
+        std::mutex mutex{};
+        std::unordered_map<std::string, std::shared_ptr<const ProcessInternal::ElfModuleSymbols>> byBuildId{};
+    };
+
+    SymbolCache& symbol_cache()
+    {
+        static SymbolCache cache{};
+        return cache;
+    }
+
+    template <class Types>
+    [[nodiscard]] std::shared_ptr<const ProcessInternal::ElfModuleSymbols> load_from_image(const std::span<const std::byte> file)
+    {
+        ElfParser<Types> parser{file};
+        if (!parser.parse_headers())
+        {
+            return nullptr;
+        }
+
+        auto& cache = symbol_cache();
+        const std::string buildId = parser.build_id();
+        if (!buildId.empty())
+        {
+            {
+                std::scoped_lock lock{cache.mutex};
+                if (const auto it = cache.byBuildId.find(buildId); it != cache.byBuildId.end())
+                {
+                    return it->second;
+                }
+            }
+
+            if (auto stored = load_from_disk(buildId))
+            {
+                auto symbols = std::make_shared<const ProcessInternal::ElfModuleSymbols>(std::move(*stored));
+                std::scoped_lock lock{cache.mutex};
+                return cache.byBuildId.try_emplace(buildId, std::move(symbols)).first->second;
+            }
+        }
+
+        ProcessInternal::ElfModuleSymbols parsed{.buildId = buildId};
+        parser.collect_symbols(parsed);
+        parser.collect_dynamic(parsed);
+
+        auto symbols = std::make_shared<const ProcessInternal::ElfModuleSymbols>(std::move(parsed));
+        if (buildId.empty())
+        {
+            return symbols;
+        }
+
+        store_to_disk(*symbols);
+        std::scoped_lock lock{cache.mutex};
+        return cache.byBuildId.try_emplace(buildId, std::move(symbols)).first->second;
+    }
+}
+
+namespace ProcessInternal
+{
+    std::shared_ptr<const ElfModuleSymbols> load_elf_symbols(const native_handle pid, const ModuleInformation& module)
+    {
+        const int fd = open_module_file(pid, module);
+        if (fd == -1)
+        {
+            return nullptr;
+        }
+
+        MappedFile mapped{};
+        const bool ok = mapped.map(fd);
+        close(fd);
+        if (!ok)
+        {
+            return nullptr;
+        }
+
+        const auto file = mapped.bytes();
+        if (std::memcmp(file.data(), ELFMAG, SELFMAG) != 0)
+        {
+            return nullptr;
+        }
+
+        return std::to_integer<int>(file[EI_CLASS]) == ELFCLASS64 ? load_from_image<Elf64Types>(file) : load_from_image<Elf32Types>(file);
+    }
+}
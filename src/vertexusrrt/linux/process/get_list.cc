@@ -6,6 +6,8 @@
 #include <sdk/process.h>
 
 #include <cerrno>
+#include <dirent.h>
+#include <fcntl.h>
 #include <pwd.h>
 #include <sys/inotify.h>
 #include <sys/stat.h>
@@ -13,17 +15,20 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cctype>
 #include <charconv>
 #include <chrono>
-#include <filesystem>
-#include <format>
-#include <fstream>
+#include <memory>
 #include <mutex>
+#include <new>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <system_error>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace
@@ -40,114 +45,63 @@ namespace
         dst[cpy_len] = '\0';
     }
 
-    [[nodiscard]] std::optional<uid_t> uid_from_proc_dir(const uint32_t pid) noexcept
-    {
-        const auto path = std::format("/proc/{}", pid);
-        struct stat st{};
-        if (stat(path.c_str(), &st) == 0)
-        {
-            return st.st_uid;
-        }
-        return std::nullopt;
-    }
-
-    struct ProcStatus final
-    {
-        std::string name{};
-        uint32_t ppid{};
-        uid_t uid{};
-        bool gotName{};
-        bool gotPpid{};
-        bool gotUid{};
-    };
+    constexpr std::size_t PROC_FILE_BUFFER_SIZE{4096};
+    constexpr std::size_t PIDS_PER_WORKER{256};
+    constexpr unsigned MAX_ENUMERATION_WORKERS{8};
 
-    [[nodiscard]] ProcStatus read_proc_status(const uint32_t pid) noexcept
+    // Reads a /proc file relative to an open /proc/<pid> directory with as few read() calls as it takes
+    // to fill buffer. procfs files are generated on read, so one call usually returns everything.
+    [[nodiscard]] std::string_view read_proc_file(const int pidFd, const char* name, const std::span<char> buffer) noexcept
     {
-        const auto path = std::format("/proc/{}/status", pid);
-        std::ifstream file{path};
-        if (!file)
+        const int fd = openat(pidFd, name, O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
         {
             return {};
         }
 
-        ProcStatus result{};
-        std::string line{};
-
-        while (std::getline(file, line))
+        std::size_t total{};
+        while (total < buffer.size())
         {
-            std::string_view sv{line};
-
-            if (sv.starts_with("Name:"))
-            {
-                sv.remove_prefix(5);
-                while (!sv.empty() && (sv.front() == ' ' || sv.front() == '\t'))
-                {
-                    sv.remove_prefix(1);
-                }
-                result.name = std::string{sv};
-                result.gotName = true;
-            }
-            else if (sv.starts_with("PPid:"))
-            {
-                sv.remove_prefix(5);
-                while (!sv.empty() && (sv.front() == ' ' || sv.front() == '\t'))
-                {
-                    sv.remove_prefix(1);
-                }
-                if (auto [ptr, ec] = std::from_chars(sv.data(), sv.data() + sv.size(), result.ppid); ec == std::errc{})
-                {
-                    result.gotPpid = true;
-                }
-            }
-            else if (sv.starts_with("Uid:"))
+            const ssize_t bytesRead = read(fd, buffer.data() + total, buffer.size() - total);
+            if (bytesRead < 0 && errno == EINTR)
             {
-                sv.remove_prefix(4);
-                while (!sv.empty() && (sv.front() == ' ' || sv.front() == '\t'))
-                {
-                    sv.remove_prefix(1);
-                }
-                unsigned int uidVal{};
-                if (auto [ptr, ec] = std::from_chars(sv.data(), sv.data() + sv.size(), uidVal); ec == std::errc{})
-                {
-                    result.uid = static_cast<uid_t>(uidVal);
-                    result.gotUid = true;
-                }
+                continue;
             }
-
-            if (result.gotName && result.gotPpid && result.gotUid)
+            if (bytesRead <= 0)
             {
                 break;
             }
+            total += static_cast<std::size_t>(bytesRead);
         }
 
-        return result;
+        close(fd);
+        return {buffer.data(), total};
+    }
+
+    [[nodiscard]] std::string_view skip_blanks(std::string_view sv) noexcept
+    {
+        while (!sv.empty() && (sv.front() == ' ' || sv.front() == '\t'))
+        {
+            sv.remove_prefix(1);
+        }
+        return sv;
     }
 
     struct ProcStatInfo final
     {
-        std::string comm{};
+        std::string_view comm{};
         uint32_t ppid{};
+        uint64_t startTime{};
         bool valid{};
     };
 
-    [[nodiscard]] ProcStatInfo read_proc_stat(const uint32_t pid) noexcept
+    // comm may contain spaces and parentheses, so fields are counted from the last ')'.
+    // ppid is field 4 and starttime field 22 of /proc/<pid>/stat.
+    [[nodiscard]] ProcStatInfo parse_proc_stat(const std::string_view content) noexcept
     {
-        const auto path = std::format("/proc/{}/stat", pid);
-        std::ifstream file{path};
-        if (!file)
-        {
-            return {};
-        }
-
-        std::string content{};
-        if (!std::getline(file, content))
-        {
-            return {};
-        }
-
         const auto openParen = content.find('(');
         const auto closeParen = content.rfind(')');
-        if (openParen == std::string::npos || closeParen == std::string::npos || closeParen <= openParen)
+        if (openParen == std::string_view::npos || closeParen == std::string_view::npos || closeParen <= openParen)
         {
             return {};
         }
@@ -155,56 +109,63 @@ namespace
         ProcStatInfo result{};
         result.comm = content.substr(openParen + 1, closeParen - openParen - 1);
 
-        if (closeParen + 2 >= content.size())
-        {
-            return result;
-        }
-
-        std::string_view sv{content};
-        sv.remove_prefix(closeParen + 2);
+        constexpr int PPID_FIELD{4};
+        constexpr int START_TIME_FIELD{22};
 
-        if (const auto spacePos = sv.find(' '); spacePos != std::string_view::npos && spacePos + 1 < sv.size())
+        std::string_view fields = content.substr(closeParen + 1);
+        bool gotPpid{};
+        for (int field = 3; field <= START_TIME_FIELD && !fields.empty(); ++field)
         {
-            sv.remove_prefix(spacePos + 1);
-            if (auto [ptr, ec] = std::from_chars(sv.data(), sv.data() + sv.size(), result.ppid); ec == std::errc{})
+            fields = skip_blanks(fields);
+            const auto tokenEnd = std::min(fields.find(' '), fields.size());
+            const std::string_view token = fields.substr(0, tokenEnd);
+            fields.remove_prefix(tokenEnd);
+
+            if (field == PPID_FIELD)
+            {
+                gotPpid = std::from_chars(token.data(), token.data() + token.size(), result.ppid).ec == std::errc{};
+            }
+            else if (field == START_TIME_FIELD)
             {
-                result.valid = true;
+                result.valid = gotPpid && std::from_chars(token.data(), token.data() + token.size(), result.startTime).ec == std::errc{};
             }
         }
 
         return result;
     }
 
-    [[nodiscard]] std::string read_proc_cmdline(const uint32_t pid) noexcept
+    // The real uid is the first value of the "Uid:" line of /proc/<pid>/status.
+    [[nodiscard]] std::optional<uid_t> parse_status_uid(const std::string_view content) noexcept
     {
-        const auto path = std::format("/proc/{}/cmdline", pid);
-        std::ifstream file{path, std::ios::binary};
-        if (!file)
+        constexpr std::string_view UID_KEY{"\nUid:"};
+        const auto pos = content.find(UID_KEY);
+        if (pos == std::string_view::npos)
         {
-            return {};
+            return std::nullopt;
         }
 
-        std::string segment{};
-        std::getline(file, segment, '\0');
-
-        if (segment.empty())
+        const std::string_view value = skip_blanks(content.substr(pos + UID_KEY.size()));
+        unsigned int uid{};
+        if (std::from_chars(value.data(), value.data() + value.size(), uid).ec != std::errc{})
         {
-            return {};
+            return std::nullopt;
         }
+        return static_cast<uid_t>(uid);
+    }
 
-        if (const auto pos = segment.rfind('/'); pos != std::string::npos)
+    [[nodiscard]] std::string_view base_name(std::string_view path) noexcept
+    {
+        if (const auto pos = path.rfind('/'); pos != std::string_view::npos)
         {
-            return segment.substr(pos + 1);
+            path.remove_prefix(pos + 1);
         }
-        return segment;
+        return path;
     }
 
-    [[nodiscard]] std::string read_exe_name(const uint32_t pid) noexcept
+    [[nodiscard]] std::string read_exe_name(const int pidFd) noexcept
     {
-        const auto linkPath = std::format("/proc/{}/exe", pid);
-
-        std::array<char, VERTEX_MAX_NAME_LENGTH + 1> buf{};
-        const ssize_t len = readlink(linkPath.c_str(), buf.data(), VERTEX_MAX_NAME_LENGTH);
+        std::array<char, VERTEX_MAX_PATH_LENGTH> buf{};
+        const ssize_t len = readlinkat(pidFd, "exe", buf.data(), buf.size());
         if (len <= 0)
         {
             return {};
@@ -218,31 +179,15 @@ namespace
             sv.remove_suffix(DELETED_SUFFIX.size());
         }
 
-        if (const auto pos = sv.rfind('/'); pos != std::string_view::npos)
-        {
-            sv = sv.substr(pos + 1);
-        }
-        return std::string{sv};
+        return std::string{base_name(sv)};
     }
 
-    [[nodiscard]] std::string resolve_process_name(const uint32_t pid, std::string_view statusName) noexcept
+    [[nodiscard]] std::string read_cmdline_name(const int pidFd) noexcept
     {
-        if (std::string exeName = read_exe_name(pid); !exeName.empty())
-        {
-            return exeName;
-        }
-
-        if (std::string cmdlineName = read_proc_cmdline(pid); !cmdlineName.empty())
-        {
-            return cmdlineName;
-        }
-
-        if (!statusName.empty())
-        {
-            return std::string{statusName};
-        }
-
-        return {};
+        std::array<char, PROC_FILE_BUFFER_SIZE> buf{};
+        std::string_view content = read_proc_file(pidFd, "cmdline", buf);
+        content = content.substr(0, content.find('\0'));
+        return std::string{base_name(content)};
     }
 
     [[nodiscard]] std::string uid_to_username(const uid_t uid) noexcept
@@ -269,10 +214,19 @@ namespace
     constexpr uint32_t SYSTEM_INIT_PID{1};
     constexpr uint32_t SYSTEM_KTHREADD_PID{2};
 
+    struct CachedProcess final
+    {
+        uint64_t startTime{};
+        std::string comm{};
+        ProcessInformation info{};
+        bool listed{};
+    };
+
     struct ProcessListCache final
     {
         std::mutex mutex{};
         std::vector<ProcessInformation> processes{};
+        std::unordered_map<uint32_t, CachedProcess> entries{};
         int inotifyFd{-1};
         int watchFd{-1};
         bool watchAttempted{};
@@ -403,103 +357,190 @@ namespace
         return processListChanged;
     }
 
-    [[nodiscard]] std::optional<std::vector<ProcessInformation>> enumerate_processes() noexcept
+    struct DirCloser final
+    {
+        void operator()(DIR* dir) const noexcept { closedir(dir); }
+    };
+
+    struct ProcessProbe final
+    {
+        uint32_t pid{};
+        CachedProcess entry{};
+        uid_t uid{};
+        bool gotUid{};
+        bool fresh{};
+        bool alive{};
+    };
+
+    // Fills probe from /proc/<pid>. A PID whose start time and comm match the cached entry is the same
+    // process as last time and only costs the stat read.
+    void probe_process(const int procFd, ProcessProbe& probe, const std::unordered_map<uint32_t, CachedProcess>& known) noexcept
     {
-        std::error_code ec{};
-        std::filesystem::directory_iterator procIter{"/proc", ec};
-        if (ec)
+        std::array<char, 16> pidName{};
+        std::to_chars(pidName.data(), pidName.data() + pidName.size() - 1, probe.pid);
+
+        const int pidFd = openat(procFd, pidName.data(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (pidFd < 0)
         {
-            return std::nullopt;
+            return;
         }
 
-        std::vector<ProcessInformation> processes{};
+        std::array<char, PROC_FILE_BUFFER_SIZE> buffer{};
+        const ProcStatInfo stat = parse_proc_stat(read_proc_file(pidFd, "stat", buffer));
+        if (!stat.valid)
+        {
+            close(pidFd);
+            return;
+        }
+        probe.alive = true;
+
+        const uint32_t ppid = (stat.ppid == SYSTEM_INIT_PID || stat.ppid == SYSTEM_KTHREADD_PID) ? 0 : stat.ppid;
+        if (const auto it = known.find(probe.pid); it != known.end() && it->second.startTime == stat.startTime && it->second.comm == stat.comm)
+        {
+            // Orphans are reparented to init or a subreaper, so the parent can change under a cache hit.
+            probe.entry = it->second;
+            probe.entry.info.parentProcessId = ppid;
+            close(pidFd);
+            return;
+        }
+
+        probe.fresh = true;
+        probe.entry.startTime = stat.startTime;
+        probe.entry.comm = std::string{stat.comm};
+
+        if (const auto uid = parse_status_uid(read_proc_file(pidFd, "status", buffer)))
+        {
+            probe.uid = *uid;
+            probe.gotUid = true;
+        }
+        else if (struct stat st{}; fstat(pidFd, &st) == 0)
+        {
+            probe.uid = st.st_uid;
+            probe.gotUid = true;
+        }
+
+        std::string processName = read_exe_name(pidFd);
+        if (processName.empty())
+        {
+            processName = read_cmdline_name(pidFd);
+        }
+        if (processName.empty())
+        {
+            processName = probe.entry.comm;
+        }
+        close(pidFd);
+
+        probe.entry.listed = !processName.empty();
+        probe.entry.info.processId = probe.pid;
+        probe.entry.info.parentProcessId = ppid;
+        safe_cpy(probe.entry.info.processName, processName, VERTEX_MAX_NAME_LENGTH);
+    }
+
+    [[nodiscard]] std::optional<std::vector<ProcessInformation>> enumerate_processes(ProcessListCache& cache) noexcept
+    {
+        std::unique_ptr<DIR, DirCloser> procDir{opendir("/proc")};
+        if (!procDir)
+        {
+            return std::nullopt;
+        }
+        const int procFd = dirfd(procDir.get());
 
         try
         {
-            for (const auto& dirEntry : procIter)
+            std::vector<ProcessProbe> probes{};
+            probes.reserve(cache.entries.size() + PIDS_PER_WORKER);
+            while (const dirent* dirEntry = readdir(procDir.get()))
+            {
+                if (is_pid_dir(dirEntry->d_name))
+                {
+                    probes.push_back(ProcessProbe{.pid = sv_to_uint32(dirEntry->d_name)});
+                }
+            }
+
+            std::atomic<std::size_t> nextProbe{};
+            const auto probe_batches = [&]() noexcept
             {
-                try
+                for (;;)
                 {
-                    const auto filename = dirEntry.path().filename().string();
-                    if (!is_pid_dir(filename))
+                    const std::size_t begin = nextProbe.fetch_add(PIDS_PER_WORKER, std::memory_order_relaxed);
+                    if (begin >= probes.size())
                     {
-                        continue;
+                        return;
                     }
 
-                    const auto pid = sv_to_uint32(filename);
-
-                    std::string baseName{};
-                    uint32_t ppid{};
-                    uid_t uid{};
-                    bool gotPpid{};
-                    bool gotUid{};
-
-                    auto status = read_proc_status(pid);
-                    baseName = std::move(status.name);
-                    ppid = status.ppid;
-                    uid = status.uid;
-                    gotPpid = status.gotPpid;
-                    gotUid = status.gotUid;
-
-                    if (!gotPpid || baseName.empty())
+                    const std::size_t end = std::min(begin + PIDS_PER_WORKER, probes.size());
+                    for (std::size_t i = begin; i < end; ++i)
                     {
-                        if (const auto statInfo = read_proc_stat(pid); statInfo.valid)
-                        {
-                            if (!gotPpid)
-                            {
-                                ppid = statInfo.ppid;
-                                gotPpid = true;
-                            }
-                            if (baseName.empty())
-                            {
-                                baseName = statInfo.comm;
-                            }
-                        }
+                        probe_process(procFd, probes[i], cache.entries);
                     }
+                }
+            };
 
-                    if (!gotUid)
+            // Steady-state refreshes only read stat per PID, which rarely fills more than one batch.
+            const std::size_t batches = (probes.size() + PIDS_PER_WORKER - 1) / PIDS_PER_WORKER;
+            const std::size_t workerCount = std::min<std::size_t>({batches, std::max(1U, std::thread::hardware_concurrency()), MAX_ENUMERATION_WORKERS});
+            {
+                std::vector<std::jthread> workers{};
+                workers.reserve(workerCount);
+                for (std::size_t i = 1; i < workerCount; ++i)
+                {
+                    try
                     {
-                        if (const auto uidOpt = uid_from_proc_dir(pid))
-                        {
-                            uid = *uidOpt;
-                            gotUid = true;
-                        }
+                        workers.emplace_back(probe_batches);
                     }
-
-                    const std::string processName = resolve_process_name(pid, baseName);
-                    if (processName.empty())
+                    catch (const std::system_error&)
                     {
-                        continue;
+                        break;
                     }
+                }
+                probe_batches();
+            }
+            procDir.reset();
 
-                    ProcessInformation info{};
-                    info.processId = pid;
-                    info.parentProcessId = (ppid == SYSTEM_INIT_PID || ppid == SYSTEM_KTHREADD_PID) ? 0 : ppid;
+            std::unordered_map<uid_t, std::string> owners{};
+            std::unordered_map<uint32_t, CachedProcess> entries{};
+            entries.reserve(probes.size());
+            std::vector<ProcessInformation> processes{};
+            processes.reserve(probes.size());
 
-                    safe_cpy(info.processName, processName, VERTEX_MAX_NAME_LENGTH);
+            for (auto& probe : probes)
+            {
+                if (!probe.alive)
+                {
+                    continue;
+                }
 
-                    if (gotUid)
+                if (probe.fresh)
+                {
+                    if (probe.gotUid)
                     {
-                        safe_cpy(info.processOwner, uid_to_username(uid), VERTEX_MAX_OWNER_LENGTH);
+                        auto [owner, inserted] = owners.try_emplace(probe.uid);
+                        if (inserted)
+                        {
+                            owner->second = uid_to_username(probe.uid);
+                        }
+                        safe_cpy(probe.entry.info.processOwner, owner->second, VERTEX_MAX_OWNER_LENGTH);
                     }
                     else
                     {
-                        safe_cpy(info.processOwner, "Unknown", VERTEX_MAX_OWNER_LENGTH);
+                        safe_cpy(probe.entry.info.processOwner, "Unknown", VERTEX_MAX_OWNER_LENGTH);
                     }
-
-                    processes.push_back(info);
                 }
-                catch (const std::filesystem::filesystem_error&)
+
+                if (probe.entry.listed)
                 {
-                    continue;
+                    processes.push_back(probe.entry.info);
                 }
+                entries.emplace(probe.pid, std::move(probe.entry));
             }
+
+            cache.entries = std::move(entries);
+            return processes;
         }
-        catch (const std::filesystem::filesystem_error&)
+        catch (const std::bad_alloc&)
         {
+            return std::nullopt;
         }
-
-        return processes;
     }
 }
 
@@ -532,7 +573,7 @@ extern "C"
 
         if (cache.dirty)
         {
-            if (auto refreshed = enumerate_processes())
+            if (auto refreshed = enumerate_processes(cache))
             {
                 cache.processes = std::move(*refreshed);
                 cache.dirty = false;
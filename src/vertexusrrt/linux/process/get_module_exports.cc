@@ -3,6 +3,7 @@
 // Licensed under LGPLv3.0+
 //
 #include <vertexusrrt/process_internal.hh>
+#include <vertexusrrt/linux/elf_symbols.hh>
 
 #include <elf.h>
 
@@ -12,6 +13,8 @@
 #include <limits>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <unordered_set>
 #include <vector>
 
 namespace
@@ -211,6 +214,63 @@ namespace
         return copy_to_user_buffer(it->second.exports, exports, count);
     }
 
+    StatusCode exports_from_file(const std::uint64_t baseAddress, const ModuleInformation& module,
+        const ProcessInternal::ElfModuleSymbols& symbols,
+        ProcessInternal::ModuleCache& cache,
+        ModuleExport** exports, std::uint32_t* count)
+    {
+        ProcessInternal::ModuleExportCache newCache{};
+        newCache.stringStorage.emplace_back(module.moduleName);
+        const char* moduleName = newCache.stringStorage.back().c_str();
+
+        const auto append = [&](const ProcessInternal::ElfSymbol& sym)
+        {
+            newCache.stringStorage.push_back(sym.name);
+
+            ModuleExport exp{};
+            exp.moduleName = moduleName;
+            exp.entry.name = newCache.stringStorage.back().c_str();
+            exp.entry.address = reinterpret_cast<void*>(sym.value);
+            exp.entry.moduleHandle = reinterpret_cast<void*>(baseAddress);
+            exp.entry.ordinal = static_cast<int>(sym.index);
+            exp.entry.isFunction = (sym.type == STT_FUNC) ? 1 : 0;
+            exp.entry.isImport = 0;
+            exp.entry.isForwarder = 0;
+            exp.entry.forwarderName = nullptr;
+            exp.isData = (sym.type == STT_OBJECT) ? 1 : 0;
+            exp.isThunk = 0;
+            exp.relocationTable = nullptr;
+            exp.characteristics = 0;
+            newCache.exports.push_back(exp);
+        };
+
+        std::unordered_set<std::string_view> seen{};
+        for (const auto& sym : symbols.symbols)
+        {
+            if (!sym.dynamic || sym.sectionIndex == SHN_UNDEF || sym.value == 0
+                || (sym.bind != STB_GLOBAL && sym.bind != STB_WEAK)
+                || sym.visibility == STV_HIDDEN || sym.visibility == STV_INTERNAL)
+            {
+                continue;
+            }
+            append(sym);
+            seen.insert(sym.name);
+        }
+
+        for (const auto& sym : symbols.symbols)
+        {
+            if (sym.dynamic || sym.sectionIndex == SHN_UNDEF || sym.value == 0
+                || (sym.type != STT_FUNC && sym.type != STT_OBJECT) || seen.contains(sym.name))
+            {
+                continue;
+            }
+            append(sym);
+            seen.insert(sym.name);
+        }
+
+        return populate_and_copy(baseAddress, cache, std::move(newCache), exports, count);
+    }
+
     StatusCode enumerate_exports64(const std::uint64_t baseAddress,
         const ElfDynInfo& dynInfo,
         const char* moduleName,
@@ -389,6 +449,12 @@ extern "C"
             }
         }
 
+        if (const auto symbols = ProcessInternal::load_elf_symbols(get_native_handle(), *module);
+            symbols && !symbols->symbols.empty())
+        {
+            return exports_from_file(baseAddress, *module, *symbols, cache, exports, count);
+        }
+
         std::array<std::uint8_t, EI_NIDENT> ident{};
         if (!ProcessInternal::read_remote_buffer(baseAddress, ident.data(), EI_NIDENT))
         {
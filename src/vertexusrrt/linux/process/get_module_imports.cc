@@ -4,6 +4,7 @@
 //
 #include <array>
 #include <vertexusrrt/process_internal.hh>
+#include <vertexusrrt/linux/elf_symbols.hh>
 
 #include <elf.h>
 
@@ -286,6 +287,44 @@ namespace
         }
         return copy_to_user_buffer(it->second.imports, imports, count);
     }
+
+    StatusCode imports_from_file(const std::uint64_t baseAddress,
+        const ProcessInternal::ElfModuleSymbols& symbols,
+        ProcessInternal::ModuleCache& cache,
+        ModuleImport** imports, std::uint32_t* count)
+    {
+        ProcessInternal::ModuleImportCache newCache{};
+
+        const char* defaultLib = "";
+        if (!symbols.neededLibraries.empty())
+        {
+            newCache.stringStorage.push_back(symbols.neededLibraries.front());
+            defaultLib = newCache.stringStorage.back().c_str();
+        }
+
+        for (const auto& import : symbols.imports)
+        {
+            newCache.stringStorage.push_back(import.name);
+
+            ModuleImport imp{};
+            imp.libraryName = defaultLib;
+            imp.importAddress = reinterpret_cast<void*>(import.offset);
+            imp.entry.name = newCache.stringStorage.back().c_str();
+            imp.entry.address = nullptr;
+            imp.entry.moduleHandle = reinterpret_cast<void*>(baseAddress);
+            imp.entry.ordinal = static_cast<int>(import.symbolIndex);
+            imp.entry.isFunction = (import.type == STT_FUNC) ? 1 : 0;
+            imp.entry.isImport = 1;
+            imp.entry.isForwarder = 0;
+            imp.entry.forwarderName = nullptr;
+            imp.isOrdinal = 0;
+            imp.hint = 0;
+
+            newCache.imports.push_back(imp);
+        }
+
+        return populate_and_copy(baseAddress, cache, std::move(newCache), imports, count);
+    }
 }
 
 extern "C"
@@ -309,6 +348,12 @@ extern "C"
             }
         }
 
+        if (const auto symbols = ProcessInternal::load_elf_symbols(get_native_handle(), *module);
+            symbols && (!symbols->imports.empty() || !symbols->neededLibraries.empty()))
+        {
+            return imports_from_file(baseAddress, *symbols, cache, imports, count);
+        }
+
         std::array<std::uint8_t, EI_NIDENT> ident{};
         if (!ProcessInternal::read_remote_buffer(baseAddress, ident.data(), EI_NIDENT))
         {
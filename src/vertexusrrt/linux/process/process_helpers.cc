@@ -3,6 +3,8 @@
 // Licensed under LGPLv3.0+
 //
 #include <vertexusrrt/process_internal.hh>
+#include <vertexusrrt/linux/proc_mem_file.hh>
+#include <vertexusrrt/linux/region_map.hh>
 
 #include <elf.h>
 
@@ -86,6 +88,8 @@ namespace ProcessInternal
     StatusCode invalidate_handle()
     {
         get_native_handle() = -1;
+        MemoryInternal::proc_mem_file().close();
+        MemoryInternal::region_map().reset();
 
         clear_process_architecture();
 
@@ -105,6 +105,28 @@ namespace
     }
 }
 
+namespace Debugger
+{
+    void fill_stack_frame(lldb::SBFrame& frame, const std::uint32_t frameIndex, StackFrame& out)
+    {
+        out.frameIndex = frameIndex;
+        out.returnAddress = frame.GetPC();
+        out.framePointer = frame.GetFP();
+        out.stackPointer = frame.GetSP();
+
+        const auto functionName = resolve_function_name(frame);
+        const auto moduleName = resolve_module_name(frame);
+        const auto sourceFile = resolve_source_file(frame);
+
+        copy_string(out.functionName, VERTEX_MAX_FUNCTION_NAME_LENGTH, functionName);
+        copy_string(out.moduleName, VERTEX_MAX_NAME_LENGTH, moduleName);
+        copy_string(out.sourceFile, VERTEX_MAX_SOURCE_FILE_LENGTH, sourceFile);
+
+        auto lineEntry = frame.GetLineEntry();
+        out.sourceLine = lineEntry.IsValid() ? lineEntry.GetLine() : 0;
+    }
+}
+
 extern "C"
 {
     VERTEX_EXPORT StatusCode VERTEX_API vertex_debugger_get_call_stack(const uint32_t threadId, CallStack* callStack)
@@ -153,22 +175,7 @@ extern "C"
                 continue;
             }
 
-            StackFrame& out = callStack->frames[i];
-            out.frameIndex = i;
-            out.returnAddress = frame.GetPC();
-            out.framePointer = frame.GetFP();
-            out.stackPointer = frame.GetSP();
-
-            const auto functionName = resolve_function_name(frame);
-            const auto moduleName = resolve_module_name(frame);
-            const auto sourceFile = resolve_source_file(frame);
-
-            copy_string(out.functionName, VERTEX_MAX_FUNCTION_NAME_LENGTH, functionName);
-            copy_string(out.moduleName, VERTEX_MAX_NAME_LENGTH, moduleName);
-            copy_string(out.sourceFile, VERTEX_MAX_SOURCE_FILE_LENGTH, sourceFile);
-
-            auto lineEntry = frame.GetLineEntry();
-            out.sourceLine = lineEntry.IsValid() ? lineEntry.GetLine() : 0;
+            Debugger::fill_stack_frame(frame, i, callStack->frames[i]);
         }
 
         callStack->frameCount = frameCount;
@@ -73,6 +73,67 @@ namespace
     }
 }
 
+namespace Debugger
+{
+    std::uint32_t collect_registers(lldb::SBFrame& frame, const std::uint32_t categoryMask, Register* out, const std::uint32_t capacity,
+                                    std::uint64_t& flagsRegister)
+    {
+        auto registerSets = frame.GetRegisters();
+        const auto setCount = registerSets.GetSize();
+        std::uint32_t outIndex = 0;
+
+        for (std::uint32_t i = 0; i < setCount && outIndex < capacity; ++i)
+        {
+            auto regSet = registerSets.GetValueAtIndex(i);
+            if (!regSet.IsValid())
+            {
+                continue;
+            }
+
+            const char* setNameCStr = regSet.GetName();
+            const std::string_view setName{setNameCStr != nullptr ? setNameCStr : ""};
+            const auto category = classify_register_set(setName);
+            if ((categoryMask & VERTEX_REGISTER_CATEGORY_BIT(category)) == 0)
+            {
+                continue;
+            }
+
+            const auto childCount = regSet.GetNumChildren();
+            for (std::uint32_t c = 0; c < childCount && outIndex < capacity; ++c)
+            {
+                auto regValue = regSet.GetChildAtIndex(c);
+                if (!regValue.IsValid())
+                {
+                    continue;
+                }
+
+                const char* regNameCStr = regValue.GetName();
+                if (regNameCStr == nullptr)
+                {
+                    continue;
+                }
+
+                Register& reg = out[outIndex];
+                copy_name(reg.name, VERTEX_MAX_REGISTER_NAME_LENGTH, regNameCStr);
+                reg.category = category;
+                reg.value = regValue.GetValueAsUnsigned(0);
+                reg.previousValue = 0;
+                reg.bitWidth = byte_size_to_bit_width(regValue.GetByteSize());
+                reg.modified = 0;
+
+                if (category == VERTEX_REG_FLAGS && flagsRegister == 0)
+                {
+                    flagsRegister = reg.value;
+                }
+
+                ++outIndex;
+            }
+        }
+
+        return outIndex;
+    }
+}
+
 extern "C"
 {
     VERTEX_EXPORT StatusCode VERTEX_API vertex_debugger_get_registers(const uint32_t threadId, RegisterSet* registers)
@@ -119,56 +180,8 @@ extern "C"
         registers->instructionPointer = frame.GetPC();
         registers->stackPointer = frame.GetSP();
         registers->basePointer = frame.GetFP();
-
-        auto registerSets = frame.GetRegisters();
-        const auto setCount = registerSets.GetSize();
-        std::uint32_t outIndex = 0;
-
-        for (std::uint32_t i = 0; i < setCount && outIndex < VERTEX_MAX_REGISTERS; ++i)
-        {
-            auto regSet = registerSets.GetValueAtIndex(i);
-            if (!regSet.IsValid())
-            {
-                continue;
-            }
-
-            const char* setNameCStr = regSet.GetName();
-            const std::string_view setName{setNameCStr != nullptr ? setNameCStr : ""};
-            const auto category = classify_register_set(setName);
-
-            const auto childCount = regSet.GetNumChildren();
-            for (std::uint32_t c = 0; c < childCount && outIndex < VERTEX_MAX_REGISTERS; ++c)
-            {
-                auto regValue = regSet.GetChildAtIndex(c);
-                if (!regValue.IsValid())
-                {
-                    continue;
-                }
-
-                const char* regNameCStr = regValue.GetName();
-                if (regNameCStr == nullptr)
-                {
-                    continue;
-                }
-
-                Register& out = registers->registers[outIndex];
-                copy_name(out.name, VERTEX_MAX_REGISTER_NAME_LENGTH, regNameCStr);
-                out.category = category;
-                out.value = regValue.GetValueAsUnsigned(0);
-                out.previousValue = 0;
-                out.bitWidth = byte_size_to_bit_width(regValue.GetByteSize());
-                out.modified = 0;
-
-                if (category == VERTEX_REG_FLAGS && registers->flagsRegister == 0)
-                {
-                    registers->flagsRegister = out.value;
-                }
-
-                ++outIndex;
-            }
-        }
-
-        registers->registerCount = outIndex;
+        registers->registerCount = Debugger::collect_registers(frame, VERTEX_REGISTER_CATEGORY_ALL, registers->registers,
+                                                               VERTEX_MAX_REGISTERS, registers->flagsRegister);
         return StatusCode::STATUS_OK;
     }
 }
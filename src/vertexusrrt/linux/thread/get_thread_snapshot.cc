@@ -0,0 +1,159 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under LGPLv3.0+
+//
+#include <vertexusrrt/native_handle.hh>
+#include <vertexusrrt/linux/lldb_backend.hh>
+#include <sdk/api.h>
+
+#include <lldb/API/LLDB.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+extern native_handle& get_native_handle();
+extern std::uint32_t get_current_debug_thread_id();
+
+namespace ThreadInternal
+{
+    void fill_thread_details(pid_t pid, pid_t tid, ThreadInfo& info);
+}
+
+namespace
+{
+    [[nodiscard]] constexpr std::size_t align_up(const std::size_t value, const std::size_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    // Frames are unwound lazily, so walking GetFrameAtIndex up to the limit avoids the full unwind GetNumFrames forces.
+    void collect_frames(lldb::SBThread& thread, lldb::SBFrame& top, const std::uint32_t maxFrames, std::vector<StackFrame>& frames)
+    {
+        for (std::uint32_t i = 0; i < maxFrames; ++i)
+        {
+            auto frame = i == 0 ? top : thread.GetFrameAtIndex(i);
+            if (!frame.IsValid())
+            {
+                break;
+            }
+
+            Debugger::fill_stack_frame(frame, i, frames.emplace_back());
+        }
+    }
+}
+
+extern "C"
+{
+    VERTEX_EXPORT StatusCode VERTEX_API vertex_debugger_get_thread_snapshot(const ThreadSnapshotRequest* request, ThreadSnapshot* snapshot)
+    {
+        if (request == nullptr || snapshot == nullptr)
+        {
+            return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        *snapshot = {};
+
+        auto& state = Debugger::get_backend_state();
+        if (!state.process.IsValid())
+        {
+            return StatusCode::STATUS_ERROR_DEBUGGER_NOT_ATTACHED;
+        }
+
+        const native_handle pid = get_native_handle();
+        const std::uint32_t currentThreadId = get_current_debug_thread_id();
+        const std::uint32_t maxFrames = std::min<std::uint32_t>(request->maxFrames, VERTEX_MAX_STACK_FRAMES);
+
+        const auto threadCount = state.process.GetNumThreads();
+        std::vector<ThreadSnapshotEntry> entries{};
+        std::vector<Register> registers{};
+        std::vector<StackFrame> frames{};
+        entries.reserve(threadCount);
+        frames.reserve(static_cast<std::size_t>(threadCount) * maxFrames);
+
+        for (std::uint32_t i = 0; i < threadCount; ++i)
+        {
+            auto thread = state.process.GetThreadAtIndex(i);
+            if (!thread.IsValid())
+            {
+                continue;
+            }
+
+            ThreadSnapshotEntry& entry = entries.emplace_back();
+            entry.thread.id = static_cast<std::uint32_t>(thread.GetThreadID());
+            entry.thread.isCurrent = entry.thread.id == currentThreadId ? 1 : 0;
+            entry.firstRegister = static_cast<std::uint32_t>(registers.size());
+            entry.firstFrame = static_cast<std::uint32_t>(frames.size());
+
+            if (pid > 0)
+            {
+                ThreadInternal::fill_thread_details(pid, static_cast<pid_t>(entry.thread.id), entry.thread);
+            }
+
+            auto top = thread.GetFrameAtIndex(0);
+            if (!top.IsValid())
+            {
+                entry.status = StatusCode::STATUS_ERROR_THREAD_CONTEXT_FAILED;
+                continue;
+            }
+
+            entry.thread.instructionPointer = top.GetPC();
+            entry.thread.stackPointer = top.GetSP();
+            entry.basePointer = top.GetFP();
+
+            if (request->registerCategoryMask != 0)
+            {
+                const auto offset = registers.size();
+                registers.resize(offset + VERTEX_MAX_REGISTERS);
+                entry.registerCount = Debugger::collect_registers(top, request->registerCategoryMask, registers.data() + offset,
+                                                                  VERTEX_MAX_REGISTERS, entry.flagsRegister);
+                registers.resize(offset + entry.registerCount);
+            }
+
+            collect_frames(thread, top, maxFrames, frames);
+            entry.frameCount = static_cast<std::uint32_t>(frames.size()) - entry.firstFrame;
+            entry.status = StatusCode::STATUS_OK;
+        }
+
+        const std::size_t registerOffset = align_up(entries.size() * sizeof(ThreadSnapshotEntry), alignof(Register));
+        const std::size_t frameOffset = align_up(registerOffset + registers.size() * sizeof(Register), alignof(StackFrame));
+        const std::size_t totalSize = frameOffset + frames.size() * sizeof(StackFrame);
+
+        if (totalSize != 0)
+        {
+            auto* block = static_cast<std::byte*>(std::malloc(totalSize));
+            if (block == nullptr)
+            {
+                return StatusCode::STATUS_ERROR_MEMORY_ALLOCATION_FAILED;
+            }
+
+            std::memcpy(block, entries.data(), entries.size() * sizeof(ThreadSnapshotEntry));
+            std::memcpy(block + registerOffset, registers.data(), registers.size() * sizeof(Register));
+            std::memcpy(block + frameOffset, frames.data(), frames.size() * sizeof(StackFrame));
+
+            snapshot->threads = reinterpret_cast<ThreadSnapshotEntry*>(block);
+            snapshot->registers = reinterpret_cast<Register*>(block + registerOffset);
+            snapshot->frames = reinterpret_cast<StackFrame*>(block + frameOffset);
+        }
+
+        snapshot->threadCount = static_cast<std::uint32_t>(entries.size());
+        snapshot->registerCount = static_cast<std::uint32_t>(registers.size());
+        snapshot->frameCount = static_cast<std::uint32_t>(frames.size());
+        snapshot->currentThreadId = currentThreadId;
+        return StatusCode::STATUS_OK;
+    }
+
+    VERTEX_EXPORT StatusCode VERTEX_API vertex_debugger_free_thread_snapshot(ThreadSnapshot* snapshot)
+    {
+        if (snapshot == nullptr)
+        {
+            return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        std::free(snapshot->threads);
+        *snapshot = {};
+        return StatusCode::STATUS_OK;
+    }
+}
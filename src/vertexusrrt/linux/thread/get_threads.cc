@@ -23,6 +23,7 @@ extern ProcessArchitecture get_process_architecture();
 namespace ThreadInternal
 {
     ThreadList* get_thread_list();
+    void fill_thread_details(pid_t pid, pid_t tid, ThreadInfo& info);
 }
 
 namespace
@@ -129,6 +130,18 @@ namespace
     }
 }
 
+namespace ThreadInternal
+{
+    void fill_thread_details(const pid_t pid, const pid_t tid, ThreadInfo& info)
+    {
+        read_thread_name(pid, tid, info.name, sizeof(ThreadInfo::name));
+
+        const auto statInfo = parse_proc_stat(pid, tid);
+        info.state = statInfo.valid ? map_proc_state(statInfo.state) : VERTEX_THREAD_RUNNING;
+        info.priority = statInfo.valid ? statInfo.nice : 0;
+    }
+}
+
 extern "C"
 {
     VERTEX_EXPORT StatusCode VERTEX_API vertex_debugger_get_threads(ThreadList* threadList)
@@ -188,19 +201,7 @@ extern "C"
             instructionPointer = 0;
             stackPointer = 0;
 
-            read_thread_name(pid, tid, name, sizeof(ThreadInfo::name));
-
-            const auto statInfo = parse_proc_stat(pid, tid);
-            if (statInfo.valid)
-            {
-                state = map_proc_state(statInfo.state);
-                priority = statInfo.nice;
-            }
-            else
-            {
-                state = VERTEX_THREAD_RUNNING;
-                priority = 0;
-            }
+            ThreadInternal::fill_thread_details(pid, tid, internalList->threads[internalList->threadCount]);
 
             user_regs_struct regs{};
             if (ptrace(PTRACE_GETREGS, tid, nullptr, &regs) == 0)
@@ -0,0 +1,71 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under LGPLv3.0+
+//
+#include <vertexusrrt/disassembler.hh>
+#include <vertexusrrt/process_internal.hh>
+#include <sdk/api.h>
+
+#include <cstring>
+#include <span>
+#include <vector>
+
+extern "C" VERTEX_EXPORT StatusCode VERTEX_API vertex_process_disassemble_range_compact(std::uint64_t address, std::uint32_t size, CompactDisassembly* results)
+{
+    if (!results || size == 0)
+    {
+        return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+    }
+
+    if (!PluginRuntime::is_disassembler_initialized())
+    {
+        return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+    }
+
+    std::vector<std::uint8_t> buffer(size);
+    StatusCode status = vertex_memory_read_process(address, size, reinterpret_cast<char*>(buffer.data()));
+    if (status != StatusCode::STATUS_OK)
+    {
+        return status;
+    }
+
+    status = PluginRuntime::disassemble_compact(address, std::span<const std::uint8_t>(buffer.data(), buffer.size()), results);
+
+    if (status == StatusCode::STATUS_OK && results->count > 0 && (results->fields & VERTEX_COMPACT_FIELD_SECTION) != 0)
+    {
+        auto resolved = ProcessInternal::resolve_module_sections(address);
+        if (resolved.has_value())
+        {
+            // Consecutive instructions almost always share a section, so its name is stored once.
+            const char* lastName{};
+            std::uint32_t lastOffset{VERTEX_COMPACT_NO_STRING};
+
+            for (std::uint32_t i = 0; i < results->count; ++i)
+            {
+                auto& res = results->instructions[i];
+                const auto* name = ProcessInternal::find_section_for_rva(resolved->sections, res.address - resolved->baseAddress);
+                if (!name)
+                {
+                    continue;
+                }
+
+                if (!lastName || std::strcmp(name, lastName) != 0)
+                {
+                    // A section name that does not fit ends the result here, so every returned record stays complete.
+                    const auto offset = PluginRuntime::append_compact_string(*results, name);
+                    if (!offset.has_value())
+                    {
+                        results->endAddress = res.address;
+                        results->count = i;
+                        break;
+                    }
+                    lastName = name;
+                    lastOffset = *offset;
+                }
+                res.sectionName = lastOffset;
+            }
+        }
+    }
+
+    return status;
+}
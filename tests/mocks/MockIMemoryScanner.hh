@@ -23,6 +23,7 @@ namespace Vertex::Testing::Mocks
         
         MOCK_METHOD(StatusCode, initialize_scan, (const Scanner::ScanConfiguration& configuration, std::shared_ptr<const Scanner::TypeSchema> schema, const std::vector<Scanner::ScanRegion>& memoryRegions), (override));
         MOCK_METHOD(StatusCode, initialize_next_scan, (const Scanner::ScanConfiguration& configuration, std::shared_ptr<const Scanner::TypeSchema> schema), (override));
+        MOCK_METHOD(StatusCode, extend_scan, (std::shared_ptr<const Scanner::TypeSchema> schema, const std::vector<Scanner::ScanRegion>& memoryRegions), (override));
         MOCK_METHOD(StatusCode, undo_scan, (), (override));
         MOCK_METHOD(StatusCode, stop_scan, (), (override));
         MOCK_METHOD(void, finalize_scan, (), (override));
@@ -32,6 +33,7 @@ namespace Vertex::Testing::Mocks
         MOCK_METHOD(std::uint64_t, get_total_regions, (), (const, noexcept, override));
         MOCK_METHOD(std::uint64_t, get_results_count, (), (const, override));
         MOCK_METHOD(StatusCode, get_last_plugin_error, (), (const, noexcept, override));
+        MOCK_METHOD(Scanner::ScanBudgetUsage, get_budget_usage, (), (const, noexcept, override));
         MOCK_METHOD(void, set_scan_abort_state, (bool state), (override));
         MOCK_METHOD(bool, is_scan_complete, (), (override));
         MOCK_METHOD(bool, can_undo, (), (const, override));
@@ -39,5 +41,8 @@ namespace Vertex::Testing::Mocks
         
         MOCK_METHOD(StatusCode, get_scan_results_range, (std::vector<ScanResultEntry> & results, std::size_t startIndex, std::size_t count), (const, override));
         MOCK_METHOD(StatusCode, get_scan_results, (std::vector<ScanResultEntry> & results, std::size_t maxResults), (const, override));
+        MOCK_METHOD(StatusCode, read_scan_results_page, (Scanner::ScanResultPage & page, std::size_t startIndex, std::size_t count, bool readCurrentValues), (const, override));
+        MOCK_METHOD(StatusCode, export_session, (const std::filesystem::path& path, const std::vector<Scanner::ScanRegion>& modules, Scanner::ScanSessionCompression compression), (override));
+        MOCK_METHOD(StatusCode, import_session, (const std::filesystem::path& path, const std::vector<Scanner::ScanRegion>& modules, const Scanner::SchemaResolver& resolveSchema), (override));
     };
 } 
@@ -29,6 +29,9 @@ namespace Vertex::Testing::Mocks
         MOCK_METHOD(StatusCode, snapshot_results,
                     (std::vector<Vertex::Scanner::IMemoryScanner::ScanResultEntry>& out,
                      std::size_t startIndex, std::size_t count), (const, override));
+        MOCK_METHOD(StatusCode, snapshot_results_page,
+                    (Vertex::Scanner::ScanResultPage& page,
+                     std::size_t startIndex, std::size_t count), (const, override));
         MOCK_METHOD(bool, can_undo, (), (const, override));
         MOCK_METHOD(bool, is_scanning, (), (const, override));
 
@@ -0,0 +1,103 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <gtest/gtest.h>
+#include <vertex/debugger/compactdisassembly.hh>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace dbg = Vertex::Debugger;
+
+namespace
+{
+    constexpr std::uint64_t CODE_BASE = 0x401000;
+
+    // Four-byte instructions, each a call with text in every string field.
+    StatusCode legacy_disassemble(const std::uint64_t address, const std::uint32_t size, ::DisassemblerResults* results)
+    {
+        results->count = 0;
+        for (auto cursor = address; cursor + 4 <= address + size && results->count < results->capacity; cursor += 4)
+        {
+            auto& out = results->results[results->count++];
+            out = {};
+            out.address = cursor;
+            out.size = 4;
+            out.branchType = VERTEX_BRANCH_CALL;
+            out.targetAddress = cursor + 0x100;
+            out.rawBytes[0] = 0xE8;
+            std::snprintf(out.mnemonic, sizeof(out.mnemonic), "call");
+            std::snprintf(out.operands, sizeof(out.operands), "0x%llx", static_cast<unsigned long long>(out.targetAddress));
+            std::snprintf(out.comment, sizeof(out.comment), "comment");
+            std::snprintf(out.targetSymbol, sizeof(out.targetSymbol), "fn_%llx", static_cast<unsigned long long>(out.targetAddress));
+            std::snprintf(out.sectionName, sizeof(out.sectionName), ".text");
+        }
+        return StatusCode::STATUS_OK;
+    }
+}
+
+TEST(CompactDisassemblyTest, RecordsStaySmallerThanLegacyResults)
+{
+    EXPECT_EQ(sizeof(::CompactInstruction), 80u);
+    EXPECT_LE(sizeof(::CompactInstruction) * 8, sizeof(::DisassemblerResult));
+}
+
+TEST(CompactDisassemblyTest, LegacyAdapterCopiesOnlyRequestedStrings)
+{
+    dbg::CompactDisassemblyBuffer buffer{8, VERTEX_COMPACT_FIELD_TARGET_SYMBOL, 256};
+
+    ASSERT_EQ(dbg::disassemble_compact_from_legacy(legacy_disassemble, CODE_BASE, 16, buffer.prepare()), StatusCode::STATUS_OK);
+    const auto decoded = buffer.instructions();
+    ASSERT_EQ(decoded.size(), 4u);
+
+    const auto& first = decoded.front();
+    EXPECT_EQ(first.address, CODE_BASE);
+    EXPECT_EQ(first.size, 4u);
+    EXPECT_EQ(first.branchType, VERTEX_BRANCH_CALL);
+    EXPECT_EQ(first.targetAddress, CODE_BASE + 0x100);
+    EXPECT_EQ(first.rawBytes[0], 0xE8);
+    EXPECT_EQ(buffer.string_at(first.targetSymbol), "fn_401100");
+    EXPECT_EQ(first.mnemonic, VERTEX_COMPACT_NO_STRING);
+    EXPECT_EQ(first.comment, VERTEX_COMPACT_NO_STRING);
+    EXPECT_EQ(first.sectionName, VERTEX_COMPACT_NO_STRING);
+    EXPECT_TRUE(buffer.string_at(first.mnemonic).empty());
+}
+
+TEST(CompactDisassemblyTest, FullStringTableEndsAtARecordBoundary)
+{
+    // Each record needs "call", "0x..." and "fn_..." (5 + 9 + 10 bytes); 60 bytes hold two of them.
+    dbg::CompactDisassemblyBuffer buffer{8, VERTEX_COMPACT_FIELD_TEXT | VERTEX_COMPACT_FIELD_TARGET_SYMBOL, 60};
+    auto* results = buffer.prepare();
+
+    ASSERT_EQ(dbg::disassemble_compact_from_legacy(legacy_disassemble, CODE_BASE, 32, results), StatusCode::STATUS_OK);
+    const auto decoded = buffer.instructions();
+    ASSERT_EQ(decoded.size(), 2u);
+    EXPECT_EQ(results->endAddress, CODE_BASE + 8);
+    EXPECT_EQ(results->stringSize, 48u);
+    EXPECT_EQ(buffer.string_at(decoded[1].mnemonic), "call");
+    EXPECT_EQ(buffer.string_at(decoded[1].operands), "0x401104");
+
+    const auto resume = results->endAddress;
+    ASSERT_EQ(dbg::disassemble_compact_from_legacy(legacy_disassemble, resume, 8, buffer.prepare()), StatusCode::STATUS_OK);
+    ASSERT_EQ(buffer.instructions().size(), 2u);
+    EXPECT_EQ(buffer.instructions().front().address, CODE_BASE + 8);
+}
+
+TEST(CompactDisassemblyTest, StringLookupRejectsOffsetsOutsideTheTable)
+{
+    char strings[] = {'a', 'b', '\0', 'c', 'd'};
+    ::CompactDisassembly results{};
+    results.strings = strings;
+    results.stringCapacity = sizeof(strings);
+    results.stringSize = sizeof(strings);
+
+    EXPECT_EQ(dbg::compact_string(results, 0), "ab");
+    EXPECT_EQ(dbg::compact_string(results, 3), "cd");
+    EXPECT_TRUE(dbg::compact_string(results, 5).empty());
+    EXPECT_TRUE(dbg::compact_string(results, VERTEX_COMPACT_NO_STRING).empty());
+
+    EXPECT_EQ(dbg::disassemble_compact_from_legacy(legacy_disassemble, CODE_BASE, 16, nullptr), StatusCode::STATUS_ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(dbg::disassemble_compact_from_legacy({}, CODE_BASE, 16, &results), StatusCode::STATUS_ERROR_INVALID_PARAMETER);
+}
@@ -0,0 +1,189 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <gtest/gtest.h>
+#include <vertex/debugger/controlflow.hh>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace dbg = Vertex::Debugger;
+
+namespace
+{
+    constexpr std::uint64_t FUNCTION_START = 0x1000;
+    constexpr std::uint64_t FUNCTION_END = 0x101A;
+
+    // if (...) { a } else { b }; do { ... } while (...); return
+    // with four bytes of int3 padding between the branches that nothing jumps to.
+    [[nodiscard]] std::vector<dbg::FlowInstruction> diamond_with_loop()
+    {
+        std::vector<dbg::FlowInstruction> instructions{
+            {.address = 0x1000, .size = 3},
+            {.address = 0x1003, .targetAddress = 0x1010, .size = 2, .branchType = VERTEX_BRANCH_CONDITIONAL},
+            {.address = 0x1005, .size = 5},
+            {.address = 0x100A, .targetAddress = 0x1014, .size = 2, .branchType = VERTEX_BRANCH_UNCONDITIONAL},
+            {.address = 0x1010, .size = 4},
+            {.address = 0x1014, .size = 3},
+            {.address = 0x1017, .targetAddress = 0x1014, .size = 2, .branchType = VERTEX_BRANCH_CONDITIONAL},
+            {.address = 0x1019, .size = 1, .branchType = VERTEX_BRANCH_RETURN}
+        };
+        for (std::uint64_t address = 0x100C; address < 0x1010; ++address)
+        {
+            instructions.push_back({.address = address, .size = 1, .branchType = VERTEX_BRANCH_EXCEPTION});
+        }
+        return instructions;
+    }
+
+    [[nodiscard]] dbg::FunctionRange function_range(const std::uint64_t start, const std::uint64_t end)
+    {
+        return dbg::FunctionRange{.start = start, .end = end, .source = dbg::FunctionSource::Unwind};
+    }
+
+    StatusCode table_disassemble(const std::vector<dbg::FlowInstruction>& table, const std::uint64_t address,
+                                 const std::uint32_t size, ::CompactDisassembly* results)
+    {
+        results->count = 0;
+        for (const auto& instr : table)
+        {
+            if (instr.address < address || instr.address >= address + size || results->count >= results->capacity)
+            {
+                continue;
+            }
+
+            auto& out = results->instructions[results->count++];
+            out = {};
+            out.address = instr.address;
+            out.size = static_cast<std::uint8_t>(instr.size);
+            out.targetAddress = instr.targetAddress;
+            out.branchType = static_cast<std::uint8_t>(instr.branchType);
+        }
+        return results->count != 0 ? StatusCode::STATUS_OK : StatusCode::STATUS_ERROR_GENERAL;
+    }
+}
+
+TEST(ControlFlowGraphTest, SplitsBlocksAndSkipsUnreachablePadding)
+{
+    const auto instructions = diamond_with_loop();
+    const auto graph = dbg::ControlFlowGraph::build(function_range(FUNCTION_START, FUNCTION_END), instructions);
+
+    const auto blocks = graph->blocks();
+    ASSERT_EQ(blocks.size(), 5u);
+    EXPECT_EQ(graph->instruction_count(), 8u);
+
+    EXPECT_EQ(blocks[0].start, 0x1000u);
+    EXPECT_EQ(blocks[0].end, 0x1005u);
+    EXPECT_EQ(blocks[0].exit, dbg::BlockExit::Conditional);
+    EXPECT_EQ(blocks[1].end, 0x100Cu);
+    EXPECT_EQ(blocks[1].exit, dbg::BlockExit::Jump);
+    EXPECT_EQ(blocks[2].start, 0x1010u);
+    EXPECT_EQ(blocks[2].exit, dbg::BlockExit::FallThrough);
+    EXPECT_EQ(blocks[3].start, 0x1014u);
+    EXPECT_EQ(blocks[3].instructionCount, 2u);
+    EXPECT_EQ(blocks[4].exit, dbg::BlockExit::Return);
+
+    EXPECT_EQ(graph->block_at(0x1007), 1u);
+    EXPECT_EQ(graph->block_at(0x1018), 3u);
+    EXPECT_FALSE(graph->block_at(0x100D).has_value());
+    EXPECT_FALSE(graph->block_at(FUNCTION_END).has_value());
+}
+
+TEST(ControlFlowGraphTest, EdgesCarryKindAndBackEdges)
+{
+    const auto instructions = diamond_with_loop();
+    const auto graph = dbg::ControlFlowGraph::build(function_range(FUNCTION_START, FUNCTION_END), instructions);
+
+    const auto entryOut = graph->successors(0);
+    ASSERT_EQ(entryOut.size(), 2u);
+    EXPECT_EQ(entryOut[0].to, 2u);
+    EXPECT_EQ(entryOut[0].kind, dbg::FlowEdgeKind::Taken);
+    EXPECT_EQ(entryOut[1].to, 1u);
+    EXPECT_EQ(entryOut[1].kind, dbg::FlowEdgeKind::NotTaken);
+
+    const auto loopOut = graph->successors(3);
+    ASSERT_EQ(loopOut.size(), 2u);
+    EXPECT_EQ(loopOut[0].to, 3u);
+    EXPECT_TRUE(loopOut[0].backEdge);
+    EXPECT_FALSE(loopOut[1].backEdge);
+
+    const auto loopIn = graph->predecessors(3);
+    ASSERT_EQ(loopIn.size(), 3u);
+    EXPECT_EQ(std::ranges::count_if(loopIn, [](const dbg::FlowEdge& edge) { return edge.backEdge; }), 1);
+
+    EXPECT_EQ(graph->edges().size(), 6u);
+    EXPECT_TRUE(graph->successors(4).empty());
+    EXPECT_TRUE(graph->successors(99).empty());
+}
+
+TEST(ControlFlowGraphTest, ComputesDominatorsAndReachingBlocks)
+{
+    const auto instructions = diamond_with_loop();
+    const auto graph = dbg::ControlFlowGraph::build(function_range(FUNCTION_START, FUNCTION_END), instructions);
+    const auto blocks = graph->blocks();
+
+    EXPECT_EQ(blocks[0].immediateDominator, dbg::ControlFlowGraph::NO_BLOCK);
+    EXPECT_EQ(blocks[1].immediateDominator, 0u);
+    EXPECT_EQ(blocks[2].immediateDominator, 0u);
+    EXPECT_EQ(blocks[3].immediateDominator, 0u);
+    EXPECT_EQ(blocks[4].immediateDominator, 3u);
+
+    EXPECT_TRUE(graph->dominates(0, 4));
+    EXPECT_TRUE(graph->dominates(3, 4));
+    EXPECT_TRUE(graph->dominates(2, 2));
+    EXPECT_FALSE(graph->dominates(1, 3));
+    EXPECT_FALSE(graph->dominates(4, 3));
+
+    EXPECT_EQ(graph->blocks_reaching(2), (std::vector<std::uint32_t>{0, 2}));
+    EXPECT_EQ(graph->blocks_reaching(4), (std::vector<std::uint32_t>{0, 1, 2, 3, 4}));
+}
+
+TEST(ControlFlowGraphTest, CallsFallThroughAndOutsideJumpsAreTailCalls)
+{
+    const std::vector<dbg::FlowInstruction> instructions{
+        {.address = 0x2000, .targetAddress = 0x9000, .size = 5, .branchType = VERTEX_BRANCH_CALL},
+        {.address = 0x2005, .targetAddress = 0x200C, .size = 2, .branchType = VERTEX_BRANCH_CONDITIONAL},
+        {.address = 0x2007, .size = 5},
+        {.address = 0x200C, .size = 2},
+        {.address = 0x200E, .targetAddress = 0x8000, .size = 5, .branchType = VERTEX_BRANCH_UNCONDITIONAL}
+    };
+    const auto graph = dbg::ControlFlowGraph::build(function_range(0x2000, 0x2013), instructions);
+
+    const auto blocks = graph->blocks();
+    ASSERT_EQ(blocks.size(), 3u);
+    EXPECT_EQ(blocks[0].instructionCount, 2u);
+    EXPECT_EQ(blocks[1].exit, dbg::BlockExit::FallThrough);
+    EXPECT_EQ(blocks[2].start, 0x200Cu);
+    EXPECT_EQ(blocks[2].exit, dbg::BlockExit::TailCall);
+    EXPECT_EQ(graph->predecessors(2).size(), 2u);
+    EXPECT_FALSE(graph->truncated());
+}
+
+TEST(ControlFlowGraphTest, CacheBuildsOnceThroughDisassembler)
+{
+    const auto table = diamond_with_loop();
+    std::size_t calls{};
+    const dbg::XrefDisassembler disassemble = [&](const std::uint64_t address, const std::uint32_t size, ::CompactDisassembly* results)
+    {
+        ++calls;
+        return table_disassemble(table, address, size, results);
+    };
+
+    dbg::ModuleControlFlowCache cache{};
+    const auto first = cache.acquire(function_range(FUNCTION_START, FUNCTION_END), disassemble);
+    const auto callsAfterBuild = calls;
+    const auto second = cache.acquire(function_range(FUNCTION_START, FUNCTION_END), disassemble);
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(calls, callsAfterBuild);
+    EXPECT_EQ(cache.size(), 1u);
+    EXPECT_EQ(first->blocks().size(), 5u);
+    EXPECT_EQ(cache.find(FUNCTION_START), first);
+    EXPECT_EQ(cache.find(FUNCTION_START + 1), nullptr);
+
+    const auto undecodable = dbg::ControlFlowGraph::build(function_range(0x5000, 0x5100), disassemble);
+    EXPECT_TRUE(undecodable->blocks().empty());
+    EXPECT_TRUE(undecodable->truncated());
+    EXPECT_FALSE(undecodable->block_at(0x5000).has_value());
+}
@@ -0,0 +1,302 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <gtest/gtest.h>
+#include <vertex/debugger/functiontable.hh>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace dbg = Vertex::Debugger;
+
+namespace
+{
+    constexpr std::uint64_t IMAGE_BASE = 0x7F0000000000;
+    constexpr std::size_t IMAGE_SIZE = 0x4000;
+
+    class FakeImage final
+    {
+    public:
+        FakeImage() : m_bytes(IMAGE_SIZE) {}
+
+        template <class T>
+        void put(const std::size_t offset, const T value)
+        {
+            std::memcpy(m_bytes.data() + offset, &value, sizeof(T));
+        }
+
+        void put_bytes(const std::size_t offset, const std::vector<std::uint8_t>& bytes)
+        {
+            std::memcpy(m_bytes.data() + offset, bytes.data(), bytes.size());
+        }
+
+        [[nodiscard]] dbg::ImageReader reader() const
+        {
+            return [this](const std::uint64_t address, const std::uint64_t size, std::uint8_t* buffer)
+            {
+                if (address < IMAGE_BASE || address + size > IMAGE_BASE + m_bytes.size())
+                {
+                    return StatusCode::STATUS_ERROR_MEMORY_READ;
+                }
+                std::memcpy(buffer, m_bytes.data() + (address - IMAGE_BASE), size);
+                return StatusCode::STATUS_OK;
+            };
+        }
+
+    private:
+        std::vector<std::uint8_t> m_bytes;
+    };
+
+    void put_program_header(FakeImage& image, const std::size_t index, const std::uint32_t type, const std::uint32_t flags,
+                            const std::uint64_t address, const std::uint64_t size)
+    {
+        const auto offset = 64 + index * 56;
+        image.put<std::uint32_t>(offset, type);
+        image.put<std::uint32_t>(offset + 4, flags);
+        image.put<std::uint64_t>(offset + 8, address);
+        image.put<std::uint64_t>(offset + 16, address);
+        image.put<std::uint64_t>(offset + 32, size);
+        image.put<std::uint64_t>(offset + 40, size);
+    }
+
+    // One FDE with pcrel|sdata4 addresses, as emitted by GCC and Clang.
+    std::size_t put_fde(FakeImage& image, const std::size_t offset, const std::size_t cieOffset,
+                        const std::uint64_t functionOffset, const std::uint32_t functionSize)
+    {
+        image.put<std::uint32_t>(offset, 16);
+        image.put<std::uint32_t>(offset + 4, static_cast<std::uint32_t>(offset + 4 - cieOffset));
+        image.put<std::int32_t>(offset + 8, static_cast<std::int32_t>(functionOffset) - static_cast<std::int32_t>(offset + 8));
+        image.put<std::uint32_t>(offset + 12, functionSize);
+        return offset + 20;
+    }
+
+    // PIE-style ELF64: code in [0x1000, 0x3000), .eh_frame_hdr at 0x3000 and .eh_frame at 0x3100.
+    FakeImage make_elf(const bool withSearchTable)
+    {
+        FakeImage image{};
+        image.put_bytes(0, {0x7F, 'E', 'L', 'F', 2, 1, 1});
+        image.put<std::uint16_t>(16, 3);
+        image.put<std::uint16_t>(18, 62);
+        image.put<std::uint64_t>(0x20, 64);
+        image.put<std::uint16_t>(0x36, 56);
+        image.put<std::uint16_t>(0x38, 3);
+
+        put_program_header(image, 0, 1, 5, 0, 0x3000);
+        put_program_header(image, 1, 1, 4, 0x3000, 0x1000);
+        put_program_header(image, 2, 0x6474E550, 4, 0x3000, 0x20);
+
+        constexpr std::size_t cie = 0x3100;
+        image.put<std::uint32_t>(cie, 16);
+        image.put_bytes(cie + 8, {1, 'z', 'R', 0, 0x01, 0x78, 0x10, 0x01, 0x1B});
+        auto next = put_fde(image, cie + 20, cie, 0x1000, 0x40);
+        const auto secondFde = next;
+        next = put_fde(image, next, cie, 0x1100, 0x80);
+        image.put<std::uint32_t>(next, 0);
+
+        image.put_bytes(0x3000, {1, 0x1B, static_cast<std::uint8_t>(withSearchTable ? 0x03 : 0xFF), 0x3B});
+        image.put<std::int32_t>(0x3004, 0x3100 - 0x3004);
+        image.put<std::uint32_t>(0x3008, 2);
+        image.put<std::int32_t>(0x300C, 0x1000 - 0x3000);
+        image.put<std::int32_t>(0x3010, static_cast<std::int32_t>(cie + 20) - 0x3000);
+        image.put<std::int32_t>(0x3014, 0x1100 - 0x3000);
+        image.put<std::int32_t>(0x3018, static_cast<std::int32_t>(secondFde) - 0x3000);
+
+        // Padded prologue, a prologue pattern that follows ordinary code, and one inside an unwound function.
+        image.put_bytes(0x11FF, {0xCC, 0x55, 0x48, 0x89, 0xE5});
+        image.put_bytes(0x120F, {0x01, 0x55, 0x48, 0x89, 0xE5});
+        image.put_bytes(0x113F, {0xCC, 0x55, 0x48, 0x89, 0xE5});
+        return image;
+    }
+
+    // PE32+ with one executable section and three .pdata entries, the second of them chained.
+    FakeImage make_pe()
+    {
+        FakeImage image{};
+        image.put_bytes(0, {'M', 'Z'});
+        image.put<std::uint32_t>(0x3C, 0x80);
+        image.put<std::uint32_t>(0x80, 0x00004550);
+        image.put<std::uint16_t>(0x84, 0x8664);
+        image.put<std::uint16_t>(0x86, 1);
+        image.put<std::uint16_t>(0x94, 240);
+
+        constexpr std::size_t optional = 0x98;
+        image.put<std::uint16_t>(optional, 0x20B);
+        image.put<std::uint32_t>(optional + 108, 16);
+        image.put<std::uint32_t>(optional + 112 + 3 * 8, 0x3000);
+        image.put<std::uint32_t>(optional + 112 + 3 * 8 + 4, 36);
+
+        constexpr std::size_t section = optional + 240;
+        image.put<std::uint32_t>(section + 8, 0x2000);
+        image.put<std::uint32_t>(section + 12, 0x1000);
+        image.put<std::uint32_t>(section + 36, 0x60000020);
+
+        const std::uint32_t pdata[] = {
+            0x1000, 0x1050, 0x3100,
+            0x1100, 0x1120, 0x3104,
+            0x1200, 0x1300, 0x3108
+        };
+        for (std::size_t i = 0; i < std::size(pdata); ++i)
+        {
+            image.put<std::uint32_t>(0x3000 + i * 4, pdata[i]);
+        }
+        image.put<std::uint8_t>(0x3100, 0x01);
+        image.put<std::uint8_t>(0x3104, 0x21);
+        image.put<std::uint8_t>(0x3108, 0x09);
+        return image;
+    }
+
+    [[nodiscard]] std::vector<dbg::FunctionRange> ranges_of(const dbg::ModuleFunctionTable& table)
+    {
+        return {table.ranges().begin(), table.ranges().end()};
+    }
+}
+
+TEST(ModuleFunctionTableTest, ElfUnwindRangesAndHeuristicsMerge)
+{
+    const auto image = make_elf(true);
+
+    dbg::FunctionDiscoveryHints hints{};
+    hints.knownStarts = {IMAGE_BASE + 0x1020, IMAGE_BASE + 0x2000};
+    hints.callTargets = {IMAGE_BASE + 0x1300, IMAGE_BASE + 0x3500, IMAGE_BASE + 0x1100};
+
+    const auto table = dbg::ModuleFunctionTable::build(IMAGE_BASE, IMAGE_SIZE, image.reader(), hints);
+    const auto ranges = ranges_of(*table);
+
+    ASSERT_EQ(ranges.size(), 5u);
+    EXPECT_EQ(ranges[0].start, IMAGE_BASE + 0x1000);
+    EXPECT_EQ(ranges[0].end, IMAGE_BASE + 0x1040);
+    EXPECT_EQ(ranges[0].source, dbg::FunctionSource::Unwind);
+    EXPECT_EQ(ranges[1].start, IMAGE_BASE + 0x1100);
+    EXPECT_EQ(ranges[1].end, IMAGE_BASE + 0x1180);
+    EXPECT_EQ(ranges[1].source, dbg::FunctionSource::Unwind);
+    EXPECT_EQ(ranges[2].start, IMAGE_BASE + 0x1200);
+    EXPECT_EQ(ranges[2].end, IMAGE_BASE + 0x1300);
+    EXPECT_EQ(ranges[2].source, dbg::FunctionSource::Prologue);
+    EXPECT_EQ(ranges[3].start, IMAGE_BASE + 0x1300);
+    EXPECT_EQ(ranges[3].source, dbg::FunctionSource::CallTarget);
+    EXPECT_EQ(ranges[4].start, IMAGE_BASE + 0x2000);
+    EXPECT_EQ(ranges[4].end, IMAGE_BASE + 0x3000);
+    EXPECT_EQ(ranges[4].source, dbg::FunctionSource::Symbol);
+
+    EXPECT_EQ(table->count_from(dbg::FunctionSource::Unwind), 2u);
+}
+
+TEST(ModuleFunctionTableTest, GuessedStartsDoNotSplitSymbolFunctions)
+{
+    auto image = make_elf(true);
+    image.put_bytes(0x17FF, {0xC3, 0x55, 0x48, 0x89, 0xE5});
+
+    dbg::FunctionDiscoveryHints hints{};
+    hints.knownStarts = {IMAGE_BASE + 0x2000};
+    hints.knownFunctions = {{.start = IMAGE_BASE + 0x1200, .size = 0x700}};
+    hints.callTargets = {IMAGE_BASE + 0x1300, IMAGE_BASE + 0x1800};
+
+    const auto table = dbg::ModuleFunctionTable::build(IMAGE_BASE, IMAGE_SIZE, image.reader(), hints);
+    const auto ranges = ranges_of(*table);
+
+    ASSERT_EQ(ranges.size(), 4u);
+    EXPECT_EQ(ranges[2].start, IMAGE_BASE + 0x1200);
+    EXPECT_EQ(ranges[2].end, IMAGE_BASE + 0x2000);
+    EXPECT_EQ(ranges[2].source, dbg::FunctionSource::Symbol);
+    EXPECT_EQ(table->start_at_or_before(IMAGE_BASE + 0x1900), IMAGE_BASE + 0x1200);
+    EXPECT_EQ(table->count_from(dbg::FunctionSource::Prologue), 0u);
+    EXPECT_EQ(table->count_from(dbg::FunctionSource::CallTarget), 0u);
+}
+
+TEST(ModuleFunctionTableTest, SymbolProtectionEndsAtSymbolSize)
+{
+    auto image = make_elf(true);
+    image.put_bytes(0x17FF, {0xC3, 0x55, 0x48, 0x89, 0xE5});
+
+    dbg::FunctionDiscoveryHints hints{};
+    hints.knownStarts = {IMAGE_BASE + 0x2000};
+    hints.knownFunctions = {{.start = IMAGE_BASE + 0x1200, .size = 0x200}};
+    hints.callTargets = {IMAGE_BASE + 0x1300, IMAGE_BASE + 0x1800};
+
+    const auto table = dbg::ModuleFunctionTable::build(IMAGE_BASE, IMAGE_SIZE, image.reader(), hints);
+
+    EXPECT_EQ(table->start_at_or_before(IMAGE_BASE + 0x1300), IMAGE_BASE + 0x1200);
+    EXPECT_EQ(table->start_at_or_before(IMAGE_BASE + 0x1900), IMAGE_BASE + 0x1800);
+    EXPECT_EQ(table->find(IMAGE_BASE + 0x1200)->end, IMAGE_BASE + 0x1800);
+}
+
+TEST(ModuleFunctionTableTest, UnsizedSymbolsLeaveGuessedStarts)
+{
+    const auto image = make_elf(true);
+
+    dbg::FunctionDiscoveryHints hints{};
+    hints.knownStarts = {IMAGE_BASE + 0x1200, IMAGE_BASE + 0x2000};
+    hints.callTargets = {IMAGE_BASE + 0x1800};
+
+    const auto table = dbg::ModuleFunctionTable::build(IMAGE_BASE, IMAGE_SIZE, image.reader(), hints);
+
+    EXPECT_EQ(table->count_from(dbg::FunctionSource::CallTarget), 1u);
+    EXPECT_EQ(table->find(IMAGE_BASE + 0x1200)->end, IMAGE_BASE + 0x1800);
+}
+
+TEST(ModuleFunctionTableTest, ImageCodeRangesReadOnlyExecutableSegments)
+{
+    const auto image = make_elf(true);
+    const auto code = dbg::image_code_ranges(IMAGE_BASE, IMAGE_SIZE, image.reader());
+
+    ASSERT_EQ(code.size(), 1u);
+    EXPECT_EQ(code[0].begin, IMAGE_BASE);
+    EXPECT_EQ(code[0].end, IMAGE_BASE + 0x3000);
+}
+
+TEST(ModuleFunctionTableTest, ElfWithoutSearchTableWalksEhFrame)
+{
+    const auto image = make_elf(false);
+    const auto table = dbg::ModuleFunctionTable::build(IMAGE_BASE, IMAGE_SIZE, image.reader(), {});
+
+    EXPECT_EQ(table->count_from(dbg::FunctionSource::Unwind), 2u);
+    const auto function = table->find(IMAGE_BASE + 0x1150);
+    ASSERT_TRUE(function.has_value());
+    EXPECT_EQ(function->start, IMAGE_BASE + 0x1100);
+    EXPECT_EQ(function->end, IMAGE_BASE + 0x1180);
+}
+
+TEST(ModuleFunctionTableTest, PeRuntimeFunctionsSkipChainedEntries)
+{
+    const auto image = make_pe();
+    const auto table = dbg::ModuleFunctionTable::build(IMAGE_BASE, IMAGE_SIZE, image.reader(), {});
+
+    EXPECT_EQ(table->count_from(dbg::FunctionSource::Unwind), 2u);
+    EXPECT_EQ(table->find(IMAGE_BASE + 0x104F)->start, IMAGE_BASE + 0x1000);
+    EXPECT_FALSE(table->find(IMAGE_BASE + 0x1050).has_value());
+    EXPECT_FALSE(table->find(IMAGE_BASE + 0x1110).has_value());
+    EXPECT_EQ(table->find(IMAGE_BASE + 0x12FF)->end, IMAGE_BASE + 0x1300);
+}
+
+TEST(ModuleFunctionTableTest, NavigationQueries)
+{
+    const auto image = make_elf(true);
+    const auto table = dbg::ModuleFunctionTable::build(IMAGE_BASE, IMAGE_SIZE, image.reader(), {});
+
+    EXPECT_EQ(table->start_at_or_before(IMAGE_BASE + 0x10FF), IMAGE_BASE + 0x1000);
+    EXPECT_EQ(table->start_at_or_before(IMAGE_BASE + 0x1100), IMAGE_BASE + 0x1100);
+    EXPECT_EQ(table->start_after(IMAGE_BASE + 0x1000), IMAGE_BASE + 0x1100);
+    EXPECT_FALSE(table->start_at_or_before(IMAGE_BASE + 0xFFF).has_value());
+    EXPECT_FALSE(table->find(IMAGE_BASE + 0x1040).has_value());
+    EXPECT_TRUE(table->overlaps(IMAGE_BASE + IMAGE_SIZE - 1, 4));
+}
+
+TEST(ModuleFunctionTableTest, UnreadableImageFallsBackToHints)
+{
+    dbg::FunctionDiscoveryHints hints{};
+    hints.knownStarts = {IMAGE_BASE + 0x2000, IMAGE_BASE + 0x1000};
+    hints.callTargets = {IMAGE_BASE + 0x1000, IMAGE_BASE + IMAGE_SIZE};
+
+    const auto table = dbg::ModuleFunctionTable::build(IMAGE_BASE, IMAGE_SIZE,
+        [](std::uint64_t, std::uint64_t, std::uint8_t*) { return StatusCode::STATUS_ERROR_MEMORY_READ; },
+        hints);
+    const auto ranges = ranges_of(*table);
+
+    ASSERT_EQ(ranges.size(), 2u);
+    EXPECT_EQ(ranges[0].start, IMAGE_BASE + 0x1000);
+    EXPECT_EQ(ranges[0].end, IMAGE_BASE + 0x2000);
+    EXPECT_EQ(ranges[0].source, dbg::FunctionSource::Symbol);
+    EXPECT_EQ(ranges[1].end, IMAGE_BASE + IMAGE_SIZE);
+}
@@ -0,0 +1,222 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <gtest/gtest.h>
+#include <vertex/debugger/signature.hh>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <vector>
+
+namespace dbg = Vertex::Debugger;
+
+namespace
+{
+    constexpr std::uint64_t MODULE_BASE = 0x140000000;
+    constexpr std::uint64_t MODULE_SIZE = 0x80000;
+    constexpr std::uint64_t CODE_OFFSET = 0x1000;
+    constexpr std::uint64_t TWIN_OFFSET = 0x1FFFC;
+    constexpr std::uint64_t IMM_OFFSET = 0x3000;
+
+    [[nodiscard]] ::CompactInstruction make_instr(const std::uint64_t address, const std::uint8_t size,
+                                                  const ::BranchType branchType = VERTEX_BRANCH_NONE,
+                                                  const std::uint64_t target = 0, const std::uint64_t data = 0)
+    {
+        ::CompactInstruction instr{};
+        instr.address = address;
+        instr.size = size;
+        instr.branchType = static_cast<std::uint8_t>(branchType);
+        instr.targetAddress = target;
+        instr.dataAddress = data;
+        return instr;
+    }
+
+    void put_le32(std::vector<std::uint8_t>& image, const std::size_t offset, const std::uint32_t value)
+    {
+        std::memcpy(image.data() + offset, &value, sizeof(value));
+    }
+
+    // mov rax, [rip+disp]; mov [rax+0x10], ecx; call rel32; je +5; ret
+    // The twin copy differs in its data displacement and uses jmp instead of call.
+    struct FakeModule final
+    {
+        std::vector<std::uint8_t> image{};
+        std::map<std::uint64_t, ::CompactInstruction> instructions{};
+
+        FakeModule()
+            : image(MODULE_SIZE)
+        {
+            std::uint32_t state = 0x12345678;
+            for (auto& byte : image)
+            {
+                state = state * 1664525 + 1013904223;
+                byte = static_cast<std::uint8_t>(state >> 24);
+            }
+
+            plant(CODE_OFFSET, 0x40000, 0xE8);
+            plant(TWIN_OFFSET, 0x48000, 0xE9);
+
+            const std::uint8_t movImm[] = {0x48, 0xB8, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+            std::ranges::copy(movImm, image.begin() + IMM_OFFSET);
+            add(make_instr(MODULE_BASE + IMM_OFFSET, sizeof(movImm)));
+        }
+
+        void plant(const std::uint64_t offset, const std::uint64_t dataOffset, const std::uint8_t branchOpcode)
+        {
+            const auto address = MODULE_BASE + offset;
+            image[offset] = 0x48;
+            image[offset + 1] = 0x8B;
+            image[offset + 2] = 0x05;
+            put_le32(image, offset + 3, static_cast<std::uint32_t>(dataOffset - (offset + 7)));
+            image[offset + 7] = 0x89;
+            image[offset + 8] = 0x48;
+            image[offset + 9] = 0x10;
+            image[offset + 10] = branchOpcode;
+            put_le32(image, offset + 11, static_cast<std::uint32_t>(0x2000 - (offset + 15)));
+            image[offset + 15] = 0x74;
+            image[offset + 16] = 0x05;
+            image[offset + 17] = 0xC3;
+
+            add(make_instr(address, 7, VERTEX_BRANCH_NONE, 0, MODULE_BASE + dataOffset));
+            add(make_instr(address + 7, 3));
+            add(make_instr(address + 10, 5, branchOpcode == 0xE8 ? VERTEX_BRANCH_CALL : VERTEX_BRANCH_UNCONDITIONAL, MODULE_BASE + 0x2000));
+            add(make_instr(address + 15, 2, VERTEX_BRANCH_CONDITIONAL, address + 22));
+            add(make_instr(address + 17, 1, VERTEX_BRANCH_RETURN));
+        }
+
+        void add(const ::CompactInstruction& instr)
+        {
+            instructions[instr.address] = instr;
+        }
+
+        [[nodiscard]] dbg::ImageReader reader() const
+        {
+            return [this](const std::uint64_t address, const std::uint64_t size, std::uint8_t* buffer)
+            {
+                std::memcpy(buffer, image.data() + (address - MODULE_BASE), size);
+                return StatusCode::STATUS_OK;
+            };
+        }
+
+        [[nodiscard]] dbg::XrefDisassembler disassembler() const
+        {
+            return [this](const std::uint64_t address, const std::uint32_t size, ::CompactDisassembly* results)
+            {
+                results->count = 0;
+                for (auto it = instructions.find(address); it != instructions.end() && it->first < address + size &&
+                     results->count < results->capacity; ++it)
+                {
+                    results->instructions[results->count++] = it->second;
+                }
+                return results->count != 0 ? StatusCode::STATUS_OK : StatusCode::STATUS_ERROR_GENERAL;
+            };
+        }
+    };
+
+    [[nodiscard]] std::size_t naive_count(const std::vector<std::uint8_t>& image, const std::vector<std::uint8_t>& bytes,
+                                          const std::vector<std::uint8_t>& mask)
+    {
+        std::size_t count{};
+        for (std::size_t p = 0; p + bytes.size() <= image.size(); ++p)
+        {
+            bool matches = true;
+            for (std::size_t i = 0; i < bytes.size() && matches; ++i)
+            {
+                matches = mask[i] == 0 || image[p + i] == bytes[i];
+            }
+            count += matches ? 1 : 0;
+        }
+        return count;
+    }
+}
+
+TEST(CodeSignatureTest, MasksRelocatableOperands)
+{
+    const std::uint64_t address = MODULE_BASE + 0x100;
+
+    const std::vector<std::uint8_t> call{0xE8, 0xFB, 0x0E, 0x00, 0x00};
+    const auto callMask = dbg::relocation_mask(make_instr(address, 5, VERTEX_BRANCH_CALL, address + 5 + 0xEFB), call, MODULE_BASE, MODULE_SIZE);
+    EXPECT_EQ(callMask, (std::vector<std::uint8_t>{1, 0, 0, 0, 0}));
+
+    const std::vector<std::uint8_t> load{0x8B, 0x05, 0xF9, 0xFF, 0xFF, 0xFF};
+    const auto loadMask = dbg::relocation_mask(make_instr(address, 6, VERTEX_BRANCH_NONE, 0, address - 1), load, MODULE_BASE, MODULE_SIZE);
+    EXPECT_EQ(loadMask, (std::vector<std::uint8_t>{1, 1, 0, 0, 0, 0}));
+
+    const std::vector<std::uint8_t> shortJump{0x74, 0x05};
+    const auto shortMask = dbg::relocation_mask(make_instr(address, 2, VERTEX_BRANCH_CONDITIONAL, address + 7), shortJump, MODULE_BASE, MODULE_SIZE);
+    EXPECT_EQ(shortMask, (std::vector<std::uint8_t>{1, 1}));
+
+    const std::vector<std::uint8_t> movAbs{0x48, 0xB8, 0x00, 0x20, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00};
+    const auto movMask = dbg::relocation_mask(make_instr(address, 10), movAbs, MODULE_BASE, MODULE_SIZE);
+    EXPECT_EQ(movMask, (std::vector<std::uint8_t>{1, 1, 0, 0, 0, 0, 0, 0, 0, 0}));
+
+    const std::vector<std::uint8_t> fixedWidthBranch{0x10, 0x00, 0x00, 0x94};
+    const auto branchMask = dbg::relocation_mask(make_instr(address, 4, VERTEX_BRANCH_CALL, address + 0x40), fixedWidthBranch, MODULE_BASE, MODULE_SIZE);
+    EXPECT_EQ(branchMask, (std::vector<std::uint8_t>{0, 0, 0, 0}));
+}
+
+TEST(CodeSignatureTest, ParallelCountMatchesNaiveScanAcrossSlices)
+{
+    const FakeModule module{};
+    const std::vector<std::uint8_t> bytes{0x48, 0x8B, 0x05, 0, 0, 0, 0, 0x89, 0x48, 0x10};
+    const std::vector<std::uint8_t> mask{1, 1, 1, 0, 0, 0, 0, 1, 1, 1};
+
+    const auto expected = naive_count(module.image, bytes, mask);
+    EXPECT_EQ(expected, 2u);
+    EXPECT_EQ(dbg::count_pattern_matches(module.image, bytes, mask, 100, 4), expected);
+    EXPECT_EQ(dbg::count_pattern_matches(module.image, bytes, mask, 1, 4), 1u);
+
+    const std::vector<std::uint8_t> twoBytes{0x48, 0x8B};
+    const std::vector<std::uint8_t> twoMask{1, 1};
+    EXPECT_EQ(dbg::count_pattern_matches(module.image, twoBytes, twoMask, SIZE_MAX, 8), naive_count(module.image, twoBytes, twoMask));
+}
+
+TEST(CodeSignatureTest, ExtendsUntilUniqueAndStopsThere)
+{
+    const FakeModule module{};
+    const dbg::CodeSignatureGenerator generator{MODULE_BASE, MODULE_SIZE, module.reader(), {.workerCount = 4, .maxBytes = 64}};
+
+    const auto signature = generator.generate(MODULE_BASE + CODE_OFFSET, module.disassembler());
+    ASSERT_TRUE(signature.has_value());
+    EXPECT_TRUE(signature->unique());
+    EXPECT_EQ(signature->to_pattern(), "48 8B 05 ?? ?? ?? ?? 89 48 10 E8");
+
+    const auto twin = generator.generate(MODULE_BASE + TWIN_OFFSET, module.disassembler());
+    ASSERT_TRUE(twin.has_value());
+    EXPECT_EQ(twin->to_pattern(), "48 8B 05 ?? ?? ?? ?? 89 48 10 E9");
+}
+
+TEST(CodeSignatureTest, ShrinksInsideUniqueFirstInstruction)
+{
+    const FakeModule module{};
+    const dbg::CodeSignatureGenerator generator{MODULE_BASE, MODULE_SIZE, module.reader(), {.workerCount = 3}};
+
+    const auto signature = generator.generate(MODULE_BASE + IMM_OFFSET, module.disassembler());
+    ASSERT_TRUE(signature.has_value());
+    ASSERT_TRUE(signature->unique());
+    ASSERT_GE(signature->bytes.size(), 2u);
+    EXPECT_LT(signature->bytes.size(), 10u);
+
+    const std::span bytes{signature->bytes};
+    const std::span mask{signature->mask};
+    EXPECT_EQ(dbg::count_pattern_matches(module.image, bytes, mask, SIZE_MAX, 1), 1u);
+    EXPECT_GT(dbg::count_pattern_matches(module.image, bytes.first(bytes.size() - 1), mask.first(mask.size() - 1), SIZE_MAX, 1), 1u);
+}
+
+TEST(CodeSignatureTest, ReportsAmbiguityAndBadInput)
+{
+    const FakeModule module{};
+    const dbg::CodeSignatureGenerator generator{MODULE_BASE, MODULE_SIZE, module.reader(), {.workerCount = 2, .maxBytes = 8}};
+
+    const auto signature = generator.generate(MODULE_BASE + CODE_OFFSET, module.disassembler());
+    ASSERT_TRUE(signature.has_value());
+    EXPECT_FALSE(signature->unique());
+    EXPECT_GE(signature->matchCount, 2u);
+    EXPECT_EQ(signature->to_pattern(), "48 8B 05 ?? ?? ?? ?? 89");
+
+    EXPECT_EQ(generator.generate(MODULE_BASE + MODULE_SIZE, module.disassembler()).error(), StatusCode::STATUS_ERROR_INVALID_PARAMETER);
+    EXPECT_FALSE(generator.generate(MODULE_BASE + 0x5000, module.disassembler()).has_value());
+}
@@ -0,0 +1,156 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <gtest/gtest.h>
+#include <vertex/debugger/symbolindex.hh>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace dbg = Vertex::Debugger;
+
+namespace
+{
+    constexpr std::uint64_t MAIN_BASE = 0x140000000;
+    constexpr std::uint64_t MAIN_SIZE = 0x10000;
+    constexpr std::uint64_t LIB_BASE = 0x7FF800000000;
+    constexpr std::uint64_t LIB_SIZE = 0x4000;
+
+    [[nodiscard]] std::shared_ptr<const dbg::SymbolIndex> make_index()
+    {
+        dbg::SymbolIndexBuilder builder{};
+        builder.add_module("app.exe", MAIN_BASE, MAIN_SIZE);
+        builder.add_module("kernel32.dll", LIB_BASE, LIB_SIZE);
+
+        builder.add_symbol(MAIN_BASE + 0x2000, 0, "WinMain");
+        builder.add_symbol(MAIN_BASE + 0x1000, 0x80, "InitializeRenderer");
+        builder.add_symbol(MAIN_BASE + 0x1000, 0, "InitializeRendererAlias");
+        builder.add_symbol(MAIN_BASE + 0x3000, 0, "ShutdownRenderer");
+        builder.add_symbol(LIB_BASE + 0x100, 0, "CreateFileW");
+        builder.add_symbol(LIB_BASE + 0x200, 0, "CreateProcessW");
+        builder.add_symbol(0, 0, "ignored");
+        builder.add_symbol(MAIN_BASE + 0x4000, 0, "");
+        return builder.build();
+    }
+}
+
+TEST(SymbolIndexTest, ExactLookupKeepsFirstAlias)
+{
+    const auto index = make_index();
+
+    EXPECT_EQ(index->size(), 5u);
+    EXPECT_EQ(index->name_at(MAIN_BASE + 0x1000), "InitializeRenderer");
+    EXPECT_EQ(index->name_at(LIB_BASE + 0x200), "CreateProcessW");
+    EXPECT_FALSE(index->name_at(MAIN_BASE + 0x1001).has_value());
+    EXPECT_FALSE(index->name_at(MAIN_BASE + 0x4000).has_value());
+}
+
+TEST(SymbolIndexTest, ResolvesNearestSymbolWithOffset)
+{
+    const auto index = make_index();
+
+    const auto match = index->resolve(MAIN_BASE + 0x201A);
+    ASSERT_TRUE(match.has_value());
+    EXPECT_EQ(match->address, MAIN_BASE + 0x2000);
+    EXPECT_EQ(match->offset, 0x1Au);
+    EXPECT_EQ(match->name, "WinMain");
+    EXPECT_EQ(match->moduleName, "app.exe");
+
+    EXPECT_EQ(index->format(MAIN_BASE + 0x201A), "WinMain+0x1A");
+    EXPECT_EQ(index->format(MAIN_BASE + 0x2000), "WinMain");
+    EXPECT_EQ(index->format(LIB_BASE + 0x3FFF), "CreateProcessW+0x3DFF");
+}
+
+TEST(SymbolIndexTest, ResolveRespectsSizeAndModuleBounds)
+{
+    const auto index = make_index();
+
+    EXPECT_TRUE(index->resolve(MAIN_BASE + 0x107F).has_value());
+    EXPECT_FALSE(index->resolve(MAIN_BASE + 0x1080).has_value());
+    EXPECT_FALSE(index->resolve(MAIN_BASE + 0xFFF).has_value());
+    EXPECT_FALSE(index->resolve(MAIN_BASE + MAIN_SIZE).has_value());
+    EXPECT_FALSE(index->resolve(LIB_BASE + LIB_SIZE).has_value());
+    EXPECT_TRUE(index->format(MAIN_BASE + 0x1080).empty());
+
+    EXPECT_EQ(index->symbol_at_or_before(MAIN_BASE + 0x2FFF), MAIN_BASE + 0x2000);
+    EXPECT_EQ(index->symbol_after(MAIN_BASE + 0x2000), MAIN_BASE + 0x3000);
+    EXPECT_FALSE(index->symbol_after(LIB_BASE + 0x200).has_value());
+}
+
+TEST(SymbolIndexTest, PrefixAndSubstringSearchIgnoreCase)
+{
+    const auto index = make_index();
+
+    const auto prefix = index->search("create", dbg::SymbolSearchMode::Prefix, 10);
+    ASSERT_EQ(prefix.size(), 2u);
+    EXPECT_EQ(prefix[0].name, "CreateFileW");
+    EXPECT_EQ(prefix[1].name, "CreateProcessW");
+    EXPECT_EQ(prefix[0].moduleName, "kernel32.dll");
+
+    const auto substring = index->search("RENDERER", dbg::SymbolSearchMode::Substring, 10);
+    ASSERT_EQ(substring.size(), 2u);
+    EXPECT_EQ(substring[0].name, "InitializeRenderer");
+    EXPECT_EQ(substring[1].name, "ShutdownRenderer");
+
+    EXPECT_TRUE(index->search("renderer", dbg::SymbolSearchMode::Prefix, 10).empty());
+    EXPECT_TRUE(index->search("rendererx", dbg::SymbolSearchMode::Substring, 10).empty());
+    EXPECT_EQ(index->search("re", dbg::SymbolSearchMode::Substring, 10).size(), 4u);
+    EXPECT_EQ(index->search("re", dbg::SymbolSearchMode::Substring, 3).size(), 3u);
+}
+
+TEST(SymbolIndexTest, TrigramCandidatesAreVerified)
+{
+    dbg::SymbolIndexBuilder builder{};
+    builder.add_module("m", MAIN_BASE, MAIN_SIZE);
+    builder.add_symbol(MAIN_BASE + 0x10, 0, "abcXbcd");
+    builder.add_symbol(MAIN_BASE + 0x20, 0, "abcd");
+    const auto index = builder.build();
+
+    const auto results = index->search("abcd", dbg::SymbolSearchMode::Substring, 10);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0].address, MAIN_BASE + 0x20);
+}
+
+TEST(SymbolIndexTest, LargeIndexIsSharedAcrossThreads)
+{
+    constexpr std::uint64_t symbolCount = 100000;
+
+    dbg::SymbolIndexBuilder builder{};
+    builder.add_module("big.dll", MAIN_BASE, symbolCount * 0x10);
+    for (std::uint64_t i = 0; i < symbolCount; ++i)
+    {
+        builder.add_symbol(MAIN_BASE + i * 0x10, 0x10, "fn_" + std::to_string(i));
+    }
+    const std::shared_ptr<const dbg::SymbolIndex> index = builder.build();
+
+    std::vector<std::jthread> readers{};
+    std::vector<int> failures(4);
+    for (std::size_t t = 0; t < failures.size(); ++t)
+    {
+        readers.emplace_back([&, t]()
+        {
+            for (std::uint64_t i = t; i < symbolCount; i += failures.size())
+            {
+                const auto match = index->resolve(MAIN_BASE + i * 0x10 + 7);
+                if (!match.has_value() || match->offset != 7 || match->name != "fn_" + std::to_string(i))
+                {
+                    ++failures[t];
+                }
+            }
+        });
+    }
+    readers.clear();
+
+    for (const auto failureCount : failures)
+    {
+        EXPECT_EQ(failureCount, 0);
+    }
+
+    const auto results = index->search("fn_9999", dbg::SymbolSearchMode::Prefix, 100);
+    ASSERT_EQ(results.size(), 11u);
+    EXPECT_EQ(results.front().name, "fn_9999");
+}
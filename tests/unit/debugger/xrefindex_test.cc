@@ -0,0 +1,241 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <gtest/gtest.h>
+#include <vertex/debugger/xrefindex.hh>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace dbg = Vertex::Debugger;
+
+namespace
+{
+    constexpr std::uint64_t MODULE_BASE = 0x10000;
+    constexpr std::uint64_t MODULE_SIZE = 0x8000;
+    constexpr std::uint64_t INSTRUCTION_SIZE = 12;
+    constexpr std::uint64_t DATA_BASE = 0x900000;
+    constexpr std::uint64_t IMPORT_SLOT = 0x980000;
+    constexpr std::uint64_t MISDECODE_TARGET = 0xBAD;
+
+    [[nodiscard]] std::uint64_t call_target(const std::uint64_t k)
+    {
+        return MODULE_BASE + (k % 7) * 0x100;
+    }
+
+    // Fixed-width stream with a call, a data access, a conditional jump and a call through an import slot
+    // in every five instructions.
+    // Decoding from a misaligned address first yields one bogus instruction, like a real x86 desync.
+    void decode_instruction(const std::uint64_t address, ::DisassemblerResult& out)
+    {
+        out = {};
+        out.address = address;
+        out.size = static_cast<std::uint32_t>(INSTRUCTION_SIZE);
+
+        const auto k = (address - MODULE_BASE) / INSTRUCTION_SIZE;
+        if (k % 50 == 0)
+        {
+            out.flags |= VERTEX_FLAG_ENTRY_POINT;
+        }
+
+        switch (k % 5)
+        {
+            case 0:
+                out.branchType = VERTEX_BRANCH_CALL;
+                out.targetAddress = call_target(k);
+                std::snprintf(out.targetSymbol, sizeof(out.targetSymbol), "fn_%llu", static_cast<unsigned long long>(k % 7));
+                break;
+            case 1:
+                out.branchType = VERTEX_BRANCH_NONE;
+                out.dataAddress = DATA_BASE + (k % 3) * 8;
+                out.dataAccess = k % 2 == 0 ? VERTEX_DATA_ACCESS_WRITE : VERTEX_DATA_ACCESS_READ;
+                out.dataSize = 4;
+                break;
+            case 2:
+                out.branchType = VERTEX_BRANCH_CONDITIONAL;
+                out.targetAddress = address + 0x40;
+                break;
+            case 3:
+                out.branchType = VERTEX_BRANCH_INDIRECT_CALL;
+                out.targetAddress = IMPORT_SLOT;
+                out.dataAddress = IMPORT_SLOT;
+                out.dataAccess = VERTEX_DATA_ACCESS_READ;
+                out.dataSize = 8;
+                break;
+            default:
+                break;
+        }
+    }
+
+    StatusCode fake_disassemble(const std::uint64_t address, const std::uint32_t size, ::DisassemblerResults* results)
+    {
+        const auto end = std::min(address + size, MODULE_BASE + MODULE_SIZE);
+        auto cursor = address;
+        results->count = 0;
+
+        if (const auto misalignment = (cursor - MODULE_BASE) % INSTRUCTION_SIZE; misalignment != 0)
+        {
+            auto& bogus = results->results[results->count++];
+            bogus = {};
+            bogus.address = cursor;
+            bogus.size = static_cast<std::uint32_t>(INSTRUCTION_SIZE - misalignment);
+            bogus.targetAddress = MISDECODE_TARGET;
+            cursor += bogus.size;
+        }
+
+        while (cursor + INSTRUCTION_SIZE <= end && results->count < results->capacity)
+        {
+            decode_instruction(cursor, results->results[results->count++]);
+            cursor += INSTRUCTION_SIZE;
+        }
+
+        return StatusCode::STATUS_OK;
+    }
+
+    StatusCode compact_disassemble(const std::uint64_t address, const std::uint32_t size, ::CompactDisassembly* results)
+    {
+        return dbg::disassemble_compact_from_legacy(fake_disassemble, address, size, results);
+    }
+
+    [[nodiscard]] dbg::XrefIndexBuildOptions parallel_options()
+    {
+        return dbg::XrefIndexBuildOptions{
+            .workerCount = 4,
+            .sliceBytes = 4096,
+            .chunkBytes = 512,
+            .chunkInstructions = 16
+        };
+    }
+
+    [[nodiscard]] std::vector<std::uint64_t> sources_of(const std::span<const dbg::XrefRecord> records)
+    {
+        std::vector<std::uint64_t> sources{};
+        for (const auto& record : records)
+        {
+            sources.push_back(record.source);
+        }
+        return sources;
+    }
+}
+
+TEST(ModuleXrefIndexTest, ReferencesToReturnsEveryCaller)
+{
+    const auto index = dbg::ModuleXrefIndex::build(MODULE_BASE, MODULE_SIZE, compact_disassemble, parallel_options());
+
+    std::vector<std::uint64_t> expected{};
+    for (std::uint64_t k = 0; (k + 1) * INSTRUCTION_SIZE <= MODULE_SIZE; ++k)
+    {
+        if (k % 5 == 0 && call_target(k) == MODULE_BASE + 0x300)
+        {
+            expected.push_back(MODULE_BASE + k * INSTRUCTION_SIZE);
+        }
+    }
+
+    const auto refs = index->references_to(MODULE_BASE + 0x300);
+    ASSERT_FALSE(expected.empty());
+    EXPECT_EQ(sources_of(refs), expected);
+    for (const auto& ref : refs)
+    {
+        EXPECT_EQ(ref.type, dbg::XrefType::Call);
+    }
+    EXPECT_EQ(index->target_symbol(MODULE_BASE + 0x300), "fn_3");
+}
+
+TEST(ModuleXrefIndexTest, ParallelBuildMatchesSingleSweep)
+{
+    const auto parallel = dbg::ModuleXrefIndex::build(MODULE_BASE, MODULE_SIZE, compact_disassemble, parallel_options());
+
+    auto serialOptions = parallel_options();
+    serialOptions.workerCount = 1;
+    serialOptions.sliceBytes = MODULE_SIZE;
+    const auto serial = dbg::ModuleXrefIndex::build(MODULE_BASE, MODULE_SIZE, compact_disassemble, serialOptions);
+
+    const auto parallelRefs = parallel->references_from(MODULE_BASE, MODULE_BASE + MODULE_SIZE);
+    const auto serialRefs = serial->references_from(MODULE_BASE, MODULE_BASE + MODULE_SIZE);
+
+    std::size_t expectedCount{};
+    for (std::uint64_t k = 0; (k + 1) * INSTRUCTION_SIZE <= MODULE_SIZE; ++k)
+    {
+        expectedCount += k % 5 < 4 ? 1 : 0;
+    }
+
+    EXPECT_EQ(parallel->reference_count(), expectedCount);
+    ASSERT_EQ(parallelRefs.size(), serialRefs.size());
+    for (std::size_t i = 0; i < parallelRefs.size(); ++i)
+    {
+        EXPECT_EQ(parallelRefs[i].source, serialRefs[i].source);
+        EXPECT_EQ(parallelRefs[i].target, serialRefs[i].target);
+        EXPECT_EQ(parallelRefs[i].type, serialRefs[i].type);
+    }
+    EXPECT_TRUE(parallel->references_to(MISDECODE_TARGET).empty());
+}
+
+TEST(ModuleXrefIndexTest, DataReferencesAreIndexedByTarget)
+{
+    const auto index = dbg::ModuleXrefIndex::build(MODULE_BASE, MODULE_SIZE, compact_disassemble, parallel_options());
+
+    const auto refs = index->references_to(DATA_BASE + 8);
+    ASSERT_FALSE(refs.empty());
+    EXPECT_TRUE(std::ranges::is_sorted(sources_of(refs)));
+    for (const auto& ref : refs)
+    {
+        const auto k = (ref.source - MODULE_BASE) / INSTRUCTION_SIZE;
+        EXPECT_EQ(ref.type, dbg::XrefType::Data);
+        EXPECT_EQ(k % 3, 1u);
+        EXPECT_EQ(ref.access, k % 2 == 0 ? dbg::XrefAccess::Write : dbg::XrefAccess::Read);
+        EXPECT_EQ(ref.operandSize, 4u);
+    }
+}
+
+TEST(ModuleXrefIndexTest, CallThroughSlotIsIndexedOnceAsDataRead)
+{
+    const auto index = dbg::ModuleXrefIndex::build(MODULE_BASE, MODULE_SIZE, compact_disassemble, parallel_options());
+
+    const auto refs = index->references_to(IMPORT_SLOT);
+    ASSERT_FALSE(refs.empty());
+    for (std::size_t i = 0; i < refs.size(); ++i)
+    {
+        EXPECT_EQ(refs[i].type, dbg::XrefType::Data);
+        EXPECT_EQ(refs[i].access, dbg::XrefAccess::Read);
+        EXPECT_EQ(refs[i].operandSize, 8u);
+        if (i > 0)
+        {
+            EXPECT_LT(refs[i - 1].source, refs[i].source);
+        }
+    }
+}
+
+TEST(ModuleXrefIndexTest, FunctionBoundsAndSourceRange)
+{
+    const auto index = dbg::ModuleXrefIndex::build(MODULE_BASE, MODULE_SIZE, compact_disassemble, parallel_options());
+
+    const std::uint64_t functionStart = MODULE_BASE + 50 * INSTRUCTION_SIZE;
+    const std::uint64_t nextFunction = MODULE_BASE + 100 * INSTRUCTION_SIZE;
+    const std::uint64_t inside = functionStart + 7 * INSTRUCTION_SIZE;
+
+    EXPECT_EQ(index->function_start_at_or_before(inside), functionStart);
+    EXPECT_EQ(index->function_start_at_or_before(functionStart), functionStart);
+    EXPECT_EQ(index->function_start_after(inside), nextFunction);
+    EXPECT_FALSE(index->function_start_at_or_before(MODULE_BASE - 1).has_value());
+
+    const auto refs = index->references_from(functionStart, nextFunction);
+    EXPECT_EQ(refs.size(), 40u);
+    EXPECT_EQ(refs.front().source, functionStart);
+    EXPECT_LT(refs.back().source, nextFunction);
+    EXPECT_TRUE(index->references_from(nextFunction, functionStart).empty());
+}
+
+TEST(ModuleXrefIndexTest, FailedReadsYieldEmptyIndex)
+{
+    const auto index = dbg::ModuleXrefIndex::build(MODULE_BASE, MODULE_SIZE,
+        [](std::uint64_t, std::uint32_t, ::CompactDisassembly*) { return StatusCode::STATUS_ERROR_MEMORY_READ; },
+        parallel_options());
+
+    EXPECT_EQ(index->reference_count(), 0u);
+    EXPECT_TRUE(index->overlaps(MODULE_BASE + MODULE_SIZE - 1, 1));
+    EXPECT_FALSE(index->overlaps(MODULE_BASE + MODULE_SIZE, 0x1000));
+    EXPECT_FALSE(index->function_start_after(MODULE_BASE).has_value());
+}
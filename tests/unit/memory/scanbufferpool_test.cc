@@ -0,0 +1,61 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <gtest/gtest.h>
+#include <vertex/memory/scanbufferpool.hh>
+
+#include <algorithm>
+
+using Vertex::Memory::ScanBuffer;
+using Vertex::Memory::ScanBufferPool;
+
+TEST(ScanBufferPoolTest, Reserve_CreatesOneWritableBufferPerWorker)
+{
+    ScanBufferPool pool{};
+    ASSERT_EQ(StatusCode::STATUS_OK, pool.reserve(3, 1024 * 1024, false));
+    ASSERT_EQ(3U, pool.worker_count());
+
+    for (std::size_t i = 0; i < pool.worker_count(); ++i)
+    {
+        const auto buffer = pool.acquire(i, 1024 * 1024);
+        ASSERT_GE(buffer.size(), 1024U * 1024U);
+        EXPECT_EQ(0U, buffer.size() % ScanBuffer::HUGE_PAGE_SIZE);
+
+        std::fill(buffer.begin(), buffer.end(), static_cast<char>(i + 1));
+        EXPECT_EQ(static_cast<char>(i + 1), buffer.back());
+    }
+
+    EXPECT_EQ(3U * ScanBuffer::HUGE_PAGE_SIZE, pool.total_capacity());
+}
+
+TEST(ScanBufferPoolTest, Reserve_KeepsBuffersWarmAcrossScans)
+{
+    ScanBufferPool pool{};
+    ASSERT_EQ(StatusCode::STATUS_OK, pool.reserve(2, 4 * 1024 * 1024, true));
+    const char* first = pool.acquire(0, 1).data();
+    const char* second = pool.acquire(1, 1).data();
+
+    ASSERT_EQ(StatusCode::STATUS_OK, pool.reserve(2, 1024 * 1024, true));
+    EXPECT_EQ(first, pool.acquire(0, 1).data());
+    EXPECT_EQ(second, pool.acquire(1, 1).data());
+}
+
+TEST(ScanBufferPoolTest, Acquire_GrowsOnlyTheRequestedSlot)
+{
+    ScanBufferPool pool{};
+    ASSERT_EQ(StatusCode::STATUS_OK, pool.reserve(2, 1024 * 1024, false));
+    const char* untouched = pool.acquire(1, 1).data();
+
+    const auto grown = pool.acquire(0, 3 * ScanBuffer::HUGE_PAGE_SIZE);
+    EXPECT_GE(grown.size(), 3 * ScanBuffer::HUGE_PAGE_SIZE);
+    EXPECT_EQ(untouched, pool.acquire(1, 1).data());
+    EXPECT_TRUE(pool.acquire(2, 1).empty());
+}
+
+TEST(ScanBufferPoolTest, Reserve_RejectsEmptyRequests)
+{
+    ScanBufferPool pool{};
+    EXPECT_EQ(StatusCode::STATUS_ERROR_INVALID_PARAMETER, pool.reserve(0, 1024, false));
+    EXPECT_EQ(StatusCode::STATUS_ERROR_INVALID_PARAMETER, pool.reserve(1, 0, false));
+}
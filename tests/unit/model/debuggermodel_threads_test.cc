@@ -0,0 +1,316 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <vertex/model/debuggermodel.hh>
+#include <vertex/runtime/plugin.hh>
+
+#include "../../mocks/MockISettings.hh"
+#include "../../mocks/MockILoader.hh"
+#include "../../mocks/MockILog.hh"
+#include "../../mocks/MockIThreadDispatcher.hh"
+
+#include <wx/app.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <expected>
+#include <future>
+#include <optional>
+#include <vector>
+
+using namespace Vertex::Debugger;
+using namespace Vertex::Model;
+using namespace Vertex::Testing::Mocks;
+using namespace Vertex::Thread;
+using namespace testing;
+
+namespace
+{
+    struct ThreadStubContext final
+    {
+        std::size_t snapshotCalls{};
+        std::size_t freeCalls{};
+        std::size_t threadListCalls{};
+        std::size_t registerCalls{};
+        std::size_t callStackCalls{};
+        std::uint32_t lastRegisterMask{};
+        std::uint32_t lastMaxFrames{};
+    };
+
+    ThreadStubContext* g_threadStubContext{};
+
+    void fill_thread(::ThreadInfo& thread, const std::uint32_t id, const std::uint64_t ip)
+    {
+        thread.id = id;
+        std::snprintf(thread.name, sizeof(thread.name), "worker-%u", id);
+        thread.state = VERTEX_THREAD_SUSPENDED;
+        thread.instructionPointer = ip;
+        thread.stackPointer = ip + 0x1000;
+    }
+
+    StatusCode VERTEX_API stub_get_thread_snapshot(const ::ThreadSnapshotRequest* request, ::ThreadSnapshot* snapshot)
+    {
+        if (g_threadStubContext == nullptr || request == nullptr || snapshot == nullptr)
+        {
+            return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        g_threadStubContext->snapshotCalls++;
+        g_threadStubContext->lastRegisterMask = request->registerCategoryMask;
+        g_threadStubContext->lastMaxFrames = request->maxFrames;
+
+        constexpr std::size_t THREADS = 2;
+        constexpr std::size_t REGISTERS = 2;
+        constexpr std::size_t FRAMES = 3;
+        const std::size_t registerOffset = THREADS * sizeof(::ThreadSnapshotEntry);
+        const std::size_t frameOffset = registerOffset + REGISTERS * sizeof(::Register);
+        auto* block = static_cast<std::byte*>(std::calloc(1, frameOffset + FRAMES * sizeof(::StackFrame)));
+
+        snapshot->threads = reinterpret_cast<::ThreadSnapshotEntry*>(block);
+        snapshot->registers = reinterpret_cast<::Register*>(block + registerOffset);
+        snapshot->frames = reinterpret_cast<::StackFrame*>(block + frameOffset);
+        snapshot->threadCount = THREADS;
+        snapshot->registerCount = REGISTERS;
+        snapshot->frameCount = FRAMES;
+        snapshot->currentThreadId = 100;
+
+        fill_thread(snapshot->threads[0].thread, 100, 0x401000);
+        snapshot->threads[0].firstRegister = 0;
+        snapshot->threads[0].registerCount = 1;
+        snapshot->threads[0].firstFrame = 0;
+        snapshot->threads[0].frameCount = 1;
+
+        fill_thread(snapshot->threads[1].thread, 200, 0x402000);
+        snapshot->threads[1].basePointer = 0x7000;
+        snapshot->threads[1].firstRegister = 1;
+        snapshot->threads[1].registerCount = 1;
+        snapshot->threads[1].firstFrame = 1;
+        snapshot->threads[1].frameCount = 2;
+
+        std::strcpy(snapshot->registers[0].name, "rax");
+        snapshot->registers[0].category = VERTEX_REG_GENERAL;
+        snapshot->registers[0].value = 1;
+        std::strcpy(snapshot->registers[1].name, "rflags");
+        snapshot->registers[1].category = VERTEX_REG_FLAGS;
+        snapshot->registers[1].value = 0x246;
+
+        for (std::uint32_t i{}; i < FRAMES; ++i)
+        {
+            snapshot->frames[i].frameIndex = i == 0 ? 0 : i - 1;
+            snapshot->frames[i].returnAddress = 0x500000 + i;
+            std::snprintf(snapshot->frames[i].functionName, sizeof(snapshot->frames[i].functionName), "fn%u", i);
+        }
+
+        return StatusCode::STATUS_OK;
+    }
+
+    StatusCode VERTEX_API stub_free_thread_snapshot(::ThreadSnapshot* snapshot)
+    {
+        if (g_threadStubContext != nullptr)
+        {
+            g_threadStubContext->freeCalls++;
+        }
+        std::free(snapshot->threads);
+        *snapshot = {};
+        return StatusCode::STATUS_OK;
+    }
+
+    StatusCode VERTEX_API stub_get_threads(::ThreadList* threadList)
+    {
+        if (g_threadStubContext == nullptr || threadList == nullptr)
+        {
+            return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        g_threadStubContext->threadListCalls++;
+        fill_thread(threadList->threads[0], 300, 0x403000);
+        threadList->threadCount = 1;
+        threadList->currentThreadId = 300;
+        return StatusCode::STATUS_OK;
+    }
+
+    StatusCode VERTEX_API stub_get_registers([[maybe_unused]] const std::uint32_t threadId, ::RegisterSet* registers)
+    {
+        if (g_threadStubContext != nullptr)
+        {
+            g_threadStubContext->registerCalls++;
+        }
+        *registers = {};
+        return StatusCode::STATUS_OK;
+    }
+
+    StatusCode VERTEX_API stub_get_call_stack([[maybe_unused]] const std::uint32_t threadId, ::CallStack* callStack)
+    {
+        if (g_threadStubContext != nullptr)
+        {
+            g_threadStubContext->callStackCalls++;
+        }
+        *callStack = {};
+        return StatusCode::STATUS_OK;
+    }
+}
+
+class DebuggerModelThreadsTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        if (!wxTheApp)
+        {
+            wxInitialize();
+        }
+    }
+
+    static void TearDownTestSuite()
+    {
+        if (wxTheApp)
+        {
+            wxUninitialize();
+        }
+    }
+
+    void SetUp() override
+    {
+        m_settings = std::make_unique<NiceMock<MockISettings>>();
+        m_loader = std::make_unique<NiceMock<MockILoader>>();
+        m_logger = std::make_unique<NiceMock<MockILog>>();
+        m_dispatcher = std::make_unique<NiceMock<MockIThreadDispatcher>>();
+
+        ON_CALL(*m_dispatcher, dispatch_with_priority(_, _, _))
+            .WillByDefault(Invoke(
+                []([[maybe_unused]] ThreadChannel channel,
+                   [[maybe_unused]] DispatchPriority priority,
+                   std::packaged_task<StatusCode()>&& task)
+                    -> std::expected<std::future<StatusCode>, StatusCode>
+                {
+                    auto future = task.get_future();
+                    task();
+                    return future;
+                }));
+
+        ON_CALL(*m_dispatcher, schedule_recurring(_, _, _, _, _, _))
+            .WillByDefault(Return(std::expected<RecurringTaskHandle, StatusCode>{RecurringTaskHandle{1}}));
+        ON_CALL(*m_dispatcher, schedule_recurring_persistent(_, _, _, _, _, _))
+            .WillByDefault(Return(std::expected<RecurringTaskHandle, StatusCode>{RecurringTaskHandle{2}}));
+        ON_CALL(*m_dispatcher, cancel_recurring(_))
+            .WillByDefault(Return(StatusCode::STATUS_OK));
+
+        m_model = std::make_unique<DebuggerModel>(
+            *m_settings, *m_loader, *m_logger, *m_dispatcher);
+
+        g_threadStubContext = &m_stubContext;
+    }
+
+    void TearDown() override
+    {
+        g_threadStubContext = nullptr;
+        m_model.reset();
+    }
+
+    void flush_pending_wx_events() const
+    {
+        if (wxTheApp)
+        {
+            wxTheApp->ProcessPendingEvents();
+        }
+    }
+
+    void setup_plugin(Vertex::Runtime::Plugin& plugin) const
+    {
+        ON_CALL(*m_loader, has_plugin_loaded())
+            .WillByDefault(Return(StatusCode::STATUS_OK));
+        ON_CALL(*m_loader, get_active_plugin())
+            .WillByDefault(Return(std::optional<std::reference_wrapper<Vertex::Runtime::Plugin>>{std::ref(plugin)}));
+    }
+
+    std::unique_ptr<NiceMock<MockISettings>> m_settings;
+    std::unique_ptr<NiceMock<MockILoader>> m_loader;
+    std::unique_ptr<NiceMock<MockILog>> m_logger;
+    std::unique_ptr<NiceMock<MockIThreadDispatcher>> m_dispatcher;
+    std::unique_ptr<DebuggerModel> m_model;
+
+    ThreadStubContext m_stubContext{};
+};
+
+TEST_F(DebuggerModelThreadsTest, RequestThreadsLoadsEveryThreadFromOneSnapshot)
+{
+    Vertex::Runtime::Plugin plugin{*m_logger};
+    plugin.internal_vertex_debugger_get_thread_snapshot = stub_get_thread_snapshot;
+    plugin.internal_vertex_debugger_free_thread_snapshot = stub_free_thread_snapshot;
+    plugin.internal_vertex_debugger_get_threads = stub_get_threads;
+    setup_plugin(plugin);
+
+    m_model->request_threads();
+    flush_pending_wx_events();
+
+    EXPECT_EQ(m_stubContext.snapshotCalls, 1u);
+    EXPECT_EQ(m_stubContext.freeCalls, 1u);
+    EXPECT_EQ(m_stubContext.threadListCalls, 0u);
+    EXPECT_EQ(m_stubContext.lastRegisterMask, VERTEX_REGISTER_CATEGORY_ALL);
+    EXPECT_GT(m_stubContext.lastMaxFrames, 0u);
+
+    const auto& threads = m_model->get_cached_threads();
+    ASSERT_EQ(threads.size(), 2u);
+    EXPECT_EQ(threads[0].id, 100u);
+    EXPECT_TRUE(threads[0].isCurrent);
+    EXPECT_EQ(threads[1].id, 200u);
+    EXPECT_EQ(threads[1].name, "worker-200");
+    EXPECT_EQ(threads[1].instructionPointer, 0x402000u);
+    EXPECT_EQ(threads[1].state, Vertex::Debugger::ThreadState::Suspended);
+}
+
+TEST_F(DebuggerModelThreadsTest, SelectThreadServesRegistersAndCallStackFromSnapshot)
+{
+    Vertex::Runtime::Plugin plugin{*m_logger};
+    plugin.internal_vertex_debugger_get_thread_snapshot = stub_get_thread_snapshot;
+    plugin.internal_vertex_debugger_free_thread_snapshot = stub_free_thread_snapshot;
+    plugin.internal_vertex_debugger_get_registers = stub_get_registers;
+    plugin.internal_vertex_debugger_get_call_stack = stub_get_call_stack;
+    setup_plugin(plugin);
+
+    m_model->request_threads();
+    flush_pending_wx_events();
+
+    ASSERT_EQ(m_model->select_thread(200), StatusCode::STATUS_OK);
+    flush_pending_wx_events();
+
+    EXPECT_EQ(m_stubContext.registerCalls, 0u);
+    EXPECT_EQ(m_stubContext.callStackCalls, 0u);
+
+    const auto& registers = m_model->get_cached_registers();
+    EXPECT_EQ(registers.instructionPointer, 0x402000u);
+    EXPECT_EQ(registers.basePointer, 0x7000u);
+    EXPECT_TRUE(registers.generalPurpose.empty());
+    ASSERT_EQ(registers.flags.size(), 1u);
+    EXPECT_EQ(registers.flags[0].name, "rflags");
+    EXPECT_EQ(registers.flags[0].value, 0x246u);
+
+    const auto& callStack = m_model->get_cached_call_stack();
+    ASSERT_EQ(callStack.frames.size(), 2u);
+    EXPECT_EQ(callStack.frames[0].functionName, "fn1");
+    EXPECT_EQ(callStack.frames[1].returnAddress, 0x500002u);
+    EXPECT_EQ(m_model->get_current_thread_id(), 200u);
+}
+
+TEST_F(DebuggerModelThreadsTest, RequestThreadsFallsBackToThreadListWithoutSnapshotSupport)
+{
+    Vertex::Runtime::Plugin plugin{*m_logger};
+    plugin.internal_vertex_debugger_get_threads = stub_get_threads;
+    setup_plugin(plugin);
+
+    m_model->request_threads();
+    flush_pending_wx_events();
+
+    EXPECT_EQ(m_stubContext.threadListCalls, 1u);
+
+    const auto& threads = m_model->get_cached_threads();
+    ASSERT_EQ(threads.size(), 1u);
+    EXPECT_EQ(threads[0].id, 300u);
+    EXPECT_TRUE(threads[0].isCurrent);
+}
@@ -11,6 +11,7 @@
 #include <vertex/model/mainmodel.hh>
 #include <vertex/scanner/scanner_command.hh>
 #include <vertex/utility.hh>
+#include <cstdlib>
 #include "../../mocks/MockISettings.hh"
 #include "../../mocks/MockIMemoryScanner.hh"
 #include "../../mocks/MockIScannerRuntimeService.hh"
@@ -44,6 +45,13 @@ protected:
                 return future;
             });
 
+        ON_CALL(*mockDispatcher, dispatch_fire_and_forget(_, _))
+            .WillByDefault([](Vertex::Thread::ThreadChannel, std::packaged_task<StatusCode()>&& task) -> StatusCode
+            {
+                task();
+                return StatusCode::STATUS_OK;
+            });
+
         model = std::make_unique<Vertex::Model::MainModel>(
             *mockSettings,
             *mockScanner,
@@ -345,3 +353,69 @@ TEST_F(MainModelTest, ValidateInput_InvalidInput_ReturnsError)
     
     EXPECT_EQ(StatusCode::STATUS_ERROR_INVALID_PARAMETER, result);
 }
+
+TEST_F(MainModelTest, QueryRegionChanges_ValidPlugin_CopiesChangesAndGeneration)
+{
+    EXPECT_CALL(*mockLoader, has_plugin_loaded())
+        .WillRepeatedly(Return(StatusCode::STATUS_OK));
+
+    Vertex::Runtime::Plugin mockPlugin{*mockLogger};
+    mockPlugin.set_library(Vertex::Runtime::Library::create_stub());
+    mockPlugin.internal_vertex_memory_query_region_changes = [](std::uint64_t sinceGeneration, RegionChange** changes, std::uint32_t* count, std::uint64_t* generation) {
+        *changes = static_cast<RegionChange*>(std::malloc(sizeof(RegionChange) * 2));
+        (*changes)[0] = {.baseAddress = 0x1000, .regionSize = 0x2000, .kind = VERTEX_REGION_REMOVED, .protection = VERTEX_REGION_READ};
+        (*changes)[1] = {.baseAddress = 0x1000, .regionSize = 0x1000, .kind = VERTEX_REGION_ADDED, .protection = VERTEX_REGION_READ | VERTEX_REGION_WRITE};
+        *count = 2;
+        *generation = sinceGeneration + 1;
+        return StatusCode::STATUS_OK;
+    };
+
+    EXPECT_CALL(*mockLoader, get_active_plugin())
+        .WillRepeatedly(Return(std::optional<std::reference_wrapper<Vertex::Runtime::Plugin>>(mockPlugin)));
+
+    StatusCode status{StatusCode::STATUS_ERROR_GENERAL};
+    std::vector<RegionChange> changes{};
+    std::uint64_t generation{};
+    StatusCode result = model->query_region_changes(41, [&](const StatusCode completed, std::vector<RegionChange> received, const std::uint64_t receivedGeneration)
+    {
+        status = completed;
+        changes = std::move(received);
+        generation = receivedGeneration;
+    });
+
+    EXPECT_EQ(StatusCode::STATUS_OK, result);
+    EXPECT_EQ(StatusCode::STATUS_OK, status);
+    EXPECT_EQ(42U, generation);
+    ASSERT_EQ(2U, changes.size());
+    EXPECT_EQ(VERTEX_REGION_REMOVED, changes[0].kind);
+    EXPECT_EQ(VERTEX_REGION_ADDED, changes[1].kind);
+    EXPECT_EQ(0x1000U, changes[1].regionSize);
+}
+
+TEST_F(MainModelTest, QueryRegionChanges_FunctionNotImplemented_ReturnsError)
+{
+    EXPECT_CALL(*mockLoader, has_plugin_loaded())
+        .WillRepeatedly(Return(StatusCode::STATUS_OK));
+
+    Vertex::Runtime::Plugin mockPlugin{*mockLogger};
+    mockPlugin.set_library(Vertex::Runtime::Library::create_stub());
+    mockPlugin.internal_vertex_memory_query_region_changes = nullptr;
+
+    EXPECT_CALL(*mockLoader, get_active_plugin())
+        .WillRepeatedly(Return(std::optional<std::reference_wrapper<Vertex::Runtime::Plugin>>(mockPlugin)));
+
+    StatusCode status{StatusCode::STATUS_OK};
+    std::vector<RegionChange> changes{};
+    std::uint64_t generation{};
+    StatusCode result = model->query_region_changes(7, [&](const StatusCode completed, std::vector<RegionChange> received, const std::uint64_t receivedGeneration)
+    {
+        status = completed;
+        changes = std::move(received);
+        generation = receivedGeneration;
+    });
+
+    EXPECT_EQ(StatusCode::STATUS_OK, result);
+    EXPECT_EQ(StatusCode::STATUS_ERROR_PLUGIN_FUNCTION_NOT_IMPLEMENTED, status);
+    EXPECT_TRUE(changes.empty());
+    EXPECT_EQ(7U, generation);
+}
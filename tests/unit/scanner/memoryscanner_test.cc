@@ -9,10 +9,13 @@
 #include "../../mocks/MockISettings.hh"
 #include "../../mocks/MockILog.hh"
 #include "../../mocks/MockIThreadDispatcher.hh"
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <mutex>
 #include <thread>
 
@@ -28,6 +31,89 @@ namespace
     public:
         MOCK_METHOD(StatusCode, read_memory, (std::uint64_t address, std::uint64_t size, void* buffer), (override));
     };
+
+    class MockBulkMemoryReader : public MockMemoryReader
+    {
+    public:
+        [[nodiscard]] bool supports_bulk_read() const noexcept override { return true; }
+        MOCK_METHOD(StatusCode, read_memory_bulk, (std::span<const Vertex::Scanner::BulkReadRequest> requests, std::span<Vertex::Scanner::BulkReadResult> results), (override));
+    };
+
+    class MockResidencyMemoryReader : public MockMemoryReader
+    {
+    public:
+        [[nodiscard]] bool supports_residency_query() const noexcept override { return true; }
+        MOCK_METHOD(StatusCode, query_resident_pages, (std::uint64_t address, std::uint64_t size, std::span<std::uint8_t> bitmap, std::uint64_t& pageSize), (override));
+    };
+
+    class FakeAsyncMemoryReader : public MockMemoryReader
+    {
+    public:
+        FakeAsyncMemoryReader(const std::uint64_t base, std::vector<std::uint8_t> memory)
+            : m_base(base), m_memory(std::move(memory))
+        {
+        }
+
+        [[nodiscard]] bool supports_async_read() const noexcept override { return true; }
+
+        StatusCode open_read_queue(const std::uint32_t depth, std::uint64_t& queue) override
+        {
+            m_depth = depth;
+            queue = 1;
+            ++m_openQueues;
+            return StatusCode::STATUS_OK;
+        }
+
+        StatusCode submit_reads(std::uint64_t, std::span<const Vertex::Scanner::AsyncReadRequest> requests) override
+        {
+            if (m_pending.size() + requests.size() > m_depth)
+            {
+                return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+            }
+            m_maxInFlight = std::max(m_maxInFlight, m_pending.size() + requests.size());
+            m_pending.insert(m_pending.end(), requests.begin(), requests.end());
+            return StatusCode::STATUS_OK;
+        }
+
+        // Completes in reverse submission order to make sure the scanner does not rely on ordering.
+        StatusCode complete_reads(std::uint64_t, std::span<Vertex::Scanner::AsyncReadCompletion> completions, bool, std::uint32_t& completed) override
+        {
+            completed = 0;
+            while (!m_pending.empty() && completed < completions.size())
+            {
+                const auto request = m_pending.back();
+                m_pending.pop_back();
+                std::memcpy(request.buffer, m_memory.data() + (request.address - m_base), static_cast<std::size_t>(request.size));
+                completions[completed++] = {request.userData, StatusCode::STATUS_OK};
+            }
+            return StatusCode::STATUS_OK;
+        }
+
+        StatusCode close_read_queue(std::uint64_t) override
+        {
+            --m_openQueues;
+            return m_pending.empty() ? StatusCode::STATUS_OK : StatusCode::STATUS_ERROR_GENERAL;
+        }
+
+        [[nodiscard]] std::size_t max_in_flight() const noexcept { return m_maxInFlight; }
+        [[nodiscard]] int open_queues() const noexcept { return m_openQueues; }
+
+    private:
+        std::uint64_t m_base{};
+        std::vector<std::uint8_t> m_memory{};
+        std::uint32_t m_depth{};
+        std::vector<Vertex::Scanner::AsyncReadRequest> m_pending{};
+        std::size_t m_maxInFlight{};
+        int m_openQueues{};
+    };
+
+    class MockDirtyTrackingMemoryReader : public MockMemoryReader
+    {
+    public:
+        [[nodiscard]] bool supports_dirty_tracking() const noexcept override { return true; }
+        MOCK_METHOD(StatusCode, reset_dirty_tracking, (), (override));
+        MOCK_METHOD(StatusCode, query_dirty_pages, (std::uint64_t address, std::uint64_t size, std::span<std::uint8_t> bitmap, std::uint64_t& pageSize), (override));
+    };
 }
 
 class MemoryScannerTest : public ::testing::Test
@@ -570,3 +656,880 @@ TEST_F(MemoryScannerTest, GetScanResults_UsesReadableRegionCountsDuringInProgres
     EXPECT_EQ(StatusCode::STATUS_OK, initialScanStatus);
     EXPECT_TRUE(scanner->is_scan_complete());
 }
+
+TEST_F(MemoryScannerTest, ReadScanResultsPage_ResolvesArbitraryStartIndexWithoutEntries)
+{
+    ON_CALL(*mockSettings, get_int(::testing::HasSubstr("readerThreads"), _)).WillByDefault(Return(1));
+
+    auto mockReader = std::make_shared<NiceMock<MockMemoryReader>>();
+    scanner->set_memory_reader(mockReader);
+
+    constexpr std::int32_t expectedValue = 1337;
+    ON_CALL(*mockReader, read_memory(_, _, _))
+      .WillByDefault(Invoke(
+        [expectedValue](std::uint64_t, std::uint64_t size, void* buffer) -> StatusCode
+        {
+            if (buffer == nullptr || size < sizeof(expectedValue))
+            {
+                return StatusCode::STATUS_ERROR_INVALID_PARAMETER;
+            }
+
+            auto* bytes = static_cast<std::uint8_t*>(buffer);
+            for (std::uint64_t offset = 0; offset + sizeof(expectedValue) <= size; offset += sizeof(expectedValue))
+            {
+                std::memcpy(bytes + offset, &expectedValue, sizeof(expectedValue));
+            }
+            return StatusCode::STATUS_OK;
+        }));
+
+    ON_CALL(*mockDispatcher, enqueue_on_worker(_, _, _))
+      .WillByDefault(Invoke(
+        [](Vertex::Thread::ThreadChannel, std::size_t, std::packaged_task<StatusCode()>&& task) -> StatusCode
+        {
+            task();
+            return StatusCode::STATUS_OK;
+        }));
+
+    Vertex::Scanner::ScanConfiguration config{};
+    config.valueType = Vertex::Scanner::ValueType::Int32;
+    config.scanMode = static_cast<std::uint8_t>(Vertex::Scanner::NumericScanMode::Exact);
+    config.alignmentRequired = true;
+    config.alignment = sizeof(expectedValue);
+    const auto* valueBytes = reinterpret_cast<const std::uint8_t*>(&expectedValue);
+    config.input.assign(valueBytes, valueBytes + sizeof(expectedValue));
+
+    std::vector<Vertex::Scanner::ScanRegion> regions{
+        Vertex::Scanner::ScanRegion{.baseAddress = 0x1000, .size = 4 * sizeof(expectedValue)}
+    };
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_scan(config, Vertex::Scanner::make_builtin_schema(config.valueType), regions));
+    ASSERT_TRUE(scanner->is_scan_complete());
+    ASSERT_EQ(4U, scanner->get_results_count());
+
+    Vertex::Scanner::ScanResultPage page{};
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->read_scan_results_page(page, 1, 2, true));
+    ASSERT_EQ(2U, page.size());
+    EXPECT_EQ(0x1004U, page.address_at(0));
+    EXPECT_EQ(0x1008U, page.address_at(1));
+
+    const auto record = page[1];
+    ASSERT_EQ(sizeof(expectedValue), record.previousValue.size());
+    ASSERT_EQ(sizeof(expectedValue), record.currentValue.size());
+    EXPECT_EQ(0, std::memcmp(record.previousValue.data(), &expectedValue, sizeof(expectedValue)));
+    EXPECT_EQ(0, std::memcmp(record.currentValue.data(), &expectedValue, sizeof(expectedValue)));
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->read_scan_results_page(page, 3, 10, false));
+    ASSERT_EQ(1U, page.size());
+    EXPECT_EQ(0x100CU, page.address_at(0));
+    EXPECT_TRUE(page[0].currentValue.empty());
+
+    EXPECT_EQ(StatusCode::STATUS_ERROR_INVALID_PARAMETER, scanner->read_scan_results_page(page, 4, 1, false));
+}
+
+TEST_F(MemoryScannerTest, ExportImportSession_RebasesModuleRelativeResults)
+{
+    ON_CALL(*mockSettings, get_int(::testing::HasSubstr("readerThreads"), _)).WillByDefault(Return(2));
+
+    auto mockReader = std::make_shared<NiceMock<MockMemoryReader>>();
+    scanner->set_memory_reader(mockReader);
+
+    constexpr std::int32_t expectedValue = 4242;
+    ON_CALL(*mockReader, read_memory(_, _, _))
+      .WillByDefault(Invoke(
+        [expectedValue](std::uint64_t, std::uint64_t size, void* buffer) -> StatusCode
+        {
+            auto* bytes = static_cast<std::uint8_t*>(buffer);
+            for (std::uint64_t offset = 0; offset + sizeof(expectedValue) <= size; offset += sizeof(expectedValue))
+            {
+                std::memcpy(bytes + offset, &expectedValue, sizeof(expectedValue));
+            }
+            return StatusCode::STATUS_OK;
+        }));
+
+    ON_CALL(*mockDispatcher, enqueue_on_worker(_, _, _))
+      .WillByDefault(Invoke(
+        [](Vertex::Thread::ThreadChannel, std::size_t, std::packaged_task<StatusCode()>&& task) -> StatusCode
+        {
+            task();
+            return StatusCode::STATUS_OK;
+        }));
+
+    Vertex::Scanner::ScanConfiguration config{};
+    config.typeId = Vertex::Scanner::builtin_type_id(Vertex::Scanner::ValueType::Int32);
+    config.valueType = Vertex::Scanner::ValueType::Int32;
+    config.scanMode = static_cast<std::uint8_t>(Vertex::Scanner::NumericScanMode::Exact);
+    config.alignment = sizeof(expectedValue);
+    const auto* valueBytes = reinterpret_cast<const std::uint8_t*>(&expectedValue);
+    config.input.assign(valueBytes, valueBytes + sizeof(expectedValue));
+
+    std::vector<Vertex::Scanner::ScanRegion> regions{
+        Vertex::Scanner::ScanRegion{.baseAddress = 0x1000, .size = 2 * sizeof(expectedValue)},
+        Vertex::Scanner::ScanRegion{.baseAddress = 0x9000, .size = sizeof(expectedValue)}
+    };
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_scan(config, Vertex::Scanner::make_builtin_schema(config.valueType), regions));
+    ASSERT_TRUE(scanner->is_scan_complete());
+    ASSERT_EQ(3U, scanner->get_results_count());
+
+    const auto sessionPath = std::filesystem::temp_directory_path() / "vertex_session_roundtrip.vxs";
+    const std::vector<Vertex::Scanner::ScanRegion> exportModules{
+        Vertex::Scanner::ScanRegion{.moduleName = "game.so", .baseAddress = 0x1000, .size = 0x1000}
+    };
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->export_session(sessionPath, exportModules, Vertex::Scanner::ScanSessionCompression::Zlib));
+
+    Vertex::Scanner::MemoryScanner restored{*mockSettings, *mockLog, *mockDispatcher};
+    restored.set_memory_reader(mockReader);
+    const std::vector<Vertex::Scanner::ScanRegion> importModules{
+        Vertex::Scanner::ScanRegion{.moduleName = "game.so", .baseAddress = 0x40000, .size = 0x1000}
+    };
+    const Vertex::Scanner::SchemaResolver resolveSchema = [&config](const Vertex::Scanner::TypeId typeId)
+    {
+        return typeId == config.typeId ? Vertex::Scanner::make_builtin_schema(config.valueType) : nullptr;
+    };
+    EXPECT_EQ(StatusCode::STATUS_ERROR_INVALID_PARAMETER,
+              restored.import_session(sessionPath, importModules, [](Vertex::Scanner::TypeId) { return std::shared_ptr<const Vertex::Scanner::TypeSchema>{}; }));
+    EXPECT_EQ(0U, restored.get_results_count());
+
+    ASSERT_EQ(StatusCode::STATUS_OK, restored.import_session(sessionPath, importModules, resolveSchema));
+    std::filesystem::remove(sessionPath);
+
+    ASSERT_EQ(3U, restored.get_results_count());
+    EXPECT_FALSE(restored.can_undo());
+
+    Vertex::Scanner::ScanResultPage page{};
+    ASSERT_EQ(StatusCode::STATUS_OK, restored.read_scan_results_page(page, 0, 3, false));
+    ASSERT_EQ(3U, page.size());
+
+    std::vector<std::uint64_t> addresses{};
+    for (std::size_t i = 0; i < page.size(); ++i)
+    {
+        addresses.push_back(page.address_at(i));
+        ASSERT_EQ(sizeof(expectedValue), page[i].previousValue.size());
+        EXPECT_EQ(0, std::memcmp(page[i].previousValue.data(), &expectedValue, sizeof(expectedValue)));
+    }
+    std::ranges::sort(addresses);
+    EXPECT_EQ((std::vector<std::uint64_t>{0x9000, 0x40000, 0x40004}), addresses);
+
+    std::vector<std::uint64_t> extendReads{};
+    ON_CALL(*mockReader, read_memory(_, _, _))
+      .WillByDefault(Invoke(
+        [&extendReads, expectedValue](const std::uint64_t address, const std::uint64_t size, void* buffer) -> StatusCode
+        {
+            extendReads.push_back(address);
+            auto* bytes = static_cast<std::uint8_t*>(buffer);
+            for (std::uint64_t offset = 0; offset + sizeof(expectedValue) <= size; offset += sizeof(expectedValue))
+            {
+                std::memcpy(bytes + offset, &expectedValue, sizeof(expectedValue));
+            }
+            return StatusCode::STATUS_OK;
+        }));
+
+    const std::vector<Vertex::Scanner::ScanRegion> grownRegions{
+        Vertex::Scanner::ScanRegion{.baseAddress = 0x9000, .size = sizeof(expectedValue)},
+        Vertex::Scanner::ScanRegion{.baseAddress = 0x40000, .size = 2 * sizeof(expectedValue)},
+        Vertex::Scanner::ScanRegion{.baseAddress = 0x50000, .size = sizeof(expectedValue)}
+    };
+    ASSERT_EQ(StatusCode::STATUS_OK, restored.extend_scan(Vertex::Scanner::make_builtin_schema(config.valueType), grownRegions));
+    EXPECT_EQ((std::vector<std::uint64_t>{0x50000}), extendReads);
+    EXPECT_EQ(4U, restored.get_results_count());
+}
+
+TEST_F(MemoryScannerTest, ImportSession_DropsResultsOutsideResizedModuleAndCapsUndoLevels)
+{
+    ON_CALL(*mockSettings, get_int(::testing::HasSubstr("readerThreads"), _)).WillByDefault(Return(1));
+
+    auto mockReader = std::make_shared<NiceMock<MockMemoryReader>>();
+    scanner->set_memory_reader(mockReader);
+
+    constexpr std::int32_t expectedValue = 99;
+    ON_CALL(*mockReader, read_memory(_, _, _))
+      .WillByDefault(Invoke(
+        [expectedValue](std::uint64_t, std::uint64_t size, void* buffer) -> StatusCode
+        {
+            auto* bytes = static_cast<std::uint8_t*>(buffer);
+            for (std::uint64_t offset = 0; offset + sizeof(expectedValue) <= size; offset += sizeof(expectedValue))
+            {
+                std::memcpy(bytes + offset, &expectedValue, sizeof(expectedValue));
+            }
+            return StatusCode::STATUS_OK;
+        }));
+
+    ON_CALL(*mockDispatcher, enqueue_on_worker(_, _, _))
+      .WillByDefault(Invoke(
+        [](Vertex::Thread::ThreadChannel, std::size_t, std::packaged_task<StatusCode()>&& task) -> StatusCode
+        {
+            task();
+            return StatusCode::STATUS_OK;
+        }));
+
+    Vertex::Scanner::ScanConfiguration config{};
+    config.typeId = Vertex::Scanner::builtin_type_id(Vertex::Scanner::ValueType::Int32);
+    config.valueType = Vertex::Scanner::ValueType::Int32;
+    config.scanMode = static_cast<std::uint8_t>(Vertex::Scanner::NumericScanMode::Exact);
+    config.alignment = sizeof(expectedValue);
+    const auto* valueBytes = reinterpret_cast<const std::uint8_t*>(&expectedValue);
+    config.input.assign(valueBytes, valueBytes + sizeof(expectedValue));
+    const auto schema = Vertex::Scanner::make_builtin_schema(config.valueType);
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_scan(config, schema, {Vertex::Scanner::ScanRegion{.baseAddress = 0x1000, .size = 2 * sizeof(expectedValue)}}));
+    Vertex::Scanner::ScanConfiguration nextConfig = config;
+    nextConfig.scanMode = static_cast<std::uint8_t>(Vertex::Scanner::NumericScanMode::Unchanged);
+    nextConfig.input.clear();
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_next_scan(nextConfig, schema));
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_next_scan(nextConfig, schema));
+    ASSERT_EQ(2U, scanner->get_results_count());
+
+    const auto sessionPath = std::filesystem::temp_directory_path() / "vertex_session_resized.vxs";
+    ASSERT_EQ(StatusCode::STATUS_OK,
+              scanner->export_session(sessionPath, {Vertex::Scanner::ScanRegion{.moduleName = "game.so", .baseAddress = 0x1000, .size = 0x1000}},
+                                      Vertex::Scanner::ScanSessionCompression::None));
+
+    ON_CALL(*mockSettings, get_int(::testing::HasSubstr("maxUndoDepth"), _)).WillByDefault(Return(1));
+    Vertex::Scanner::MemoryScanner restored{*mockSettings, *mockLog, *mockDispatcher};
+    restored.set_memory_reader(mockReader);
+    const std::vector<Vertex::Scanner::ScanRegion> importModules{
+        Vertex::Scanner::ScanRegion{.moduleName = "game.so", .baseAddress = 0x40000, .size = sizeof(expectedValue)}
+    };
+    ASSERT_EQ(StatusCode::STATUS_OK,
+              restored.import_session(sessionPath, importModules,
+                                      [&schema](Vertex::Scanner::TypeId) { return schema; }));
+    std::filesystem::remove(sessionPath);
+
+    EXPECT_EQ(1U, restored.get_results_count());
+    ASSERT_TRUE(restored.can_undo());
+    ASSERT_EQ(StatusCode::STATUS_OK, restored.undo_scan());
+    EXPECT_FALSE(restored.can_undo());
+}
+
+TEST_F(MemoryScannerTest, ImportSession_RejectsForeignFile)
+{
+    const auto sessionPath = std::filesystem::temp_directory_path() / "vertex_session_invalid.vxs";
+    {
+        std::ofstream out{sessionPath, std::ios::binary | std::ios::trunc};
+        out << "not a scan session";
+    }
+
+    EXPECT_EQ(StatusCode::STATUS_ERROR_FS_FILE_INVALID_CONTENT, scanner->import_session(sessionPath, {}, {}));
+    std::filesystem::remove(sessionPath);
+    EXPECT_EQ(0U, scanner->get_results_count());
+}
+
+TEST_F(MemoryScannerTest, InitializeScan_DiskBudgetExceeded_KeepsPartialResults)
+{
+    ON_CALL(*mockSettings, get_int(::testing::HasSubstr("readerThreads"), _)).WillByDefault(Return(1));
+    ON_CALL(*mockSettings, get_int(::testing::HasSubstr("diskBudgetMB"), _)).WillByDefault(Return(1));
+
+    auto mockReader = std::make_shared<NiceMock<MockMemoryReader>>();
+    scanner->set_memory_reader(mockReader);
+
+    ON_CALL(*mockReader, read_memory(_, _, _))
+      .WillByDefault(Invoke(
+        [](std::uint64_t, std::uint64_t size, void* buffer) -> StatusCode
+        {
+            std::memset(buffer, 0, static_cast<std::size_t>(size));
+            return StatusCode::STATUS_OK;
+        }));
+
+    ON_CALL(*mockDispatcher, enqueue_on_worker(_, _, _))
+      .WillByDefault(Invoke(
+        [](Vertex::Thread::ThreadChannel, std::size_t, std::packaged_task<StatusCode()>&& task) -> StatusCode
+        {
+            task();
+            return StatusCode::STATUS_OK;
+        }));
+
+    Vertex::Scanner::ScanConfiguration config{};
+    config.valueType = Vertex::Scanner::ValueType::Int32;
+    config.scanMode = static_cast<std::uint8_t>(Vertex::Scanner::NumericScanMode::Exact);
+    config.alignment = sizeof(std::int32_t);
+    config.input.assign(sizeof(std::int32_t), 0);
+
+    // 4 MB of zeroes yields ~12 MB of records, far above the 1 MB budget.
+    std::vector<Vertex::Scanner::ScanRegion> regions{
+        Vertex::Scanner::ScanRegion{.baseAddress = 0x100000, .size = 4 * 1024 * 1024}
+    };
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_scan(config, Vertex::Scanner::make_builtin_schema(config.valueType), regions));
+    ASSERT_TRUE(scanner->is_scan_complete());
+
+    const auto usage = scanner->get_budget_usage();
+    EXPECT_TRUE(usage.exceeded);
+    EXPECT_LE(usage.diskBytes, 1024U * 1024U);
+
+    const std::uint64_t recordSize = sizeof(std::uint64_t) + sizeof(std::int32_t);
+    EXPECT_GT(scanner->get_results_count(), 0U);
+    EXPECT_EQ(usage.diskBytes / recordSize, scanner->get_results_count());
+}
+
+TEST_F(MemoryScannerTest, InitializeNextScan_BundleReadFails_FallsBackToBulkReads)
+{
+    ON_CALL(*mockSettings, get_int(::testing::HasSubstr("readerThreads"), _)).WillByDefault(Return(1));
+
+    auto mockReader = std::make_shared<NiceMock<MockBulkMemoryReader>>();
+    scanner->set_memory_reader(mockReader);
+
+    constexpr std::int32_t expectedValue = 7;
+    constexpr std::uint64_t regionBase = 0x1000;
+    std::atomic<bool> failBundleReads{false};
+
+    ON_CALL(*mockReader, read_memory(_, _, _))
+      .WillByDefault(Invoke(
+        [&](const std::uint64_t, const std::uint64_t size, void* buffer) -> StatusCode
+        {
+            if (failBundleReads.load())
+            {
+                return StatusCode::STATUS_ERROR_MEMORY_READ;
+            }
+
+            std::memset(buffer, 0, static_cast<std::size_t>(size));
+            std::memcpy(buffer, &expectedValue, sizeof(expectedValue));
+            std::memcpy(static_cast<char*>(buffer) + 8, &expectedValue, sizeof(expectedValue));
+            return StatusCode::STATUS_OK;
+        }));
+
+    ON_CALL(*mockReader, read_memory_bulk(_, _))
+      .WillByDefault(Invoke(
+        [](std::span<const Vertex::Scanner::BulkReadRequest> requests, std::span<Vertex::Scanner::BulkReadResult> results) -> StatusCode
+        {
+            for (std::size_t i{}; i < requests.size(); ++i)
+            {
+                const std::int32_t value = requests[i].address == regionBase ? expectedValue : 99;
+                std::memcpy(requests[i].buffer, &value, sizeof(value));
+                results[i].status = StatusCode::STATUS_OK;
+            }
+            return StatusCode::STATUS_OK;
+        }));
+
+    ON_CALL(*mockDispatcher, enqueue_on_worker(_, _, _))
+      .WillByDefault(Invoke(
+        [](Vertex::Thread::ThreadChannel, std::size_t, std::packaged_task<StatusCode()>&& task) -> StatusCode
+        {
+            task();
+            return StatusCode::STATUS_OK;
+        }));
+
+    Vertex::Scanner::ScanConfiguration config{};
+    config.valueType = Vertex::Scanner::ValueType::Int32;
+    config.scanMode = static_cast<std::uint8_t>(Vertex::Scanner::NumericScanMode::Exact);
+    config.alignmentRequired = true;
+    config.alignment = sizeof(expectedValue);
+    const auto* valueBytes = reinterpret_cast<const std::uint8_t*>(&expectedValue);
+    config.input.assign(valueBytes, valueBytes + sizeof(expectedValue));
+
+    std::vector<Vertex::Scanner::ScanRegion> regions{
+        Vertex::Scanner::ScanRegion{.baseAddress = regionBase, .size = 16}
+    };
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_scan(config, Vertex::Scanner::make_builtin_schema(config.valueType), regions));
+    ASSERT_EQ(2U, scanner->get_results_count());
+
+    failBundleReads.store(true);
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_next_scan(config, Vertex::Scanner::make_builtin_schema(config.valueType)));
+    EXPECT_TRUE(scanner->is_scan_complete());
+    EXPECT_EQ(1U, scanner->get_results_count());
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_next_scan(config, Vertex::Scanner::make_builtin_schema(config.valueType)));
+    EXPECT_EQ(1U, scanner->get_results_count());
+
+    std::vector<Vertex::Scanner::IMemoryScanner::ScanResultEntry> results{};
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->get_scan_results_range(results, 0, 1));
+    ASSERT_EQ(1U, results.size());
+    EXPECT_EQ(regionBase, results[0].address);
+}
+
+TEST_F(MemoryScannerTest, InitializeNextScan_CleanPages_CarryPreviousValuesWithoutReading)
+{
+    ON_CALL(*mockSettings, get_int(::testing::HasSubstr("readerThreads"), _)).WillByDefault(Return(1));
+    ON_CALL(*mockSettings, get_bool(::testing::HasSubstr("softDirtyTracking"), _)).WillByDefault(Return(true));
+
+    auto mockReader = std::make_shared<NiceMock<MockDirtyTrackingMemoryReader>>();
+    scanner->set_memory_reader(mockReader);
+
+    constexpr std::int32_t expectedValue = 7;
+    constexpr std::uint64_t cleanPage = 0x1000;
+    constexpr std::uint64_t dirtyPage = 0x2000;
+    constexpr std::uint64_t pageSize = 0x1000;
+    std::atomic<std::int32_t> liveValue{expectedValue};
+    std::atomic<std::size_t> readsAfterFirstScan{};
+    std::atomic<bool> firstScanDone{false};
+
+    ON_CALL(*mockReader, read_memory(_, _, _))
+      .WillByDefault(Invoke(
+        [&](const std::uint64_t, const std::uint64_t size, void* buffer) -> StatusCode
+        {
+            if (firstScanDone.load())
+            {
+                readsAfterFirstScan.fetch_add(1);
+            }
+
+            const std::int32_t value = liveValue.load();
+            std::memset(buffer, 0, static_cast<std::size_t>(size));
+            std::memcpy(buffer, &value, sizeof(value));
+            std::memcpy(static_cast<char*>(buffer) + 8, &value, sizeof(value));
+            return StatusCode::STATUS_OK;
+        }));
+
+    std::atomic<std::size_t> epochResets{};
+    ON_CALL(*mockReader, reset_dirty_tracking())
+      .WillByDefault(Invoke(
+        [&]() -> StatusCode
+        {
+            epochResets.fetch_add(1);
+            return StatusCode::STATUS_OK;
+        }));
+    ON_CALL(*mockReader, query_dirty_pages(_, _, _, _))
+      .WillByDefault(Invoke(
+        [](const std::uint64_t address, const std::uint64_t size, std::span<std::uint8_t> bitmap, std::uint64_t& outPageSize) -> StatusCode
+        {
+            outPageSize = pageSize;
+            std::ranges::fill(bitmap, std::uint8_t{});
+            for (std::uint64_t page = address; page < address + size; page += pageSize)
+            {
+                if (page == dirtyPage)
+                {
+                    const std::uint64_t bit = (page - address) / pageSize;
+                    bitmap[bit / 8] |= static_cast<std::uint8_t>(1U << (bit % 8));
+                }
+            }
+            return StatusCode::STATUS_OK;
+        }));
+
+    ON_CALL(*mockDispatcher, enqueue_on_worker(_, _, _))
+      .WillByDefault(Invoke(
+        [](Vertex::Thread::ThreadChannel, std::size_t, std::packaged_task<StatusCode()>&& task) -> StatusCode
+        {
+            task();
+            return StatusCode::STATUS_OK;
+        }));
+
+    Vertex::Scanner::ScanConfiguration config{};
+    config.valueType = Vertex::Scanner::ValueType::Int32;
+    config.scanMode = static_cast<std::uint8_t>(Vertex::Scanner::NumericScanMode::Exact);
+    config.alignmentRequired = true;
+    config.alignment = sizeof(expectedValue);
+    const auto* valueBytes = reinterpret_cast<const std::uint8_t*>(&expectedValue);
+    config.input.assign(valueBytes, valueBytes + sizeof(expectedValue));
+
+    std::vector<Vertex::Scanner::ScanRegion> regions{
+        Vertex::Scanner::ScanRegion{.baseAddress = cleanPage, .size = 16},
+        Vertex::Scanner::ScanRegion{.baseAddress = dirtyPage, .size = 16}
+    };
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_scan(config, Vertex::Scanner::make_builtin_schema(config.valueType), regions));
+    ASSERT_EQ(4U, scanner->get_results_count());
+
+    firstScanDone.store(true);
+    liveValue.store(99);
+
+    Vertex::Scanner::ScanConfiguration nextConfig = config;
+    nextConfig.scanMode = static_cast<std::uint8_t>(Vertex::Scanner::NumericScanMode::Unchanged);
+    nextConfig.input.clear();
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_next_scan(nextConfig, Vertex::Scanner::make_builtin_schema(nextConfig.valueType)));
+    EXPECT_TRUE(scanner->is_scan_complete());
+    EXPECT_EQ(2U, scanner->get_results_count());
+    EXPECT_EQ(1U, readsAfterFirstScan.load());
+    EXPECT_EQ(1U, epochResets.load());
+
+    std::vector<Vertex::Scanner::IMemoryScanner::ScanResultEntry> results{};
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->get_scan_results_range(results, 0, 2));
+    ASSERT_EQ(2U, results.size());
+    EXPECT_EQ(cleanPage, results[0].address);
+    EXPECT_EQ(cleanPage + 8, results[1].address);
+}
+
+TEST_F(MemoryScannerTest, InitializeNextScan_MostlyDirtyPages_RestartEpochAndReadEveryResult)
+{
+    ON_CALL(*mockSettings, get_int(::testing::HasSubstr("readerThreads"), _)).WillByDefault(Return(1));
+    ON_CALL(*mockSettings, get_bool(::testing::HasSubstr("softDirtyTracking"), _)).WillByDefault(Return(true));
+
+    auto mockReader = std::make_shared<NiceMock<MockDirtyTrackingMemoryReader>>();
+    scanner->set_memory_reader(mockReader);
+
+    constexpr std::int32_t expectedValue = 7;
+    constexpr std::uint64_t firstPage = 0x1000;
+    constexpr std::uint64_t secondPage = 0x2000;
+    constexpr std::uint64_t pageSize = 0x1000;
+    std::atomic<std::int32_t> liveValue{expectedValue};
+    std::atomic<std::size_t> readsAfterFirstScan{};
+    std::atomic<bool> firstScanDone{false};
+
+    ON_CALL(*mockReader, read_memory(_, _, _))
+      .WillByDefault(Invoke(
+        [&](const std::uint64_t, const std::uint64_t size, void* buffer) -> StatusCode
+        {
+            if (firstScanDone.load())
+            {
+                readsAfterFirstScan.fetch_add(1);
+            }
+
+            const std::int32_t value = liveValue.load();
+            std::memset(buffer, 0, static_cast<std::size_t>(size));
+            std::memcpy(buffer, &value, sizeof(value));
+            std::memcpy(static_cast<char*>(buffer) + 8, &value, sizeof(value));
+            return StatusCode::STATUS_OK;
+        }));
+
+    std::atomic<std::size_t> epochResets{};
+    ON_CALL(*mockReader, reset_dirty_tracking())
+      .WillByDefault(Invoke(
+        [&]() -> StatusCode
+        {
+            epochResets.fetch_add(1);
+            return StatusCode::STATUS_OK;
+        }));
+    ON_CALL(*mockReader, query_dirty_pages(_, _, _, _))
+      .WillByDefault(Invoke(
+        [](const std::uint64_t address, const std::uint64_t size, std::span<std::uint8_t> bitmap, std::uint64_t& outPageSize) -> StatusCode
+        {
+            outPageSize = pageSize;
+            std::ranges::fill(bitmap, std::uint8_t{});
+            for (std::uint64_t page = address; page < address + size; page += pageSize)
+            {
+                if (page == secondPage || page == firstPage)
+                {
+                    const std::uint64_t bit = (page - address) / pageSize;
+                    bitmap[bit / 8] |= static_cast<std::uint8_t>(1U << (bit % 8));
+                }
+            }
+            return StatusCode::STATUS_OK;
+        }));
+
+    ON_CALL(*mockDispatcher, enqueue_on_worker(_, _, _))
+      .WillByDefault(Invoke(
+        [](Vertex::Thread::ThreadChannel, std::size_t, std::packaged_task<StatusCode()>&& task) -> StatusCode
+        {
+            task();
+            return StatusCode::STATUS_OK;
+        }));
+
+    Vertex::Scanner::ScanConfiguration config{};
+    config.valueType = Vertex::Scanner::ValueType::Int32;
+    config.scanMode = static_cast<std::uint8_t>(Vertex::Scanner::NumericScanMode::Exact);
+    config.alignmentRequired = true;
+    config.alignment = sizeof(expectedValue);
+    const auto* valueBytes = reinterpret_cast<const std::uint8_t*>(&expectedValue);
+    config.input.assign(valueBytes, valueBytes + sizeof(expectedValue));
+
+    std::vector<Vertex::Scanner::ScanRegion> regions{
+        Vertex::Scanner::ScanRegion{.baseAddress = firstPage, .size = 16},
+        Vertex::Scanner::ScanRegion{.baseAddress = secondPage, .size = 16}
+    };
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_scan(config, Vertex::Scanner::make_builtin_schema(config.valueType), regions));
+    ASSERT_EQ(4U, scanner->get_results_count());
+
+    firstScanDone.store(true);
+    liveValue.store(99);
+
+    Vertex::Scanner::ScanConfiguration nextConfig = config;
+    nextConfig.scanMode = static_cast<std::uint8_t>(Vertex::Scanner::NumericScanMode::Unchanged);
+    nextConfig.input.clear();
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_next_scan(nextConfig, Vertex::Scanner::make_builtin_schema(nextConfig.valueType)));
+    EXPECT_TRUE(scanner->is_scan_complete());
+    EXPECT_EQ(0U, scanner->get_results_count());
+    EXPECT_EQ(2U, readsAfterFirstScan.load());
+    EXPECT_EQ(2U, epochResets.load());
+}
+
+TEST_F(MemoryScannerTest, InitializeScan_NonResidentPages_AreNeverRead)
+{
+    ON_CALL(*mockSettings, get_int(::testing::HasSubstr("readerThreads"), _)).WillByDefault(Return(1));
+    ON_CALL(*mockSettings, get_bool(::testing::HasSubstr("skipNonResidentPages"), _)).WillByDefault(Return(true));
+
+    auto mockReader = std::make_shared<NiceMock<MockResidencyMemoryReader>>();
+    scanner->set_memory_reader(mockReader);
+
+    constexpr std::int32_t expectedValue = 7;
+    constexpr std::uint64_t pageSize = 0x1000;
+    constexpr std::uint64_t regionBase = 0x10000;
+    constexpr std::uint64_t untouchedPage = regionBase + pageSize;
+    std::atomic<bool> untouchedPageRead{false};
+
+    ON_CALL(*mockReader, read_memory(_, _, _))
+      .WillByDefault(Invoke(
+        [&](const std::uint64_t address, const std::uint64_t size, void* buffer) -> StatusCode
+        {
+            if (address < untouchedPage + pageSize && address + size > untouchedPage)
+            {
+                untouchedPageRead.store(true);
+            }
+
+            auto* bytes = static_cast<std::uint8_t*>(buffer);
+            std::memset(bytes, 0, static_cast<std::size_t>(size));
+            for (std::uint64_t page = address; page < address + size; page += pageSize)
+            {
+                std::memcpy(bytes + (page - address), &expectedValue, sizeof(expectedValue));
+            }
+            return StatusCode::STATUS_OK;
+        }));
+
+    ON_CALL(*mockReader, query_resident_pages(_, _, _, _))
+      .WillByDefault(Invoke(
+        [](const std::uint64_t address, const std::uint64_t size, std::span<std::uint8_t> bitmap, std::uint64_t& outPageSize) -> StatusCode
+        {
+            outPageSize = pageSize;
+            std::ranges::fill(bitmap, std::uint8_t{});
+            const std::uint64_t firstPage = address / pageSize * pageSize;
+            for (std::uint64_t page = firstPage; page < address + size; page += pageSize)
+            {
+                if (page != untouchedPage)
+                {
+                    const std::uint64_t bit = (page - firstPage) / pageSize;
+                    bitmap[bit / 8] |= static_cast<std::uint8_t>(1U << (bit % 8));
+                }
+            }
+            return StatusCode::STATUS_OK;
+        }));
+
+    ON_CALL(*mockDispatcher, enqueue_on_worker(_, _, _))
+      .WillByDefault(Invoke(
+        [](Vertex::Thread::ThreadChannel, std::size_t, std::packaged_task<StatusCode()>&& task) -> StatusCode
+        {
+            task();
+            return StatusCode::STATUS_OK;
+        }));
+
+    Vertex::Scanner::ScanConfiguration config{};
+    config.valueType = Vertex::Scanner::ValueType::Int32;
+    config.scanMode = static_cast<std::uint8_t>(Vertex::Scanner::NumericScanMode::Exact);
+    config.alignmentRequired = true;
+    config.alignment = sizeof(expectedValue);
+    const auto* valueBytes = reinterpret_cast<const std::uint8_t*>(&expectedValue);
+    config.input.assign(valueBytes, valueBytes + sizeof(expectedValue));
+
+    std::vector<Vertex::Scanner::ScanRegion> regions{
+        Vertex::Scanner::ScanRegion{.baseAddress = regionBase, .size = 3 * pageSize}
+    };
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_scan(config, Vertex::Scanner::make_builtin_schema(config.valueType), regions));
+    EXPECT_TRUE(scanner->is_scan_complete());
+    EXPECT_FALSE(untouchedPageRead.load());
+    ASSERT_EQ(2U, scanner->get_results_count());
+
+    std::vector<Vertex::Scanner::IMemoryScanner::ScanResultEntry> results{};
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->get_scan_results_range(results, 0, 2));
+    ASSERT_EQ(2U, results.size());
+    EXPECT_EQ(regionBase, results[0].address);
+    EXPECT_EQ(regionBase + 2 * pageSize, results[1].address);
+}
+
+TEST_F(MemoryScannerTest, InitializeScan_ZeroPages_StillFindValuesCrossingIntoThem)
+{
+    ON_CALL(*mockSettings, get_int(::testing::HasSubstr("readerThreads"), _)).WillByDefault(Return(1));
+
+    auto mockReader = std::make_shared<NiceMock<MockMemoryReader>>();
+    scanner->set_memory_reader(mockReader);
+
+    constexpr std::uint64_t pageSize = 0x1000;
+    constexpr std::uint64_t regionBase = 0x20000;
+    std::vector<std::uint8_t> memory(4 * pageSize, 0);
+    memory[2 * pageSize] = 0x07;
+    memory[pageSize - 1] = 0x05;
+
+    ON_CALL(*mockReader, read_memory(_, _, _))
+      .WillByDefault(Invoke(
+        [&](const std::uint64_t address, const std::uint64_t size, void* buffer) -> StatusCode
+        {
+            std::memcpy(buffer, memory.data() + (address - regionBase), static_cast<std::size_t>(size));
+            return StatusCode::STATUS_OK;
+        }));
+
+    ON_CALL(*mockDispatcher, enqueue_on_worker(_, _, _))
+      .WillByDefault(Invoke(
+        [](Vertex::Thread::ThreadChannel, std::size_t, std::packaged_task<StatusCode()>&& task) -> StatusCode
+        {
+            task();
+            return StatusCode::STATUS_OK;
+        }));
+
+    // Starts three bytes into a zero page and ends on the first byte of the next page.
+    constexpr std::uint32_t crossingValue = 0x07000000;
+    Vertex::Scanner::ScanConfiguration config{};
+    config.valueType = Vertex::Scanner::ValueType::UInt32;
+    config.scanMode = static_cast<std::uint8_t>(Vertex::Scanner::NumericScanMode::Exact);
+    config.alignmentRequired = false;
+    const auto* valueBytes = reinterpret_cast<const std::uint8_t*>(&crossingValue);
+    config.input.assign(valueBytes, valueBytes + sizeof(crossingValue));
+
+    std::vector<Vertex::Scanner::ScanRegion> regions{
+        Vertex::Scanner::ScanRegion{.baseAddress = regionBase, .size = memory.size()}
+    };
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_scan(config, Vertex::Scanner::make_builtin_schema(config.valueType), regions));
+    ASSERT_EQ(1U, scanner->get_results_count());
+
+    std::vector<Vertex::Scanner::IMemoryScanner::ScanResultEntry> results{};
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->get_scan_results_range(results, 0, 1));
+    ASSERT_EQ(1U, results.size());
+    EXPECT_EQ(regionBase + 2 * pageSize - 3, results[0].address);
+
+    // Ends on the last byte of a page that is otherwise zero.
+    constexpr std::uint32_t trailingValue = 0x00000005;
+    valueBytes = reinterpret_cast<const std::uint8_t*>(&trailingValue);
+    config.input.assign(valueBytes, valueBytes + sizeof(trailingValue));
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_scan(config, Vertex::Scanner::make_builtin_schema(config.valueType), regions));
+    ASSERT_EQ(1U, scanner->get_results_count());
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->get_scan_results_range(results, 0, 1));
+    EXPECT_EQ(regionBase + pageSize - 1, results[0].address);
+}
+
+TEST_F(MemoryScannerTest, InitializeScan_AsyncReader_PipelinesPiecesAndKeepsBoundaryValues)
+{
+    ON_CALL(*mockSettings, get_int(::testing::HasSubstr("readerThreads"), _)).WillByDefault(Return(1));
+    ON_CALL(*mockSettings, get_int(::testing::HasSubstr("threadBufferSizeMB"), _)).WillByDefault(Return(1));
+    ON_CALL(*mockSettings, get_int(::testing::HasSubstr("workerChunkSizeMB"), _)).WillByDefault(Return(1));
+    ON_CALL(*mockSettings, get_int(::testing::HasSubstr("asyncReadDepth"), _)).WillByDefault(Return(4));
+
+    constexpr std::uint64_t regionBase = 0x400000;
+    constexpr std::size_t regionSize = 2 * 1024 * 1024;
+    constexpr std::size_t pieceSize = 1024 * 1024 / 4;
+    constexpr std::uint32_t needle = 0xCAFEBABE;
+
+    std::vector<std::uint8_t> memory(regionSize, 0x11);
+    const std::vector<std::size_t> offsets{0x10, pieceSize - 2, 3 * pieceSize + 1, regionSize - sizeof(needle)};
+    for (const std::size_t offset : offsets)
+    {
+        std::memcpy(memory.data() + offset, &needle, sizeof(needle));
+    }
+
+    auto reader = std::make_shared<NiceMock<FakeAsyncMemoryReader>>(regionBase, std::move(memory));
+    EXPECT_CALL(*reader, read_memory(_, _, _)).Times(0);
+    scanner->set_memory_reader(reader);
+
+    ON_CALL(*mockDispatcher, enqueue_on_worker(_, _, _))
+      .WillByDefault(Invoke(
+        [](Vertex::Thread::ThreadChannel, std::size_t, std::packaged_task<StatusCode()>&& task) -> StatusCode
+        {
+            task();
+            return StatusCode::STATUS_OK;
+        }));
+
+    Vertex::Scanner::ScanConfiguration config{};
+    config.valueType = Vertex::Scanner::ValueType::UInt32;
+    config.scanMode = static_cast<std::uint8_t>(Vertex::Scanner::NumericScanMode::Exact);
+    config.alignmentRequired = false;
+    const auto* valueBytes = reinterpret_cast<const std::uint8_t*>(&needle);
+    config.input.assign(valueBytes, valueBytes + sizeof(needle));
+
+    std::vector<Vertex::Scanner::ScanRegion> regions{
+        Vertex::Scanner::ScanRegion{.baseAddress = regionBase, .size = regionSize}
+    };
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_scan(config, Vertex::Scanner::make_builtin_schema(config.valueType), regions));
+    EXPECT_TRUE(scanner->is_scan_complete());
+    EXPECT_EQ(4U, reader->max_in_flight());
+    EXPECT_EQ(0, reader->open_queues());
+    EXPECT_EQ(scanner->get_total_regions(), scanner->get_regions_scanned());
+    ASSERT_EQ(offsets.size(), scanner->get_results_count());
+    ::testing::Mock::VerifyAndClearExpectations(reader.get());
+
+    std::vector<Vertex::Scanner::IMemoryScanner::ScanResultEntry> results{};
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->get_scan_results_range(results, 0, offsets.size()));
+    ASSERT_EQ(offsets.size(), results.size());
+    std::ranges::sort(results, {}, &Vertex::Scanner::IMemoryScanner::ScanResultEntry::address);
+    for (std::size_t i = 0; i < offsets.size(); ++i)
+    {
+        EXPECT_EQ(regionBase + offsets[i], results[i].address);
+    }
+}
+
+TEST_F(MemoryScannerTest, ExtendScan_ScansOnlyNewAndGrownRangesAndKeepsNarrowedResults)
+{
+    ON_CALL(*mockSettings, get_int(::testing::HasSubstr("readerThreads"), _)).WillByDefault(Return(1));
+
+    auto mockReader = std::make_shared<NiceMock<MockMemoryReader>>();
+    scanner->set_memory_reader(mockReader);
+
+    constexpr std::int32_t expectedValue = 7;
+    constexpr std::uint64_t heapBase = 0x1000;
+    constexpr std::uint64_t newBase = 0x5000;
+    const std::vector<std::uint64_t> valueAddresses{heapBase, heapBase + 8, heapBase + 0x18, newBase + 4};
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> reads{};
+
+    ON_CALL(*mockReader, read_memory(_, _, _))
+      .WillByDefault(Invoke(
+        [&](const std::uint64_t address, const std::uint64_t size, void* buffer) -> StatusCode
+        {
+            reads.emplace_back(address, size);
+            std::memset(buffer, 0, static_cast<std::size_t>(size));
+            for (const std::uint64_t valueAddress : valueAddresses)
+            {
+                if (valueAddress >= address && valueAddress + sizeof(expectedValue) <= address + size)
+                {
+                    std::memcpy(static_cast<char*>(buffer) + (valueAddress - address), &expectedValue, sizeof(expectedValue));
+                }
+            }
+            return StatusCode::STATUS_OK;
+        }));
+
+    ON_CALL(*mockDispatcher, enqueue_on_worker(_, _, _))
+      .WillByDefault(Invoke(
+        [](Vertex::Thread::ThreadChannel, std::size_t, std::packaged_task<StatusCode()>&& task) -> StatusCode
+        {
+            task();
+            return StatusCode::STATUS_OK;
+        }));
+
+    Vertex::Scanner::ScanConfiguration config{};
+    config.valueType = Vertex::Scanner::ValueType::Int32;
+    config.scanMode = static_cast<std::uint8_t>(Vertex::Scanner::NumericScanMode::Exact);
+    config.alignmentRequired = true;
+    config.alignment = sizeof(expectedValue);
+    const auto* valueBytes = reinterpret_cast<const std::uint8_t*>(&expectedValue);
+    config.input.assign(valueBytes, valueBytes + sizeof(expectedValue));
+    const auto schema = Vertex::Scanner::make_builtin_schema(config.valueType);
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_scan(config, schema, {Vertex::Scanner::ScanRegion{.baseAddress = heapBase, .size = 0x10}}));
+    ASSERT_EQ(2U, scanner->get_results_count());
+
+    Vertex::Scanner::ScanConfiguration nextConfig = config;
+    nextConfig.scanMode = static_cast<std::uint8_t>(Vertex::Scanner::NumericScanMode::Unchanged);
+    nextConfig.input.clear();
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_next_scan(nextConfig, schema));
+    ASSERT_EQ(2U, scanner->get_results_count());
+
+    reads.clear();
+    const std::vector<Vertex::Scanner::ScanRegion> grownRegions{
+        Vertex::Scanner::ScanRegion{.baseAddress = heapBase, .size = 0x20},
+        Vertex::Scanner::ScanRegion{.baseAddress = newBase, .size = 0x10}
+    };
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->extend_scan(schema, grownRegions));
+    EXPECT_TRUE(scanner->is_scan_complete());
+    ASSERT_EQ(4U, scanner->get_results_count());
+    for (const auto& [address, size] : reads)
+    {
+        EXPECT_GE(address, heapBase + 0x10);
+    }
+
+    std::vector<Vertex::Scanner::IMemoryScanner::ScanResultEntry> results{};
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->get_scan_results_range(results, 0, 4));
+    ASSERT_EQ(4U, results.size());
+    std::ranges::sort(results, {}, &Vertex::Scanner::IMemoryScanner::ScanResultEntry::address);
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        EXPECT_EQ(valueAddresses[i], results[i].address);
+        ASSERT_EQ(sizeof(expectedValue), results[i].firstValue.size());
+        EXPECT_EQ(0, std::memcmp(results[i].firstValue.data(), &expectedValue, sizeof(expectedValue)));
+    }
+
+    reads.clear();
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->extend_scan(schema, grownRegions));
+    EXPECT_TRUE(reads.empty());
+    EXPECT_EQ(4U, scanner->get_results_count());
+
+    ASSERT_EQ(StatusCode::STATUS_OK, scanner->initialize_next_scan(nextConfig, schema));
+    EXPECT_EQ(4U, scanner->get_results_count());
+}
+
+TEST_F(MemoryScannerTest, ExtendScan_WithoutFirstScan_ReturnsError)
+{
+    scanner->set_memory_reader(std::make_shared<NiceMock<MockMemoryReader>>());
+
+    EXPECT_EQ(StatusCode::STATUS_ERROR_GENERAL,
+              scanner->extend_scan(Vertex::Scanner::make_builtin_schema(Vertex::Scanner::ValueType::Int32),
+                                   {Vertex::Scanner::ScanRegion{.baseAddress = 0x1000, .size = 0x1000}}));
+}
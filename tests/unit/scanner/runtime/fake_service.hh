@@ -86,6 +86,12 @@ namespace Vertex::Testing::Fakes
             out.clear();
             return STATUS_OK;
         }
+        [[nodiscard]] StatusCode snapshot_results_page(Scanner::ScanResultPage& page,
+                                                         std::size_t , std::size_t ) const override
+        {
+            page.clear();
+            return STATUS_OK;
+        }
         [[nodiscard]] bool can_undo() const override { return m_canUndo; }
         [[nodiscard]] bool is_scanning() const override { return m_isScanning; }
 
@@ -0,0 +1,106 @@
+//
+// Copyright (C) 2026 PHTNC<>.
+// Licensed under GPLv3.0 with Plugin Interface exceptions.
+//
+#include <gtest/gtest.h>
+#include <vertex/scanner/scanbudget.hh>
+
+using Vertex::Scanner::ScanBudgetGovernor;
+using Vertex::Scanner::ScanBudgetLimits;
+using Vertex::Scanner::ScanBudgetPolicy;
+
+TEST(ScanBudgetGovernorTest, Unlimited_AdmitsEverythingAndTracksUsage)
+{
+    ScanBudgetGovernor governor{};
+    governor.reset(ScanBudgetLimits{});
+
+    EXPECT_EQ(0U, governor.admit_disk_batch(1ULL << 40).value());
+    EXPECT_EQ(0U, governor.admit_memory(1ULL << 30).value());
+
+    const auto usage = governor.usage();
+    EXPECT_EQ(1ULL << 40, usage.diskBytes);
+    EXPECT_EQ(1ULL << 30, usage.memoryBytes);
+    EXPECT_FALSE(usage.exceeded);
+}
+
+TEST(ScanBudgetGovernorTest, AbortPolicy_RejectsBatchThatWouldOverrunDisk)
+{
+    ScanBudgetGovernor governor{};
+    governor.reset(ScanBudgetLimits{.diskBytes = 1000, .policy = ScanBudgetPolicy::AbortWithPartialResults});
+
+    EXPECT_EQ(0U, governor.admit_disk_batch(600).value());
+    EXPECT_FALSE(governor.admit_disk_batch(600).has_value());
+    EXPECT_FALSE(governor.admit_disk_batch(1).has_value());
+
+    const auto usage = governor.usage();
+    EXPECT_EQ(600U, usage.diskBytes);
+    EXPECT_TRUE(usage.exceeded);
+}
+
+TEST(ScanBudgetGovernorTest, DownsamplePolicy_KeepsDiskUsageBelowTwiceTheBudget)
+{
+    ScanBudgetGovernor governor{};
+    governor.reset(ScanBudgetLimits{.diskBytes = 1 << 20, .policy = ScanBudgetPolicy::Downsample});
+
+    std::uint32_t lastShift{};
+    for (int i = 0; i < 10000; ++i)
+    {
+        const auto shift = governor.admit_disk_batch(64 * 1024);
+        if (!shift.has_value())
+        {
+            break;
+        }
+        EXPECT_GE(*shift, lastShift);
+        lastShift = *shift;
+    }
+
+    const auto usage = governor.usage();
+    EXPECT_GT(usage.sampleShift, 0U);
+    EXPECT_LT(usage.diskBytes, 2U << 20);
+}
+
+TEST(ScanBudgetGovernorTest, MemoryAdmission_DownsamplesOrAbortsByPolicy)
+{
+    ScanBudgetGovernor governor{};
+    governor.reset(ScanBudgetLimits{.memoryBytes = 1000, .policy = ScanBudgetPolicy::Downsample});
+    EXPECT_EQ(2U, governor.admit_memory(4000).value());
+    EXPECT_EQ(1000U, governor.usage().memoryBytes);
+
+    governor.release_memory(1000);
+    EXPECT_EQ(0U, governor.usage().memoryBytes);
+
+    governor.reset(ScanBudgetLimits{.memoryBytes = 1000, .policy = ScanBudgetPolicy::AbortWithPartialResults});
+    EXPECT_FALSE(governor.admit_memory(4000).has_value());
+    EXPECT_TRUE(governor.usage().exceeded);
+}
+
+TEST(ScanBudgetGovernorTest, MemoryAndDiskShiftsAreIndependent)
+{
+    ScanBudgetGovernor governor{};
+    governor.reset(ScanBudgetLimits{.diskBytes = 1 << 20, .memoryBytes = 1000, .policy = ScanBudgetPolicy::Downsample});
+
+    EXPECT_EQ(3U, governor.admit_memory(8000).value());
+    EXPECT_EQ(0U, governor.admit_disk_batch(64 * 1024).value());
+    EXPECT_EQ(3U, governor.usage().sampleShift);
+}
+
+TEST(ScanBudgetGovernorTest, RetainedStoresCountAgainstDisk)
+{
+    ScanBudgetGovernor governor{};
+    governor.reset(ScanBudgetLimits{.diskBytes = 1000, .policy = ScanBudgetPolicy::AbortWithPartialResults}, 700);
+
+    EXPECT_EQ(700U, governor.usage().diskBytes);
+    EXPECT_EQ(0U, governor.admit_disk_batch(300).value());
+    EXPECT_FALSE(governor.admit_disk_batch(1).has_value());
+}
+
+TEST(ScanBudgetGovernorTest, KeepSample_SelectsOneOfEveryPowerOfTwo)
+{
+    int kept{};
+    for (std::uint64_t sequence = 0; sequence < 64; ++sequence)
+    {
+        kept += ScanBudgetGovernor::keep_sample(sequence, 3) ? 1 : 0;
+    }
+    EXPECT_EQ(8, kept);
+    EXPECT_TRUE(ScanBudgetGovernor::keep_sample(5, 0));
+}
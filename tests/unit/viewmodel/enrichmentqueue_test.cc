@@ -191,3 +191,33 @@ TEST(EnrichmentQueueTest, DroppedCounterSurvivesMultipleOverflows)
     EXPECT_EQ(queue.pending_size(), EnrichmentQueue::MAX_PENDING_DISTINCT_PCS);
     EXPECT_EQ(queue.dropped_jobs(), 10u);
 }
+
+TEST(EnrichmentQueueTest, PopBatchTakesOldestJobsAsOneInFlightUnit)
+{
+    EnrichmentQueue queue {};
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        EXPECT_TRUE(queue.enqueue(make_job(0x1000 + i)));
+    }
+
+    const auto batch = queue.pop_batch(3);
+    ASSERT_EQ(batch.size(), 3u);
+    EXPECT_EQ(batch[0].pc, 0x1000u);
+    EXPECT_EQ(batch[2].pc, 0x1002u);
+    EXPECT_EQ(queue.in_flight(), 1u);
+    EXPECT_EQ(queue.pending_size(), 2u);
+
+    EXPECT_TRUE(queue.enqueue(make_job(0x1000)));
+    EXPECT_EQ(queue.pending_size(), 3u);
+
+    const auto rest = queue.pop_batch();
+    ASSERT_EQ(rest.size(), 3u);
+    EXPECT_EQ(rest.back().pc, 0x1000u);
+    EXPECT_EQ(queue.in_flight(), 2u);
+    EXPECT_TRUE(queue.pop_batch().empty());
+    EXPECT_EQ(queue.in_flight(), 2u);
+
+    queue.complete_job();
+    queue.complete_job();
+    EXPECT_TRUE(queue.wait_for_drain(std::chrono::milliseconds {0}));
+}
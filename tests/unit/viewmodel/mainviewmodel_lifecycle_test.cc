@@ -66,6 +66,8 @@ namespace
         std::uint64_t results_count() const override { return 0; }
         StatusCode snapshot_results(std::vector<scn::IMemoryScanner::ScanResultEntry>&,
                                      std::size_t, std::size_t) const override { return STATUS_OK; }
+        StatusCode snapshot_results_page(scn::ScanResultPage&,
+                                          std::size_t, std::size_t) const override { return STATUS_OK; }
         bool can_undo() const override { return false; }
         bool is_scanning() const override { return false; }
 